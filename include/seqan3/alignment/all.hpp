@@ -34,8 +34,14 @@
  *
  * # Multiple Sequence Alignment
  *
- * The current version of SeqAn does not offer multiple sequence alignments (MSA). Please reach out to us with
- * a specific use case we should consider in future versions.
+ * Progressive multiple sequence alignments (MSA) of many sequences are computed with seqan3::align_multiple, which
+ * is described in \ref alignment_multiple. The pairwise distances, the guide tree and the profile alignments are
+ * computed in parallel.
+ *
+ * # Chaining
+ *
+ * Long reads are aligned along chains of seed matches with seqan3::chain_anchors and seqan3::align_chain, which only
+ * align the gaps between the seed matches. See \ref alignment_chaining.
  *
  * # Alignments represented as CIGAR String used in SAM/BAM Files
  *
@@ -56,9 +62,11 @@
 #pragma once
 
 #include <seqan3/alignment/aligned_sequence/all.hpp>
+#include <seqan3/alignment/chaining/all.hpp>
 #include <seqan3/alignment/configuration/all.hpp>
 #include <seqan3/alignment/decorator/all.hpp>
 #include <seqan3/alignment/exception.hpp>
 #include <seqan3/alignment/matrix/all.hpp>
+#include <seqan3/alignment/multiple/all.hpp>
 #include <seqan3/alignment/pairwise/all.hpp>
 #include <seqan3/alignment/scoring/all.hpp>
@@ -0,0 +1,208 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::align_chain.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/chaining/chain_anchors.hpp>
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/utility/views/slice.hpp>
+
+namespace seqan3
+{
+
+/*!\brief The alignment of a query to a reference along a seqan3::anchor_chain, as computed by seqan3::align_chain.
+ * \ingroup alignment_chaining
+ */
+struct chain_alignment
+{
+    //!\brief The score of the alignment.
+    int32_t score{};
+    //!\brief The begin position of the alignment in the reference.
+    size_t reference_begin_position{};
+    //!\brief The end position of the alignment in the reference.
+    size_t reference_end_position{};
+    //!\brief The begin position of the alignment in the query.
+    size_t query_begin_position{};
+    //!\brief The end position of the alignment in the query.
+    size_t query_end_position{};
+    //!\brief The CIGAR string of the whole query, with soft clips for the unaligned prefix and suffix of the query.
+    std::vector<cigar> cigar_sequence{};
+};
+
+/*!\brief Aligns a query to a reference along a chain of anchors.
+ * \ingroup alignment_chaining
+ *
+ * \tparam reference_t The type of the reference; must model std::ranges::random_access_range and
+ *                     std::ranges::sized_range.
+ * \tparam query_t The type of the query; must model std::ranges::random_access_range and std::ranges::sized_range.
+ * \tparam config_t The type of the configuration; must be a seqan3::configuration.
+ *
+ * \param[in] reference The reference.
+ * \param[in] query The query.
+ * \param[in] chain The seqan3::anchor_chain, e.g. computed by seqan3::chain_anchors.
+ * \param[in] config The configuration with a seqan3::align_cfg::scoring_scheme and a
+ *                   seqan3::align_cfg::gap_cost_affine.
+ * \param[in] band_width The number of diagonals by which the alignment between two anchors may leave the diagonals
+ *                       of the anchors [default: 32].
+ * \returns The seqan3::chain_alignment.
+ *
+ * \throws std::invalid_argument if an anchor exceeds the reference or the query.
+ *
+ * \details
+ *
+ * Instead of aligning the whole region that is covered by the chain, only the gaps between consecutive anchors are
+ * aligned. Every gap is aligned globally with seqan3::align_pairwise in a band that contains the diagonals of the two
+ * anchors around the gap, widened by `band_width` diagonals on either side. Gaps that are empty in one of the
+ * sequences are a single insertion or deletion and are not aligned at all. The anchors themselves are matches;
+ * anchors that overlap the previous anchor in one of the sequences are shortened accordingly.
+ *
+ * The alignment spans from the begin of the first anchor to the end of the last anchor. Its CIGAR string describes
+ * the whole query, where the query before the first and after the last anchor is soft clipped ('S'). The first
+ * sequence is the reference and the second sequence the query, as in seqan3::align_cfg::output_cigar.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/chaining/align_chain.cpp
+ */
+template <std::ranges::random_access_range reference_t, std::ranges::random_access_range query_t, typename config_t>
+    requires std::ranges::sized_range<reference_t> && std::ranges::sized_range<query_t>
+chain_alignment align_chain(reference_t const & reference,
+                            query_t const & query,
+                            anchor_chain const & chain,
+                            config_t const & config,
+                            uint32_t const band_width = 32u)
+{
+    static_assert(config_t::template exists<align_cfg::scoring_scheme>(),
+                  "align_chain requires an align_cfg::scoring_scheme.");
+    static_assert(config_t::template exists<align_cfg::gap_cost_affine>(),
+                  "align_chain requires an align_cfg::gap_cost_affine.");
+
+    auto const & scoring_config = get<align_cfg::scoring_scheme>(config);
+    auto const & gap_config = get<align_cfg::gap_cost_affine>(config);
+    auto const & scheme = scoring_config.scheme;
+
+    size_t const reference_size = std::ranges::size(reference);
+    size_t const query_size = std::ranges::size(query);
+
+    chain_alignment result{};
+
+    auto append = [&result](uint32_t const count, cigar::operation const operation)
+    {
+        if (count == 0u)
+            return;
+
+        if (!result.cigar_sequence.empty() && get<1>(result.cigar_sequence.back()) == operation)
+            result.cigar_sequence.back() = cigar{get<0>(result.cigar_sequence.back()) + count, operation};
+        else
+            result.cigar_sequence.emplace_back(count, operation);
+    };
+
+    auto gap_score = [&gap_config](size_t const length) -> int32_t
+    {
+        return (length == 0u) ? 0 : gap_config.open_score + static_cast<int32_t>(length) * gap_config.extension_score;
+    };
+
+    if (chain.anchors.empty())
+    {
+        append(query_size, 'S'_cigar_operation);
+        return result;
+    }
+
+    for (anchor const & current : chain.anchors)
+    {
+        if (current.reference_position + current.length > reference_size
+            || current.query_position + current.length > query_size)
+            throw std::invalid_argument{"The anchor exceeds the reference or the query."};
+    }
+
+    // The end of the aligned part in the reference and in the query.
+    size_t reference_position = chain.anchors.front().reference_position;
+    size_t query_position = chain.anchors.front().query_position;
+
+    result.reference_begin_position = reference_position;
+    result.query_begin_position = query_position;
+    append(query_position, 'S'_cigar_operation);
+
+    std::vector<cigar> gap_cigar{};
+    for (anchor current : chain.anchors)
+    {
+        // Shorten anchors that overlap the aligned part.
+        size_t const reference_overlap = reference_position - std::min(reference_position, current.reference_position);
+        size_t const query_overlap = query_position - std::min(query_position, current.query_position);
+        size_t const overlap = std::max(reference_overlap, query_overlap);
+        if (overlap >= current.length)
+            continue;
+
+        current.reference_position += overlap;
+        current.query_position += overlap;
+        current.length -= overlap;
+
+        size_t const reference_gap = current.reference_position - reference_position;
+        size_t const query_gap = current.query_position - query_position;
+
+        if (reference_gap == 0u || query_gap == 0u)
+        {
+            append(query_gap, 'I'_cigar_operation);
+            append(reference_gap, 'D'_cigar_operation);
+            result.score += gap_score(reference_gap + query_gap);
+        }
+        else
+        {
+            auto reference_infix = reference | views::slice(reference_position, current.reference_position);
+            auto query_infix = query | views::slice(query_position, current.query_position);
+
+            // The band contains the main diagonal and the diagonal of the end of the gap.
+            int32_t const end_diagonal = static_cast<int32_t>(reference_gap) - static_cast<int32_t>(query_gap);
+            int32_t const margin = static_cast<int32_t>(band_width);
+            align_cfg::band_fixed_size const band{align_cfg::lower_diagonal{std::min(0, end_diagonal) - margin},
+                                                  align_cfg::upper_diagonal{std::max(0, end_diagonal) + margin}};
+
+            auto gap_alignment_config = align_cfg::method_global{} | scoring_config | gap_config | band
+                                | align_cfg::output_score{} | align_cfg::output_cigar{};
+
+            for (auto && gap_result : align_pairwise(std::tie(reference_infix, query_infix), gap_alignment_config))
+            {
+                result.score += gap_result.score();
+                gap_cigar = std::move(gap_result).cigar_sequence();
+            }
+
+            for (cigar const & operation : gap_cigar)
+                append(get<0>(operation), get<1>(operation));
+        }
+
+        for (size_t i = 0; i < current.length; ++i)
+            result.score += scheme.score(reference[current.reference_position + i], query[current.query_position + i]);
+
+        append(current.length, 'M'_cigar_operation);
+        reference_position = current.reference_position + current.length;
+        query_position = current.query_position + current.length;
+    }
+
+    result.reference_end_position = reference_position;
+    result.query_end_position = query_position;
+    append(query_size - query_position, 'S'_cigar_operation);
+
+    return result;
+}
+
+} // namespace seqan3
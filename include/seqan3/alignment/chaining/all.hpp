@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Meta-header for the \link alignment_chaining Alignment / Chaining submodule \endlink.
+ */
+
+/*!\defgroup alignment_chaining Chaining
+ * \ingroup alignment
+ * \brief Provides the chaining of seed matches and the alignment along a chain.
+ *
+ * \details
+ *
+ * Long reads are aligned without computing the alignment of the whole region they map to. Instead, seed matches
+ * between the read and the reference, e.g. shared minimisers of seqan3::views::minimiser_hash, are given as
+ * seqan3::anchor. seqan3::chain_anchors finds colinear chains of anchors and seqan3::align_chain aligns only the gaps
+ * between the anchors of a chain, which results in a single alignment with its CIGAR string.
+ *
+ * \include test/snippet/alignment/chaining/align_chain.cpp
+ *
+ * \see alignment
+ * \see alignment_pairwise
+ */
+
+#pragma once
+
+#include <seqan3/alignment/chaining/align_chain.hpp>
+#include <seqan3/alignment/chaining/chain_anchors.hpp>
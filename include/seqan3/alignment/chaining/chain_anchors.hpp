@@ -0,0 +1,220 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::anchor, seqan3::anchor_chain and seqan3::chain_anchors.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A seed match between a reference and a query.
+ * \ingroup alignment_chaining
+ *
+ * \details
+ *
+ * The anchor states that `reference[reference_position, reference_position + length)` matches
+ * `query[query_position, query_position + length)`, e.g. because both contain the same minimiser.
+ */
+struct anchor
+{
+    //!\brief The begin position of the match in the reference.
+    size_t reference_position{};
+    //!\brief The begin position of the match in the query.
+    size_t query_position{};
+    //!\brief The length of the match.
+    uint32_t length{};
+
+    //!\brief Two anchors are equal if all members are equal.
+    friend bool operator==(anchor const &, anchor const &) = default;
+};
+
+/*!\brief A colinear chain of anchors as computed by seqan3::chain_anchors.
+ * \ingroup alignment_chaining
+ */
+struct anchor_chain
+{
+    //!\brief The chaining score.
+    int32_t score{};
+    //!\brief The anchors of the chain, ordered by their reference and query position.
+    std::vector<anchor> anchors{};
+};
+
+/*!\brief The parameters of seqan3::chain_anchors.
+ * \ingroup alignment_chaining
+ *
+ * \details
+ *
+ * The defaults are the ones of minimap2 for long reads.
+ */
+struct chain_parameters
+{
+    //!\brief The maximal distance between two consecutive anchors of a chain, in the reference and in the query.
+    uint32_t max_gap{5000u};
+    //!\brief The maximal difference between the diagonals of two consecutive anchors of a chain.
+    uint32_t max_diagonal_difference{500u};
+    //!\brief The number of preceding anchors that are considered as predecessor of an anchor.
+    uint32_t max_predecessors{50u};
+    //!\brief The minimal score of a reported chain.
+    int32_t min_score{40};
+};
+
+/*!\brief Chains colinear anchors between a reference and a query.
+ * \ingroup alignment_chaining
+ *
+ * \param[in] anchors The anchors; they are sorted by this function.
+ * \param[in] parameters The seqan3::chain_parameters.
+ * \returns The chains with a score of at least `parameters.min_score`, ordered by decreasing score.
+ *
+ * \details
+ *
+ * The anchors must belong to the same reference and the same strand of the query. The chaining follows minimap2:
+ * the score of the best chain that ends in anchor \f$i\f$ is
+ * \f[
+ *   f(i) = \max\big\{w_i, \max_{j < i} \{f(j) + \min\{\Delta_q, \Delta_r, w_i\} - \gamma(|\Delta_r - \Delta_q|)\}\big\}
+ * \f]
+ * where \f$\Delta_r\f$ and \f$\Delta_q\f$ are the distances of the anchors in the reference and in the query,
+ * \f$w_i\f$ is the length of anchor \f$i\f$ and
+ * \f$\gamma(l) = 0.01 \cdot \bar{w} \cdot l + 0.5 \log_2 l\f$ penalises the difference of the diagonals with the
+ * average anchor length \f$\bar{w}\f$. Anchor \f$j\f$ must precede anchor \f$i\f$ in both sequences, and the
+ * distances and the difference of the diagonals are bounded by `parameters.max_gap` and
+ * `parameters.max_diagonal_difference`.
+ *
+ * Only the `parameters.max_predecessors` anchors that precede an anchor in the reference are considered as its
+ * predecessor, such that \f$n\f$ anchors are chained in \f$O(n \log n + n h)\f$ time for \f$h\f$ predecessors.
+ *
+ * The chains are extracted from the best scoring anchor downwards. Every anchor belongs to at most one chain: if a
+ * chain runs into an anchor of a better chain, it ends there and its score is reduced by the score of that anchor.
+ */
+inline std::vector<anchor_chain> chain_anchors(std::vector<anchor> anchors, chain_parameters const & parameters = {})
+{
+    std::ranges::sort(anchors,
+                      [](anchor const & lhs, anchor const & rhs)
+                      {
+                          return std::tie(lhs.reference_position, lhs.query_position)
+                               < std::tie(rhs.reference_position, rhs.query_position);
+                      });
+
+    size_t const anchor_count = anchors.size();
+    if (anchor_count == 0u)
+        return {};
+
+    double const average_length =
+        std::accumulate(anchors.begin(),
+                        anchors.end(),
+                        0.0,
+                        [](double const sum, anchor const & current)
+                        {
+                            return sum + current.length;
+                        })
+        / anchor_count;
+
+    auto gap_cost = [average_length](size_t const diagonal_difference) -> int32_t
+    {
+        if (diagonal_difference == 0u)
+            return 0;
+
+        return static_cast<int32_t>(0.01 * average_length * diagonal_difference
+                                    + 0.5 * std::log2(static_cast<double>(diagonal_difference)));
+    };
+
+    std::vector<int32_t> score(anchor_count);
+    std::vector<size_t> predecessor(anchor_count, anchor_count);
+
+    for (size_t i = 0; i < anchor_count; ++i)
+    {
+        anchor const & current = anchors[i];
+        score[i] = current.length;
+
+        size_t const first = (i > parameters.max_predecessors) ? i - parameters.max_predecessors : 0u;
+        for (size_t j = i; j-- > first;)
+        {
+            anchor const & previous = anchors[j];
+            size_t const reference_distance = current.reference_position - previous.reference_position;
+
+            // The anchors are sorted by their reference position.
+            if (reference_distance > parameters.max_gap)
+                break;
+
+            if (reference_distance == 0u || current.query_position <= previous.query_position)
+                continue;
+
+            size_t const query_distance = current.query_position - previous.query_position;
+            if (query_distance > parameters.max_gap)
+                continue;
+
+            size_t const diagonal_difference = (reference_distance > query_distance)
+                                                 ? reference_distance - query_distance
+                                                 : query_distance - reference_distance;
+            if (diagonal_difference > parameters.max_diagonal_difference)
+                continue;
+
+            int32_t const match_score =
+                static_cast<int32_t>(std::min<size_t>({query_distance, reference_distance, current.length}));
+            int32_t const chain_score = score[j] + match_score - gap_cost(diagonal_difference);
+
+            if (chain_score > score[i])
+            {
+                score[i] = chain_score;
+                predecessor[i] = j;
+            }
+        }
+    }
+
+    // Extract the chains from the best scoring anchor downwards.
+    std::vector<size_t> order(anchor_count);
+    std::iota(order.begin(), order.end(), 0u);
+    std::ranges::stable_sort(order,
+                             [&score](size_t const lhs, size_t const rhs)
+                             {
+                                 return score[lhs] > score[rhs];
+                             });
+
+    std::vector<bool> is_used(anchor_count, false);
+    std::vector<anchor_chain> chains{};
+
+    for (size_t const end : order)
+    {
+        if (is_used[end])
+            continue;
+
+        anchor_chain chain{};
+        size_t current = end;
+        for (; current != anchor_count && !is_used[current]; current = predecessor[current])
+        {
+            is_used[current] = true;
+            chain.anchors.push_back(anchors[current]);
+        }
+
+        chain.score = score[end] - ((current != anchor_count) ? score[current] : 0);
+
+        if (chain.score >= parameters.min_score)
+        {
+            std::ranges::reverse(chain.anchors);
+            chains.push_back(std::move(chain));
+        }
+    }
+
+    std::ranges::stable_sort(chains,
+                             [](anchor_chain const & lhs, anchor_chain const & rhs)
+                             {
+                                 return lhs.score > rhs.score;
+                             });
+
+    return chains;
+}
+
+} // namespace seqan3
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::x_drop and seqan3::align_cfg::z_drop.
+ */
+
+#pragma once
+
+#include <limits>
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Computes an extension alignment that is stopped as soon as the score drops by more than a given value.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * Extension alignments are commonly used to extend a seed match (e.g. a shared k-mer) into a longer alignment. The
+ * alignment starts at the beginning of both sequences and may end anywhere in the alignment matrix. The reported
+ * score and end position belong to the best scoring cell that was computed.
+ *
+ * With the X-drop heuristic every cell whose score is more than `score` below the best score seen so far is pruned,
+ * i.e. it is treated as if it cannot be reached. The computation of a column is restricted to the rows that can be
+ * reached from cells that were not pruned in the previous column and the extension stops as soon as all cells of a
+ * column are pruned. Thus, the runtime is proportional to the size of the aligned region instead of the size of the
+ * full alignment matrix. The smaller the value, the more aggressively the search space is pruned.
+ *
+ * This configuration can only be combined with seqan3::align_cfg::method_global and the output configurations
+ * seqan3::align_cfg::output_score, seqan3::align_cfg::output_end_position, seqan3::align_cfg::output_sequence1_id
+ * and seqan3::align_cfg::output_sequence2_id. Since the alignment always begins at the origin of the alignment matrix,
+ * computing the begin positions or the alignment is not supported and a seqan3::invalid_alignment_configuration
+ * exception is thrown. The same holds if a negative value is given.
+ * The X-drop can be combined with seqan3::align_cfg::z_drop to additionally stop the extension early.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_x_drop_example.cpp
+ */
+class x_drop : private pipeable_config_element
+{
+public:
+    //!\brief The maximal score drop below the best score seen so far [default: infinity].
+    int32_t score{std::numeric_limits<int32_t>::max()};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr x_drop() noexcept = default;                           //!< Defaulted
+    constexpr x_drop(x_drop const &) noexcept = default;             //!< Defaulted
+    constexpr x_drop(x_drop &&) noexcept = default;                  //!< Defaulted
+    constexpr x_drop & operator=(x_drop const &) noexcept = default; //!< Defaulted
+    constexpr x_drop & operator=(x_drop &&) noexcept = default;      //!< Defaulted
+    ~x_drop() noexcept = default;                                    //!< Defaulted
+
+    /*!\brief Initialises the X-drop value.
+     *
+     * \param score \copybrief score
+     */
+    constexpr x_drop(int32_t const score) : score{score}
+    {}
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::x_drop};
+};
+
+/*!\brief Computes an extension alignment that is stopped once the best score of a column drops too far below the
+ *        best score seen so far.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The Z-drop heuristic was introduced by minimap2 to stop the extension of an alignment in regions that do not
+ * share any similarity. Let \f$S(i', j')\f$ be the best score seen so far and \f$S(i, j)\f$ the best score of the
+ * column that was just computed. The extension is stopped if
+ * \f$S(i', j') - S(i, j) > Z + g_e \cdot |(i - i') - (j - j')|\f$, where \f$g_e\f$ is the absolute value of the gap
+ * extension score. In contrast to seqan3::align_cfg::x_drop, long gaps are not penalised twice and single cells are
+ * not pruned. Like seqan3::align_cfg::x_drop, the alignment starts at the beginning of both sequences, ends in the
+ * best scoring cell that was computed and only the score, the end positions and the sequence ids can be
+ * computed. If a negative value is given, a seqan3::invalid_alignment_configuration exception is thrown.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_x_drop_example.cpp
+ */
+class z_drop : private pipeable_config_element
+{
+public:
+    //!\brief The maximal score drop of a column below the best score seen so far [default: infinity].
+    int32_t score{std::numeric_limits<int32_t>::max()};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr z_drop() noexcept = default;                           //!< Defaulted
+    constexpr z_drop(z_drop const &) noexcept = default;             //!< Defaulted
+    constexpr z_drop(z_drop &&) noexcept = default;                  //!< Defaulted
+    constexpr z_drop & operator=(z_drop const &) noexcept = default; //!< Defaulted
+    constexpr z_drop & operator=(z_drop &&) noexcept = default;      //!< Defaulted
+    ~z_drop() noexcept = default;                                    //!< Defaulted
+
+    /*!\brief Initialises the Z-drop value.
+     *
+     * \param score \copybrief score
+     */
+    constexpr z_drop(int32_t const score) : score{score}
+    {}
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::z_drop};
+};
+
+} // namespace seqan3::align_cfg
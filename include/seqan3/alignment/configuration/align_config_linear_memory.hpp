@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::linear_memory configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Computes the traceback of the alignment in linear memory.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * By default, the begin positions and the alignment are obtained from a full trace matrix, which requires
+ * \f$O(N \cdot M)\f$ memory for two sequences of length \f$N\f$ and \f$M\f$. For long sequences this quickly exceeds
+ * the available memory. If this configuration element is given, the trace is instead recovered with the
+ * divide-and-conquer strategy of Hirschberg, extended to affine gap costs by Myers and Miller. The alignment matrix is
+ * recursively split at its middle column and only the score columns of the forward and the reverse computation are
+ * kept in memory. Thus, the memory consumption drops to \f$O(N + M)\f$ while the run time roughly doubles compared
+ * to the traceback using the full trace matrix.
+ *
+ * The configuration can be combined with the \ref seqan3::align_cfg::band_fixed_size "banded" alignment. It only
+ * changes how the trace is computed; the score and the end positions are computed as before. If neither the begin
+ * positions nor the alignment is requested, the configuration has no effect since only linear memory is used anyway.
+ *
+ * \note If several optimal alignments exist, the computed alignment might differ from the one obtained with the full
+ *       trace matrix.
+ *
+ * \attention This configuration is only available for the global alignment and cannot be combined with the
+ *            seqan3::align_cfg::method_local or the seqan3::align_cfg::vectorised configuration.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_linear_memory_example.cpp
+ */
+class linear_memory : private pipeable_config_element
+{
+public:
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr linear_memory() = default;                                  //!< Defaulted.
+    constexpr linear_memory(linear_memory const &) = default;             //!< Defaulted.
+    constexpr linear_memory(linear_memory &&) = default;                  //!< Defaulted.
+    constexpr linear_memory & operator=(linear_memory const &) = default; //!< Defaulted.
+    constexpr linear_memory & operator=(linear_memory &&) = default;      //!< Defaulted.
+    ~linear_memory() = default;                                           //!< Defaulted.
+
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::linear_memory};
+};
+
+} // namespace seqan3::align_cfg
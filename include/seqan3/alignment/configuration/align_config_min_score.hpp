@@ -16,17 +16,24 @@
 
 namespace seqan3::align_cfg
 {
-/*!\brief Sets the minimal score (maximal errors) allowed during an distance computation e.g. edit distance.
+/*!\brief Sets the minimal score (maximal errors) allowed during an alignment computation e.g. edit distance.
  * \ingroup alignment_configuration
  *
  * \details
  *
- * This configuration can only be used for computing the \ref seqan3::align_cfg::edit_scheme "edit distance".
- * It restricts the number of substitutions, insertions, and deletions within the alignment to the given value and
- * can thereby speed up the edit distance computation.
+ * This configuration can be used for global and semi-global alignments. For the
+ * \ref seqan3::align_cfg::edit_scheme "edit distance" it restricts the number of substitutions, insertions, and
+ * deletions within the alignment to the given value and can thereby speed up the edit distance computation.
+ * For all other scoring schemes, the computation of the alignment matrix stops as soon as no alignment can reach the
+ * minimal score anymore. This is decided by an upper bound of the score that is still reachable from the cells of the
+ * current column, which assumes that every remaining diagonal step adds the best substitution score and that gaps do
+ * not increase the score. The computation is only stopped early by the standard (banded) algorithm and not if a
+ * positive gap score is configured.
+ *
  * A typical use case is to verify a candidate region during read mapping where the number of maximal errors is given
- * beforehand. If this configuration is used for an alignment algorithm that does not compute the edit distance, a
- * seqan3::invalid_alignment_configuration exception will be thrown.
+ * beforehand. If the alignment does not reach the minimal score, the score of the seqan3::alignment_result is the
+ * largest value of the score type, the begin and end positions are set to the sizes of the sequences and no alignment
+ * or CIGAR string is computed.
  *
  * ### Example
  *
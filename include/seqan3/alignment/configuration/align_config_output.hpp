@@ -184,6 +184,52 @@ public:
     static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::output_alignment};
 };
 
+/*!\brief Configures the alignment result to output the CIGAR string of the alignment.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * This option forces the alignment to compute the traceback and to output the alignment as a run-length encoded
+ * CIGAR string, i.e. a std::vector over seqan3::cigar, as it is stored in a SAM file. The first sequence is the
+ * reference and the second sequence the query, such that the result equals
+ * `seqan3::cigar_from_alignment(result.alignment())` of the same alignment.
+ *
+ * In contrast to seqan3::align_cfg::output_alignment, the CIGAR operations are written directly while the trace
+ * is walked, without building the gapped sequences first. If the alignment itself is not needed, e.g. for writing
+ * the alignment to a SAM file, this option saves the gapped sequences and a second pass over them. The operations
+ * are written into the buffer of the seqan3::alignment_result, which can be moved out of the result with
+ * `std::move(result).cigar_sequence()`.
+ *
+ * If this option is not set in the alignment configuration, accessing the CIGAR string via the
+ * seqan3::alignment_result object is forbidden and will lead to a compile time error.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_output_cigar.cpp
+ *
+ * \see seqan3::align_cfg::output_alignment
+ * \see seqan3::cigar_from_alignment
+ */
+class output_cigar : private pipeable_config_element
+{
+public:
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr output_cigar() = default;                                 //!< Defaulted.
+    constexpr output_cigar(output_cigar const &) = default;             //!< Defaulted.
+    constexpr output_cigar(output_cigar &&) = default;                  //!< Defaulted.
+    constexpr output_cigar & operator=(output_cigar const &) = default; //!< Defaulted.
+    constexpr output_cigar & operator=(output_cigar &&) = default;      //!< Defaulted.
+    ~output_cigar() = default;                                          //!< Defaulted.
+
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::output_cigar};
+};
+
 /*!\brief Configures the alignment result to output the id of the first sequence.
  * \ingroup alignment_configuration
  *
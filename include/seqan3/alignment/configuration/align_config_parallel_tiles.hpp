@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::parallel_tiles configuration.
+ */
+
+#pragma once
+
+#include <optional>
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Computes every single alignment with several threads by splitting the alignment matrix into tiles.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The seqan3::align_cfg::parallel configuration distributes independent sequence pairs over several threads, but one
+ * very long alignment, e.g. of two chromosomes, is still computed by a single thread. With this configuration the
+ * alignment matrix of every sequence pair is split into square tiles with `tile_size` rows and columns. A tile only
+ * depends on the tiles to its left, above and to the upper left, such that all tiles of one anti-diagonal of tiles
+ * can be computed independently of each other. The tiles are handed out to `thread_count` threads in anti-diagonal
+ * order and every thread waits until the tiles its current tile depends on are finished. Hence, up to
+ * `thread_count` tiles are computed at the same time once the wavefront of tiles is wide enough.
+ *
+ * If the alignment is banded with seqan3::align_cfg::band_fixed_size, only the tiles that intersect the band are
+ * computed, such that the runtime stays proportional to the size of the band.
+ *
+ * Only the score, the end positions and the sequence ids can be computed with this configuration. If the begin
+ * positions or the alignment are requested, or if `thread_count` or `tile_size` are `0`, a
+ * seqan3::invalid_alignment_configuration exception is thrown. The computed score and end positions are the same
+ * as without this configuration.
+ *
+ * The tiles should be large enough to amortise the synchronisation between the threads and small enough to give
+ * every thread a tile early on. Since the threads are started for every alignment, this configuration only pays off
+ * for long sequences. It can be combined with seqan3::align_cfg::parallel, in which case every thread that computes
+ * an alignment starts `thread_count - 1` additional threads.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_parallel_tiles_example.cpp
+ */
+class parallel_tiles : private pipeable_config_element
+{
+public:
+    //!\brief The number of threads that compute one alignment [default: std::thread::hardware_concurrency()].
+    std::optional<uint32_t> thread_count{};
+    //!\brief The number of rows and columns of a tile [default: 256].
+    uint32_t tile_size{256};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr parallel_tiles() = default;                                   //!< Defaulted.
+    constexpr parallel_tiles(parallel_tiles const &) = default;             //!< Defaulted.
+    constexpr parallel_tiles(parallel_tiles &&) = default;                  //!< Defaulted.
+    constexpr parallel_tiles & operator=(parallel_tiles const &) = default; //!< Defaulted.
+    constexpr parallel_tiles & operator=(parallel_tiles &&) = default;      //!< Defaulted.
+    ~parallel_tiles() = default;                                            //!< Defaulted.
+
+    /*!\brief Initialises the number of threads and the size of the tiles.
+     *
+     * \param thread_count \copybrief thread_count
+     * \param tile_size \copybrief tile_size
+     */
+    constexpr explicit parallel_tiles(uint32_t const thread_count, uint32_t const tile_size = 256) noexcept :
+        thread_count{thread_count},
+        tile_size{tile_size}
+    {}
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::parallel_tiles};
+};
+
+} // namespace seqan3::align_cfg
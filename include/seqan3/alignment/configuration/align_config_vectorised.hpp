@@ -3,7 +3,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 
 /*!\file
- * \brief Provides seqan3::align_cfg::vectorised configuration.
+ * \brief Provides seqan3::align_cfg::vectorised and seqan3::align_cfg::vectorised_anti_diagonal configuration.
  * \author Jörg Winkler <j.winkler AT fu-berlin.de>
  * \author Lydia Buntrock <lydia.buntrock AT fu-berlin.de>
  */
@@ -27,7 +27,8 @@ namespace seqan3::align_cfg
  * instruction on multiple data at the same time. Depending on your processor architecture you can gain a significant
  * speed-up, e.g. by running up to 64 alignments in parallel on the latest intel CPUs. In our mode we vectorise
  * multiple alignments and not a single alignment. This means that you should provide many sequences to compute as
- * one batch rather than computing them separately as there won't be performance gains.
+ * one batch rather than computing them separately as there won't be performance gains. To vectorise the alignment
+ * of a single long sequence pair, use seqan3::align_cfg::vectorised_anti_diagonal instead.
  *
  * \sa For further information on SIMD see https://en.wikipedia.org/wiki/SIMD.
  *
@@ -55,4 +56,46 @@ public:
     static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::vectorised};
 };
 
+/*!\brief Enables the vectorised computation of a single alignment along the anti-diagonals of the alignment matrix.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * In contrast to seqan3::align_cfg::vectorised, which computes several pairwise alignments simultaneously, this mode
+ * vectorises the computation of a single pairwise alignment. All cells on an anti-diagonal of the alignment matrix
+ * are independent of each other and thus consecutive cells of an anti-diagonal are computed in one SIMD register.
+ * Since every pair of sequences uses all SIMD lanes, this mode is beneficial if a few long sequences shall be aligned,
+ * e.g. a long read against its reference window. The mode can be combined with global and local alignments
+ * (seqan3::align_cfg::method_global and seqan3::align_cfg::method_local) and with the banded alignment
+ * (seqan3::align_cfg::band_fixed_size).
+ *
+ * Only the score and the end positions (as well as the sequence ids) can be computed in this mode. If the begin
+ * positions or the alignment are requested, a seqan3::invalid_alignment_configuration exception is thrown.
+ *
+ * \sa For further information on SIMD see https://en.wikipedia.org/wiki/SIMD.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_vectorised_anti_diagonal_example.cpp
+ */
+class vectorised_anti_diagonal : private pipeable_config_element
+{
+public:
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr vectorised_anti_diagonal() = default;                                             //!< Defaulted.
+    constexpr vectorised_anti_diagonal(vectorised_anti_diagonal const &) = default;             //!< Defaulted.
+    constexpr vectorised_anti_diagonal(vectorised_anti_diagonal &&) = default;                  //!< Defaulted.
+    constexpr vectorised_anti_diagonal & operator=(vectorised_anti_diagonal const &) = default; //!< Defaulted.
+    constexpr vectorised_anti_diagonal & operator=(vectorised_anti_diagonal &&) = default;      //!< Defaulted.
+    ~vectorised_anti_diagonal() = default;                                                      //!< Defaulted.
+
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::vectorised_anti_diagonal};
+};
+
 } // namespace seqan3::align_cfg
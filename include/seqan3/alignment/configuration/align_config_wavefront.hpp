@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::wavefront configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Computes the global alignment with the wavefront alignment algorithm (WFA).
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The dynamic programming algorithms compute every cell of the alignment matrix, such that their run time grows with
+ * the product \f$N \cdot M\f$ of the sequence lengths, no matter how similar the sequences are. The wavefront
+ * alignment algorithm of Marco-Sola et al. (Fast gap-affine pairwise alignment using the wavefront algorithm, 2021)
+ * instead computes, for increasing penalties \f$s\f$, the furthest reaching cell of every diagonal that can be reached
+ * with penalty \f$s\f$ and follows runs of matches without any further computation. It stops as soon as the last cell
+ * of the alignment matrix is reached. Thus, the run time is \f$O(N \cdot s)\f$, where \f$s\f$ is the penalty of the
+ * optimal alignment, which makes it much faster for highly similar sequences.
+ *
+ * The algorithm minimises penalties where matches are free. The configured scores are transformed into equivalent
+ * penalties, such that the optimal alignment and the reported score are exactly the ones of the
+ * \ref seqan3::align_cfg::method_global "global alignment" with the same configuration. For this, the scoring scheme
+ * must only distinguish between matches and mismatches (e.g. seqan3::nucleotide_scoring_scheme or
+ * seqan3::hamming_scoring_scheme), the match score must be larger than the mismatch score and twice the gap
+ * extension score must be smaller than the match score. Otherwise, a seqan3::invalid_alignment_configuration
+ * exception is thrown.
+ *
+ * The score, the begin and end positions and the alignment can be computed. If the alignment or the begin positions
+ * are requested, all wavefronts are kept in memory, which requires \f$O(s^2)\f$ memory. Otherwise only the last few
+ * wavefronts are stored.
+ *
+ * \note If several optimal alignments exist, the computed alignment might differ from the one computed without this
+ *       configuration.
+ *
+ * \attention This configuration is only available for the global alignment without free end gaps and cannot be
+ *            combined with the seqan3::align_cfg::band_fixed_size or the seqan3::align_cfg::vectorised
+ *            configuration.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_wavefront_example.cpp
+ */
+class wavefront : private pipeable_config_element
+{
+public:
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr wavefront() = default;                              //!< Defaulted.
+    constexpr wavefront(wavefront const &) = default;             //!< Defaulted.
+    constexpr wavefront(wavefront &&) = default;                  //!< Defaulted.
+    constexpr wavefront & operator=(wavefront const &) = default; //!< Defaulted.
+    constexpr wavefront & operator=(wavefront &&) = default;      //!< Defaulted.
+    ~wavefront() = default;                                       //!< Defaulted.
+
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::wavefront};
+};
+
+} // namespace seqan3::align_cfg
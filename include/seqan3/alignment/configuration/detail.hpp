@@ -19,25 +19,32 @@ namespace seqan3::detail
  */
 enum struct align_config_id : uint8_t
 {
-    band,                  //!< ID for the \ref seqan3::align_cfg::band_fixed_size "band" option.
-    debug,                 //!< ID for the \ref seqan3::align_cfg::detail::debug "debug" option.
-    gap,                   //!< ID for the \ref seqan3::align_cfg::gap_cost_affine "gap_cost_affine" option.
-    global,                //!< ID for the \ref seqan3::align_cfg::method_global "global alignment" option.
-    local,                 //!< ID for the \ref seqan3::align_cfg::method_local "local alignment" option.
-    min_score,             //!< ID for the \ref seqan3::align_cfg::min_score "min_score" option.
-    on_result,             //!< ID for the \ref seqan3::align_cfg::on_result "on_result" option.
-    output_alignment,      //!< ID for the \ref seqan3::align_cfg::output_alignment "alignment output" option.
-    output_begin_position, //!< ID for the \ref seqan3::align_cfg::output_begin_position "begin position output" option.
-    output_end_position,   //!< ID for the \ref seqan3::align_cfg::output_end_position "end position output" option.
-    output_sequence1_id,   //!< ID for the \ref seqan3::align_cfg::output_sequence1_id "sequence1 id output" option.
-    output_sequence2_id,   //!< ID for the \ref seqan3::align_cfg::output_sequence2_id "sequence2 id output" option.
-    output_score,          //!< ID for the \ref seqan3::align_cfg::output_score "score output" option.
-    parallel,              //!< ID for the \ref seqan3::align_cfg::parallel "parallel" option.
-    result_type,           //!< ID for the \ref seqan3::align_cfg::detail::result_type "result_type" option.
-    score_type,            //!< ID for the \ref seqan3::align_cfg::score_type "score_type" option.
-    scoring,               //!< ID for the \ref seqan3::align_cfg::scoring_scheme "scoring_scheme" option.
-    vectorised,            //!< ID for the \ref seqan3::align_cfg::vectorised "vectorised" option.
-    SIZE                   //!< Represents the number of configuration elements.
+    band,                     //!< ID for the \ref seqan3::align_cfg::band_fixed_size "band" option.
+    debug,                    //!< ID for the \ref seqan3::align_cfg::detail::debug "debug" option.
+    gap,                      //!< ID for the \ref seqan3::align_cfg::gap_cost_affine "gap_cost_affine" option.
+    global,                   //!< ID for the \ref seqan3::align_cfg::method_global "global alignment" option.
+    linear_memory,            //!< ID for the \ref seqan3::align_cfg::linear_memory "linear memory" option.
+    local,                    //!< ID for the \ref seqan3::align_cfg::method_local "local alignment" option.
+    min_score,                //!< ID for the \ref seqan3::align_cfg::min_score "min_score" option.
+    on_result,                //!< ID for the \ref seqan3::align_cfg::on_result "on_result" option.
+    output_alignment,         //!< ID for the \ref seqan3::align_cfg::output_alignment "alignment output" option.
+    output_begin_position,    //!< ID for the \ref seqan3::align_cfg::output_begin_position "begin position" option.
+    output_cigar,             //!< ID for the \ref seqan3::align_cfg::output_cigar "CIGAR output" option.
+    output_end_position,      //!< ID for the \ref seqan3::align_cfg::output_end_position "end position output" option.
+    output_sequence1_id,      //!< ID for the \ref seqan3::align_cfg::output_sequence1_id "sequence1 id output" option.
+    output_sequence2_id,      //!< ID for the \ref seqan3::align_cfg::output_sequence2_id "sequence2 id output" option.
+    output_score,             //!< ID for the \ref seqan3::align_cfg::output_score "score output" option.
+    parallel,                 //!< ID for the \ref seqan3::align_cfg::parallel "parallel" option.
+    parallel_tiles,           //!< ID for the \ref seqan3::align_cfg::parallel_tiles "parallel tiles" option.
+    result_type,              //!< ID for the \ref seqan3::align_cfg::detail::result_type "result_type" option.
+    score_type,               //!< ID for the \ref seqan3::align_cfg::score_type "score_type" option.
+    scoring,                  //!< ID for the \ref seqan3::align_cfg::scoring_scheme "scoring_scheme" option.
+    vectorised,               //!< ID for the \ref seqan3::align_cfg::vectorised "vectorised" option.
+    vectorised_anti_diagonal, //!< ID for the \ref seqan3::align_cfg::vectorised_anti_diagonal "anti-diagonal" option.
+    wavefront,                //!< ID for the \ref seqan3::align_cfg::wavefront "wavefront" option.
+    x_drop,                   //!< ID for the \ref seqan3::align_cfg::x_drop "X-drop" option.
+    z_drop,                   //!< ID for the \ref seqan3::align_cfg::z_drop "Z-drop" option.
+    SIZE                      //!< Represents the number of configuration elements.
 };
 
 // ----------------------------------------------------------------------------
@@ -57,38 +64,52 @@ inline constexpr std::array<std::array<bool, static_cast<uint8_t>(align_config_i
         //|  debug
         //|  |  gap
         //|  |  |  global
-        //|  |  |  |  local
-        //|  |  |  |  |  min_score
-        //|  |  |  |  |  |  on_result
-        //|  |  |  |  |  |  |  output_alignment
-        //|  |  |  |  |  |  |  |  output_begin_position
-        //|  |  |  |  |  |  |  |  |  output_end_position
-        //|  |  |  |  |  |  |  |  |  |  output_sequence1_id
-        //|  |  |  |  |  |  |  |  |  |  |  output_sequence2_id
-        //|  |  |  |  |  |  |  |  |  |  |  |  output_score
-        //|  |  |  |  |  |  |  |  |  |  |  |  |  parallel
-        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  result_type
-        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  | score_type
-        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  scoring
-        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  vectorised
-        {0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  0: band
-        {1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  1: debug
-        {1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  2: gap
-        {1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  3: global
-        {1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  4: local
-        {1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  5: max_error
-        {1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  6: on_result
-        {1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  7: output_alignment
-        {1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  8: output_begin_position
-        {1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1}, // 9: output_end_position
-        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1}, // 10: output_sequence1_id
-        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1}, // 11: output_sequence2_id
-        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1}, // 12: output_score
-        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1}, // 13: parallel
-        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1}, // 14: result_type
-        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1}, // 15: score_type
-        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1}, // 16: scoring
-        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0}  // 17: vectorised
+        //|  |  |  |  linear_memory
+        //|  |  |  |  |  local
+        //|  |  |  |  |  |  min_score
+        //|  |  |  |  |  |  |  on_result
+        //|  |  |  |  |  |  |  |  output_alignment
+        //|  |  |  |  |  |  |  |  |  output_begin_position
+        //|  |  |  |  |  |  |  |  |  |  output_cigar
+        //|  |  |  |  |  |  |  |  |  |  |  output_end_position
+        //|  |  |  |  |  |  |  |  |  |  |  |  output_sequence1_id
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  output_sequence2_id
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  output_score
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  parallel
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  parallel_tiles
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  result_type
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  score_type
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  scoring
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  vectorised
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  vectorised_anti_diagonal
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  wavefront
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  x_drop
+        //|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  z_drop
+        {0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0}, //  0: band
+        {1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 0, 0}, //  1: debug
+        {1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  2: gap
+        {1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  3: global
+        {1, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0}, //  4: linear_memory
+        {1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0}, //  5: local
+        {1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 0, 0}, //  6: min_score
+        {1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  7: on_result
+        {1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  8: output_alignment
+        {1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  9: output_begin_position
+        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 10: output_cigar
+        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 11: output_end_position
+        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 12: output_sequence1_id
+        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 13: output_sequence2_id
+        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 14: output_score
+        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // 15: parallel
+        {1, 0, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0}, // 16: parallel_tiles
+        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1}, // 17: result_type
+        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1}, // 18: score_type
+        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1}, // 19: scoring
+        {1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0}, // 20: vectorised
+        {1, 0, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0}, // 21: vectorised_anti_diagonal
+        {0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0}, // 22: wavefront
+        {0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 1}, // 23: x_drop
+        {0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0, 1, 0}  // 24: z_drop
     }};
 
 } // namespace seqan3::detail
@@ -13,9 +13,9 @@
 #include <algorithm>
 #include <limits>
 #include <ranges>
-#include <set>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include <seqan3/alignment/exception.hpp>
 #include <seqan3/alphabet/concept.hpp>
@@ -56,11 +56,13 @@ namespace seqan3
  *
  * ### Implementation details
  *
- * This decorator stores a std::set over tuples of `(pos, cumulative_size)` where every entry represents one
+ * This decorator stores a sorted std::vector over tuples of `(pos, cumulative_size)` where every entry represents one
  * contiguous stretch of gaps. `pos` is the (virtual) insert position in the underlying range and `cumulative_size`
  * is the length of that contiguous stretch of gaps plus the length of all preceding elements.
- * Resolving random access requires logarithmic access into the set and inserting or removing a gap symbol additionally
- * entails updating all subsequent elements in the set to preserve correct cumulative sizes.
+ * Resolving random access requires a binary search over the anchors and inserting or removing a gap symbol
+ * additionally entails updating all subsequent anchors to preserve correct cumulative sizes.
+ * Since the anchors are stored contiguously, the binary search and the iteration touch only few cache lines and
+ * extending or shrinking an existing gap does not allocate any memory.
  *
  * ### The seqan3::gap_decorator::iterator type
  *
@@ -206,31 +208,20 @@ public:
         size_type const pos = it - begin();
         assert(pos <= size());
 
-        set_iterator_type it_set = anchors.upper_bound(anchor_gap_t{pos, bound_dummy});
+        set_iterator_type it_set = std::ranges::upper_bound(anchors, anchor_gap_t{pos, bound_dummy});
 
         if (it_set == anchors.begin()) // will also catch if anchors is empty since begin() == end()
         {
-            anchors.emplace_hint(anchors.begin(), anchor_gap_t{pos, count});
+            anchors.insert(anchors.begin(), anchor_gap_t{pos, count});
         }
         else // there are gaps before pos
         {
             --it_set;
-            auto gap_len{it_set->second};
-            if (it_set != anchors.begin())
-                gap_len -= (*(std::prev(it_set))).second;
 
-            if (it_set->first + gap_len >= pos) // extend existing gap
-            {
-                anchor_gap_t gap{it_set->first, it_set->second + count};
-                it_set = anchors.erase(it_set);
-                anchors.insert(it_set, gap);
-            }
+            if (it_set->first + gap_length(it_set) >= pos) // extend existing gap
+                it_set->second += count;
             else // insert new gap
-            {
-                anchor_gap_t gap{pos, it_set->second + count};
-                ++it_set;
-                anchors.insert(it_set, gap);
-            }
+                anchors.insert(std::next(it_set), anchor_gap_t{pos, it_set->second + count});
         }
 
         // post-processing: reverse update of succeeding gaps
@@ -247,7 +238,7 @@ public:
     *
     * ### Complexity
     *
-    * \f$O(\log k)\f$
+    * Linear in the number of gaps after the position, which are shifted.
      *
      * \stableapi{Since version 3.1.}
     */
@@ -271,7 +262,7 @@ public:
      *
      * ### Complexity
      *
-     * \f$O(\log k)\f$
+     * Linear in the number of gaps after the position, which are shifted.
      *
      * \stableapi{Since version 3.1.}
      */
@@ -279,7 +270,8 @@ public:
     {
         size_type const pos1 = first - begin();
         size_type const pos2 = last - begin();
-        set_iterator_type it = anchors.upper_bound(anchor_gap_t{pos1, bound_dummy}); // first element greater than pos1
+        // first element greater than pos1
+        set_iterator_type it = std::ranges::upper_bound(anchors, anchor_gap_t{pos1, bound_dummy});
 
         if (it == anchors.begin())
             throw gap_erase_failure{"There is no gap to erase in range [" + std::to_string(pos1) + ","
@@ -301,10 +293,8 @@ public:
         // case 2: gap to be deleted in tail or larger than 1 (equiv. to shift tail left, i.e. pos remains unchanged)
         else
         {
-            anchor_gap_t gap{it->first, it->second - pos2 + pos1};
-            it = anchors.erase(it);
-            it = anchors.insert(it, gap); // amortized constant because of hint
-            ++it;                         // update node after the current
+            it->second -= pos2 - pos1;
+            ++it; // update node after the current
         }
 
         // post-processing: forward update of succeeding gaps
@@ -540,12 +530,15 @@ private:
     //!\brief The gap type as a tuple storing position and accumulated gap lengths.
     using anchor_gap_t = typename std::pair<size_t, size_t>;
 
-    //!\brief The type of set to store the anchor gaps.
-    using anchor_set_type = std::set<anchor_gap_t>;
+    //!\brief The type of the sorted container to store the anchor gaps.
+    using anchor_set_type = std::vector<anchor_gap_t>;
 
     //!\brief The iterator type for an anchor set.
     using set_iterator_type = typename anchor_set_type::iterator;
 
+    //!\brief The const iterator type for an anchor set.
+    using const_set_iterator_type = typename anchor_set_type::const_iterator;
+
     //!\brief The maximum value is needed for a correct search with upper_bound() in the anchor set.
     static constexpr size_t bound_dummy{std::numeric_limits<size_t>::max()};
 
@@ -561,7 +554,7 @@ private:
      * ### Exceptions
      * Strong exception guarantee.
      */
-    size_type gap_length(set_iterator_type it) const
+    size_type gap_length(const_set_iterator_type it) const
     {
         return (it == anchors.begin()) ? it->second : it->second - (*std::prev(it)).second;
     }
@@ -572,18 +565,17 @@ private:
      *
      * \details
      *
-     * In order to avoid key conflicts when inserting into anchors, the
-     * update is done in reverse manner excluding the indicated gap.
+     * The anchors are updated in place, starting from the last one, which keeps them sorted.
      *
      * ### Complexity
      * Linear in the number of gaps.
      */
     void rupdate(size_type const pos, size_type const offset)
     {
-        for (auto it = std::prev(anchors.end(), 1); it->first > pos;)
+        for (auto it = anchors.rbegin(); it != anchors.rend() && it->first > pos; ++it)
         {
-            anchors.emplace_hint(it, anchor_gap_t{it->first + offset, it->second + offset});
-            anchors.erase(*it--);
+            it->first += offset;
+            it->second += offset;
         }
     }
 
@@ -593,27 +585,24 @@ private:
      *
      * \details
      *
-     * In order to avoid key conflicts when inserting into anchors, the
-     * decreasing is done in a forward manner excluding the indicated gap.
+     * The anchors are updated in place, which keeps them sorted.
      *
      * ### Complexity
      * Linear in the number of gaps.
      */
     void update(set_iterator_type it, size_type const offset)
     {
-        while (it != anchors.end())
+        for (; it != anchors.end(); ++it)
         {
-            anchor_gap_t gap{it->first - offset, it->second - offset};
-            it = anchors.erase(it);
-            it = anchors.insert(it, gap);
-            ++it;
+            it->first -= offset;
+            it->second -= offset;
         }
     }
 
     //!\brief Stores a (copy of a) view to the ungapped, underlying sequence.
     ungapped_view_type ungapped_view{};
 
-    //!\brief Set storing the anchor gaps.
+    //!\brief Sorted vector storing the anchor gaps.
     anchor_set_type anchors{};
 };
 
@@ -670,7 +659,7 @@ protected:
     typename gap_decorator::size_type left_gap_end{0};
     //!\brief A pointer to the current anchor gap node. Note that the current tuple value at position 0 is the
     //!       start of the right gap that is still behind the current iterator position.
-    typename gap_decorator::set_iterator_type anchor_set_it{};
+    typename gap_decorator::const_set_iterator_type anchor_set_it{};
     //!\brief Caches whether the iterator points to a gap (true) or not (false).
     bool is_at_gap{true};
 
@@ -680,12 +669,12 @@ protected:
         assert(new_pos <= host->size());
         pos = new_pos;
 
-        anchor_set_it = host->anchors.upper_bound(anchor_gap_t{pos, host->bound_dummy});
+        anchor_set_it = std::ranges::upper_bound(host->anchors, anchor_gap_t{pos, host->bound_dummy});
         ungapped_view_pos = pos;
 
         if (anchor_set_it != host->anchors.begin())
         {
-            typename gap_decorator::set_iterator_type prev{std::prev(anchor_set_it)};
+            typename gap_decorator::const_set_iterator_type prev{std::prev(anchor_set_it)};
             size_type gap_len{prev->second};
 
             if (prev != host->anchors.begin())
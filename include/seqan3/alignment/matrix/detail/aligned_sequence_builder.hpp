@@ -17,6 +17,7 @@
 #include <seqan3/alignment/aligned_sequence/aligned_sequence_concept.hpp>
 #include <seqan3/alignment/decorator/gap_decorator.hpp>
 #include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/release_excess_memory.hpp>
 #include <seqan3/alignment/matrix/detail/trace_directions.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
 #include <seqan3/core/detail/is_class_template_declarable.hpp>
@@ -176,7 +177,10 @@ public:
         std::tie(res.first_sequence_slice_positions.second, res.second_sequence_slice_positions.second) =
             std::pair<size_t, size_t>{trace_it.coordinate()};
 
-        std::vector<std::pair<trace_directions, size_t>> trace_segments;
+        // The segments are only needed while building the alignment, so every thread reuses the same buffer unless it
+        // grew too large.
+        static thread_local std::vector<std::pair<trace_directions, size_t>> trace_segments{};
+        trace_segments.clear();
 
         while (trace_it != std::ranges::end(trace_path))
         {
@@ -205,6 +209,8 @@ public:
                               std::get<0>(res.alignment),
                               std::get<1>(res.alignment));
 
+        release_excess_memory(trace_segments);
+
         return res;
     }
 
@@ -108,12 +108,33 @@ public:
     constexpr alignment_score_matrix_one_column(first_sequence_t && first,
                                                 second_sequence_t && second,
                                                 score_t const initial_value = score_t{})
+    {
+        resize(first, second, initial_value);
+    }
+    //!\}
+
+    /*!\brief Resizes the matrix for two new ranges.
+     * \tparam first_sequence_t  The first range type; must model std::ranges::forward_range.
+     * \tparam second_sequence_t The second range type; must model std::ranges::forward_range.
+     *
+     * \param[in] first         The first range.
+     * \param[in] second        The second range.
+     * \param[in] initial_value The value to initialise the matrix with. Default initialised if not specified.
+     *
+     * \details
+     *
+     * The matrix is in the same state as if it was constructed from the given ranges, but the already allocated
+     * memory is reused.
+     */
+    template <std::ranges::forward_range first_sequence_t, std::ranges::forward_range second_sequence_t>
+    constexpr void
+    resize(first_sequence_t && first, second_sequence_t && second, score_t const initial_value = score_t{})
     {
         matrix_base_t::num_cols = static_cast<size_type>(std::ranges::distance(first) + 1);
         matrix_base_t::num_rows = static_cast<size_type>(std::ranges::distance(second) + 1);
-        matrix_base_t::pool.resize(matrix_base_t::num_rows + 1, element_type{initial_value, initial_value});
+        matrix_base_t::cache = {};
+        matrix_base_t::pool.assign(matrix_base_t::num_rows + 1, element_type{initial_value, initial_value});
     }
-    //!\}
 
 private:
     //!\copydoc seqan3::detail::alignment_matrix_column_major_range_base::initialise_column
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iterator>
 #include <ranges>
 
@@ -116,20 +117,42 @@ public:
     template <std::ranges::forward_range first_sequence_t, std::ranges::forward_range second_sequence_t>
     constexpr alignment_trace_matrix_full(first_sequence_t && first,
                                           second_sequence_t && second,
-                                          [[maybe_unused]] trace_t const initial_value = trace_t{})
+                                          trace_t const initial_value = trace_t{})
+    {
+        resize(first, second, initial_value);
+    }
+    //!\}
+
+    /*!\brief Resizes the matrix for two new ranges.
+     * \tparam first_sequence_t  The first range type; must model std::ranges::forward_range.
+     * \tparam second_sequence_t The second range type; must model std::ranges::forward_range.
+     *
+     * \param[in] first  The first range.
+     * \param[in] second The second range.
+     * \param[in] initial_value The value to initialise the matrix with. Default initialised if not specified.
+     *
+     * \details
+     *
+     * The matrix is in the same state as if it was constructed from the given ranges, but the already allocated
+     * memory is reused. All stored traces are reset.
+     */
+    template <std::ranges::forward_range first_sequence_t, std::ranges::forward_range second_sequence_t>
+    constexpr void resize(first_sequence_t && first,
+                          second_sequence_t && second,
+                          [[maybe_unused]] trace_t const initial_value = trace_t{})
     {
         matrix_base_t::num_cols = static_cast<size_type>(std::ranges::distance(first) + 1);
         matrix_base_t::num_rows = static_cast<size_type>(std::ranges::distance(second) + 1);
+        matrix_base_t::cache_up = trace_t{};
 
         if constexpr (!coordinate_only)
         {
-            // Allocate the matrix here.
-            matrix_base_t::data = typename matrix_base_t::pool_type{number_rows{matrix_base_t::num_rows},
-                                                                    number_cols{matrix_base_t::num_cols}};
-            matrix_base_t::cache_left.resize(matrix_base_t::num_rows, initial_value);
+            // Allocate the matrix here or reuse the memory of the previous matrix.
+            matrix_base_t::data.resize(number_rows{matrix_base_t::num_rows}, number_cols{matrix_base_t::num_cols});
+            std::fill_n(matrix_base_t::data.data(), matrix_base_t::num_rows * matrix_base_t::num_cols, trace_t{});
+            matrix_base_t::cache_left.assign(matrix_base_t::num_rows, initial_value);
         }
     }
-    //!\}
 
     /*!\brief Returns a trace path starting from the given coordinate and ending in the cell with
      *        seqan3::detail::trace_directions::none.
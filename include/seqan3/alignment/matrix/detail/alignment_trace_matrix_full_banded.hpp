@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iterator>
 #include <ranges>
 
@@ -127,10 +128,35 @@ public:
     constexpr alignment_trace_matrix_full_banded(first_sequence_t && first,
                                                  second_sequence_t && second,
                                                  align_cfg::band_fixed_size const & band,
-                                                 [[maybe_unused]] trace_t const initial_value = trace_t{})
+                                                 trace_t const initial_value = trace_t{})
+    {
+        resize(first, second, band, initial_value);
+    }
+    //!\}
+
+    /*!\brief Resizes the matrix for two new ranges and a band.
+     * \tparam first_sequence_t  The first range type; must model std::ranges::forward_range.
+     * \tparam second_sequence_t The second range type; must model std::ranges::forward_range.
+     *
+     * \param[in] first         The first range.
+     * \param[in] second        The second range.
+     * \param[in] band          The seqan3::align_cfg::band_fixed_size in which to calculate the alignment.
+     * \param[in] initial_value The value to initialise the matrix with. Default initialised if not specified.
+     *
+     * \details
+     *
+     * The matrix is in the same state as if it was constructed from the given ranges and band, but the already
+     * allocated memory is reused. All stored traces are reset.
+     */
+    template <std::ranges::forward_range first_sequence_t, std::ranges::forward_range second_sequence_t>
+    constexpr void resize(first_sequence_t && first,
+                          second_sequence_t && second,
+                          align_cfg::band_fixed_size const & band,
+                          [[maybe_unused]] trace_t const initial_value = trace_t{})
     {
         matrix_base_t::num_cols = static_cast<size_type>(std::ranges::distance(first) + 1);
         matrix_base_t::num_rows = static_cast<size_type>(std::ranges::distance(second) + 1);
+        matrix_base_t::cache_up = trace_t{};
 
         band_col_index = std::min<int32_t>(std::max<int32_t>(band.upper_diagonal, 0), matrix_base_t::num_cols - 1);
         band_row_index =
@@ -140,12 +166,12 @@ public:
         // Reserve one more cell to deal with last cell in the banded column which needs only the diagonal and up cell.
         if constexpr (!coordinate_only)
         {
-            matrix_base_t::data = typename matrix_base_t::pool_type{number_rows{static_cast<size_type>(band_size)},
-                                                                    number_cols{matrix_base_t::num_cols}};
-            matrix_base_t::cache_left.resize(band_size + 1, initial_value);
+            size_type const row_count = static_cast<size_type>(band_size);
+            matrix_base_t::data.resize(number_rows{row_count}, number_cols{matrix_base_t::num_cols});
+            std::fill_n(matrix_base_t::data.data(), row_count * matrix_base_t::num_cols, trace_t{});
+            matrix_base_t::cache_left.assign(band_size + 1, initial_value);
         }
     }
-    //!\}
 
     //!\copydoc seqan3::detail::alignment_trace_matrix_full::trace_path
     auto trace_path(matrix_coordinate const & trace_begin)
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::cigar_from_trace_path.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <ranges>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alphabet/cigar/cigar.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Writes the run-length encoded CIGAR operations of a trace path into the given buffer.
+ * \ingroup alignment_matrix
+ *
+ * \tparam trace_path_t The type of the trace path; must model std::ranges::input_range over
+ *                      seqan3::detail::trace_directions.
+ *
+ * \param[in] trace_path The trace path, which moves from the end to the begin of the alignment.
+ * \param[in,out] cigar_buffer The buffer to write the CIGAR operations to.
+ * \returns The matrix coordinate where the trace path ends, i.e. the begin of the alignment.
+ *
+ * \details
+ *
+ * The buffer is cleared before the operations are written, but its capacity is kept, such that a buffer that is
+ * reused for many alignments stops allocating memory after a few alignments. As in seqan3::cigar_from_alignment the
+ * first sequence is the reference and the second sequence the query: a diagonal step is a match ('M'), a step
+ * up consumes the query only and is an insertion ('I'), and a step to the left consumes the reference only and is a
+ * deletion ('D'). The trace is walked exactly once; in contrast to seqan3::detail::aligned_sequence_builder no
+ * aligned sequences are built.
+ */
+template <std::ranges::input_range trace_path_t>
+matrix_coordinate cigar_from_trace_path(trace_path_t && trace_path, std::vector<cigar> & cigar_buffer)
+{
+    static_assert(std::same_as<std::ranges::range_value_t<trace_path_t>, trace_directions>,
+                  "The value type of the trace path must be seqan3::detail::trace_directions");
+
+    auto to_cigar_operation = [](trace_directions const direction)
+    {
+        assert(direction == trace_directions::diagonal || direction == trace_directions::up
+               || direction == trace_directions::left);
+
+        if (direction == trace_directions::diagonal)
+            return 'M'_cigar_operation;
+        else if (direction == trace_directions::up)
+            return 'I'_cigar_operation;
+        else
+            return 'D'_cigar_operation;
+    };
+
+    cigar_buffer.clear();
+
+    auto trace_it = std::ranges::begin(trace_path);
+    while (trace_it != std::ranges::end(trace_path))
+    {
+        trace_directions const direction = *trace_it;
+        uint32_t count = 0;
+        for (; trace_it != std::ranges::end(trace_path) && *trace_it == direction; ++trace_it, ++count)
+        {}
+
+        cigar_buffer.emplace_back(count, to_cigar_operation(direction));
+    }
+
+    // The trace path moves from the end to the begin of the alignment.
+    std::ranges::reverse(cigar_buffer);
+    return trace_it.coordinate();
+}
+
+} // namespace seqan3::detail
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::release_excess_memory.
+ */
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <vector>
+
+namespace seqan3::detail
+{
+
+/*!\brief The number of matrix cells up to which a thread keeps the memory of its alignment buffers.
+ * \ingroup alignment_matrix
+ *
+ * \details
+ *
+ * The alignment algorithms keep their matrices and buffers in thread local storage, such that subsequent alignments
+ * computed by the same thread reuse the memory. After an alignment with more cells, the memory is released again.
+ * Computing that many cells takes far longer than allocating the memory for the next alignment, hence the limit
+ * barely affects the runtime, but a single long alignment does not pin its memory until the thread ends.
+ */
+inline constexpr size_t retained_alignment_cell_count = size_t{1} << 24;
+
+/*!\brief Releases the memory of a thread local alignment buffer after a large alignment.
+ * \ingroup alignment_matrix
+ * \tparam buffer_t The type of the buffer; must model std::default_initializable and std::movable.
+ * \param[in,out] buffer The buffer to release.
+ * \param[in] cell_count The number of cells of the alignment that used the buffer.
+ *
+ * \details
+ *
+ * The buffer is replaced by a default constructed one if `cell_count` exceeds
+ * seqan3::detail::retained_alignment_cell_count.
+ */
+template <typename buffer_t>
+    requires std::default_initializable<buffer_t> && std::movable<buffer_t>
+void release_excess_memory(buffer_t & buffer, size_t const cell_count)
+{
+    if (cell_count > retained_alignment_cell_count)
+        buffer = buffer_t{};
+}
+
+/*!\brief Releases the memory of a thread local vector if its capacity exceeds
+ *        seqan3::detail::retained_alignment_cell_count elements.
+ * \ingroup alignment_matrix
+ * \param[in,out] buffer The buffer to release.
+ */
+template <typename value_t, typename allocator_t>
+void release_excess_memory(std::vector<value_t, allocator_t> & buffer)
+{
+    if (buffer.capacity() > retained_alignment_cell_count)
+        std::vector<value_t, allocator_t>{}.swap(buffer);
+}
+
+} // namespace seqan3::detail
@@ -0,0 +1,257 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::trace_segments.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A run-length encoded trace path recorded from the begin to the end of an alignment.
+ * \ingroup alignment_matrix
+ *
+ * \details
+ *
+ * Stores the trace of an alignment as a sequence of segments, each consisting of a seqan3::detail::trace_directions
+ * value (seqan3::detail::trace_directions::diagonal, seqan3::detail::trace_directions::up or
+ * seqan3::detail::trace_directions::left) and the number of consecutive steps in that direction. In contrast to
+ * seqan3::detail::trace_matrix_full, the trace is not read from a matrix but appended step by step while the
+ * trace is computed, e.g. by the linear memory traceback. The stored trace can be accessed from the end to the begin
+ * via seqan3::detail::trace_segments::trace_path, which offers the same interface as the trace path of the trace
+ * matrices and can thus be passed to the seqan3::detail::aligned_sequence_builder.
+ */
+class trace_segments
+{
+private:
+    //!\brief The type of a single segment.
+    using segment_type = std::pair<trace_directions, size_t>;
+
+    //!\brief The recorded segments in the order from the begin to the end of the alignment.
+    std::vector<segment_type> segments{};
+    //!\brief The matrix coordinate where the trace begins.
+    matrix_coordinate begin_coordinate{};
+
+    /*!\brief The iterator over the trace path, which moves from the end to the begin of the recorded trace.
+     * \implements std::forward_iterator
+     */
+    class path_iterator
+    {
+    private:
+        //!\brief The segments of the trace.
+        std::vector<segment_type> const * segments_ptr{};
+        //!\brief The number of segments which are not yet fully consumed.
+        size_t remaining_segments{};
+        //!\brief The number of steps left in the current segment.
+        size_t remaining_steps{};
+        //!\brief The current matrix coordinate.
+        matrix_coordinate current_coordinate{};
+
+    public:
+        /*!\name Associated types
+         * \{
+         */
+        using value_type = trace_directions;                 //!< The value type.
+        using reference = trace_directions const &;          //!< The reference type.
+        using pointer = value_type const *;                  //!< The pointer type.
+        using difference_type = std::ptrdiff_t;              //!< The difference type.
+        using iterator_category = std::forward_iterator_tag; //!< Forward iterator tag.
+        //!\}
+
+        /*!\name Constructors, destructor and assignment
+         * \{
+         */
+        path_iterator() = default;                                  //!< Defaulted.
+        path_iterator(path_iterator const &) = default;             //!< Defaulted.
+        path_iterator(path_iterator &&) = default;                  //!< Defaulted.
+        path_iterator & operator=(path_iterator const &) = default; //!< Defaulted.
+        path_iterator & operator=(path_iterator &&) = default;      //!< Defaulted.
+        ~path_iterator() = default;                                 //!< Defaulted.
+
+        //!\brief Constructs the iterator pointing to the last step of the given trace.
+        explicit path_iterator(trace_segments const & trace) noexcept :
+            segments_ptr{std::addressof(trace.segments)},
+            remaining_segments{trace.segments.size()},
+            remaining_steps{trace.segments.empty() ? 0 : trace.segments.back().second},
+            current_coordinate{trace.end_position()}
+        {}
+        //!\}
+
+        /*!\name Element access
+         * \{
+         */
+        //!\brief Returns the direction of the current step.
+        reference operator*() const noexcept
+        {
+            return (*segments_ptr)[remaining_segments - 1].first;
+        }
+
+        //!\brief Returns the matrix coordinate of the cell the iterator currently points to.
+        [[nodiscard]] matrix_coordinate coordinate() const noexcept
+        {
+            return current_coordinate;
+        }
+        //!\}
+
+        /*!\name Arithmetic operators
+         * \{
+         */
+        //!\brief Moves the iterator to the previous cell of the trace.
+        path_iterator & operator++() noexcept
+        {
+            trace_directions const direction = **this;
+            current_coordinate.row -= (direction != trace_directions::left);
+            current_coordinate.col -= (direction != trace_directions::up);
+
+            if (--remaining_steps == 0 && --remaining_segments > 0)
+                remaining_steps = (*segments_ptr)[remaining_segments - 1].second;
+
+            return *this;
+        }
+
+        //!\brief Moves the iterator to the previous cell of the trace and returns the previous position.
+        path_iterator operator++(int) noexcept
+        {
+            path_iterator tmp{*this};
+            ++(*this);
+            return tmp;
+        }
+        //!\}
+
+        /*!\name Comparison operators
+         * \{
+         */
+        //!\brief Returns `true` if both iterators point to the same step.
+        friend bool operator==(path_iterator const & lhs, path_iterator const & rhs) noexcept
+        {
+            return lhs.remaining_segments == rhs.remaining_segments && lhs.remaining_steps == rhs.remaining_steps;
+        }
+
+        //!\brief Returns `true` if the iterator reached the begin of the trace.
+        friend bool operator==(path_iterator const & lhs, std::default_sentinel_t const &) noexcept
+        {
+            return lhs.remaining_segments == 0;
+        }
+        //!\}
+    };
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    trace_segments() = default;                                   //!< Defaulted.
+    trace_segments(trace_segments const &) = default;             //!< Defaulted.
+    trace_segments(trace_segments &&) = default;                  //!< Defaulted.
+    trace_segments & operator=(trace_segments const &) = default; //!< Defaulted.
+    trace_segments & operator=(trace_segments &&) = default;      //!< Defaulted.
+    ~trace_segments() = default;                                  //!< Defaulted.
+
+    //!\}
+
+    /*!\brief Removes all segments and sets the begin of the trace.
+     * \param[in] begin The matrix coordinate where the new trace begins.
+     *
+     * \details
+     *
+     * The allocated memory is kept, such that the same object can be reused for many alignments.
+     */
+    void reset(matrix_coordinate const begin) noexcept
+    {
+        segments.clear();
+        begin_coordinate = begin;
+    }
+
+    /*!\brief Appends `count` steps in the given direction to the end of the trace.
+     * \param[in] direction The direction of the steps; must be one of seqan3::detail::trace_directions::diagonal,
+     *                      seqan3::detail::trace_directions::up or seqan3::detail::trace_directions::left.
+     * \param[in] count The number of steps.
+     *
+     * \details
+     *
+     * If the last segment has the same direction, it is extended by `count` steps.
+     */
+    void append(trace_directions const direction, size_t const count = 1)
+    {
+        assert(direction == trace_directions::diagonal || direction == trace_directions::up
+               || direction == trace_directions::left);
+
+        if (count == 0)
+            return;
+
+        if (!segments.empty() && segments.back().first == direction)
+            segments.back().second += count;
+        else
+            segments.emplace_back(direction, count);
+    }
+
+    //!\brief Returns the matrix coordinate where the trace begins.
+    matrix_coordinate begin_position() const noexcept
+    {
+        return begin_coordinate;
+    }
+
+    //!\brief Returns the matrix coordinate where the trace ends.
+    matrix_coordinate end_position() const noexcept
+    {
+        matrix_coordinate end = begin_coordinate;
+        for (auto const & [direction, count] : segments)
+        {
+            end.row += (direction != trace_directions::left) ? count : 0;
+            end.col += (direction != trace_directions::up) ? count : 0;
+        }
+        return end;
+    }
+
+    /*!\name Segment access
+     * \brief Iterates over the segments in the order from the begin to the end of the alignment.
+     * \{
+     */
+    //!\brief Returns an iterator to the first segment.
+    auto begin() const noexcept
+    {
+        return segments.begin();
+    }
+
+    //!\brief Returns an iterator behind the last segment.
+    auto end() const noexcept
+    {
+        return segments.end();
+    }
+
+    //!\brief Returns the number of segments.
+    size_t size() const noexcept
+    {
+        return segments.size();
+    }
+    //!\}
+
+    /*!\brief Returns a path over the recorded trace starting at the given end position.
+     * \param[in] trace_end The matrix coordinate where the trace ends; must be equal to
+     *                      seqan3::detail::trace_segments::end_position.
+     *
+     * \returns A std::ranges::subrange over the trace directions from the end to the begin of the trace.
+     */
+    auto trace_path([[maybe_unused]] matrix_coordinate const & trace_end) const noexcept
+    {
+        assert(trace_end.row == end_position().row);
+        assert(trace_end.col == end_position().col);
+
+        return std::ranges::subrange<path_iterator, std::default_sentinel_t>{path_iterator{*this},
+                                                                             std::default_sentinel};
+    }
+};
+
+} // namespace seqan3::detail
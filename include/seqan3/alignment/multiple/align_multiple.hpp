@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::align_multiple.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/alignment/configuration/align_config_score_type.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/decorator/gap_decorator.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/multiple/detail/distance_matrix.hpp>
+#include <seqan3/alignment/multiple/detail/guide_tree.hpp>
+#include <seqan3/alignment/multiple/detail/progressive_alignment.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+namespace seqan3
+{
+
+/*!\brief The method that builds the guide tree of seqan3::align_multiple.
+ * \ingroup alignment_multiple
+ */
+enum class guide_tree_method : uint8_t
+{
+    //!\brief The unweighted pair group method with arithmetic mean; \f$O(n^2)\f$ time.
+    upgma,
+    //!\brief Neighbour joining; \f$O(n^3)\f$ time, but does not assume a constant rate of evolution.
+    neighbour_joining
+};
+
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+/*!\brief Whether the configuration only consists of elements that are supported by seqan3::align_multiple.
+ * \ingroup alignment_multiple
+ */
+template <typename configuration_t>
+inline constexpr bool is_multiple_alignment_configuration = false;
+
+//!\cond
+template <typename... configs_t>
+inline constexpr bool is_multiple_alignment_configuration<configuration<configs_t...>> =
+    ((configs_t::id == align_config_id::global || configs_t::id == align_config_id::scoring
+      || configs_t::id == align_config_id::gap || configs_t::id == align_config_id::parallel)
+     && ...);
+//!\endcond
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief Computes a progressive multiple sequence alignment.
+ * \ingroup alignment_multiple
+ *
+ * \tparam sequences_t The type of the sequences; must model std::ranges::random_access_range and
+ *                     std::ranges::sized_range over sequences that can be wrapped in a seqan3::gap_decorator.
+ * \tparam config_t The type of the configuration; must be a seqan3::configuration.
+ *
+ * \param[in] sequences The sequences to align.
+ * \param[in] config The configuration.
+ * \param[in] method The seqan3::guide_tree_method [default: seqan3::guide_tree_method::upgma].
+ * \returns A std::vector with one seqan3::gap_decorator per sequence, in the order of the sequences.
+ *
+ * \throws seqan3::invalid_alignment_configuration if free end gaps are configured.
+ * \throws std::runtime_error if seqan3::align_cfg::parallel is given without a thread count.
+ *
+ * \details
+ *
+ * The multiple alignment is built in three stages:
+ *
+ *  1. The global alignment scores of all pairs of sequences are computed with seqan3::align_pairwise over
+ *     seqan3::views::pairwise_combine and turned into distances by normalising them with the scores of the sequences
+ *     aligned to themselves.
+ *  2. A guide tree is built from the distances, either with UPGMA or with neighbour joining.
+ *  3. Following the guide tree from the leaves to the root, the alignments of the two children of every node are
+ *     aligned to each other with an affine profile–profile alignment. Gaps that are inserted once are never removed.
+ *
+ * The configuration must contain a seqan3::align_cfg::scoring_scheme and a seqan3::align_cfg::gap_cost_affine. It may
+ * contain seqan3::align_cfg::method_global without free end gaps and seqan3::align_cfg::parallel; no other
+ * configuration elements are supported. With seqan3::align_cfg::parallel every stage uses the given number of
+ * threads: the pairwise alignments are distributed over the threads, the neighbour-joining search is split by rows
+ * and independent subtrees of the guide tree are aligned at the same time.
+ *
+ * The returned rows refer to the given sequences, which must outlive the rows.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/multiple/align_multiple.cpp
+ */
+template <std::ranges::random_access_range sequences_t, typename config_t>
+    requires std::ranges::sized_range<sequences_t>
+          && writable_semialphabet<std::ranges::range_value_t<std::ranges::range_reference_t<sequences_t const &>>>
+auto align_multiple(sequences_t const & sequences,
+                    config_t const & config,
+                    guide_tree_method const method = guide_tree_method::upgma)
+{
+    static_assert(detail::is_multiple_alignment_configuration<config_t>,
+                  "align_multiple only supports the configuration elements align_cfg::method_global, "
+                  "align_cfg::scoring_scheme, align_cfg::gap_cost_affine and align_cfg::parallel.");
+    static_assert(config_t::template exists<align_cfg::scoring_scheme>(),
+                  "align_multiple requires an align_cfg::scoring_scheme.");
+    static_assert(config_t::template exists<align_cfg::gap_cost_affine>(),
+                  "align_multiple requires an align_cfg::gap_cost_affine.");
+
+    using alphabet_t = std::ranges::range_value_t<std::ranges::range_reference_t<sequences_t const &>>;
+    using row_t = decltype(gap_decorator{std::declval<std::ranges::range_reference_t<sequences_t const &>>()});
+
+    align_cfg::method_global const method_config = config.get_or(align_cfg::method_global{});
+    if (method_config.free_end_gaps_sequence1_leading || method_config.free_end_gaps_sequence2_leading
+        || method_config.free_end_gaps_sequence1_trailing || method_config.free_end_gaps_sequence2_trailing)
+        throw invalid_alignment_configuration{"align_multiple does not support free end gaps."};
+
+    std::optional<uint32_t> const thread_count = config.get_or(align_cfg::parallel{1u}).thread_count;
+    if (!thread_count)
+        throw std::runtime_error{"You must configure the number of threads in seqan3::align_cfg::parallel."};
+
+    auto const & scoring_config = get<align_cfg::scoring_scheme>(config);
+    auto const & gap_config = get<align_cfg::gap_cost_affine>(config);
+
+    std::vector<row_t> rows{};
+    rows.reserve(std::ranges::size(sequences));
+    for (auto && sequence : sequences)
+        rows.emplace_back(sequence);
+
+    if (rows.size() < 2u)
+        return rows;
+
+    detail::distance_matrix distances =
+        detail::compute_distance_matrix(sequences, scoring_config, gap_config, *thread_count);
+
+    detail::guide_tree const tree = (method == guide_tree_method::upgma)
+                                      ? detail::upgma_guide_tree(std::move(distances))
+                                      : detail::neighbour_joining_guide_tree(std::move(distances), *thread_count);
+
+    auto const profile_config =
+        align_cfg::method_global{} | scoring_config | gap_config | align_cfg::score_type<float>{};
+    detail::progressive_alignment<alphabet_t>(rows, tree, profile_config, *thread_count);
+
+    return rows;
+}
+
+} // namespace seqan3
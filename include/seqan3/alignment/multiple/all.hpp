@@ -0,0 +1,28 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Meta-header for the \link alignment_multiple Alignment / Multiple submodule \endlink.
+ */
+
+/*!\defgroup alignment_multiple Multiple Alignments
+ * \ingroup alignment
+ * \brief Provides the computation of progressive multiple sequence alignments.
+ *
+ * \details
+ *
+ * A multiple sequence alignment of many sequences is computed with the free function seqan3::align_multiple. It
+ * computes the distances of all pairs of sequences with seqan3::align_pairwise, builds a guide tree from the distances
+ * and aligns the sequences progressively along the guide tree with affine profile–profile alignments. The result is
+ * a seqan3::gap_decorator per sequence.
+ *
+ * \include test/snippet/alignment/multiple/align_multiple.cpp
+ *
+ * \see alignment
+ * \see alignment_pairwise
+ */
+
+#pragma once
+
+#include <seqan3/alignment/multiple/align_multiple.hpp>
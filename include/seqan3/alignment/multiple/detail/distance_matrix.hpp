@@ -0,0 +1,174 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::distance_matrix and seqan3::detail::compute_distance_matrix.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/core/algorithm/detail/parallel_for.hpp>
+#include <seqan3/utility/views/pairwise_combine.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A symmetric matrix of pairwise distances with a zero diagonal.
+ * \ingroup alignment_multiple
+ *
+ * \details
+ *
+ * Only the entries above the diagonal are stored, row by row. This is the order in which
+ * seqan3::views::pairwise_combine enumerates the pairs of a range, such that the id of a sequence pair computed with
+ * seqan3::align_pairwise is the index of its distance in the storage.
+ */
+class distance_matrix
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    distance_matrix() = default;                                    //!< Defaulted.
+    distance_matrix(distance_matrix const &) = default;             //!< Defaulted.
+    distance_matrix(distance_matrix &&) = default;                  //!< Defaulted.
+    distance_matrix & operator=(distance_matrix const &) = default; //!< Defaulted.
+    distance_matrix & operator=(distance_matrix &&) = default;      //!< Defaulted.
+    ~distance_matrix() = default;                                   //!< Defaulted.
+
+    /*!\brief Constructs a matrix of the given dimension with all distances set to `0`.
+     * \param[in] dimension The number of rows and columns.
+     */
+    explicit distance_matrix(size_t const dimension) :
+        matrix_dimension{dimension},
+        storage(dimension * (std::max<size_t>(dimension, 1u) - 1) / 2)
+    {}
+    //!\}
+
+    //!\brief Returns the number of rows and columns.
+    size_t dimension() const noexcept
+    {
+        return matrix_dimension;
+    }
+
+    //!\brief Returns the distance between `i` and `j`; both must be smaller than the dimension.
+    float operator()(size_t const i, size_t const j) const noexcept
+    {
+        return (i == j) ? 0.0f : storage[index_of(i, j)];
+    }
+
+    //!\brief Returns a reference to the distance between `i` and `j`; `i` and `j` must differ.
+    float & at(size_t const i, size_t const j) noexcept
+    {
+        assert(i != j);
+        return storage[index_of(i, j)];
+    }
+
+    //!\brief Returns the distance of the `index`-th pair enumerated by seqan3::views::pairwise_combine.
+    float & operator[](size_t const index) noexcept
+    {
+        assert(index < storage.size());
+        return storage[index];
+    }
+
+private:
+    //!\brief Returns the storage index of the pair `(i, j)`.
+    size_t index_of(size_t i, size_t j) const noexcept
+    {
+        assert(i < matrix_dimension && j < matrix_dimension && i != j);
+
+        if (i > j)
+            std::swap(i, j);
+
+        // Row i starts after the (dimension - 1) + ... + (dimension - i) entries of the rows above.
+        return i * (2 * matrix_dimension - i - 1) / 2 + (j - i - 1);
+    }
+
+    //!\brief The number of rows and columns.
+    size_t matrix_dimension{};
+    //!\brief The distances above the diagonal.
+    std::vector<float> storage{};
+};
+
+/*!\brief Computes the distances between all pairs of sequences.
+ * \ingroup alignment_multiple
+ *
+ * \tparam sequences_t The type of the sequences; must model std::ranges::random_access_range.
+ * \tparam scoring_config_t The type of the scoring scheme configuration.
+ * \tparam gap_config_t The type of the gap cost configuration.
+ *
+ * \param[in] sequences The sequences.
+ * \param[in] scoring_config The seqan3::align_cfg::scoring_scheme.
+ * \param[in] gap_config The seqan3::align_cfg::gap_cost_affine.
+ * \param[in] thread_count The number of threads.
+ * \returns The seqan3::detail::distance_matrix of the sequences.
+ *
+ * \details
+ *
+ * The global alignment scores of all pairs are computed with a vectorised and parallel seqan3::align_pairwise over
+ * seqan3::views::pairwise_combine. The score \f$S(a, b)\f$ is normalised by the mean of the scores of the sequences
+ * aligned to themselves, i.e. the distance is \f$\max(0, 1 - S(a, b) / \bar{S})\f$ with
+ * \f$\bar{S} = \max(1, (S(a, a) + S(b, b)) / 2)\f$. Identical sequences have the distance `0`, unrelated sequences
+ * a distance around `1` and sequences that can only be aligned with many gaps a distance above `1`.
+ */
+template <std::ranges::random_access_range sequences_t, typename scoring_config_t, typename gap_config_t>
+distance_matrix compute_distance_matrix(sequences_t && sequences,
+                                        scoring_config_t const & scoring_config,
+                                        gap_config_t const & gap_config,
+                                        uint32_t const thread_count)
+{
+    size_t const sequence_count = std::ranges::distance(sequences);
+    distance_matrix distances{sequence_count};
+
+    if (sequence_count < 2u)
+        return distances;
+
+    // The score of every sequence aligned to itself.
+    std::vector<float> self_scores(sequence_count);
+    parallel_for(sequence_count,
+                 thread_count,
+                 [&](size_t const index)
+                 {
+                     float score = 0;
+                     for (auto const & symbol : std::ranges::begin(sequences)[index])
+                         score += scoring_config.scheme.score(symbol, symbol);
+                     self_scores[index] = score;
+                 });
+
+    auto const distance_config = align_cfg::method_global{} | scoring_config | gap_config
+                               | align_cfg::output_score{} | align_cfg::output_sequence1_id{}
+                               | align_cfg::vectorised{} | align_cfg::parallel{thread_count};
+
+    // The index of the first pair of every row, to find the two sequences of a pair by its id.
+    std::vector<size_t> row_begin(sequence_count);
+    for (size_t i = 1; i < sequence_count; ++i)
+        row_begin[i] = row_begin[i - 1] + (sequence_count - i);
+
+    for (auto && result : align_pairwise(views::pairwise_combine(sequences), distance_config))
+    {
+        size_t const id = result.sequence1_id();
+        size_t const i = std::ranges::upper_bound(row_begin, id) - row_begin.begin() - 1;
+        size_t const j = i + 1 + (id - row_begin[i]);
+        float const normaliser = std::max(1.0f, (self_scores[i] + self_scores[j]) / 2);
+        distances[id] = std::max(0.0f, 1.0f - result.score() / normaliser);
+    }
+
+    return distances;
+}
+
+} // namespace seqan3::detail
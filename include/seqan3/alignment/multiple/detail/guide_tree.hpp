@@ -0,0 +1,216 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::guide_tree and the UPGMA and neighbour-joining tree construction.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/multiple/detail/distance_matrix.hpp>
+#include <seqan3/core/algorithm/detail/parallel_for.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A rooted binary tree that determines the order in which a multiple sequence alignment is built.
+ * \ingroup alignment_multiple
+ *
+ * \details
+ *
+ * The leaves `0, ..., leaf_count - 1` are the sequences. The `i`-th join creates the inner node `leaf_count + i`
+ * with the two given children, which are always created before their parent. The last join is the root.
+ */
+struct guide_tree
+{
+    //!\brief The number of leaves.
+    size_t leaf_count{};
+    //!\brief The children of the inner nodes in the order of their creation.
+    std::vector<std::pair<size_t, size_t>> joins{};
+};
+
+/*!\brief Builds the guide tree with the unweighted pair group method with arithmetic mean (UPGMA).
+ * \ingroup alignment_multiple
+ *
+ * \param[in] distances The distances between the sequences.
+ * \returns The seqan3::detail::guide_tree.
+ *
+ * \details
+ *
+ * The two clusters with the smallest average distance are joined until a single cluster remains. Instead of searching
+ * the whole matrix for every join, the nearest-neighbour chain algorithm follows the nearest neighbours from an
+ * arbitrary cluster until two clusters are their mutual nearest neighbours. Since UPGMA never decreases the distance
+ * of a cluster to a join of two other clusters, such a pair can always be joined and the rest of the chain stays
+ * valid. Hence, the tree is built in \f$O(n^2)\f$ time instead of \f$O(n^3)\f$.
+ */
+inline guide_tree upgma_guide_tree(distance_matrix distances)
+{
+    size_t const leaf_count = distances.dimension();
+    guide_tree tree{leaf_count, {}};
+
+    std::vector<size_t> cluster_size(leaf_count, 1u);
+    std::vector<size_t> node_id(leaf_count);
+    std::iota(node_id.begin(), node_id.end(), 0u);
+    std::vector<bool> is_active(leaf_count, true);
+
+    std::vector<size_t> chain{};
+    size_t first_active = 0;
+
+    for (size_t join = 0; join + 1 < leaf_count; ++join)
+    {
+        if (chain.empty())
+        {
+            for (; !is_active[first_active]; ++first_active)
+            {}
+            chain.push_back(first_active);
+        }
+
+        // Follow the nearest neighbours. Ties are resolved in favour of the previous cluster in the chain.
+        while (true)
+        {
+            size_t const current = chain.back();
+            size_t nearest = (chain.size() > 1u) ? chain[chain.size() - 2] : leaf_count;
+            float nearest_distance =
+                (nearest < leaf_count) ? distances(current, nearest) : std::numeric_limits<float>::infinity();
+
+            for (size_t other = 0; other < leaf_count; ++other)
+            {
+                if (is_active[other] && other != current && distances(current, other) < nearest_distance)
+                {
+                    nearest = other;
+                    nearest_distance = distances(current, other);
+                }
+            }
+
+            if (chain.size() > 1u && nearest == chain[chain.size() - 2])
+                break;
+
+            chain.push_back(nearest);
+        }
+
+        size_t const first = chain.back();
+        chain.pop_back();
+        size_t const second = chain.back();
+        chain.pop_back();
+
+        // The joined cluster takes the place of the first one.
+        for (size_t other = 0; other < leaf_count; ++other)
+        {
+            if (is_active[other] && other != first && other != second)
+            {
+                distances.at(first, other) = (cluster_size[first] * distances(first, other)
+                                              + cluster_size[second] * distances(second, other))
+                                           / (cluster_size[first] + cluster_size[second]);
+            }
+        }
+
+        tree.joins.emplace_back(node_id[first], node_id[second]);
+        node_id[first] = leaf_count + join;
+        cluster_size[first] += cluster_size[second];
+        is_active[second] = false;
+    }
+
+    return tree;
+}
+
+/*!\brief Builds the guide tree with the neighbour-joining method.
+ * \ingroup alignment_multiple
+ *
+ * \param[in] distances The distances between the sequences.
+ * \param[in] thread_count The number of threads that search the next pair to join.
+ * \returns The seqan3::detail::guide_tree.
+ *
+ * \details
+ *
+ * In contrast to UPGMA, neighbour joining does not assume that all sequences evolve at the same rate. The pair
+ * \f$(i, j)\f$ that minimises \f$(m - 2) d(i, j) - r_i - r_j\f$ is joined, where \f$m\f$ is the number of remaining
+ * clusters and \f$r_i\f$ the sum of the distances of \f$i\f$ to all remaining clusters. The new cluster \f$u\f$ has
+ * the distance \f$(d(i, k) + d(j, k) - d(i, j)) / 2\f$ to every other cluster \f$k\f$. The tree is rooted at the last
+ * join.
+ *
+ * Every join searches all pairs of remaining clusters, such that the tree is built in \f$O(n^3)\f$ time. The rows of
+ * the search are distributed over the threads; the result does not depend on the number of threads.
+ */
+inline guide_tree neighbour_joining_guide_tree(distance_matrix distances, uint32_t const thread_count)
+{
+    size_t const leaf_count = distances.dimension();
+    guide_tree tree{leaf_count, {}};
+
+    if (leaf_count < 2u)
+        return tree;
+
+    std::vector<size_t> active(leaf_count);
+    std::iota(active.begin(), active.end(), 0u);
+    std::vector<size_t> node_id = active;
+
+    std::vector<double> distance_sum(leaf_count);
+    for (size_t i = 0; i < leaf_count; ++i)
+        for (size_t j = 0; j < leaf_count; ++j)
+            distance_sum[i] += distances(i, j);
+
+    // The best partner of every row of the search.
+    std::vector<std::pair<double, size_t>> row_minimum(leaf_count);
+    size_t const min_rows_per_thread = 256;
+
+    while (active.size() > 2u)
+    {
+        size_t const cluster_count = active.size();
+        double const factor = cluster_count - 2;
+
+        parallel_for(cluster_count,
+                     (cluster_count >= min_rows_per_thread) ? thread_count : 1u,
+                     [&](size_t const p)
+                     {
+                         size_t const i = active[p];
+                         std::pair<double, size_t> best{std::numeric_limits<double>::infinity(), cluster_count};
+                         for (size_t q = p + 1; q < cluster_count; ++q)
+                         {
+                             size_t const j = active[q];
+                             double const value = factor * distances(i, j) - distance_sum[i] - distance_sum[j];
+                             if (value < best.first)
+                                 best = {value, q};
+                         }
+                         row_minimum[p] = best;
+                     });
+
+        size_t best_p = 0;
+        for (size_t p = 1; p + 1 < cluster_count; ++p)
+            if (row_minimum[p].first < row_minimum[best_p].first)
+                best_p = p;
+
+        size_t const best_q = row_minimum[best_p].second;
+        size_t const first = active[best_p];
+        size_t const second = active[best_q];
+        float const joined_distance = distances(first, second);
+
+        // The joined cluster takes the place of the first one.
+        distance_sum[first] = 0;
+        for (size_t const other : active)
+        {
+            if (other == first || other == second)
+                continue;
+
+            float const new_distance = (distances(first, other) + distances(second, other) - joined_distance) / 2;
+            distance_sum[other] += new_distance - distances(first, other) - distances(second, other);
+            distance_sum[first] += new_distance;
+            distances.at(first, other) = new_distance;
+        }
+
+        tree.joins.emplace_back(node_id[first], node_id[second]);
+        node_id[first] = leaf_count + tree.joins.size() - 1;
+        active.erase(active.begin() + best_q);
+    }
+
+    tree.joins.emplace_back(node_id[active[0]], node_id[active[1]]);
+    return tree;
+}
+
+} // namespace seqan3::detail
@@ -0,0 +1,309 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::profile_alignment_algorithm and seqan3::detail::progressive_alignment.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/cigar_from_trace_path.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/matrix/detail/trace_iterator.hpp>
+#include <seqan3/alignment/matrix/detail/two_dimensional_matrix.hpp>
+#include <seqan3/alignment/multiple/detail/guide_tree.hpp>
+#include <seqan3/alignment/pairwise/detail/policy_affine_gap_with_trace_recursion.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/gap/gap.hpp>
+#include <seqan3/core/algorithm/detail/parallel_for.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Aligns two groups of already aligned sequences to each other.
+ * \ingroup alignment_multiple
+ *
+ * \tparam alignment_configuration_t The type of the alignment configuration; must contain the scoring scheme and the
+ *                                   gap costs and select `float` as score type.
+ * \tparam alphabet_t The alphabet of the sequences; must model seqan3::writable_semialphabet.
+ *
+ * \details
+ *
+ * Each group is summarised by its profile, i.e. the frequency of every symbol in every column. Two columns are
+ * scored with the average score of all pairs of symbols, such that the alignment of two profiles with one row each
+ * is the ordinary pairwise alignment. Gaps within the profiles are not scored. To make the score of a pair of columns
+ * cheap, the columns of the first profile are stored as lists of their symbols and the columns of the second profile
+ * store the average score of every symbol against the column. Scoring a cell then costs one operation per distinct
+ * symbol of the column of the first profile.
+ *
+ * The recursion and the trace are computed by seqan3::detail::policy_affine_gap_with_trace_recursion, i.e. the same
+ * affine recursion as in seqan3::align_pairwise, and the trace path is converted with
+ * seqan3::detail::cigar_from_trace_path. The profiles are global alignments with penalised end gaps.
+ */
+template <typename alignment_configuration_t, writable_semialphabet alphabet_t>
+class profile_alignment_algorithm : protected policy_affine_gap_with_trace_recursion<alignment_configuration_t>
+{
+private:
+    //!\brief The type of the affine recursion policy.
+    using recursion_policy_t = policy_affine_gap_with_trace_recursion<alignment_configuration_t>;
+    //!\brief The type of the cells of the alignment matrix.
+    using cell_type = typename recursion_policy_t::affine_cell_type;
+
+    static_assert(std::same_as<typename recursion_policy_t::score_type, float>,
+                  "The profile alignment must be configured with align_cfg::score_type<float>.");
+
+    //!\brief The size of the alphabet.
+    static constexpr size_t sigma = alphabet_size<alphabet_t>;
+
+    //!\brief The score of every pair of symbols.
+    std::vector<float> symbol_scores{};
+    //!\brief The number of occurrences of every symbol in every column of a profile.
+    std::vector<uint32_t> symbol_counts{};
+    //!\brief The symbols of the columns of the first profile and their frequencies.
+    std::vector<std::pair<uint32_t, float>> sparse_profile{};
+    //!\brief The begin of every column of the first profile in seqan3::detail::sparse_profile.
+    std::vector<size_t> sparse_column_begin{};
+    //!\brief The average score of every symbol against every column of the second profile.
+    std::vector<float> score_profile{};
+    //!\brief The current column of the alignment matrix.
+    std::vector<cell_type> column{};
+    //!\brief The buffer for the alignment operations.
+    std::vector<cigar> operations{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    profile_alignment_algorithm() = default;                                                //!< Defaulted.
+    profile_alignment_algorithm(profile_alignment_algorithm const &) = default;             //!< Defaulted.
+    profile_alignment_algorithm(profile_alignment_algorithm &&) = default;                  //!< Defaulted.
+    profile_alignment_algorithm & operator=(profile_alignment_algorithm const &) = default; //!< Defaulted.
+    profile_alignment_algorithm & operator=(profile_alignment_algorithm &&) = default;      //!< Defaulted.
+    ~profile_alignment_algorithm() = default;                                               //!< Defaulted.
+
+    /*!\brief Initialises the gap costs and the symbol scores from the configuration.
+     * \param[in] config The alignment configuration.
+     */
+    explicit profile_alignment_algorithm(alignment_configuration_t const & config) :
+        recursion_policy_t{config},
+        symbol_scores(sigma * sigma)
+    {
+        auto const & scheme = get<align_cfg::scoring_scheme>(config).scheme;
+        for (size_t x = 0; x < sigma; ++x)
+            for (size_t y = 0; y < sigma; ++y)
+                symbol_scores[x * sigma + y] =
+                    scheme.score(assign_rank_to(x, alphabet_t{}), assign_rank_to(y, alphabet_t{}));
+    }
+    //!\}
+
+    /*!\brief Aligns two groups of rows and inserts the gap columns into the rows.
+     * \tparam row_t The type of the rows; must be a seqan3::gap_decorator.
+     * \param[in,out] rows All rows of the multiple alignment.
+     * \param[in] group1 The indices of the rows of the first group; all rows must have the same size.
+     * \param[in] group2 The indices of the rows of the second group; all rows must have the same size.
+     */
+    template <typename row_t>
+    void align(std::vector<row_t> & rows, std::vector<size_t> const & group1, std::vector<size_t> const & group2)
+    {
+        // The smaller group has fewer distinct symbols per column and is the cheaper first profile.
+        std::vector<size_t> const & first = (group1.size() <= group2.size()) ? group1 : group2;
+        std::vector<size_t> const & second = (group1.size() <= group2.size()) ? group2 : group1;
+
+        size_t const first_size = rows[first[0]].size();
+        size_t const second_size = rows[second[0]].size();
+
+        count_symbols(rows, first);
+        sparse_column_begin.assign(1, 0u);
+        sparse_profile.clear();
+        for (size_t column_index = 0; column_index < first_size; ++column_index)
+        {
+            for (size_t x = 0; x < sigma; ++x)
+                if (uint32_t const count = symbol_counts[column_index * sigma + x]; count != 0u)
+                    sparse_profile.emplace_back(x, static_cast<float>(count) / first.size());
+
+            sparse_column_begin.push_back(sparse_profile.size());
+        }
+
+        count_symbols(rows, second);
+        score_profile.assign(second_size * sigma, 0.0f);
+        for (size_t column_index = 0; column_index < second_size; ++column_index)
+        {
+            float * profile_column = score_profile.data() + column_index * sigma;
+            for (size_t y = 0; y < sigma; ++y)
+            {
+                if (uint32_t const count = symbol_counts[column_index * sigma + y]; count != 0u)
+                {
+                    float const frequency = static_cast<float>(count) / second.size();
+                    for (size_t x = 0; x < sigma; ++x)
+                        profile_column[x] += frequency * symbol_scores[x * sigma + y];
+                }
+            }
+        }
+
+        compute_trace(first_size, second_size);
+
+        // A step up ('I') consumes a column of the second profile only, a step to the left ('D') of the first one.
+        size_t position = 0;
+        for (cigar const & operation : operations)
+        {
+            uint32_t const count = get<0>(operation);
+            if (get<1>(operation) == 'I'_cigar_operation)
+            {
+                for (size_t const row_index : first)
+                    rows[row_index].insert_gap(rows[row_index].begin() + position, count);
+            }
+            else if (get<1>(operation) == 'D'_cigar_operation)
+            {
+                for (size_t const row_index : second)
+                    rows[row_index].insert_gap(rows[row_index].begin() + position, count);
+            }
+
+            position += count;
+        }
+    }
+
+private:
+    //!\brief Counts the symbols in every column of the given rows.
+    template <typename row_t>
+    void count_symbols(std::vector<row_t> const & rows, std::vector<size_t> const & group)
+    {
+        symbol_counts.assign(rows[group[0]].size() * sigma, 0u);
+        for (size_t const row_index : group)
+        {
+            uint32_t * column_counts = symbol_counts.data();
+            for (auto const symbol : rows[row_index])
+            {
+                if (symbol != gap{})
+                    ++column_counts[to_rank(symbol)];
+
+                column_counts += sigma;
+            }
+        }
+    }
+
+    //!\brief Computes the alignment matrix of the two profiles and stores the trace path in the operations buffer.
+    void compute_trace(size_t const first_size, size_t const second_size)
+    {
+        // The columns of the matrix are the columns of the first profile.
+        two_dimensional_matrix<trace_directions, std::allocator<trace_directions>, matrix_major_order::column> trace{
+            number_rows{second_size + 1},
+            number_cols{first_size + 1}};
+        auto trace_at = [&](size_t const row, size_t const col) -> trace_directions &
+        {
+            return trace[matrix_coordinate{row_index_type{row}, column_index_type{col}}];
+        };
+
+        column.resize(second_size + 1);
+        column[0] = this->initialise_origin_cell();
+        trace_at(0, 0) = column[0].best_trace();
+        for (size_t row = 1; row <= second_size; ++row)
+        {
+            column[row] = this->initialise_first_column_cell(column[row - 1]);
+            trace_at(row, 0) = column[row].best_trace();
+        }
+
+        for (size_t col = 1; col <= first_size; ++col)
+        {
+            auto const sparse_first = sparse_profile.begin() + sparse_column_begin[col - 1];
+            auto const sparse_last = sparse_profile.begin() + sparse_column_begin[col];
+
+            float diagonal = column[0].best_score();
+            column[0] = this->initialise_first_row_cell(column[0]);
+            trace_at(0, col) = column[0].best_trace();
+
+            for (size_t row = 1; row <= second_size; ++row)
+            {
+                float const * profile_column = score_profile.data() + (row - 1) * sigma;
+                float column_score = 0;
+                for (auto it = sparse_first; it != sparse_last; ++it)
+                    column_score += it->second * profile_column[it->first];
+
+                // The horizontal values come from the previous column, the vertical ones from the cell above.
+                cell_type previous_cell = column[row];
+                previous_cell.vertical_score() = column[row - 1].vertical_score();
+                previous_cell.vertical_trace() = column[row - 1].vertical_trace();
+
+                float const next_diagonal = column[row].best_score();
+                column[row] = this->compute_inner_cell(diagonal, previous_cell, column_score);
+                trace_at(row, col) = column[row].best_trace();
+                diagonal = next_diagonal;
+            }
+        }
+
+        matrix_offset const end{row_index_type{static_cast<std::ptrdiff_t>(second_size)},
+                                column_index_type{static_cast<std::ptrdiff_t>(first_size)}};
+        using trace_iterator_t = decltype(trace_iterator{trace.begin() + end});
+        cigar_from_trace_path(std::ranges::subrange<trace_iterator_t, std::default_sentinel_t>{
+                                  trace_iterator{trace.begin() + end},
+                                  std::default_sentinel},
+                              operations);
+    }
+};
+
+/*!\brief Aligns the rows progressively along the guide tree.
+ * \ingroup alignment_multiple
+ *
+ * \tparam alphabet_t The alphabet of the sequences; must model seqan3::writable_semialphabet.
+ * \tparam alignment_configuration_t The type of the configuration of the seqan3::detail::profile_alignment_algorithm.
+ * \tparam row_t The type of the rows; must be a seqan3::gap_decorator.
+ *
+ * \param[in,out] rows The rows, one per leaf of the tree.
+ * \param[in] tree The seqan3::detail::guide_tree.
+ * \param[in] config The configuration of the seqan3::detail::profile_alignment_algorithm.
+ * \param[in] thread_count The number of threads.
+ *
+ * \details
+ *
+ * Every inner node aligns the alignments of its two children. The inner nodes are grouped by their height in the tree,
+ * such that all nodes of one height only depend on nodes of smaller heights and touch disjoint sets of rows. The nodes
+ * of one height are distributed over the threads.
+ */
+template <writable_semialphabet alphabet_t, typename alignment_configuration_t, typename row_t>
+void progressive_alignment(std::vector<row_t> & rows,
+                           guide_tree const & tree,
+                           alignment_configuration_t const & config,
+                           uint32_t const thread_count)
+{
+    size_t const leaf_count = tree.leaf_count;
+
+    std::vector<std::vector<size_t>> members(leaf_count + tree.joins.size());
+    for (size_t leaf = 0; leaf < leaf_count; ++leaf)
+        members[leaf].push_back(leaf);
+
+    std::vector<size_t> height(leaf_count + tree.joins.size());
+    std::vector<std::vector<size_t>> nodes_by_height{};
+    for (size_t join = 0; join < tree.joins.size(); ++join)
+    {
+        size_t const node = leaf_count + join;
+        height[node] = 1 + std::max(height[tree.joins[join].first], height[tree.joins[join].second]);
+        nodes_by_height.resize(std::max(nodes_by_height.size(), height[node]));
+        nodes_by_height[height[node] - 1].push_back(node);
+    }
+
+    for (std::vector<size_t> const & nodes : nodes_by_height)
+    {
+        parallel_for(nodes.size(),
+                     thread_count,
+                     [&](size_t const index)
+                     {
+                         size_t const node = nodes[index];
+                         auto const [left, right] = tree.joins[node - leaf_count];
+
+                         profile_alignment_algorithm<alignment_configuration_t, alphabet_t> algorithm{config};
+                         algorithm.align(rows, members[left], members[right]);
+
+                         members[node] = std::move(members[left]);
+                         members[node].insert(members[node].end(), members[right].begin(), members[right].end());
+                         members[right].clear();
+                     });
+    }
+}
+
+} // namespace seqan3::detail
@@ -12,6 +12,7 @@
 #include <optional>
 #include <ranges>
 #include <type_traits>
+#include <vector>
 
 #include <seqan3/alignment/configuration/align_config_debug.hpp>
 #include <seqan3/alignment/decorator/gap_decorator.hpp>
@@ -20,6 +21,7 @@
 #include <seqan3/alignment/matrix/detail/trace_directions.hpp>
 #include <seqan3/alignment/matrix/detail/two_dimensional_matrix.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/cigar/cigar.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
 #include <seqan3/core/configuration/configuration.hpp>
 #include <seqan3/core/detail/template_inspection.hpp>
@@ -87,6 +89,9 @@ private:
                            debug_trace_matrix_type,
                            disabled_type>;
 
+    //!\brief The configured CIGAR type if selected.
+    using configured_cigar_type = std::conditional_t<traits_type::compute_cigar, std::vector<cigar>, disabled_type>;
+
 public:
     //!\brief The selected result type.
     using type = alignment_result_value_type<configured_sequence1_id_type,
@@ -96,7 +101,8 @@ public:
                                              configured_begin_position_type,
                                              configured_alignment_type,
                                              configured_debug_score_matrix_type,
-                                             configured_debug_trace_matrix_type>;
+                                             configured_debug_trace_matrix_type,
+                                             configured_cigar_type>;
 };
 
 } // namespace seqan3::detail
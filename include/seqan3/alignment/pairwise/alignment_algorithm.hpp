@@ -19,6 +19,8 @@
 #include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
 #include <seqan3/alignment/exception.hpp>
 #include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/matrix/detail/cigar_from_trace_path.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_concept.hpp>
 #include <seqan3/alignment/matrix/detail/trace_directions.hpp>
 #include <seqan3/alignment/pairwise/align_result_selector.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
@@ -234,6 +236,7 @@ public:
         compute_matrix(simd_sequences1, simd_sequences2);
 
         make_alignment_result(indexed_sequence_pairs, callback);
+        this->release_matrix();
     }
     //!\}
 
@@ -305,13 +308,24 @@ private:
             auto && [subsequence1, subsequence2] = this->slice_sequences(sequence1, sequence2, band);
             // It would be great to use this interface here instead
             compute_matrix(subsequence1, subsequence2, band);
-            make_alignment_result(idx, subsequence1, subsequence2, callback);
+
+            if (reaches_min_score(this->alignment_state.optimum.score))
+                make_alignment_result(idx, subsequence1, subsequence2, callback);
+            else
+                make_min_score_unreachable_result(idx, sequence1, sequence2, callback);
         }
         else
         {
             compute_matrix(sequence1, sequence2);
-            make_alignment_result(idx, sequence1, sequence2, callback);
+
+            if (reaches_min_score(this->alignment_state.optimum.score))
+                make_alignment_result(idx, sequence1, sequence2, callback);
+            else
+                make_min_score_unreachable_result(idx, sequence1, sequence2, callback);
         }
+
+        // Hand the memory of the matrices back to this thread for the next alignment.
+        this->release_matrix();
     }
 
     /*!\brief Checks if the band parameters are valid for the given sequences.
@@ -633,22 +647,44 @@ private:
             }
         }
 
-        if constexpr (traits_t::compute_begin_positions)
+        if constexpr (traits_t::requires_trace_information)
         {
-            // Get a aligned sequence builder for banded or un-banded case.
-            aligned_sequence_builder builder{sequence1, sequence2};
-
             detail::matrix_coordinate const optimum_coordinate{
                 detail::row_index_type{this->alignment_state.optimum.row_index},
                 detail::column_index_type{this->alignment_state.optimum.column_index}};
-            auto trace_res = builder(this->trace_matrix.trace_path(optimum_coordinate));
-            res.begin_positions.first =
-                this->to_original_sequence1_position(trace_res.first_sequence_slice_positions.first);
-            res.begin_positions.second =
-                this->to_original_sequence2_position(trace_res.second_sequence_slice_positions.first);
-
-            if constexpr (traits_t::compute_sequence_alignment)
-                res.alignment = std::move(trace_res.alignment);
+
+            if constexpr (traits_t::compute_cigar)
+            {
+                // The operations are written directly into the buffer owned by the result.
+                detail::matrix_coordinate const begin_coordinate =
+                    cigar_from_trace_path(this->trace_matrix.trace_path(optimum_coordinate), res.cigar_sequence);
+
+                if constexpr (traits_t::compute_begin_positions)
+                {
+                    res.begin_positions.first = this->to_original_sequence1_position(begin_coordinate.col);
+                    res.begin_positions.second = this->to_original_sequence2_position(begin_coordinate.row);
+                }
+            }
+
+            // Unless the alignment is requested, the begin positions were already taken from the CIGAR string.
+            if constexpr (traits_t::compute_sequence_alignment
+                          || (traits_t::compute_begin_positions && !traits_t::compute_cigar))
+            {
+                // Get a aligned sequence builder for banded or un-banded case.
+                aligned_sequence_builder builder{sequence1, sequence2};
+
+                auto trace_res = builder(this->trace_matrix.trace_path(optimum_coordinate));
+                if constexpr (traits_t::compute_begin_positions)
+                {
+                    res.begin_positions.first =
+                        this->to_original_sequence1_position(trace_res.first_sequence_slice_positions.first);
+                    res.begin_positions.second =
+                        this->to_original_sequence2_position(trace_res.second_sequence_slice_positions.first);
+                }
+
+                if constexpr (traits_t::compute_sequence_alignment)
+                    res.alignment = std::move(trace_res.alignment);
+            }
         }
 
         // Store the matrices in debug mode.
@@ -696,7 +732,16 @@ private:
         size_t simd_index = 0;
         for (auto && [sequence_pairs, alignment_index] : index_sequence_pairs)
         {
-            (void)sequence_pairs;
+            if (!reaches_min_score(this->alignment_state.optimum.score[simd_index]))
+            {
+                make_min_score_unreachable_result(alignment_index,
+                                                  std::get<0>(sequence_pairs),
+                                                  std::get<1>(sequence_pairs),
+                                                  callback);
+                ++simd_index;
+                continue;
+            }
+
             result_value_t res{};
 
             if constexpr (traits_t::output_sequence1_id)
@@ -721,6 +766,75 @@ private:
         }
     }
 
+    /*!\brief Checks whether the given score reaches the minimal score of seqan3::align_cfg::min_score.
+     * \tparam score_t The type of the score.
+     * \param[in] score The score of the computed alignment.
+     * \returns `true` if no minimal score is configured or the score is not below it, `false` otherwise.
+     */
+    template <typename score_t>
+    bool reaches_min_score([[maybe_unused]] score_t const score) const noexcept
+    {
+        if constexpr (traits_t::has_min_score)
+            return score >= get<align_cfg::min_score>(*cfg_ptr).score;
+        else
+            return true;
+    }
+
+    /*!\brief Invokes the callback with the result of an alignment that does not reach the minimal score.
+     * \tparam index_t The type of the index.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::forward_range.
+     * \tparam callback_t The type of the callback function.
+     *
+     * \param[in] idx The index of the sequence pair.
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in] callback The callback function to be invoked with the alignment result.
+     *
+     * \details
+     *
+     * No traceback is computed. As for the edit distance, the score is set to seqan3::detail::matrix_inf and the
+     * begin and end positions are set to the sizes of the sequences.
+     */
+    template <typename index_t,
+              std::ranges::forward_range sequence1_t,
+              std::ranges::forward_range sequence2_t,
+              typename callback_t>
+    void make_min_score_unreachable_result([[maybe_unused]] index_t const idx,
+                                           sequence1_t && sequence1,
+                                           sequence2_t && sequence2,
+                                           callback_t & callback)
+    {
+        using result_value_t = typename alignment_result_value_type_accessor<alignment_result_t>::type;
+
+        size_t const sequence1_size = std::ranges::distance(sequence1);
+        size_t const sequence2_size = std::ranges::distance(sequence2);
+        result_value_t res{};
+
+        if constexpr (traits_t::output_sequence1_id)
+            res.sequence1_id = idx;
+
+        if constexpr (traits_t::output_sequence2_id)
+            res.sequence2_id = idx;
+
+        if constexpr (traits_t::compute_score)
+            res.score = matrix_inf<std::remove_cvref_t<decltype(res.score)>>;
+
+        if constexpr (traits_t::compute_end_positions)
+        {
+            res.end_positions.first = sequence1_size;
+            res.end_positions.second = sequence2_size;
+        }
+
+        if constexpr (traits_t::compute_begin_positions)
+        {
+            res.begin_positions.first = sequence1_size;
+            res.begin_positions.second = sequence2_size;
+        }
+
+        callback(std::move(res));
+    }
+
     /*!\brief Dumps the current alignment matrix in the debug score matrix and if requested debug trace matrix.
      *
      * \details
@@ -29,6 +29,11 @@
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_banded.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_anti_diagonal.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_linear_memory.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_parallel_tiles.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_wavefront.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_x_drop.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_affine_gap_recursion.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_affine_gap_recursion_banded.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_affine_gap_with_trace_recursion.hpp>
@@ -136,8 +141,7 @@ private:
     {
     private:
         //!\brief Indicates whether only the coordinate is required to compute the alignment.
-        static constexpr bool only_coordinates =
-            !(traits_t::compute_begin_positions || traits_t::compute_sequence_alignment);
+        static constexpr bool only_coordinates = !traits_t::requires_trace_information;
 
         //!\brief The selected score matrix for either banded or unbanded alignments.
         using score_matrix_t =
@@ -196,9 +200,23 @@ private:
 
     //!\brief Selects either the banded or the unbanded alignment algorithm based on the given traits type.
     template <typename traits_t, typename... args_t>
-    using select_alignment_algorithm_t = lazy_conditional_t<traits_t::is_banded,
-                                                            lazy<pairwise_alignment_algorithm_banded, args_t...>,
-                                                            lazy<pairwise_alignment_algorithm, args_t...>>;
+    using select_alignment_algorithm_t = lazy_conditional_t<
+        traits_t::is_wavefront,
+        lazy<pairwise_alignment_algorithm_wavefront, args_t...>,
+        lazy_conditional_t<
+            traits_t::is_parallel_tiles && !traits_t::requires_trace_information,
+            lazy<pairwise_alignment_algorithm_parallel_tiles, args_t...>,
+            lazy_conditional_t<
+                traits_t::is_vectorised_anti_diagonal && !traits_t::requires_trace_information,
+                lazy<pairwise_alignment_algorithm_anti_diagonal, args_t...>,
+                lazy_conditional_t<
+                    traits_t::is_extension && !traits_t::requires_trace_information,
+                    lazy<pairwise_alignment_algorithm_x_drop, args_t...>,
+                    lazy_conditional_t<traits_t::is_linear_memory && traits_t::requires_trace_information,
+                                       lazy<pairwise_alignment_algorithm_linear_memory, args_t...>,
+                                       lazy_conditional_t<traits_t::is_banded,
+                                                          lazy<pairwise_alignment_algorithm_banded, args_t...>,
+                                                          lazy<pairwise_alignment_algorithm, args_t...>>>>>>>;
 
     /*!\brief Selects the gap recursion policy.
      * \tparam config_t The alignment configuration type.
@@ -210,7 +228,8 @@ private:
         //!\brief The traits type.
         using traits_type = alignment_configuration_traits<config_t>;
         //!\brief A flag indicating if trace is required.
-        static constexpr bool with_trace = traits_type::requires_trace_information;
+        static constexpr bool with_trace = traits_type::requires_trace_information && !traits_type::is_linear_memory
+                                        && !traits_type::is_wavefront;
 
         //!\brief The gap recursion policy.
         using gap_recursion_policy_type = std::conditional_t<with_trace,
@@ -317,7 +336,10 @@ public:
         auto const & gap_cost = config_with_result_type.get_or(edit_gap_cost);
         auto const & scoring_scheme = get<align_cfg::scoring_scheme>(cfg).scheme;
 
-        if constexpr (config_t::template exists<seqan3::align_cfg::method_global>())
+        if constexpr (config_t::template exists<seqan3::align_cfg::method_global>()
+                      && !alignment_configuration_traits<config_t>::is_extension
+                      && !alignment_configuration_traits<config_t>::is_wavefront
+                      && !alignment_configuration_traits<config_t>::is_parallel_tiles)
         {
             // Only use edit distance if ...
             if constexpr (std::same_as<std::remove_cvref_t<decltype(scoring_scheme)>, hamming_scoring_scheme>)
@@ -342,10 +364,25 @@ public:
         // Check if invalid configuration was used.
         // ----------------------------------------------------------------------------
 
-        // Do not allow min score configuration for alignments not computing the edit distance.
-        if (config_t::template exists<align_cfg::min_score>())
-            throw invalid_alignment_configuration{"The align_cfg::min_score configuration is only allowed for the "
-                                                  "specific edit distance computation."};
+        // Do not allow the extension alignment to compute anything that requires the trace.
+        using config_traits_t = alignment_configuration_traits<decltype(config_with_result_type)>;
+        if constexpr (config_traits_t::is_extension && config_traits_t::requires_trace_information)
+            throw invalid_alignment_configuration{"The align_cfg::x_drop and align_cfg::z_drop configurations can only "
+                                                  "be combined with align_cfg::output_score, "
+                                                  "align_cfg::output_end_position and the sequence id outputs."};
+
+        // Do not allow the anti-diagonal vectorisation to compute anything that requires the trace.
+        if constexpr (config_traits_t::is_vectorised_anti_diagonal && config_traits_t::requires_trace_information)
+            throw invalid_alignment_configuration{"The align_cfg::vectorised_anti_diagonal configuration can only be "
+                                                  "combined with align_cfg::output_score, "
+                                                  "align_cfg::output_end_position and the sequence id outputs."};
+
+        // Do not allow the tiled parallelisation to compute anything that requires the trace.
+        if constexpr (config_traits_t::is_parallel_tiles && config_traits_t::requires_trace_information)
+            throw invalid_alignment_configuration{"The align_cfg::parallel_tiles configuration can only be combined "
+                                                  "with align_cfg::output_score, align_cfg::output_end_position and "
+                                                  "the sequence id outputs."};
+
         // Configure the alignment algorithm.
         return std::pair{configure_scoring_scheme<function_wrapper_t>(config_with_result_type),
                          config_with_result_type};
@@ -475,12 +512,17 @@ private:
         // macrobenchmarks to show that it maintains a high performance.
 
         // Use old alignment implementation if...
-        if constexpr (traits_t::is_local ||                   // it is a local alignment,
+        if constexpr (!traits_t::is_wavefront &&                                                 // (not wavefront)
+                      !(traits_t::is_linear_memory && traits_t::requires_trace_information) && // (not linear memory)
+                      !(traits_t::is_vectorised_anti_diagonal &&                               // (not anti-diagonal)
+                        !traits_t::requires_trace_information) &&
+                      !(traits_t::is_parallel_tiles && !traits_t::requires_trace_information) && // (not tiled)
+                      (traits_t::is_local ||                  // it is a local alignment,
                       traits_t::is_debug ||                   // it runs in debug mode,
                       traits_t::compute_sequence_alignment || // it computes more than the begin position.
-                      (traits_t::is_banded && traits_t::compute_begin_positions)
+                      (traits_t::is_banded && (traits_t::compute_begin_positions || traits_t::compute_cigar))
                       || // banded && more than end positions.
-                      (traits_t::is_vectorised && traits_t::compute_end_positions)) // simd and more than the score.
+                      (traits_t::is_vectorised && traits_t::compute_end_positions))) // simd and more than the score.
         {
             using matrix_policy_t = typename select_matrix_policy<traits_t>::type;
             using gap_policy_t = typename select_gap_policy<traits_t>::type;
@@ -560,7 +602,8 @@ private:
             using trace_matrix_t = trace_matrix_full<trace_directions>;
 
             using alignment_matrix_t =
-                std::conditional_t<traits_t::requires_trace_information,
+                std::conditional_t<traits_t::requires_trace_information && !traits_t::is_linear_memory
+                                       && !traits_t::is_wavefront,
                                    combined_score_and_trace_matrix<score_matrix_t, trace_matrix_t>,
                                    score_matrix_t>;
             using alignment_matrix_policy_t = policy_alignment_matrix<traits_t, alignment_matrix_t>;
@@ -36,6 +36,7 @@ class policy_alignment_result_builder;
  * \tparam alignment_t           The type of the alignment, can be omitted.
  * \tparam score_debug_matrix_t  The type of the score matrix. Only present if seqan3::align_cfg::detail::debug is enabled.
  * \tparam trace_debug_matrix_t  The type of the trace matrix. Only present if seqan3::align_cfg::detail::debug is enabled.
+ * \tparam cigar_t               The type of the CIGAR string, can be omitted.
  */
 template <typename sequence1_id_t,
           typename sequence2_id_t,
@@ -44,7 +45,8 @@ template <typename sequence1_id_t,
           typename begin_positions_t = std::nullopt_t *,
           typename alignment_t = std::nullopt_t *,
           typename score_debug_matrix_t = std::nullopt_t *,
-          typename trace_debug_matrix_t = std::nullopt_t *>
+          typename trace_debug_matrix_t = std::nullopt_t *,
+          typename cigar_t = std::nullopt_t *>
 struct alignment_result_value_type
 {
     //!\brief The alignment identifier for the first sequence.
@@ -64,6 +66,9 @@ struct alignment_result_value_type
     score_debug_matrix_t score_debug_matrix{};
     //!\brief The trace matrix. Only accessible with seqan3::align_cfg::detail::debug.
     trace_debug_matrix_t trace_debug_matrix{};
+
+    //!\brief The CIGAR string of the alignment.
+    cigar_t cigar_sequence{};
 };
 
 /*!\name Type deduction guides
@@ -165,6 +170,8 @@ private:
     using begin_positions_t = decltype(data.begin_positions);
     //!\brief The type for the alignment.
     using alignment_t = decltype(data.alignment);
+    //!\brief The type for the CIGAR string.
+    using cigar_t = decltype(data.cigar_sequence);
     //!\}
 
     //!\brief Befriend alignment result builder.
@@ -338,6 +345,40 @@ public:
                       "Trying to access the alignment, although it was not requested in the alignment configuration.");
         return data.alignment;
     }
+
+    /*!\brief Returns the CIGAR string of the alignment.
+     * \return A std::vector over seqan3::cigar, which describes the alignment of the second sequence (query) to the
+     *         first sequence (reference).
+     *
+     * \note This function is only available if the CIGAR string was requested via the alignment configuration
+     * (see seqan3::align_cfg::output_cigar).
+     */
+    constexpr cigar_t const & cigar_sequence() const & noexcept
+    {
+        static_assert(!std::is_same_v<cigar_t, std::nullopt_t *>,
+                      "Trying to access the CIGAR string, although it was not requested in the alignment "
+                      "configuration.");
+        return data.cigar_sequence;
+    }
+
+    /*!\brief Moves the CIGAR string out of the alignment result.
+     * \return The std::vector over seqan3::cigar the traceback has written the CIGAR operations into.
+     *
+     * \details
+     *
+     * The traceback writes the CIGAR operations directly into a buffer owned by the result. This overload hands the
+     * buffer over to the caller, e.g. to store it without copying the operations.
+     *
+     * \note This function is only available if the CIGAR string was requested via the alignment configuration
+     * (see seqan3::align_cfg::output_cigar).
+     */
+    constexpr cigar_t cigar_sequence() && noexcept
+    {
+        static_assert(!std::is_same_v<cigar_t, std::nullopt_t *>,
+                      "Trying to access the CIGAR string, although it was not requested in the alignment "
+                      "configuration.");
+        return std::move(data.cigar_sequence);
+    }
     //!\}
 
     //!\cond DEV
@@ -433,6 +474,7 @@ struct alignment_result_printer<alignment_result<result_value_t>>
         constexpr bool has_end_positions = !std::is_same_v<typename result_t::end_positions_t, disabled_t>;
         constexpr bool has_begin_positions = !std::is_same_v<typename result_t::begin_positions_t, disabled_t>;
         constexpr bool has_alignment = !std::is_same_v<typename result_t::alignment_t, disabled_t>;
+        constexpr bool has_cigar = !std::is_same_v<typename result_t::cigar_t, disabled_t>;
 
         bool prepend_comma = false;
         auto append_to_stream = [&](auto &&... args)
@@ -455,6 +497,12 @@ struct alignment_result_printer<alignment_result<result_value_t>>
             append_to_stream("end: (", arg.sequence1_end_position(), ",", arg.sequence2_end_position(), ")");
         if constexpr (has_alignment)
             append_to_stream("\nalignment:\n", arg.alignment());
+        if constexpr (has_cigar)
+        {
+            append_to_stream("cigar: ");
+            for (auto const & operation : arg.cigar_sequence())
+                stream << operation.to_string();
+        }
         stream << '}';
     }
 };
@@ -52,6 +52,9 @@ protected:
 
     static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
 
+    //!\brief Whether the computation stops as soon as seqan3::align_cfg::min_score cannot be reached anymore.
+    static constexpr bool uses_min_score_pruning = traits_type::has_min_score && !traits_type::is_vectorised;
+
 public:
     /*!\name Constructors, destructor and assignment
      * \{
@@ -139,6 +142,7 @@ public:
                                          this->optimal_coordinate,
                                          alignment_matrix,
                                          callback);
+            this->release_matrices();
         }
     }
     //!\}
@@ -190,6 +194,8 @@ public:
                                          callback);
             ++index;
         }
+
+        this->release_matrices();
     }
 
 protected:
@@ -237,6 +243,12 @@ protected:
      * \param[in] sequence2 The second sequence to compute the alignment for.
      * \param[in] alignment_matrix The alignment matrix to compute.
      * \param[in] index_matrix The index matrix corresponding to the alignment matrix.
+     *
+     * \details
+     *
+     * If seqan3::align_cfg::min_score is given, the computation stops after the first column in which no cell can
+     * reach the minimal score anymore (see seqan3::detail::policy_optimum_tracker::is_min_score_unreachable).
+     * The tracked optimum is then either the optimum of the alignment or below the minimal score.
      */
     template <std::ranges::forward_range sequence1_t,
               std::ranges::forward_range sequence2_t,
@@ -255,6 +267,9 @@ protected:
 
         this->reset_optimum(); // Reset the tracker for the new alignment computation.
 
+        if constexpr (uses_min_score_pruning)
+            this->reset_reachable_score(std::ranges::distance(sequence1), std::ranges::distance(sequence2));
+
         auto alignment_matrix_it = alignment_matrix.begin();
         auto indexed_matrix_it = index_matrix.begin();
 
@@ -265,11 +280,21 @@ protected:
         // ---------------------------------------------------------------------
 
         for (auto alphabet1 : sequence1)
+        {
             compute_column(*++alignment_matrix_it,
                            *++indexed_matrix_it,
                            this->scoring_scheme_profile_column(alphabet1),
                            sequence2);
 
+            if constexpr (uses_min_score_pruning)
+            {
+                if (this->is_min_score_unreachable(*alignment_matrix_it,
+                                                   *indexed_matrix_it,
+                                                   std::ranges::distance(sequence2) + 1))
+                    return;
+            }
+        }
+
         // ---------------------------------------------------------------------
         // Final phase: track score of last column
         // ---------------------------------------------------------------------
@@ -0,0 +1,528 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_anti_diagonal.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <limits>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_banded.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+#include <seqan3/utility/type_traits/lazy_conditional.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The alignment algorithm type to compute a single pairwise alignment vectorised along the anti-diagonals.
+ * \implements std::invocable
+ * \ingroup alignment_pairwise
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam policies_t Variadic template argument for the different policies of this alignment algorithm.
+ *
+ * \details
+ *
+ * The cell \f$(i, j)\f$ of the alignment matrix depends only on cells of the anti-diagonals \f$i + j - 1\f$ and
+ * \f$i + j - 2\f$. Hence, all cells of one anti-diagonal can be computed independently of each other and consecutive
+ * cells of an anti-diagonal are computed in one simd vector with 32 bit scores. Only the last three anti-diagonals
+ * are stored, each in a buffer that is indexed by the row of the cell. Thus, the cells above (same row, previous
+ * column) and to the left (previous row, same column) are found at neighbouring positions of the previous
+ * anti-diagonal and the loads from all buffers are contiguous. The substitution scores are read from the ranks of
+ * the second sequence and the reversed ranks of the first sequence, such that they are contiguous as well.
+ *
+ * The gap costs, the initialisation of the first row and column and the tracking of the optimum follow the
+ * seqan3::detail::pairwise_alignment_algorithm (global alignment) and the old alignment implementation (local
+ * alignment), such that the same score and end positions are reported. If the alignment is banded, only the cells
+ * of an anti-diagonal that lie inside of the band are computed.
+ *
+ * Only the score and the end positions can be computed with this algorithm.
+ */
+template <typename alignment_configuration_t, typename... policies_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+class pairwise_alignment_algorithm_anti_diagonal :
+    protected lazy_conditional_t<alignment_configuration_traits<alignment_configuration_t>::is_banded,
+                                 lazy<pairwise_alignment_algorithm_banded, alignment_configuration_t, policies_t...>,
+                                 lazy<pairwise_alignment_algorithm, alignment_configuration_t, policies_t...>>
+{
+protected:
+    //!\brief The type of the base algorithm.
+    using base_algorithm_t =
+        lazy_conditional_t<alignment_configuration_traits<alignment_configuration_t>::is_banded,
+                           lazy<pairwise_alignment_algorithm_banded, alignment_configuration_t, policies_t...>,
+                           lazy<pairwise_alignment_algorithm, alignment_configuration_t, policies_t...>>;
+
+    // Import types from base class.
+    using typename base_algorithm_t::alignment_result_type;
+    using typename base_algorithm_t::score_type;
+    using typename base_algorithm_t::traits_type;
+
+    static_assert(!traits_type::is_vectorised, "The anti-diagonal kernel cannot vectorise several alignments.");
+    static_assert(!traits_type::requires_trace_information, "The anti-diagonal kernel computes no trace.");
+    static_assert(std::integral<score_type>, "The score type must be integral.");
+
+    //!\brief The simd vector type used to compute the cells of an anti-diagonal.
+    using simd_score_t = simd_type_t<int32_t>;
+    //!\brief The number of cells computed at once.
+    static constexpr int32_t simd_length = simd_traits<simd_score_t>::length;
+    //!\brief The alphabet type of the scoring scheme.
+    using alphabet_type = typename traits_type::scoring_scheme_alphabet_type;
+    //!\brief The size of the alphabet of the scoring scheme.
+    static constexpr int32_t alphabet_size = seqan3::alphabet_size<alphabet_type>;
+
+    //!\brief An optimum candidate given by its score and its matrix coordinate.
+    struct optimum_type
+    {
+        //!\brief The score.
+        int32_t score{minus_infinity()};
+        //!\brief The column.
+        int32_t column{std::numeric_limits<int32_t>::max()};
+        //!\brief The row.
+        int32_t row{std::numeric_limits<int32_t>::max()};
+    };
+
+    //!\brief The scores of all pairs of alphabet ranks.
+    std::vector<int32_t> score_table{};
+    //!\brief Whether the scoring scheme only distinguishes between matches and mismatches.
+    bool is_match_mismatch_scheme{};
+    //!\brief The match score if the scoring scheme only distinguishes between matches and mismatches.
+    int32_t match_score{};
+    //!\brief The mismatch score if the scoring scheme only distinguishes between matches and mismatches.
+    int32_t mismatch_score{};
+
+    //!\brief The ranks of the first sequence in reversed order.
+    std::vector<int32_t> sequence1_ranks{};
+    //!\brief The ranks of the second sequence, beginning at index 1.
+    std::vector<int32_t> sequence2_ranks{};
+    //!\brief The substitution scores of the current simd vector if the scoring scheme is not a match/mismatch scheme.
+    std::array<int32_t, simd_length> substitution_scores{};
+    //!\brief The optimal scores of the current and the two previous anti-diagonals.
+    std::array<std::vector<int32_t>, 3> optimal_scores{};
+    //!\brief The horizontal scores, which are updated in place.
+    std::vector<int32_t> horizontal_scores{};
+    //!\brief The vertical scores of the current and the previous anti-diagonal.
+    std::array<std::vector<int32_t>, 2> vertical_scores{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_anti_diagonal() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_anti_diagonal(pairwise_alignment_algorithm_anti_diagonal const &) =
+        default; //!< Defaulted.
+    pairwise_alignment_algorithm_anti_diagonal(pairwise_alignment_algorithm_anti_diagonal &&) =
+        default; //!< Defaulted.
+    pairwise_alignment_algorithm_anti_diagonal &
+    operator=(pairwise_alignment_algorithm_anti_diagonal const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_anti_diagonal &
+    operator=(pairwise_alignment_algorithm_anti_diagonal &&) = default; //!< Defaulted.
+    ~pairwise_alignment_algorithm_anti_diagonal() = default;            //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \details
+     *
+     * Initialises the base policies of the alignment algorithm and tabulates the scoring scheme.
+     */
+    pairwise_alignment_algorithm_anti_diagonal(alignment_configuration_t const & config) : base_algorithm_t(config)
+    {
+        score_table.resize(alphabet_size * alphabet_size);
+        for (int32_t rank1 = 0; rank1 < alphabet_size; ++rank1)
+            for (int32_t rank2 = 0; rank2 < alphabet_size; ++rank2)
+                score_table[rank1 * alphabet_size + rank2] =
+                    this->scoring_scheme.score(assign_rank_to(rank1, alphabet_type{}),
+                                               assign_rank_to(rank2, alphabet_type{}));
+
+        match_score = score_table[0];
+        mismatch_score = (alphabet_size > 1) ? score_table[1] : score_table[0];
+        is_match_mismatch_scheme = true;
+        for (int32_t rank1 = 0; rank1 < alphabet_size; ++rank1)
+            for (int32_t rank2 = 0; rank2 < alphabet_size; ++rank2)
+                is_match_mismatch_scheme &=
+                    score_table[rank1 * alphabet_size + rank2] == ((rank1 == rank2) ? match_score : mismatch_score);
+    }
+    //!\}
+
+    /*!\name Invocation
+     * \{
+     */
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \throws std::bad_alloc during allocation of the anti-diagonal buffers.
+     * \throws seqan3::invalid_alignment_configuration if the configured band does not fit the given sequences.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Let `n` be the length of the first sequence, `m` be the length of the second sequence and `L` the number of
+     * 32 bit scores that fit into one simd vector. The runtime is \f$ O(n*m/L) \f$ and the space is \f$ O(n+m) \f$.
+     * If the alignment is banded with `k` diagonals, the runtime is \f$ O((n+m)*k/L) \f$.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            if constexpr (traits_type::is_banded)
+                check_valid_band_configuration(std::ranges::distance(get<0>(sequence_pair)),
+                                               std::ranges::distance(get<1>(sequence_pair)));
+
+            compute_matrix(get<0>(sequence_pair), get<1>(sequence_pair));
+            this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                         std::move(idx),
+                                         this->optimal_score,
+                                         this->optimal_coordinate,
+                                         empty_type{},
+                                         callback);
+        }
+    }
+    //!\}
+
+protected:
+    /*!\brief Checks whether the band is valid for the given sequence sizes.
+     * \param[in] sequence1_size The size of the first sequence.
+     * \param[in] sequence2_size The size of the second sequence.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the band does not contain the last cell of the global
+     *         alignment or if the band excludes the whole alignment matrix of the local alignment.
+     */
+    void check_valid_band_configuration(int64_t const sequence1_size, int64_t const sequence2_size) const
+    {
+        base_algorithm_t::check_valid_band_configuration(sequence1_size, sequence2_size);
+
+        if constexpr (traits_type::is_local)
+        {
+            if (this->lower_diagonal > sequence1_size)
+                throw invalid_alignment_configuration{
+                    "Invalid band error: The lower diagonal excludes the whole alignment matrix."};
+
+            if (this->upper_diagonal < -sequence2_size)
+                throw invalid_alignment_configuration{
+                    "Invalid band error: The upper diagonal excludes the whole alignment matrix."};
+        }
+    }
+
+    //!\brief The score representing minus infinity, which can be added to any other score without an underflow.
+    static constexpr int32_t minus_infinity() noexcept
+    {
+        return std::numeric_limits<int32_t>::lowest() / 4;
+    }
+
+    /*!\brief Computes the score and the end position of the alignment.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::forward_range.
+     *
+     * \param[in] sequence1 The first sequence to compute the alignment for.
+     * \param[in] sequence2 The second sequence to compute the alignment for.
+     *
+     * \details
+     *
+     * Iterates over the anti-diagonals \f$d = i + j\f$ and computes the rows \f$i\f$ of each anti-diagonal that are
+     * inside of the matrix and the band. The rows outside of this range are set to minus infinity, such that they
+     * are never part of the alignment. The result is stored in the optimum tracker.
+     */
+    template <std::ranges::forward_range sequence1_t, std::ranges::forward_range sequence2_t>
+    void compute_matrix(sequence1_t && sequence1, sequence2_t && sequence2)
+    {
+        int32_t const sequence1_size = std::ranges::distance(sequence1);
+        int32_t const sequence2_size = std::ranges::distance(sequence2);
+
+        // ---------------------------------------------------------------------
+        // Initialisation phase: store the ranks and reset the buffers.
+        // ---------------------------------------------------------------------
+
+        sequence1_ranks.assign(sequence1_size + simd_length, 0);
+        auto sequence1_rank_it = sequence1_ranks.begin() + sequence1_size;
+        for (auto && symbol : sequence1)
+            *--sequence1_rank_it = seqan3::to_rank(static_cast<alphabet_type>(symbol));
+
+        sequence2_ranks.assign(sequence2_size + simd_length, 0);
+        auto sequence2_rank_it = sequence2_ranks.begin();
+        for (auto && symbol : sequence2)
+            *++sequence2_rank_it = seqan3::to_rank(static_cast<alphabet_type>(symbol));
+
+        size_t const buffer_size = sequence2_size + 3 + simd_length;
+        for (auto & buffer : optimal_scores)
+            buffer.assign(buffer_size, minus_infinity());
+        for (auto & buffer : vertical_scores)
+            buffer.assign(buffer_size, minus_infinity());
+        horizontal_scores.assign(buffer_size, minus_infinity());
+
+        int32_t lower_diagonal = -sequence2_size;
+        int32_t upper_diagonal = sequence1_size;
+        if constexpr (traits_type::is_banded)
+        {
+            lower_diagonal = std::max(this->lower_diagonal, lower_diagonal);
+            upper_diagonal = std::min(this->upper_diagonal, upper_diagonal);
+        }
+
+        local_optimum = optimum_type{};
+        last_row_optimum = optimum_type{};
+        last_column_optimum = optimum_type{};
+        local_optima = lane_optima{};
+
+        // ---------------------------------------------------------------------
+        // Iteration phase: compute the anti-diagonals.
+        // ---------------------------------------------------------------------
+
+        for (int32_t diagonal = 0; diagonal <= sequence1_size + sequence2_size; ++diagonal)
+        {
+            // Rotate the buffers, such that the buffers of the current anti-diagonal are at position 0.
+            std::ranges::rotate(optimal_scores, optimal_scores.end() - 1);
+            std::swap(vertical_scores[0], vertical_scores[1]);
+
+            int32_t const first_row = std::max({0, diagonal - sequence1_size, (diagonal - upper_diagonal + 1) >> 1});
+            int32_t const last_row = std::min({sequence2_size, diagonal, (diagonal - lower_diagonal) >> 1});
+
+            int32_t const inner_last_row = std::min(last_row, diagonal - 1);
+            for (int32_t row = std::max(first_row, 1); row <= inner_last_row; row += simd_length)
+                compute_inner_cells(diagonal, row, inner_last_row, sequence1_size);
+
+            if (first_row == 0 && first_row <= last_row)
+                compute_boundary_cell(0, diagonal);
+            if (last_row == diagonal && diagonal > 0)
+                compute_boundary_cell(diagonal, 0);
+
+            // Separate the computed rows from the rows that are not part of this anti-diagonal.
+            for (int32_t index : {first_row, last_row + 2})
+            {
+                if (index >= 0 && index < static_cast<int32_t>(buffer_size))
+                {
+                    optimal_scores[0][index] = minus_infinity();
+                    horizontal_scores[index] = minus_infinity();
+                    vertical_scores[0][index] = minus_infinity();
+                }
+            }
+
+            if constexpr (traits_type::is_global)
+            {
+                if (this->last_row_is_free && last_row == sequence2_size && first_row <= last_row)
+                    update_global_optimum(last_row_optimum, sequence2_size, diagonal - sequence2_size);
+
+                int32_t const last_column_row = diagonal - sequence1_size;
+                if (this->last_column_is_free && last_column_row >= first_row && last_column_row <= last_row)
+                    update_global_optimum(last_column_optimum, last_column_row, sequence1_size);
+            }
+        }
+
+        // ---------------------------------------------------------------------
+        // Final phase: select the optimum.
+        // ---------------------------------------------------------------------
+
+        optimum_type optimum{};
+        if constexpr (traits_type::is_global)
+        {
+            if (this->last_column_is_free && last_column_optimum.score >= last_row_optimum.score)
+                optimum = last_column_optimum;
+            else if (this->last_row_is_free)
+                optimum = last_row_optimum;
+            else
+                optimum = {optimal_scores[0][sequence2_size + 1], sequence1_size, sequence2_size};
+        }
+        else
+        {
+            optimum = local_optimum;
+            for (int32_t lane = 0; lane < simd_length; ++lane)
+                update_local_optimum(optimum,
+                                     {local_optima.score[lane], local_optima.column[lane], local_optima.row[lane]});
+        }
+
+        this->optimal_score = static_cast<score_type>(optimum.score);
+        this->optimal_coordinate.row = optimum.row;
+        this->optimal_coordinate.col = optimum.column;
+    }
+
+    /*!\brief Computes up to seqan3::detail::pairwise_alignment_algorithm_anti_diagonal::simd_length inner cells of an
+     *        anti-diagonal.
+     * \param[in] diagonal The index of the anti-diagonal.
+     * \param[in] row The row of the first cell to compute.
+     * \param[in] last_row The last row of the anti-diagonal that is computed in the vector; rows behind it are
+     *                     computed, too, but ignored.
+     * \param[in] sequence1_size The size of the first sequence.
+     *
+     * \details
+     *
+     * Computes the cells according to the recursion formula of the seqan3::detail::policy_affine_gap_recursion:
+     * * \f$ H[i, j] = \max \{M[i, j - 1] + g_o, H[i, j - 1] + g_e\}\f$
+     * * \f$ V[i, j] = \max \{M[i - 1, j] + g_o, V[i - 1, j] + g_e\}\f$
+     * * \f$ M[i, j] = \max \{M[i - 1, j - 1] + \delta, H[i, j], V[i, j]\}\f$
+     *
+     * The cell \f$(i, j - 1)\f$ is stored at position \f$i + 1\f$ and the cells \f$(i - 1, j)\f$ and
+     * \f$(i - 1, j - 1)\f$ are stored at position \f$i\f$ of the buffers of the previous anti-diagonals.
+     */
+    void compute_inner_cells(int32_t const diagonal,
+                             int32_t const row,
+                             int32_t const last_row,
+                             int32_t const sequence1_size) noexcept
+    {
+        simd_score_t const gap_open = simd::fill<simd_score_t>(this->gap_open_score);
+        simd_score_t const gap_extension = simd::fill<simd_score_t>(this->gap_extension_score);
+
+        // Substitution scores of the cells (row + k, diagonal - row - k) for all lanes k.
+        int32_t const * rank1_ptr = sequence1_ranks.data() + (sequence1_size - diagonal + row);
+        int32_t const * rank2_ptr = sequence2_ranks.data() + row;
+        simd_score_t substitution_score;
+        if (is_match_mismatch_scheme)
+        {
+            substitution_score = (simd::load<simd_score_t>(rank1_ptr) == simd::load<simd_score_t>(rank2_ptr))
+                                   ? simd::fill<simd_score_t>(match_score)
+                                   : simd::fill<simd_score_t>(mismatch_score);
+        }
+        else
+        {
+            for (int32_t lane = 0; lane < simd_length; ++lane)
+                substitution_scores[lane] = score_table[rank1_ptr[lane] * alphabet_size + rank2_ptr[lane]];
+            substitution_score = simd::load<simd_score_t>(substitution_scores.data());
+        }
+
+        simd_score_t const previous_optimal = simd::load<simd_score_t>(optimal_scores[1].data() + row);
+        simd_score_t horizontal = simd::load<simd_score_t>(horizontal_scores.data() + row + 1) + gap_extension;
+        simd_score_t vertical = simd::load<simd_score_t>(vertical_scores[1].data() + row) + gap_extension;
+        simd_score_t optimal = simd::load<simd_score_t>(optimal_scores[2].data() + row) + substitution_score;
+
+        horizontal = max(horizontal, simd::load<simd_score_t>(optimal_scores[1].data() + row + 1) + gap_open);
+        vertical = max(vertical, previous_optimal + gap_open);
+        optimal = max(optimal, max(horizontal, vertical));
+
+        if constexpr (traits_type::is_local)
+        {
+            optimal = max(optimal, simd::fill<simd_score_t>(0));
+
+            simd_score_t const rows = simd::iota<simd_score_t>(row);
+            simd_score_t const columns = simd::fill<simd_score_t>(diagonal) - rows;
+            auto const is_better = (rows <= simd::fill<simd_score_t>(last_row))
+                                 & ((optimal > local_optima.score)
+                                    | ((optimal == local_optima.score)
+                                       & ((columns < local_optima.column)
+                                          | ((columns == local_optima.column) & (rows < local_optima.row)))));
+
+            local_optima.score = is_better ? optimal : local_optima.score;
+            local_optima.column = is_better ? columns : local_optima.column;
+            local_optima.row = is_better ? rows : local_optima.row;
+        }
+
+        simd::store(optimal_scores[0].data() + row + 1, optimal);
+        simd::store(horizontal_scores.data() + row + 1, horizontal);
+        simd::store(vertical_scores[0].data() + row + 1, vertical);
+    }
+
+    /*!\brief Computes a cell in the first row or the first column of the alignment matrix.
+     * \param[in] row The row of the cell.
+     * \param[in] column The column of the cell.
+     *
+     * \details
+     *
+     * The score is 0 for the origin, for the local alignment and if leading gaps are free. Otherwise it is
+     * \f$g_o + g_e * (k - 1)\f$, where \f$k\f$ is the row or column. The horizontal and vertical scores are set to
+     * minus infinity, since a gap that starts at the border is already covered by the score of the cell.
+     */
+    void compute_boundary_cell(int32_t const row, int32_t const column) noexcept
+    {
+        int32_t score = 0;
+        if constexpr (traits_type::is_global)
+        {
+            bool const is_free = (row == 0) ? this->first_row_is_free : this->first_column_is_free;
+            int32_t const gap_length = row + column;
+
+            if (gap_length > 0 && !is_free)
+                score = this->gap_open_score + (gap_length - 1) * this->gap_extension_score;
+        }
+        else
+        {
+            update_local_optimum(local_optimum, {score, column, row});
+        }
+
+        optimal_scores[0][row + 1] = score;
+        horizontal_scores[row + 1] = minus_infinity();
+        vertical_scores[0][row + 1] = minus_infinity();
+    }
+
+    /*!\brief Updates the optimum of the last row or the last column with the given cell of the current anti-diagonal.
+     * \param[in,out] optimum The optimum to update.
+     * \param[in] row The row of the cell.
+     * \param[in] column The column of the cell.
+     *
+     * \details
+     *
+     * As for the seqan3::detail::max_score_updater, a later cell replaces an earlier one with the same score.
+     */
+    void update_global_optimum(optimum_type & optimum, int32_t const row, int32_t const column) const noexcept
+    {
+        int32_t const score = optimal_scores[0][row + 1];
+        if (score >= optimum.score)
+            optimum = {score, column, row};
+    }
+
+    /*!\brief Updates the local optimum with the given candidate.
+     * \param[in,out] optimum The optimum to update.
+     * \param[in] candidate The candidate.
+     *
+     * \details
+     *
+     * Of two cells with the same score, the one that comes first in column-major order is kept, which is the same
+     * cell that is reported by the local alignment without this algorithm.
+     */
+    static void update_local_optimum(optimum_type & optimum, optimum_type const & candidate) noexcept
+    {
+        if (candidate.score > optimum.score
+            || (candidate.score == optimum.score
+                && (candidate.column < optimum.column
+                    || (candidate.column == optimum.column && candidate.row < optimum.row))))
+            optimum = candidate;
+    }
+
+    //!\brief Returns the element-wise maximum of the given vectors.
+    static simd_score_t max(simd_score_t const & lhs, simd_score_t const & rhs) noexcept
+    {
+        return (lhs < rhs) ? rhs : lhs;
+    }
+
+    //!\brief The optima of the simd lanes of the local alignment.
+    struct lane_optima
+    {
+        //!\brief The scores.
+        simd_score_t score{simd::fill<simd_score_t>(minus_infinity())};
+        //!\brief The columns.
+        simd_score_t column{simd::fill<simd_score_t>(std::numeric_limits<int32_t>::max())};
+        //!\brief The rows.
+        simd_score_t row{simd::fill<simd_score_t>(std::numeric_limits<int32_t>::max())};
+    };
+
+    //!\brief The optima of the inner cells of the local alignment, one for every lane.
+    lane_optima local_optima{};
+    //!\brief The optimum of the cells in the first row and column of the local alignment.
+    optimum_type local_optimum{};
+    //!\brief The optimum of the last row of the global alignment.
+    optimum_type last_row_optimum{};
+    //!\brief The optimum of the last column of the global alignment.
+    optimum_type last_column_optimum{};
+};
+
+} // namespace seqan3::detail
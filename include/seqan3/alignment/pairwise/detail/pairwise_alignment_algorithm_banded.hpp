@@ -36,6 +36,7 @@ protected:
     using typename base_algorithm_t::alignment_result_type;
     using typename base_algorithm_t::score_type;
     using typename base_algorithm_t::traits_type;
+    using base_algorithm_t::uses_min_score_pruning;
 
     static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
     static_assert(traits_type::is_banded, "Alignment configuration must have band configured.");
@@ -102,6 +103,7 @@ public:
                                          this->optimal_coordinate,
                                          alignment_matrix,
                                          callback);
+            this->release_matrices();
         }
     }
 
@@ -153,6 +155,8 @@ public:
                                          callback);
             ++index;
         }
+
+        this->release_matrices();
     }
     //!\}
 
@@ -208,6 +212,9 @@ protected:
      * G 3|     |     |(3,2)|(3,3)|(3,4)|(3,5)|(3,6)|
      * T 4|     |     |     |(4,3)|(4,4)|(4,5)|(4,6)|
      *```
+     *
+     * If seqan3::align_cfg::min_score is given, the computation stops after the first column in which no cell of the
+     * band can reach the minimal score anymore.
      */
     template <std::ranges::forward_range sequence1_t,
               std::ranges::forward_range sequence2_t,
@@ -226,6 +233,9 @@ protected:
 
         this->reset_optimum(); // Reset the tracker for the new alignment computation.
 
+        if constexpr (uses_min_score_pruning)
+            this->reset_reachable_score(std::ranges::distance(sequence1), std::ranges::distance(sequence2));
+
         auto alignment_matrix_it = alignment_matrix.begin();
         auto indexed_matrix_it = index_matrix.begin();
 
@@ -246,6 +256,15 @@ protected:
                                  *++indexed_matrix_it,
                                  alphabet1,
                                  std::views::take(sequence2, ++row_size));
+
+            if constexpr (uses_min_score_pruning)
+            {
+                if (this->is_min_score_unreachable(
+                        *alignment_matrix_it,
+                        *indexed_matrix_it,
+                        std::min<row_index_t>(std::ranges::distance(sequence2), row_size) + 1))
+                    return;
+            }
         }
 
         // ---------------------------------------------------------------------
@@ -260,6 +279,16 @@ protected:
                                 alphabet1,
                                 views::slice(sequence2, first_row_index, ++row_size));
             ++first_row_index;
+
+            if constexpr (uses_min_score_pruning)
+            {
+                // The first cell of the band column belongs to the row first_row_index.
+                if (this->is_min_score_unreachable(
+                        *alignment_matrix_it,
+                        std::views::drop(*indexed_matrix_it, first_row_index),
+                        std::min<row_index_t>(std::ranges::distance(sequence2), row_size) - first_row_index + 1))
+                    return;
+            }
         }
 
         // ---------------------------------------------------------------------
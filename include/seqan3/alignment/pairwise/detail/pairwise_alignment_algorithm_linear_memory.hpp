@@ -0,0 +1,729 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_linear_memory.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <limits>
+#include <ranges>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/release_excess_memory.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/matrix/detail/trace_segments.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_banded.hpp>
+#include <seqan3/utility/type_traits/lazy_conditional.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The alignment algorithm type to compute the global pairwise alignment with a traceback in linear memory.
+ * \implements std::invocable
+ * \ingroup alignment_pairwise
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam policies_t Variadic template argument for the different policies of this alignment algorithm.
+ *
+ * \details
+ *
+ * The optimal score and the end position are computed with the score-only variant of the
+ * seqan3::detail::pairwise_alignment_algorithm or the seqan3::detail::pairwise_alignment_algorithm_banded, depending
+ * on whether the alignment is banded or not. Afterwards, the trace is recovered with the divide-and-conquer algorithm
+ * of Myers and Miller (Optimal alignments in linear space, 1988), which extends the algorithm of Hirschberg to affine
+ * gap costs:
+ *
+ * The alignment matrix between the begin and the end position is split at its middle column. A forward pass computes
+ * the best scores from the begin to every cell of the middle column and a reverse pass computes the best scores from
+ * every cell of the middle column to the end. An optimal alignment passes the middle column in the cell maximising
+ * the sum of both scores. Besides the cells in which the alignment can cross the column in any state, the
+ * alignment may also cross the column within a horizontal gap. In this case the gap open score was counted twice and
+ * both sub-problems are constrained to end and begin with a horizontal gap, respectively. The sub-problems left and
+ * right of the crossing cell are solved recursively until they are small enough to be solved with a full trace
+ * matrix. If leading gaps are free, the begin position is determined beforehand with one reverse pass from the end
+ * position. All passes respect the band, such that the banded alignment stays in \f$O(n*k)\f$ time.
+ *
+ * The trace is recorded in a seqan3::detail::trace_segments object, which replaces the trace matrix when building
+ * the alignment result. The trace and the columns of the passes are kept per thread for the next alignment, unless
+ * they exceed seqan3::detail::retained_alignment_cell_count.
+ */
+template <typename alignment_configuration_t, typename... policies_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+class pairwise_alignment_algorithm_linear_memory :
+    protected lazy_conditional_t<alignment_configuration_traits<alignment_configuration_t>::is_banded,
+                                 lazy<pairwise_alignment_algorithm_banded, alignment_configuration_t, policies_t...>,
+                                 lazy<pairwise_alignment_algorithm, alignment_configuration_t, policies_t...>>
+{
+protected:
+    //!\brief The type of the algorithm computing the score and the end position.
+    using base_algorithm_t =
+        lazy_conditional_t<alignment_configuration_traits<alignment_configuration_t>::is_banded,
+                           lazy<pairwise_alignment_algorithm_banded, alignment_configuration_t, policies_t...>,
+                           lazy<pairwise_alignment_algorithm, alignment_configuration_t, policies_t...>>;
+
+    // Import types from base class.
+    using typename base_algorithm_t::alignment_result_type;
+    using typename base_algorithm_t::score_type;
+    using typename base_algorithm_t::traits_type;
+
+    static_assert(traits_type::is_global, "The linear memory traceback is only available for global alignments.");
+    static_assert(!traits_type::is_vectorised, "The linear memory traceback cannot be vectorised.");
+    static_assert(std::is_arithmetic_v<score_type>, "The score type must be arithmetic.");
+
+    //!\brief A rectangular section of the alignment matrix given by the first and the last cell (inclusive).
+    struct matrix_section
+    {
+        size_t first_row; //!< The row of the first cell.
+        size_t first_col; //!< The column of the first cell.
+        size_t last_row;  //!< The row of the last cell.
+        size_t last_col;  //!< The column of the last cell.
+    };
+
+    //!\brief The state in which the alignment enters or leaves a section of the alignment matrix.
+    enum struct boundary_state : uint8_t
+    {
+        any,           //!< The alignment may begin or end with any operation.
+        horizontal_gap //!< The alignment must begin or end with a horizontal gap.
+    };
+
+    /*!\name Trace flags of the base case
+     * \brief The flags stored for every cell when a section is solved with a full trace matrix.
+     * \{
+     */
+    static constexpr uint8_t optimum_from_diagonal = 0b0000;   //!< The optimum comes from the diagonal cell.
+    static constexpr uint8_t optimum_from_vertical = 0b0001;   //!< The optimum ends in a vertical gap.
+    static constexpr uint8_t optimum_from_horizontal = 0b0010; //!< The optimum ends in a horizontal gap.
+    static constexpr uint8_t optimum_mask = 0b0011;            //!< Mask for the source of the optimum.
+    static constexpr uint8_t horizontal_extends = 0b0100;      //!< The horizontal gap extends the left gap.
+    static constexpr uint8_t vertical_extends = 0b1000;        //!< The vertical gap extends the upper gap.
+    //!\}
+
+    /*!\brief Sections with at most this number of cells are solved with a full trace matrix.
+     *
+     * \details
+     *
+     * The memory for the trace of the base case is bounded by this constant and thus does not depend on the size of the
+     * sequences.
+     */
+    static constexpr size_t base_case_cell_count = 1u << 14;
+
+    //!\brief The lower diagonal of the band (or of the entire matrix if the alignment is not banded).
+    int64_t band_lower_diagonal{};
+    //!\brief The upper diagonal of the band (or of the entire matrix if the alignment is not banded).
+    int64_t band_upper_diagonal{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_linear_memory() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_linear_memory(pairwise_alignment_algorithm_linear_memory const &) =
+        default; //!< Defaulted.
+    pairwise_alignment_algorithm_linear_memory(pairwise_alignment_algorithm_linear_memory &&) =
+        default; //!< Defaulted.
+    pairwise_alignment_algorithm_linear_memory &
+    operator=(pairwise_alignment_algorithm_linear_memory const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_linear_memory &
+    operator=(pairwise_alignment_algorithm_linear_memory &&) = default; //!< Defaulted.
+    ~pairwise_alignment_algorithm_linear_memory() = default;            //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \details
+     *
+     * Initialises the base policies of the alignment algorithm.
+     *
+     * \throws seqan3::invalid_alignment_configuration.
+     */
+    pairwise_alignment_algorithm_linear_memory(alignment_configuration_t const & config) : base_algorithm_t(config)
+    {}
+    //!\}
+
+    /*!\name Invocation
+     * \{
+     */
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \throws std::bad_alloc during allocation of the alignment matrices or
+     *         seqan3::invalid_alignment_configuration if an invalid configuration for the given sequences is detected.
+     *
+     * \details
+     *
+     * Computes the optimal score and end position with the base algorithm and recovers the trace in linear memory
+     * afterwards. The sequences must model std::ranges::random_access_range.
+     *
+     * ### Complexity
+     *
+     * Let `n` be the length of the first sequence, `m` be the length of the second sequence and `k` be the size of
+     * the band.
+     *
+     * |                        | unbanded         | banded            |
+     * |:----------------------:|:----------------:|:-----------------:|
+     * |runtime                 |\f$ O(n*m) \f$    |\f$ O(n*k) \f$     |
+     * |space                   |\f$ O(n+m) \f$    |\f$ O(n+m) \f$     |
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        static thread_local trace_segments trace{};
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            auto && sequence1 = get<0>(sequence_pair);
+            auto && sequence2 = get<1>(sequence_pair);
+
+            static_assert(std::ranges::random_access_range<decltype(sequence1)>
+                              && std::ranges::random_access_range<decltype(sequence2)>,
+                          "The linear memory traceback requires sequences modelling "
+                          "std::ranges::random_access_range.");
+
+            size_t const sequence1_size = std::ranges::distance(sequence1);
+            size_t const sequence2_size = std::ranges::distance(sequence2);
+
+            auto && [alignment_matrix, index_matrix] =
+                this->acquire_matrices(sequence1_size, sequence2_size, this->lowest_viable_score());
+
+            if constexpr (traits_type::is_banded)
+            {
+                band_lower_diagonal = this->lower_diagonal;
+                band_upper_diagonal = this->upper_diagonal;
+
+                this->compare_and_set_optimum.set_target_indices(row_index_type{sequence2_size},
+                                                                 column_index_type{sequence1_size});
+
+                // Shrink the first sequence if the band ends before its actual end.
+                size_t const banded_sequence1_size = std::min(sequence1_size, this->upper_diagonal + sequence2_size);
+                using sequence1_difference_t = std::ranges::range_difference_t<decltype(sequence1)>;
+                this->compute_matrix(
+                    std::views::take(sequence1, static_cast<sequence1_difference_t>(banded_sequence1_size)),
+                    sequence2,
+                    alignment_matrix,
+                    index_matrix);
+            }
+            else
+            {
+                band_lower_diagonal = -static_cast<int64_t>(sequence2_size);
+                band_upper_diagonal = static_cast<int64_t>(sequence1_size);
+
+                this->compute_matrix(sequence1, sequence2, alignment_matrix, index_matrix);
+            }
+
+            matrix_coordinate const end_coordinate{
+                row_index_type{static_cast<size_t>(this->optimal_coordinate.row)},
+                column_index_type{static_cast<size_t>(this->optimal_coordinate.col)}};
+
+            compute_trace(sequence1, sequence2, end_coordinate, trace);
+
+            this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                         std::move(idx),
+                                         this->optimal_score,
+                                         end_coordinate,
+                                         trace,
+                                         callback);
+
+            this->release_matrices();
+            release_excess_memory(trace, (sequence1_size + 1) * (sequence2_size + 1));
+        }
+    }
+    //!\}
+
+protected:
+    /*!\brief Computes the trace from the begin of the alignment to the given end coordinate.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::random_access_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::random_access_range.
+     *
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in] end_coordinate The matrix coordinate of the optimal score.
+     * \param[out] trace The object to record the trace in.
+     */
+    template <std::ranges::random_access_range sequence1_t, std::ranges::random_access_range sequence2_t>
+    void compute_trace(sequence1_t && sequence1,
+                       sequence2_t && sequence2,
+                       matrix_coordinate const end_coordinate,
+                       trace_segments & trace)
+    {
+        matrix_section const section{0u, 0u, end_coordinate.row, end_coordinate.col};
+
+        trace.reset(find_begin_coordinate(sequence1, sequence2, section));
+
+        compute_section_trace(sequence1,
+                              sequence2,
+                              matrix_section{trace.begin_position().row, trace.begin_position().col, section.last_row,
+                                             section.last_col},
+                              boundary_state::any,
+                              boundary_state::any,
+                              trace);
+    }
+
+    /*!\brief Determines the begin of the alignment if leading gaps are free.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::random_access_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::random_access_range.
+     *
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in] section The section from the origin to the end of the alignment.
+     *
+     * \returns The matrix coordinate where the optimal alignment begins.
+     *
+     * \details
+     *
+     * Computes the best scores from every cell of the first row and first column to the end of the alignment with a
+     * reverse pass. The alignment begins in the cell with the highest score among all cells where the alignment may
+     * begin, i.e. the origin and the cells of the first row or column if the respective leading gaps are free.
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    matrix_coordinate find_begin_coordinate(sequence1_t && sequence1,
+                                            sequence2_t && sequence2,
+                                            matrix_section const & section)
+    {
+        matrix_coordinate begin{row_index_type{0u}, column_index_type{0u}};
+
+        if ((!this->first_row_is_free && !this->first_column_is_free)
+            || (section.last_row == 0u && section.last_col == 0u))
+            return begin;
+
+        static thread_local std::vector<score_type> optimal_column{};
+        static thread_local std::vector<score_type> horizontal_column{};
+        static thread_local std::vector<score_type> last_row{};
+
+        size_t const row_count = section.last_row;
+        size_t const column_count = section.last_col;
+
+        compute_boundary_scores<true>(sequence1,
+                                      sequence2,
+                                      section,
+                                      column_count,
+                                      boundary_state::any,
+                                      optimal_column,
+                                      horizontal_column,
+                                      &last_row);
+
+        // In the reverse pass the origin corresponds to the last cell of the last column.
+        score_type best_score = optimal_column[row_count];
+
+        if (this->first_row_is_free)
+        {
+            for (size_t col = 1; col <= column_count; ++col)
+            {
+                if (last_row[column_count - col] > best_score)
+                {
+                    best_score = last_row[column_count - col];
+                    begin = matrix_coordinate{row_index_type{0u}, column_index_type{col}};
+                }
+            }
+        }
+
+        if (this->first_column_is_free)
+        {
+            for (size_t row = 1; row <= row_count; ++row)
+            {
+                if (optimal_column[row_count - row] > best_score)
+                {
+                    best_score = optimal_column[row_count - row];
+                    begin = matrix_coordinate{row_index_type{row}, column_index_type{0u}};
+                }
+            }
+        }
+
+        release_excess_memory(optimal_column);
+        release_excess_memory(horizontal_column);
+        release_excess_memory(last_row);
+
+        return begin;
+    }
+
+    /*!\brief Recursively computes the trace through the given section of the alignment matrix.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::random_access_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::random_access_range.
+     *
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in] section The section of the alignment matrix.
+     * \param[in] begin_state The state in which the alignment begins in the first cell of the section.
+     * \param[in] end_state The state in which the alignment ends in the last cell of the section.
+     * \param[in,out] trace The trace to which the trace of the section is appended.
+     *
+     * \details
+     *
+     * If the begin state is seqan3::detail::pairwise_alignment_algorithm_linear_memory::boundary_state::horizontal_gap
+     * the alignment continues a horizontal gap of the preceding section, i.e. its first operation is a horizontal gap
+     * that does not pay the gap open score.
+     * If the end state is seqan3::detail::pairwise_alignment_algorithm_linear_memory::boundary_state::horizontal_gap
+     * the last operation of the alignment must be a horizontal gap.
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    void compute_section_trace(sequence1_t && sequence1,
+                               sequence2_t && sequence2,
+                               matrix_section const & section,
+                               boundary_state const begin_state,
+                               boundary_state const end_state,
+                               trace_segments & trace)
+    {
+        size_t const row_count = section.last_row - section.first_row;
+        size_t const column_count = section.last_col - section.first_col;
+
+        if (column_count <= 1u || (row_count + 1) * (column_count + 1) <= base_case_cell_count)
+            return compute_base_case_trace(sequence1, sequence2, section, begin_state, end_state, trace);
+
+        static thread_local std::vector<score_type> forward_optimal_column{};
+        static thread_local std::vector<score_type> forward_horizontal_column{};
+        static thread_local std::vector<score_type> reverse_optimal_column{};
+        static thread_local std::vector<score_type> reverse_horizontal_column{};
+
+        size_t const middle_column = column_count / 2;
+
+        compute_boundary_scores<false>(sequence1,
+                                       sequence2,
+                                       section,
+                                       middle_column,
+                                       begin_state,
+                                       forward_optimal_column,
+                                       forward_horizontal_column);
+        compute_boundary_scores<true>(sequence1,
+                                      sequence2,
+                                      section,
+                                      column_count - middle_column,
+                                      end_state,
+                                      reverse_optimal_column,
+                                      reverse_horizontal_column);
+
+        // Find the cell in the middle column where the optimal alignment crosses the column.
+        score_type const gap_open_only_score = this->gap_open_score - this->gap_extension_score;
+        score_type best_score = minus_infinity();
+        size_t best_row = 0;
+        bool crosses_in_horizontal_gap = false;
+
+        for (size_t row = 0; row <= row_count; ++row)
+        {
+            score_type const score = forward_optimal_column[row] + reverse_optimal_column[row_count - row];
+            score_type const gap_score =
+                forward_horizontal_column[row] + reverse_horizontal_column[row_count - row] - gap_open_only_score;
+
+            if (score > best_score)
+            {
+                best_score = score;
+                best_row = row;
+                crosses_in_horizontal_gap = false;
+            }
+
+            if (gap_score > best_score)
+            {
+                best_score = gap_score;
+                best_row = row;
+                crosses_in_horizontal_gap = true;
+            }
+        }
+
+        size_t const split_row = section.first_row + best_row;
+        size_t const split_col = section.first_col + middle_column;
+        boundary_state const split_state = crosses_in_horizontal_gap ? boundary_state::horizontal_gap
+                                                                     : boundary_state::any;
+
+        release_excess_memory(forward_optimal_column);
+        release_excess_memory(forward_horizontal_column);
+        release_excess_memory(reverse_optimal_column);
+        release_excess_memory(reverse_horizontal_column);
+
+        compute_section_trace(sequence1,
+                              sequence2,
+                              matrix_section{section.first_row, section.first_col, split_row, split_col},
+                              begin_state,
+                              split_state,
+                              trace);
+        compute_section_trace(sequence1,
+                              sequence2,
+                              matrix_section{split_row, split_col, section.last_row, section.last_col},
+                              split_state,
+                              end_state,
+                              trace);
+    }
+
+    /*!\brief Computes the trace through a small section with a full trace matrix.
+     * \copydetails compute_section_trace
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    void compute_base_case_trace(sequence1_t && sequence1,
+                                 sequence2_t && sequence2,
+                                 matrix_section const & section,
+                                 boundary_state const begin_state,
+                                 boundary_state const end_state,
+                                 trace_segments & trace)
+    {
+        static thread_local std::vector<score_type> optimal_column{};
+        static thread_local std::vector<score_type> horizontal_column{};
+        static thread_local std::vector<uint8_t> trace_flags{};
+        static thread_local std::vector<trace_directions> reverse_trace{};
+
+        size_t const row_count = section.last_row - section.first_row;
+        size_t const column_count = section.last_col - section.first_col;
+
+        trace_flags.resize((row_count + 1) * (column_count + 1));
+        compute_boundary_scores<false>(sequence1,
+                                       sequence2,
+                                       section,
+                                       column_count,
+                                       begin_state,
+                                       optimal_column,
+                                       horizontal_column,
+                                       nullptr,
+                                       trace_flags.data());
+
+        // Follow the trace flags from the last cell back to the first cell.
+        reverse_trace.clear();
+        size_t row = row_count;
+        size_t col = column_count;
+        uint8_t state = (end_state == boundary_state::horizontal_gap) ? optimum_from_horizontal : optimum_from_diagonal;
+
+        while (row > 0 || col > 0)
+        {
+            uint8_t const flags = trace_flags[col * (row_count + 1) + row];
+
+            switch (state)
+            {
+                case optimum_from_horizontal:
+                {
+                    assert(col > 0);
+                    reverse_trace.push_back(trace_directions::left);
+                    state = (flags & horizontal_extends) ? optimum_from_horizontal : optimum_from_diagonal;
+                    --col;
+                    break;
+                }
+                case optimum_from_vertical:
+                {
+                    assert(row > 0);
+                    reverse_trace.push_back(trace_directions::up);
+                    state = (flags & vertical_extends) ? optimum_from_vertical : optimum_from_diagonal;
+                    --row;
+                    break;
+                }
+                default: // The state of the optimum.
+                {
+                    state = flags & optimum_mask;
+                    if (state == optimum_from_diagonal)
+                    {
+                        assert(row > 0 && col > 0);
+                        reverse_trace.push_back(trace_directions::diagonal);
+                        --row;
+                        --col;
+                    }
+                }
+            }
+        }
+
+        for (trace_directions direction : reverse_trace | std::views::reverse)
+            trace.append(direction);
+
+        release_excess_memory(optimal_column);
+        release_excess_memory(horizontal_column);
+        release_excess_memory(trace_flags);
+        release_excess_memory(reverse_trace);
+    }
+
+    /*!\brief Computes the scores of the last computed column of the given section.
+     * \tparam is_reverse Whether the section is computed from its last cell towards its first cell.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::random_access_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::random_access_range.
+     *
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in] section The section of the alignment matrix.
+     * \param[in] column_count The number of columns to compute after the initial column.
+     * \param[in] initial_state The state of the first cell in the direction of the computation.
+     * \param[out] optimal_column The optimal scores of the last computed column.
+     * \param[out] horizontal_column The scores of the last computed column ending in a horizontal gap.
+     * \param[out] last_row If not `nullptr`, stores the optimal scores of the last row for every computed column.
+     * \param[out] trace_flags If not `nullptr`, stores the trace flags of every computed cell in column major order.
+     *
+     * \details
+     *
+     * The rows and columns are local to the section and counted in the direction of the computation, i.e. in the
+     * reverse computation the local cell `(0, 0)` is the last cell of the section. Since the affine gap costs are
+     * symmetric, the same recursion can be used in both directions. If the initial state is a horizontal gap, the
+     * alignment must start with a horizontal gap: in the forward direction it continues a gap of the preceding section
+     * and thus does not pay the gap open score, while in the reverse direction it is the gap that ends the section and
+     * pays the gap open score. Cells outside of the band are set to minus infinity.
+     */
+    template <bool is_reverse, typename sequence1_t, typename sequence2_t>
+    void compute_boundary_scores(sequence1_t && sequence1,
+                                 sequence2_t && sequence2,
+                                 matrix_section const & section,
+                                 size_t const column_count,
+                                 boundary_state const initial_state,
+                                 std::vector<score_type> & optimal_column,
+                                 std::vector<score_type> & horizontal_column,
+                                 std::vector<score_type> * last_row = nullptr,
+                                 uint8_t * trace_flags = nullptr)
+    {
+        auto sequence1_it = std::ranges::begin(sequence1);
+        auto sequence2_it = std::ranges::begin(sequence2);
+
+        int64_t const row_count = section.last_row - section.first_row;
+        score_type const infinity = minus_infinity();
+        score_type const gap_open = this->gap_open_score;
+        score_type const gap_extension = this->gap_extension_score;
+
+        // The band in local diagonals, where the local diagonal of a cell is its local column minus its local row.
+        int64_t const section_diagonal =
+            is_reverse ? static_cast<int64_t>(section.last_col) - static_cast<int64_t>(section.last_row)
+                       : static_cast<int64_t>(section.first_col) - static_cast<int64_t>(section.first_row);
+        int64_t const lower_diagonal =
+            is_reverse ? section_diagonal - band_upper_diagonal : band_lower_diagonal - section_diagonal;
+        int64_t const upper_diagonal =
+            is_reverse ? section_diagonal - band_lower_diagonal : band_upper_diagonal - section_diagonal;
+
+        auto sequence1_value = [&](int64_t const col)
+        {
+            return is_reverse ? sequence1_it[section.last_col - col] : sequence1_it[section.first_col + col - 1];
+        };
+        auto sequence2_value = [&](int64_t const row)
+        {
+            return is_reverse ? sequence2_it[section.last_row - row] : sequence2_it[section.first_row + row - 1];
+        };
+
+        optimal_column.assign(row_count + 1, infinity);
+        horizontal_column.assign(row_count + 1, infinity);
+
+        if (last_row != nullptr)
+            last_row->assign(column_count + 1, infinity);
+
+        // ---------------------------------------------------------------------
+        // Initial column
+        // ---------------------------------------------------------------------
+
+        assert(lower_diagonal <= 0 && upper_diagonal >= 0); // The first cell must be inside of the band.
+
+        if (initial_state == boundary_state::horizontal_gap)
+            horizontal_column[0] = is_reverse ? gap_open - gap_extension : score_type{};
+        else
+            optimal_column[0] = score_type{};
+
+        int64_t last_row_in_band = std::min<int64_t>(row_count, -lower_diagonal);
+        score_type vertical_score = infinity;
+
+        if (trace_flags != nullptr)
+            trace_flags[0] = optimum_from_diagonal;
+
+        for (int64_t row = 1; row <= last_row_in_band; ++row)
+        {
+            bool const extends = vertical_score + gap_extension > optimal_column[row - 1] + gap_open;
+            vertical_score = extends ? vertical_score + gap_extension : optimal_column[row - 1] + gap_open;
+            optimal_column[row] = vertical_score;
+
+            if (trace_flags != nullptr)
+                trace_flags[row] = optimum_from_vertical | (extends ? vertical_extends : 0);
+        }
+
+        if (last_row != nullptr && last_row_in_band == row_count)
+            (*last_row)[0] = optimal_column[row_count];
+
+        // ---------------------------------------------------------------------
+        // Remaining columns
+        // ---------------------------------------------------------------------
+
+        int64_t first_row_in_band = 0;
+
+        for (int64_t col = 1; col <= static_cast<int64_t>(column_count); ++col)
+        {
+            first_row_in_band = std::max<int64_t>(0, col - upper_diagonal);
+            last_row_in_band = std::min<int64_t>(row_count, col - lower_diagonal);
+
+            auto const value1 = sequence1_value(col);
+            score_type diagonal_score = (first_row_in_band > 0) ? optimal_column[first_row_in_band - 1] : infinity;
+            vertical_score = infinity;
+            uint8_t * column_flags = (trace_flags != nullptr) ? trace_flags + col * (row_count + 1) : nullptr;
+
+            for (int64_t row = first_row_in_band; row <= last_row_in_band; ++row)
+            {
+                uint8_t flags{};
+
+                // Horizontal gap from the left cell.
+                bool const horizontal_extends_gap =
+                    horizontal_column[row] + gap_extension > optimal_column[row] + gap_open;
+                score_type const horizontal_score = horizontal_extends_gap ? horizontal_column[row] + gap_extension
+                                                                           : optimal_column[row] + gap_open;
+                flags |= horizontal_extends_gap ? horizontal_extends : 0;
+
+                // Vertical gap from the upper cell.
+                if (row > first_row_in_band)
+                {
+                    bool const vertical_extends_gap =
+                        vertical_score + gap_extension > optimal_column[row - 1] + gap_open;
+                    vertical_score = vertical_extends_gap ? vertical_score + gap_extension
+                                                          : optimal_column[row - 1] + gap_open;
+                    flags |= vertical_extends_gap ? vertical_extends : 0;
+                }
+
+                // Optimum with preference diagonal, vertical, horizontal.
+                score_type optimal_score = horizontal_score;
+                uint8_t source = optimum_from_horizontal;
+
+                if (vertical_score >= optimal_score)
+                {
+                    optimal_score = vertical_score;
+                    source = optimum_from_vertical;
+                }
+
+                if (row > 0)
+                {
+                    score_type const match_score =
+                        diagonal_score + this->scoring_scheme.score(value1, sequence2_value(row));
+                    if (match_score >= optimal_score)
+                    {
+                        optimal_score = match_score;
+                        source = optimum_from_diagonal;
+                    }
+                }
+
+                diagonal_score = optimal_column[row];
+                optimal_column[row] = optimal_score;
+                horizontal_column[row] = horizontal_score;
+
+                if (column_flags != nullptr)
+                    column_flags[row] = flags | source;
+            }
+
+            if (last_row != nullptr && last_row_in_band == row_count)
+                (*last_row)[col] = optimal_column[row_count];
+        }
+
+        // Invalidate the cells outside of the band of the last computed column.
+        std::fill(optimal_column.begin(), optimal_column.begin() + first_row_in_band, infinity);
+        std::fill(horizontal_column.begin(), horizontal_column.begin() + first_row_in_band, infinity);
+        std::fill(optimal_column.begin() + last_row_in_band + 1, optimal_column.end(), infinity);
+        std::fill(horizontal_column.begin() + last_row_in_band + 1, horizontal_column.end(), infinity);
+    }
+
+    /*!\brief Returns the score representing minus infinity.
+     *
+     * \details
+     *
+     * The value is chosen such that adding two of these scores and any score of a valid alignment does not
+     * underflow.
+     */
+    static constexpr score_type minus_infinity() noexcept
+    {
+        return std::numeric_limits<score_type>::lowest() / 4;
+    }
+};
+
+} // namespace seqan3::detail
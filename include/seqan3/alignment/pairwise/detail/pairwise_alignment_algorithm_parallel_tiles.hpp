@@ -0,0 +1,656 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_parallel_tiles.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <limits>
+#include <ranges>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_parallel_tiles.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_banded.hpp>
+#include <seqan3/alphabet/adaptation/char.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/utility/concept.hpp>
+#include <seqan3/utility/parallel/detail/spin_delay.hpp>
+#include <seqan3/utility/type_traits/lazy_conditional.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The alignment algorithm type to compute a single pairwise alignment with several threads.
+ * \implements std::invocable
+ * \ingroup alignment_pairwise
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam policies_t Variadic template argument for the different policies of this alignment algorithm.
+ *
+ * \details
+ *
+ * The cells of the alignment matrix (without the first row and column) are split into square tiles. A tile only
+ * depends on the last column of its left neighbour, the last row of its upper neighbour and the last cell of its
+ * upper left neighbour. The last row of every column of tiles and the last column of every row of tiles are stored in
+ * buffers over the whole matrix, which are updated in place by the tiles. Since the tiles of one column or one row of
+ * tiles are computed one after another, no two threads access the same part of a buffer at the same time.
+ *
+ * The tiles are handed out to the threads in anti-diagonal order using an atomic counter. Before a thread computes
+ * its tile, it waits until the tiles the tile depends on are finished. These tiles were handed out earlier, such that
+ * the threads can never wait for each other in a cycle. If the alignment is banded, only the tiles that intersect the
+ * band are computed. The buffers of the skipped tiles still contain minus infinity or the initialisation of the first
+ * row and column, which is exactly the content the neighbouring tiles inside of the band expect.
+ *
+ * The gap costs, the initialisation of the first row and column and the tracking of the optimum follow the
+ * seqan3::detail::pairwise_alignment_algorithm (global alignment) and the old alignment implementation (local
+ * alignment), such that the same score and end positions are reported. Every tile tracks its own optimum, which are
+ * combined after all tiles are finished.
+ *
+ * Only the score and the end positions can be computed with this algorithm.
+ */
+template <typename alignment_configuration_t, typename... policies_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+class pairwise_alignment_algorithm_parallel_tiles :
+    protected lazy_conditional_t<alignment_configuration_traits<alignment_configuration_t>::is_banded,
+                                 lazy<pairwise_alignment_algorithm_banded, alignment_configuration_t, policies_t...>,
+                                 lazy<pairwise_alignment_algorithm, alignment_configuration_t, policies_t...>>
+{
+protected:
+    //!\brief The type of the base algorithm.
+    using base_algorithm_t =
+        lazy_conditional_t<alignment_configuration_traits<alignment_configuration_t>::is_banded,
+                           lazy<pairwise_alignment_algorithm_banded, alignment_configuration_t, policies_t...>,
+                           lazy<pairwise_alignment_algorithm, alignment_configuration_t, policies_t...>>;
+
+    // Import types from base class.
+    using typename base_algorithm_t::alignment_result_type;
+    using typename base_algorithm_t::score_type;
+    using typename base_algorithm_t::traits_type;
+
+    static_assert(!traits_type::is_vectorised, "The tiled algorithm cannot vectorise several alignments.");
+    static_assert(!traits_type::requires_trace_information, "The tiled algorithm computes no trace.");
+    static_assert(std::integral<score_type>, "The score type must be integral.");
+
+    //!\brief The alphabet type of the scoring scheme.
+    using alphabet_type = typename traits_type::scoring_scheme_alphabet_type;
+    //!\brief The size of the alphabet of the scoring scheme.
+    static constexpr int32_t alphabet_size = seqan3::alphabet_size<alphabet_type>;
+    //!\brief The tile index of tiles that are not computed.
+    static constexpr size_t no_tile = std::numeric_limits<size_t>::max();
+
+    //!\brief An optimum candidate given by its score and its matrix coordinate.
+    struct optimum_type
+    {
+        //!\brief The score.
+        int32_t score{minus_infinity()};
+        //!\brief The column.
+        int32_t column{};
+        //!\brief The row.
+        int32_t row{};
+    };
+
+    //!\brief The number of threads that compute one alignment.
+    uint32_t thread_count{1};
+    //!\brief The number of rows and columns of a tile.
+    int32_t tile_size{256};
+    //!\brief The scores of all pairs of alphabet ranks.
+    std::vector<int32_t> score_table{};
+    //!\brief The ranks of the first sequence.
+    std::vector<int32_t> sequence1_ranks{};
+    //!\brief The ranks of the second sequence.
+    std::vector<int32_t> sequence2_ranks{};
+    //!\brief The optimal scores of the last computed row of every column.
+    std::vector<int32_t> top_optimal_scores{};
+    //!\brief The vertical scores of the last computed row of every column.
+    std::vector<int32_t> top_vertical_scores{};
+    //!\brief The optimal scores of the last computed column of every row.
+    std::vector<int32_t> left_optimal_scores{};
+    //!\brief The horizontal scores of the last computed column of every row.
+    std::vector<int32_t> left_horizontal_scores{};
+    //!\brief The optimal score of the last cell of every tile.
+    std::vector<int32_t> tile_corner_scores{};
+    //!\brief The optimum of every tile.
+    std::vector<optimum_type> tile_optima{};
+    //!\brief The first computed column of tiles of every row of tiles.
+    std::vector<int32_t> first_tile_columns{};
+    //!\brief The last computed column of tiles of every row of tiles.
+    std::vector<int32_t> last_tile_columns{};
+    //!\brief The index of the first computed tile of every row of tiles.
+    std::vector<size_t> tile_row_offsets{};
+    //!\brief The row and column of all computed tiles in anti-diagonal order.
+    std::vector<std::pair<int32_t, int32_t>> tile_order{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_parallel_tiles() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_parallel_tiles(pairwise_alignment_algorithm_parallel_tiles const &) =
+        default; //!< Defaulted.
+    pairwise_alignment_algorithm_parallel_tiles(pairwise_alignment_algorithm_parallel_tiles &&) =
+        default; //!< Defaulted.
+    pairwise_alignment_algorithm_parallel_tiles &
+    operator=(pairwise_alignment_algorithm_parallel_tiles const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_parallel_tiles &
+    operator=(pairwise_alignment_algorithm_parallel_tiles &&) = default; //!< Defaulted.
+    ~pairwise_alignment_algorithm_parallel_tiles() = default;            //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \details
+     *
+     * Initialises the base policies of the alignment algorithm and tabulates the scoring scheme.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the number of threads or the tile size is `0`.
+     */
+    pairwise_alignment_algorithm_parallel_tiles(alignment_configuration_t const & config) : base_algorithm_t(config)
+    {
+        auto const & parallel_tiles_config = get<align_cfg::parallel_tiles>(config);
+        thread_count = parallel_tiles_config.thread_count.value_or(std::max(1u, std::thread::hardware_concurrency()));
+        tile_size = parallel_tiles_config.tile_size;
+
+        if (thread_count == 0u || parallel_tiles_config.tile_size == 0u
+            || parallel_tiles_config.tile_size > static_cast<uint32_t>(std::numeric_limits<int32_t>::max()))
+            throw invalid_alignment_configuration{"The align_cfg::parallel_tiles configuration requires a positive "
+                                                  "number of threads and a positive tile size."};
+
+        score_table.resize(alphabet_size * alphabet_size);
+        for (int32_t rank1 = 0; rank1 < alphabet_size; ++rank1)
+            for (int32_t rank2 = 0; rank2 < alphabet_size; ++rank2)
+                score_table[rank1 * alphabet_size + rank2] =
+                    this->scoring_scheme.score(assign_rank_to(rank1, alphabet_type{}),
+                                               assign_rank_to(rank2, alphabet_type{}));
+    }
+    //!\}
+
+    /*!\name Invocation
+     * \{
+     */
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \throws std::bad_alloc during allocation of the buffers.
+     * \throws seqan3::invalid_alignment_configuration if the configured band does not fit the given sequences.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Let `n` be the length of the first sequence, `m` be the length of the second sequence and `t` the number of
+     * threads. The runtime is \f$ O(n*m/t) \f$ once the anti-diagonals of tiles contain at least `t` tiles and the
+     * space is \f$ O(n+m) \f$. If the alignment is banded with `k` diagonals, the runtime is \f$ O((n+m)*k/t) \f$.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            if constexpr (traits_type::is_banded)
+                check_valid_band_configuration(std::ranges::distance(get<0>(sequence_pair)),
+                                               std::ranges::distance(get<1>(sequence_pair)));
+
+            compute_matrix(get<0>(sequence_pair), get<1>(sequence_pair));
+            this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                         std::move(idx),
+                                         this->optimal_score,
+                                         this->optimal_coordinate,
+                                         empty_type{},
+                                         callback);
+        }
+    }
+    //!\}
+
+protected:
+    /*!\brief Checks whether the band is valid for the given sequence sizes.
+     * \param[in] sequence1_size The size of the first sequence.
+     * \param[in] sequence2_size The size of the second sequence.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the band does not contain the last cell of the global
+     *         alignment or if the band excludes the whole alignment matrix of the local alignment.
+     */
+    void check_valid_band_configuration(int64_t const sequence1_size, int64_t const sequence2_size) const
+    {
+        base_algorithm_t::check_valid_band_configuration(sequence1_size, sequence2_size);
+
+        if constexpr (traits_type::is_local)
+        {
+            if (this->lower_diagonal > sequence1_size)
+                throw invalid_alignment_configuration{
+                    "Invalid band error: The lower diagonal excludes the whole alignment matrix."};
+
+            if (this->upper_diagonal < -sequence2_size)
+                throw invalid_alignment_configuration{
+                    "Invalid band error: The upper diagonal excludes the whole alignment matrix."};
+        }
+    }
+
+    //!\brief The score representing minus infinity, which can be added to any other score without an underflow.
+    static constexpr int32_t minus_infinity() noexcept
+    {
+        return std::numeric_limits<int32_t>::lowest() / 4;
+    }
+
+    /*!\brief Stores the ranks of the given sequence in the alphabet of the scoring scheme.
+     * \tparam sequence_t The type of the sequence; must model std::ranges::input_range.
+     * \param[in] sequence The sequence.
+     * \param[out] ranks The ranks of the sequence.
+     */
+    template <std::ranges::input_range sequence_t>
+    static void initialise_ranks(sequence_t && sequence, std::vector<int32_t> & ranks)
+    {
+        ranks.clear();
+        for (auto && symbol : sequence)
+        {
+            if constexpr (explicitly_convertible_to<std::ranges::range_reference_t<sequence_t>, alphabet_type>)
+                ranks.push_back(seqan3::to_rank(static_cast<alphabet_type>(symbol)));
+            else // e.g. the seqan3::hamming_scoring_scheme compares the symbols directly.
+                ranks.push_back(seqan3::to_rank(symbol));
+        }
+    }
+
+    /*!\brief Computes the score and the end position of the alignment.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::forward_range.
+     *
+     * \param[in] sequence1 The first sequence to compute the alignment for.
+     * \param[in] sequence2 The second sequence to compute the alignment for.
+     *
+     * \details
+     *
+     * Initialises the buffers with the first row and column, determines the tiles that intersect the band, computes
+     * them in parallel and stores the combined optimum in the optimum tracker.
+     */
+    template <std::ranges::forward_range sequence1_t, std::ranges::forward_range sequence2_t>
+    void compute_matrix(sequence1_t && sequence1, sequence2_t && sequence2)
+    {
+        initialise_ranks(sequence1, sequence1_ranks);
+        initialise_ranks(sequence2, sequence2_ranks);
+
+        int32_t const sequence1_size = sequence1_ranks.size();
+        int32_t const sequence2_size = sequence2_ranks.size();
+
+        int32_t lower_diagonal = -sequence2_size;
+        int32_t upper_diagonal = sequence1_size;
+        if constexpr (traits_type::is_banded)
+        {
+            lower_diagonal = std::max(this->lower_diagonal, lower_diagonal);
+            upper_diagonal = std::min(this->upper_diagonal, upper_diagonal);
+        }
+
+        // ---------------------------------------------------------------------
+        // Initialisation phase: the first row and column.
+        // ---------------------------------------------------------------------
+
+        auto in_band = [&](int32_t const row, int32_t const column)
+        {
+            return column - row >= lower_diagonal && column - row <= upper_diagonal;
+        };
+
+        optimum_type optimum{};
+        top_optimal_scores.resize(sequence1_size + 1);
+        top_vertical_scores.assign(sequence1_size + 1, minus_infinity());
+        for (int32_t column = 0; column <= sequence1_size; ++column)
+        {
+            top_optimal_scores[column] = in_band(0, column) ? boundary_score(0, column) : minus_infinity();
+            if (in_band(0, column))
+                track_optimum(optimum, top_optimal_scores[column], 0, column, sequence1_size, sequence2_size);
+        }
+
+        left_optimal_scores.resize(sequence2_size + 1);
+        left_horizontal_scores.assign(sequence2_size + 1, minus_infinity());
+        for (int32_t row = 0; row <= sequence2_size; ++row)
+        {
+            left_optimal_scores[row] = in_band(row, 0) ? boundary_score(row, 0) : minus_infinity();
+            if (row > 0 && in_band(row, 0))
+                track_optimum(optimum, left_optimal_scores[row], row, 0, sequence1_size, sequence2_size);
+        }
+
+        // ---------------------------------------------------------------------
+        // Determine the tiles that intersect the band.
+        // ---------------------------------------------------------------------
+
+        int32_t const tile_row_count = (sequence2_size + tile_size - 1) / tile_size;
+        int32_t const tile_column_count = (sequence1_size + tile_size - 1) / tile_size;
+
+        first_tile_columns.resize(tile_row_count);
+        last_tile_columns.resize(tile_row_count);
+        tile_row_offsets.resize(tile_row_count);
+        tile_order.clear();
+
+        for (int32_t tile_row = 0; tile_row < tile_row_count; ++tile_row)
+        {
+            int64_t const first_row = static_cast<int64_t>(tile_row) * tile_size + 1;
+            int64_t const last_row = std::min<int64_t>(sequence2_size, first_row + tile_size - 1);
+            int64_t const lowest_column = first_row + lower_diagonal;  // The last column of a tile must reach it.
+            int64_t const highest_column = last_row + upper_diagonal; // The first column of a tile must not exceed it.
+
+            int32_t first_tile_column = (lowest_column <= 0) ? 0 : (lowest_column + tile_size - 1) / tile_size - 1;
+            int32_t last_tile_column = (highest_column < 1) ? -1 : (highest_column - 1) / tile_size;
+            if (lowest_column > sequence1_size)
+                first_tile_column = tile_column_count;
+
+            first_tile_columns[tile_row] = first_tile_column;
+            last_tile_columns[tile_row] = std::min(last_tile_column, tile_column_count - 1);
+            tile_row_offsets[tile_row] = tile_order.size();
+
+            for (int32_t tile_column = first_tile_column; tile_column <= last_tile_columns[tile_row]; ++tile_column)
+                tile_order.emplace_back(tile_row, tile_column);
+        }
+
+        size_t const tile_count = tile_order.size();
+        std::ranges::sort(tile_order,
+                          [](auto const & lhs, auto const & rhs)
+                          {
+                              return std::pair{lhs.first + lhs.second, lhs.first}
+                                   < std::pair{rhs.first + rhs.second, rhs.first};
+                          });
+
+        tile_corner_scores.assign(tile_count, minus_infinity());
+        tile_optima.assign(tile_count, optimum_type{});
+
+        // ---------------------------------------------------------------------
+        // Iteration phase: compute the tiles in parallel.
+        // ---------------------------------------------------------------------
+
+        std::vector<std::atomic<bool>> finished(tile_count);
+        std::atomic<size_t> next_tile{0};
+
+        auto wait_for = [&](int32_t const tile_row, int32_t const tile_column)
+        {
+            size_t const index = tile_index(tile_row, tile_column);
+            if (index == no_tile)
+                return;
+
+            spin_delay delay{};
+            while (!finished[index].load(std::memory_order_acquire))
+                delay.wait();
+        };
+
+        auto worker = [&]()
+        {
+            for (size_t order = next_tile.fetch_add(1, std::memory_order_relaxed); order < tile_count;
+                 order = next_tile.fetch_add(1, std::memory_order_relaxed))
+            {
+                auto const [tile_row, tile_column] = tile_order[order];
+
+                wait_for(tile_row - 1, tile_column);
+                wait_for(tile_row, tile_column - 1);
+                wait_for(tile_row - 1, tile_column - 1);
+
+                size_t const index = tile_index(tile_row, tile_column);
+                compute_tile(tile_row, tile_column, lower_diagonal, upper_diagonal, sequence1_size, sequence2_size);
+                finished[index].store(true, std::memory_order_release);
+            }
+        };
+
+        size_t const worker_count = std::min<size_t>(thread_count, tile_count);
+        std::vector<std::thread> workers{};
+        for (size_t thread_id = 1; thread_id < worker_count; ++thread_id)
+        {
+            try
+            {
+                workers.emplace_back(worker);
+            }
+            catch (std::system_error const &) // Continue with the threads that could be started.
+            {
+                break;
+            }
+        }
+
+        worker();
+        for (std::thread & thread : workers)
+            thread.join();
+
+        // ---------------------------------------------------------------------
+        // Final phase: combine the optima of all tiles.
+        // ---------------------------------------------------------------------
+
+        for (optimum_type const & tile_optimum : tile_optima)
+            update_optimum(optimum, tile_optimum);
+
+        this->optimal_score = static_cast<score_type>(optimum.score);
+        this->optimal_coordinate.row = optimum.row;
+        this->optimal_coordinate.col = optimum.column;
+    }
+
+    //!\brief Returns the index of the given tile or the index representing no tile if the tile is not computed.
+    size_t tile_index(int32_t const tile_row, int32_t const tile_column) const noexcept
+    {
+        if (tile_row < 0 || tile_column < 0 || tile_column < first_tile_columns[tile_row]
+            || tile_column > last_tile_columns[tile_row])
+            return no_tile;
+
+        return tile_row_offsets[tile_row] + (tile_column - first_tile_columns[tile_row]);
+    }
+
+    /*!\brief Computes all cells of the given tile that are inside of the band.
+     * \param[in] tile_row The row of the tile.
+     * \param[in] tile_column The column of the tile.
+     * \param[in] lower_diagonal The lower diagonal of the band.
+     * \param[in] upper_diagonal The upper diagonal of the band.
+     * \param[in] sequence1_size The size of the first sequence.
+     * \param[in] sequence2_size The size of the second sequence.
+     *
+     * \details
+     *
+     * Computes the cells column by column according to the recursion formula of the
+     * seqan3::detail::policy_affine_gap_recursion:
+     * * \f$ H[i, j] = \max \{M[i, j - 1] + g_o, H[i, j - 1] + g_e\}\f$
+     * * \f$ V[i, j] = \max \{M[i - 1, j] + g_o, V[i - 1, j] + g_e\}\f$
+     * * \f$ M[i, j] = \max \{M[i - 1, j - 1] + \delta, H[i, j], V[i, j]\}\f$
+     *
+     * The last column of the left tile is read from and replaced in the row buffers and the last row of the upper tile
+     * is read from and replaced in the column buffers. Rows of a column that are outside of the band are neither read
+     * nor written, except for the last row of the tile, which is set to minus infinity.
+     */
+    void compute_tile(int32_t const tile_row,
+                      int32_t const tile_column,
+                      int32_t const lower_diagonal,
+                      int32_t const upper_diagonal,
+                      int32_t const sequence1_size,
+                      int32_t const sequence2_size) noexcept
+    {
+        int32_t const first_row = tile_row * tile_size + 1;
+        int32_t const last_row = std::min(sequence2_size, first_row + tile_size - 1);
+        int32_t const first_column = tile_column * tile_size + 1;
+        int32_t const last_column = std::min(sequence1_size, first_column + tile_size - 1);
+
+        int32_t const gap_open = this->gap_open_score;
+        int32_t const gap_extension = this->gap_extension_score;
+
+        size_t const index = tile_index(tile_row, tile_column);
+        optimum_type & optimum = tile_optima[index];
+
+        // The last cell of the upper left tile.
+        int32_t diagonal_score = minus_infinity();
+        if (tile_row == 0 || tile_column == 0)
+        {
+            if (first_column - 1 - (first_row - 1) >= lower_diagonal
+                && first_column - 1 - (first_row - 1) <= upper_diagonal)
+                diagonal_score = boundary_score(first_row - 1, first_column - 1);
+        }
+        else if (size_t const upper_left_index = tile_index(tile_row - 1, tile_column - 1); upper_left_index != no_tile)
+        {
+            diagonal_score = tile_corner_scores[upper_left_index];
+        }
+
+        for (int32_t column = first_column; column <= last_column; ++column)
+        {
+            int32_t const column_first_row = std::max(first_row, column - upper_diagonal);
+            int32_t const column_last_row = std::min(last_row, column - lower_diagonal);
+
+            // The cell above the first row of this column is the diagonal predecessor for the next column.
+            int32_t const next_diagonal_score = top_optimal_scores[column];
+
+            if (column_first_row > column_last_row)
+            {
+                top_optimal_scores[column] = minus_infinity();
+                top_vertical_scores[column] = minus_infinity();
+                diagonal_score = next_diagonal_score;
+                continue;
+            }
+
+            int32_t optimal = minus_infinity();
+            int32_t vertical = minus_infinity();
+            if (column_first_row == first_row)
+            {
+                optimal = top_optimal_scores[column];
+                vertical = top_vertical_scores[column];
+            }
+            else
+            {
+                diagonal_score = left_optimal_scores[column_first_row - 1];
+            }
+
+            int32_t const * const substitution_scores =
+                score_table.data() + sequence1_ranks[column - 1] * alphabet_size;
+
+            for (int32_t row = column_first_row; row <= column_last_row; ++row)
+            {
+                int32_t const left_optimal = left_optimal_scores[row];
+                int32_t const horizontal =
+                    std::max(left_horizontal_scores[row] + gap_extension, left_optimal + gap_open);
+                vertical = std::max(vertical + gap_extension, optimal + gap_open);
+                optimal = std::max({diagonal_score + substitution_scores[sequence2_ranks[row - 1]],
+                                    horizontal,
+                                    vertical});
+
+                if constexpr (traits_type::is_local)
+                {
+                    optimal = std::max(optimal, 0);
+                    track_optimum(optimum, optimal, row, column, sequence1_size, sequence2_size);
+                }
+                else
+                {
+                    if (column == sequence1_size)
+                        track_optimum(optimum, optimal, row, column, sequence1_size, sequence2_size);
+                }
+
+                diagonal_score = left_optimal;
+                left_optimal_scores[row] = optimal;
+                left_horizontal_scores[row] = horizontal;
+            }
+
+            if constexpr (traits_type::is_global)
+            {
+                if (column_last_row == sequence2_size)
+                    track_optimum(optimum, optimal, sequence2_size, column, sequence1_size, sequence2_size);
+            }
+
+            bool const is_last_row_computed = column_last_row == last_row;
+            top_optimal_scores[column] = is_last_row_computed ? optimal : minus_infinity();
+            top_vertical_scores[column] = is_last_row_computed ? vertical : minus_infinity();
+            diagonal_score = next_diagonal_score;
+        }
+
+        tile_corner_scores[index] = top_optimal_scores[last_column];
+    }
+
+    /*!\brief Returns the score of a cell in the first row or the first column of the alignment matrix.
+     * \param[in] row The row of the cell.
+     * \param[in] column The column of the cell.
+     *
+     * \details
+     *
+     * The score is 0 for the origin, for the local alignment and if leading gaps are free. Otherwise it is
+     * \f$g_o + g_e * (k - 1)\f$, where \f$k\f$ is the row or column.
+     */
+    int32_t boundary_score(int32_t const row, int32_t const column) const noexcept
+    {
+        if constexpr (traits_type::is_global)
+        {
+            bool const is_free = (row == 0) ? this->first_row_is_free : this->first_column_is_free;
+            int32_t const gap_length = row + column;
+
+            if (gap_length > 0 && !is_free)
+                return this->gap_open_score + (gap_length - 1) * this->gap_extension_score;
+        }
+
+        return 0;
+    }
+
+    /*!\brief Updates the optimum with the given cell if the cell can be the end of the alignment.
+     * \param[in,out] optimum The optimum to update.
+     * \param[in] score The score of the cell.
+     * \param[in] row The row of the cell.
+     * \param[in] column The column of the cell.
+     * \param[in] sequence1_size The size of the first sequence.
+     * \param[in] sequence2_size The size of the second sequence.
+     *
+     * \details
+     *
+     * The global alignment ends in the last cell or, if trailing gaps are free, in the last row or column.
+     */
+    void track_optimum(optimum_type & optimum,
+                       int32_t const score,
+                       int32_t const row,
+                       int32_t const column,
+                       int32_t const sequence1_size,
+                       int32_t const sequence2_size) const noexcept
+    {
+        if constexpr (traits_type::is_global)
+        {
+            bool const is_last_row = row == sequence2_size;
+            bool const is_last_column = column == sequence1_size;
+
+            if (!((is_last_row && (this->last_row_is_free || is_last_column))
+                  || (is_last_column && (this->last_column_is_free || is_last_row))))
+                return;
+        }
+
+        update_optimum(optimum, {score, column, row});
+    }
+
+    /*!\brief Updates the optimum with the given candidate.
+     * \param[in,out] optimum The optimum to update.
+     * \param[in] candidate The candidate.
+     *
+     * \details
+     *
+     * Of two cells with the same score, the global alignment keeps the one that comes last in column-major order, as
+     * the seqan3::detail::max_score_updater does, and the local alignment keeps the one that comes first, which is the
+     * same cell that is reported by the local alignment without this algorithm.
+     */
+    static void update_optimum(optimum_type & optimum, optimum_type const & candidate) noexcept
+    {
+        if (candidate.score != optimum.score)
+        {
+            if (candidate.score > optimum.score)
+                optimum = candidate;
+        }
+        else if constexpr (traits_type::is_global)
+        {
+            if (std::pair{candidate.column, candidate.row} > std::pair{optimum.column, optimum.row})
+                optimum = candidate;
+        }
+        else
+        {
+            if (std::pair{candidate.column, candidate.row} < std::pair{optimum.column, optimum.row})
+                optimum = candidate;
+        }
+    }
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,555 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_wavefront.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <limits>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/release_excess_memory.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/matrix/detail/trace_segments.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
+#include <seqan3/alphabet/adaptation/char.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/utility/concept.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The alignment algorithm type to compute the global alignment with the wavefront alignment algorithm.
+ * \implements std::invocable
+ * \ingroup alignment_pairwise
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam policies_t Variadic template argument for the different policies of this alignment algorithm.
+ *
+ * \details
+ *
+ * Implements the gap-affine wavefront alignment algorithm (WFA) of Marco-Sola et al. (Fast gap-affine pairwise
+ * alignment using the wavefront algorithm, 2021). The algorithm minimises a penalty, where matches are free and
+ * mismatches (\f$x\f$), gap openings (\f$o\f$) and gap extensions (\f$e\f$) are penalised. For every penalty \f$s\f$
+ * a wavefront stores the furthest reaching column of every diagonal \f$k = column - row\f$ that can be reached with
+ * penalty \f$s\f$, separately for alignments ending with a match or mismatch, a horizontal gap or a vertical gap:
+ * * \f$ H_{s, k} = \max \{M_{s - o - e, k - 1}, H_{s - e, k - 1}\} + 1\f$
+ * * \f$ V_{s, k} = \max \{M_{s - o - e, k + 1}, V_{s - e, k + 1}\}\f$
+ * * \f$ M_{s, k} = \max \{M_{s - x, k} + 1, H_{s, k}, V_{s, k}\}\f$
+ *
+ * Afterwards, every column of \f$M_{s}\f$ is extended along the run of matches on its diagonal. The algorithm
+ * stops with the first \f$s\f$ that reaches the last cell of the alignment matrix.
+ *
+ * The scores of the alignment configuration are transformed into penalties according to Eizenga and Paten
+ * (Improving the time and space complexity of the WFA algorithm and generalizing its scoring, 2022): Let \f$a\f$ be
+ * the match score, \f$b\f$ the mismatch score, \f$g_o\f$ the gap open score and \f$g_e\f$ the gap extension score.
+ * With \f$x = 2(a - b)\f$, \f$o = -2 g_o\f$ and \f$e = a - 2 g_e\f$, every alignment of two sequences of length
+ * \f$n\f$ and \f$m\f$ with score \f$S\f$ has the penalty \f$a (n + m) - 2 S\f$. Hence, the alignment with minimal
+ * penalty is an optimal global alignment.
+ *
+ * If the trace is required, all wavefronts are kept and the trace is recovered from the end to the begin by
+ * recomputing which predecessor determined each offset. Otherwise, only the last \f$\max \{x, o + e\} + 1\f$
+ * wavefronts are kept in a ring buffer.
+ */
+template <typename alignment_configuration_t, typename... policies_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+class pairwise_alignment_algorithm_wavefront :
+    protected pairwise_alignment_algorithm<alignment_configuration_t, policies_t...>
+{
+protected:
+    //!\brief The type of the base algorithm.
+    using base_algorithm_t = pairwise_alignment_algorithm<alignment_configuration_t, policies_t...>;
+
+    // Import types from base class.
+    using typename base_algorithm_t::alignment_result_type;
+    using typename base_algorithm_t::score_type;
+    using typename base_algorithm_t::traits_type;
+
+    static_assert(traits_type::is_global, "The wavefront alignment is only available for global alignments.");
+    static_assert(!traits_type::is_banded, "The wavefront alignment cannot be banded.");
+    static_assert(!traits_type::is_vectorised, "The wavefront alignment cannot be vectorised.");
+    static_assert(std::integral<score_type>, "The score type must be integral.");
+
+    //!\brief The alphabet type of the scoring scheme.
+    using alphabet_type = typename traits_type::scoring_scheme_alphabet_type;
+
+    //!\brief The furthest reaching columns of all diagonals for one penalty.
+    struct wavefront_type
+    {
+        //!\brief The lowest diagonal of the wavefront.
+        int32_t lowest_diagonal{1};
+        //!\brief The highest diagonal of the wavefront; the wavefront is empty if it is below the lowest diagonal.
+        int32_t highest_diagonal{0};
+        //!\brief The columns of the alignments ending with a match or mismatch.
+        std::vector<int32_t> optimal_offsets{};
+        //!\brief The columns of the alignments ending with a horizontal gap.
+        std::vector<int32_t> horizontal_offsets{};
+        //!\brief The columns of the alignments ending with a vertical gap.
+        std::vector<int32_t> vertical_offsets{};
+
+        //!\brief Returns the offset of the given diagonal or the null offset if the diagonal is not stored.
+        static int32_t at(wavefront_type const & wavefront,
+                          std::vector<int32_t> const & offsets,
+                          int32_t const diagonal) noexcept
+        {
+            if (diagonal < wavefront.lowest_diagonal || diagonal > wavefront.highest_diagonal)
+                return null_offset();
+
+            return offsets[diagonal - wavefront.lowest_diagonal];
+        }
+    };
+
+    //!\brief The component of the wavefront a trace step is located in.
+    enum struct wavefront_component : uint8_t
+    {
+        optimal,    //!< Alignments ending with a match or mismatch.
+        horizontal, //!< Alignments ending with a horizontal gap.
+        vertical    //!< Alignments ending with a vertical gap.
+    };
+
+    //!\brief The mismatch penalty.
+    int32_t mismatch_penalty{};
+    //!\brief The penalty for opening and extending a gap by one symbol.
+    int32_t gap_open_penalty{};
+    //!\brief The penalty for extending a gap by one symbol.
+    int32_t gap_extension_penalty{};
+    //!\brief The match score used to transform the penalty back into a score.
+    int32_t match_score{};
+
+    //!\brief The wavefronts indexed by the penalty (with trace) or the penalty modulo the ring size (without trace).
+    std::vector<wavefront_type> wavefronts{};
+    //!\brief An empty wavefront representing negative penalties.
+    wavefront_type empty_wavefront{};
+    //!\brief The ranks of the first sequence followed by a sentinel.
+    std::vector<int32_t> sequence1_ranks{};
+    //!\brief The ranks of the second sequence followed by a different sentinel.
+    std::vector<int32_t> sequence2_ranks{};
+    //!\brief The trace steps collected from the end to the begin of the alignment.
+    std::vector<std::pair<trace_directions, size_t>> reverse_trace{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_wavefront() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_wavefront(pairwise_alignment_algorithm_wavefront const &) =
+        default; //!< Defaulted.
+    pairwise_alignment_algorithm_wavefront(pairwise_alignment_algorithm_wavefront &&) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_wavefront &
+    operator=(pairwise_alignment_algorithm_wavefront const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_wavefront &
+    operator=(pairwise_alignment_algorithm_wavefront &&) = default; //!< Defaulted.
+    ~pairwise_alignment_algorithm_wavefront() = default;            //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \details
+     *
+     * Initialises the base policies of the alignment algorithm and transforms the scores into penalties.
+     *
+     * \throws seqan3::invalid_alignment_configuration if free end gaps are configured, if the scoring scheme does not
+     *         only distinguish between matches and mismatches or if the scores cannot be transformed into positive
+     *         mismatch and gap extension penalties.
+     */
+    pairwise_alignment_algorithm_wavefront(alignment_configuration_t const & config) : base_algorithm_t(config)
+    {
+        auto const & method_global_config = get<align_cfg::method_global>(config);
+        if (method_global_config.free_end_gaps_sequence1_leading || method_global_config.free_end_gaps_sequence2_leading
+            || method_global_config.free_end_gaps_sequence1_trailing
+            || method_global_config.free_end_gaps_sequence2_trailing)
+            throw invalid_alignment_configuration{"The align_cfg::wavefront configuration cannot be combined with "
+                                                  "free end gaps."};
+
+        constexpr int32_t alphabet_size = seqan3::alphabet_size<alphabet_type>;
+        auto score = [&](int32_t const rank1, int32_t const rank2)
+        {
+            return static_cast<int32_t>(this->scoring_scheme.score(assign_rank_to(rank1, alphabet_type{}),
+                                                                   assign_rank_to(rank2, alphabet_type{})));
+        };
+
+        match_score = score(0, 0);
+        int32_t const mismatch_score = (alphabet_size > 1) ? score(0, 1) : match_score - 1;
+        for (int32_t rank1 = 0; rank1 < alphabet_size; ++rank1)
+            for (int32_t rank2 = 0; rank2 < alphabet_size; ++rank2)
+                if (score(rank1, rank2) != ((rank1 == rank2) ? match_score : mismatch_score))
+                    throw invalid_alignment_configuration{"The align_cfg::wavefront configuration requires a "
+                                                          "scoring scheme with a single match and mismatch score."};
+
+        int32_t const gap_extension_score = this->gap_extension_score;
+        int32_t const gap_open_score = this->gap_open_score - gap_extension_score; // The policy adds the extension.
+
+        mismatch_penalty = 2 * (match_score - mismatch_score);
+        gap_extension_penalty = match_score - 2 * gap_extension_score;
+        gap_open_penalty = -2 * gap_open_score + gap_extension_penalty;
+
+        if (mismatch_penalty <= 0 || gap_extension_penalty <= 0 || gap_open_penalty < gap_extension_penalty)
+            throw invalid_alignment_configuration{"The align_cfg::wavefront configuration requires a match score "
+                                                  "larger than the mismatch score and twice the gap extension score "
+                                                  "and a gap open score not larger than 0."};
+    }
+    //!\}
+
+    /*!\name Invocation
+     * \{
+     */
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \throws std::bad_alloc during allocation of the wavefronts.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Let `n` be the length of the first sequence, `m` be the length of the second sequence and `s` be the
+     * penalty of the optimal alignment. The runtime is \f$ O((n + m) * s) \f$. The space is \f$ O(s^2) \f$ if the
+     * trace is required and \f$ O(s) \f$ otherwise, plus \f$ O(n + m) \f$ for the sequences.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        static thread_local trace_segments trace{};
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            int32_t const sequence1_size = std::ranges::distance(get<0>(sequence_pair));
+            int32_t const sequence2_size = std::ranges::distance(get<1>(sequence_pair));
+
+            initialise_ranks(get<0>(sequence_pair), sequence1_ranks, -1);
+            initialise_ranks(get<1>(sequence_pair), sequence2_ranks, -2);
+
+            int32_t const penalty = compute_wavefronts(sequence1_size, sequence2_size);
+
+            if constexpr (traits_type::requires_trace_information)
+                compute_trace(penalty, sequence1_size, sequence2_size, trace);
+
+            int64_t const score = (static_cast<int64_t>(match_score) * (sequence1_size + sequence2_size) - penalty) / 2;
+            matrix_coordinate const end_coordinate{row_index_type{static_cast<size_t>(sequence2_size)},
+                                                   column_index_type{static_cast<size_t>(sequence1_size)}};
+
+            this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                         std::move(idx),
+                                         static_cast<score_type>(score),
+                                         end_coordinate,
+                                         trace,
+                                         callback);
+
+            release_excess_memory(trace, (static_cast<size_t>(sequence1_size) + 1) * (sequence2_size + 1));
+        }
+    }
+    //!\}
+
+protected:
+    //!\brief The offset representing an unreachable diagonal, which can be incremented without an overflow.
+    static constexpr int32_t null_offset() noexcept
+    {
+        return std::numeric_limits<int32_t>::lowest() / 4;
+    }
+
+    /*!\brief Stores the ranks of the given sequence followed by a sentinel.
+     * \tparam sequence_t The type of the sequence; must model std::ranges::input_range.
+     * \param[in] sequence The sequence.
+     * \param[out] ranks The ranks of the sequence in the alphabet of the scoring scheme.
+     * \param[in] sentinel The negative sentinel, which stops the extension at the end of the sequence.
+     */
+    template <std::ranges::input_range sequence_t>
+    static void initialise_ranks(sequence_t && sequence, std::vector<int32_t> & ranks, int32_t const sentinel)
+    {
+        ranks.clear();
+        for (auto && symbol : sequence)
+        {
+            if constexpr (explicitly_convertible_to<std::ranges::range_reference_t<sequence_t>, alphabet_type>)
+                ranks.push_back(seqan3::to_rank(static_cast<alphabet_type>(symbol)));
+            else // e.g. the seqan3::hamming_scoring_scheme compares the symbols directly.
+                ranks.push_back(seqan3::to_rank(symbol));
+        }
+        ranks.push_back(sentinel);
+    }
+
+    //!\brief Returns the wavefront of the given penalty.
+    wavefront_type & wavefront_at(int32_t const penalty) noexcept
+    {
+        if (penalty < 0)
+            return empty_wavefront;
+
+        if constexpr (traits_type::requires_trace_information)
+            return wavefronts[penalty];
+        else
+            return wavefronts[penalty % wavefronts.size()];
+    }
+
+    /*!\brief Computes the wavefronts until the last cell of the alignment matrix is reached.
+     * \param[in] sequence1_size The size of the first sequence.
+     * \param[in] sequence2_size The size of the second sequence.
+     * \returns The penalty of the optimal alignment.
+     */
+    int32_t compute_wavefronts(int32_t const sequence1_size, int32_t const sequence2_size)
+    {
+        if constexpr (traits_type::requires_trace_information)
+            wavefronts.resize(1);
+        else
+            wavefronts.resize(std::max(mismatch_penalty, gap_open_penalty) + 1);
+
+        int32_t const final_diagonal = sequence1_size - sequence2_size;
+
+        // The initial wavefront only contains the origin.
+        wavefront_type & initial_wavefront = wavefront_at(0);
+        initial_wavefront.lowest_diagonal = 0;
+        initial_wavefront.highest_diagonal = 0;
+        initial_wavefront.optimal_offsets.assign(1, 0);
+        initial_wavefront.horizontal_offsets.assign(1, null_offset());
+        initial_wavefront.vertical_offsets.assign(1, null_offset());
+
+        for (int32_t penalty = 0;; ++penalty)
+        {
+            if (penalty > 0)
+            {
+                if constexpr (traits_type::requires_trace_information)
+                    wavefronts.resize(penalty + 1);
+
+                compute_next_wavefront(penalty, sequence1_size, sequence2_size);
+            }
+
+            wavefront_type & wavefront = wavefront_at(penalty);
+            extend(wavefront);
+
+            if (wavefront_type::at(wavefront, wavefront.optimal_offsets, final_diagonal) == sequence1_size)
+                return penalty;
+        }
+    }
+
+    /*!\brief Computes the wavefront of the given penalty from the wavefronts of the smaller penalties.
+     * \param[in] penalty The penalty of the wavefront to compute.
+     * \param[in] sequence1_size The size of the first sequence.
+     * \param[in] sequence2_size The size of the second sequence.
+     */
+    void compute_next_wavefront(int32_t const penalty, int32_t const sequence1_size, int32_t const sequence2_size)
+    {
+        wavefront_type const & mismatch_source = wavefront_at(penalty - mismatch_penalty);
+        wavefront_type const & open_source = wavefront_at(penalty - gap_open_penalty);
+        wavefront_type const & extension_source = wavefront_at(penalty - gap_extension_penalty);
+        wavefront_type & wavefront = wavefront_at(penalty);
+
+        // Determine the diagonals that can be reached from the sources.
+        int32_t lowest_diagonal = std::numeric_limits<int32_t>::max();
+        int32_t highest_diagonal = std::numeric_limits<int32_t>::lowest();
+        auto widen = [&](wavefront_type const & source, int32_t const lower_shift, int32_t const upper_shift)
+        {
+            if (source.lowest_diagonal <= source.highest_diagonal)
+            {
+                lowest_diagonal = std::min(lowest_diagonal, source.lowest_diagonal + lower_shift);
+                highest_diagonal = std::max(highest_diagonal, source.highest_diagonal + upper_shift);
+            }
+        };
+        widen(mismatch_source, 0, 0);
+        widen(open_source, -1, 1);
+        widen(extension_source, -1, 1);
+
+        wavefront.lowest_diagonal = std::max(lowest_diagonal, -sequence2_size);
+        wavefront.highest_diagonal = std::min(highest_diagonal, sequence1_size);
+
+        if (wavefront.lowest_diagonal > wavefront.highest_diagonal)
+            return;
+
+        size_t const wavefront_size = wavefront.highest_diagonal - wavefront.lowest_diagonal + 1;
+        wavefront.optimal_offsets.resize(wavefront_size);
+        wavefront.horizontal_offsets.resize(wavefront_size);
+        wavefront.vertical_offsets.resize(wavefront_size);
+
+        for (int32_t diagonal = wavefront.lowest_diagonal; diagonal <= wavefront.highest_diagonal; ++diagonal)
+        {
+            size_t const index = diagonal - wavefront.lowest_diagonal;
+
+            int32_t const horizontal = std::max(
+                horizontal_step(wavefront_type::at(open_source, open_source.optimal_offsets, diagonal - 1),
+                                sequence1_size),
+                horizontal_step(wavefront_type::at(extension_source, extension_source.horizontal_offsets, diagonal - 1),
+                                sequence1_size));
+            int32_t const vertical = std::max(
+                vertical_step(wavefront_type::at(open_source, open_source.optimal_offsets, diagonal + 1),
+                              diagonal,
+                              sequence2_size),
+                vertical_step(wavefront_type::at(extension_source, extension_source.vertical_offsets, diagonal + 1),
+                              diagonal,
+                              sequence2_size));
+            int32_t const mismatch =
+                diagonal_step(wavefront_type::at(mismatch_source, mismatch_source.optimal_offsets, diagonal),
+                              diagonal,
+                              sequence1_size,
+                              sequence2_size);
+
+            wavefront.horizontal_offsets[index] = horizontal;
+            wavefront.vertical_offsets[index] = vertical;
+            wavefront.optimal_offsets[index] = std::max({mismatch, horizontal, vertical});
+        }
+    }
+
+    //!\brief Moves the given offset of diagonal `k - 1` one column to the right on diagonal `k` if possible.
+    static int32_t horizontal_step(int32_t const offset, int32_t const sequence1_size) noexcept
+    {
+        return (offset < sequence1_size) ? offset + 1 : null_offset();
+    }
+
+    //!\brief Moves the given offset of diagonal `k + 1` one row down on diagonal `k` if possible.
+    static int32_t vertical_step(int32_t const offset, int32_t const diagonal, int32_t const sequence2_size) noexcept
+    {
+        return (offset - diagonal <= sequence2_size) ? offset : null_offset();
+    }
+
+    //!\brief Moves the given offset one cell along its diagonal if possible.
+    static int32_t diagonal_step(int32_t const offset,
+                                 int32_t const diagonal,
+                                 int32_t const sequence1_size,
+                                 int32_t const sequence2_size) noexcept
+    {
+        return (offset < sequence1_size && offset - diagonal < sequence2_size) ? offset + 1 : null_offset();
+    }
+
+    /*!\brief Extends the alignments ending with a match or mismatch along the matches of their diagonals.
+     * \param[in,out] wavefront The wavefront to extend.
+     *
+     * \details
+     *
+     * The sentinels at the end of both rank sequences differ, such that the extension stops at the end of the
+     * sequences without checking any bounds.
+     */
+    void extend(wavefront_type & wavefront) const noexcept
+    {
+        for (int32_t diagonal = wavefront.lowest_diagonal; diagonal <= wavefront.highest_diagonal; ++diagonal)
+        {
+            int32_t & offset = wavefront.optimal_offsets[diagonal - wavefront.lowest_diagonal];
+
+            if (offset < 0 || offset < diagonal) // Not reachable.
+                continue;
+
+            int32_t const * rank1_ptr = sequence1_ranks.data() + offset;
+            int32_t const * rank2_ptr = sequence2_ranks.data() + (offset - diagonal);
+            int32_t const * const rank1_begin = rank1_ptr;
+
+            while (*rank1_ptr == *rank2_ptr)
+            {
+                ++rank1_ptr;
+                ++rank2_ptr;
+            }
+
+            offset += rank1_ptr - rank1_begin;
+        }
+    }
+
+    /*!\brief Recovers the trace from the stored wavefronts.
+     * \param[in] penalty The penalty of the optimal alignment.
+     * \param[in] sequence1_size The size of the first sequence.
+     * \param[in] sequence2_size The size of the second sequence.
+     * \param[out] trace The trace of the alignment from the origin to the last cell of the alignment matrix.
+     *
+     * \details
+     *
+     * Starting from the last cell, the predecessor of every offset is determined by recomputing the recursion.
+     * Mismatches are preferred over gaps and gap openings over gap extensions.
+     */
+    void compute_trace(int32_t penalty,
+                       int32_t const sequence1_size,
+                       int32_t const sequence2_size,
+                       trace_segments & trace)
+    {
+        reverse_trace.clear();
+        auto add_steps = [&](trace_directions const direction, int32_t const count)
+        {
+            if (count == 0)
+                return;
+
+            if (!reverse_trace.empty() && reverse_trace.back().first == direction)
+                reverse_trace.back().second += count;
+            else
+                reverse_trace.emplace_back(direction, count);
+        };
+
+        int32_t diagonal = sequence1_size - sequence2_size;
+        int32_t offset = sequence1_size;
+        wavefront_component component = wavefront_component::optimal;
+
+        while (penalty > 0 || component != wavefront_component::optimal)
+        {
+            if (component == wavefront_component::optimal)
+            {
+                wavefront_type const & wavefront = wavefront_at(penalty);
+                wavefront_type const & mismatch_source = wavefront_at(penalty - mismatch_penalty);
+                int32_t const mismatch =
+                    diagonal_step(wavefront_type::at(mismatch_source, mismatch_source.optimal_offsets, diagonal),
+                                  diagonal,
+                                  sequence1_size,
+                                  sequence2_size);
+                int32_t const horizontal = wavefront_type::at(wavefront, wavefront.horizontal_offsets, diagonal);
+                int32_t const vertical = wavefront_type::at(wavefront, wavefront.vertical_offsets, diagonal);
+                int32_t const extension_begin = std::max({mismatch, horizontal, vertical});
+
+                add_steps(trace_directions::diagonal, offset - extension_begin);
+                offset = extension_begin;
+
+                if (offset == mismatch)
+                {
+                    add_steps(trace_directions::diagonal, 1);
+                    --offset;
+                    penalty -= mismatch_penalty;
+                }
+                else
+                {
+                    component =
+                        (offset == horizontal) ? wavefront_component::horizontal : wavefront_component::vertical;
+                }
+            }
+            else if (component == wavefront_component::horizontal)
+            {
+                wavefront_type const & open_source = wavefront_at(penalty - gap_open_penalty);
+                bool const is_open = wavefront_type::at(open_source, open_source.optimal_offsets, diagonal - 1) + 1
+                                  == offset;
+
+                add_steps(trace_directions::left, 1);
+                --offset;
+                --diagonal;
+                penalty -= is_open ? gap_open_penalty : gap_extension_penalty;
+                component = is_open ? wavefront_component::optimal : wavefront_component::horizontal;
+            }
+            else
+            {
+                wavefront_type const & open_source = wavefront_at(penalty - gap_open_penalty);
+                bool const is_open =
+                    wavefront_type::at(open_source, open_source.optimal_offsets, diagonal + 1) == offset;
+
+                add_steps(trace_directions::up, 1);
+                ++diagonal;
+                penalty -= is_open ? gap_open_penalty : gap_extension_penalty;
+                component = is_open ? wavefront_component::optimal : wavefront_component::vertical;
+            }
+        }
+
+        add_steps(trace_directions::diagonal, offset); // The leading matches.
+
+        trace.reset(matrix_coordinate{row_index_type{0u}, column_index_type{0u}});
+        for (auto it = reverse_trace.rbegin(); it != reverse_trace.rend(); ++it)
+            trace.append(it->first, it->second);
+    }
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,419 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_x_drop.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <utility>
+
+#include <seqan3/alignment/configuration/align_config_drop.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The alignment algorithm type to compute extension alignments with the X-drop or Z-drop heuristic.
+ * \implements std::invocable
+ * \ingroup alignment_pairwise
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam policies_t Variadic template argument for the different policies of this alignment algorithm.
+ *
+ * \details
+ *
+ * Computes the alignment matrix column by column with the same policies as the
+ * seqan3::detail::pairwise_alignment_algorithm, but restricts every column to the rows that can still be part of the
+ * extension. The optimum tracker tracks every computed cell, such that the extension may end anywhere.
+ *
+ * If seqan3::align_cfg::x_drop is given, every cell whose score is more than X below the best score seen so far is
+ * pruned, i.e. its scores are set to minus infinity. The next column is only computed from the first to the last
+ * row that was not pruned, plus the rows below that can still be reached with a vertical gap. If all cells of a column
+ * are pruned the extension ends. If seqan3::align_cfg::z_drop is given, the extension ends as soon as the best score
+ * of a column fulfils the Z-drop condition. Since all cells outside of the computed rows store minus infinity, the
+ * runtime is proportional to the size of the aligned region.
+ */
+template <typename alignment_configuration_t, typename... policies_t>
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+class pairwise_alignment_algorithm_x_drop :
+    protected pairwise_alignment_algorithm<alignment_configuration_t, policies_t...>
+{
+protected:
+    //!\brief The type of the base algorithm.
+    using base_algorithm_t = pairwise_alignment_algorithm<alignment_configuration_t, policies_t...>;
+
+    // Import types from base class.
+    using typename base_algorithm_t::alignment_result_type;
+    using typename base_algorithm_t::score_type;
+    using typename base_algorithm_t::traits_type;
+
+    static_assert(traits_type::is_global, "The extension alignment is only available for global alignments.");
+    static_assert(!traits_type::is_vectorised, "The extension alignment cannot be vectorised.");
+    static_assert(std::is_arithmetic_v<score_type>, "The score type must be arithmetic.");
+
+    //!\brief The X-drop value, which is capped such that it can be subtracted from any score without overflow.
+    score_type x_drop_score{max_drop_score()};
+    //!\brief The Z-drop value.
+    int64_t z_drop_score{std::numeric_limits<int64_t>::max() / 2};
+    //!\brief The first row of the current column that was not pruned.
+    size_t first_active_row{};
+    //!\brief The row behind the last row of the current column that was not pruned.
+    size_t end_active_row{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_x_drop() = default;                                            //!< Defaulted.
+    pairwise_alignment_algorithm_x_drop(pairwise_alignment_algorithm_x_drop const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_x_drop(pairwise_alignment_algorithm_x_drop &&) = default;      //!< Defaulted.
+    pairwise_alignment_algorithm_x_drop &
+    operator=(pairwise_alignment_algorithm_x_drop const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_x_drop & operator=(pairwise_alignment_algorithm_x_drop &&) = default; //!< Defaulted.
+    ~pairwise_alignment_algorithm_x_drop() = default;                                                  //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \details
+     *
+     * Initialises the base policies of the alignment algorithm and reads the values of seqan3::align_cfg::x_drop and
+     * seqan3::align_cfg::z_drop.
+     *
+     * \throws seqan3::invalid_alignment_configuration if a negative drop value was given.
+     */
+    pairwise_alignment_algorithm_x_drop(alignment_configuration_t const & config) : base_algorithm_t(config)
+    {
+        if constexpr (alignment_configuration_t::template exists<align_cfg::x_drop>())
+        {
+            int32_t const x_drop = get<align_cfg::x_drop>(config).score;
+
+            if (x_drop < 0)
+                throw invalid_alignment_configuration{"The align_cfg::x_drop value must not be negative."};
+
+            x_drop_score = static_cast<score_type>(std::min<int64_t>(x_drop, max_drop_score()));
+        }
+
+        if constexpr (alignment_configuration_t::template exists<align_cfg::z_drop>())
+        {
+            z_drop_score = get<align_cfg::z_drop>(config).score;
+
+            if (z_drop_score < 0)
+                throw invalid_alignment_configuration{"The align_cfg::z_drop value must not be negative."};
+        }
+    }
+    //!\}
+
+    /*!\name Invocation
+     * \{
+     */
+    /*!\brief Computes the extension alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \throws std::bad_alloc during allocation of the alignment matrices.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Let `n` be the length of the first sequence, `m` be the length of the second sequence and `r` be the number
+     * of cells that were computed before the extension stopped. The runtime is \f$ O(r) \f$ plus \f$ O(m) \f$
+     * for the initialisation of the score column. The space is \f$ O(m) \f$.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            size_t const sequence1_size = std::ranges::distance(get<0>(sequence_pair));
+            size_t const sequence2_size = std::ranges::distance(get<1>(sequence_pair));
+
+            auto && [alignment_matrix, index_matrix] =
+                this->acquire_matrices(sequence1_size, sequence2_size, minus_infinity());
+            compute_matrix(get<0>(sequence_pair), get<1>(sequence_pair), alignment_matrix, index_matrix);
+            this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                         std::move(idx),
+                                         this->optimal_score,
+                                         this->optimal_coordinate,
+                                         alignment_matrix,
+                                         callback);
+            this->release_matrices();
+        }
+    }
+    //!\}
+
+protected:
+    //!\brief The score representing minus infinity, which can be added to any other score without an underflow.
+    static constexpr score_type minus_infinity() noexcept
+    {
+        return std::numeric_limits<score_type>::lowest() / 4;
+    }
+
+    //!\brief The largest drop value that keeps every reachable score above seqan3::detail::minus_infinity.
+    static constexpr score_type max_drop_score() noexcept
+    {
+        return -(minus_infinity() / 2);
+    }
+
+    /*!\brief Compute the extension alignment.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::forward_range.
+     * \tparam alignment_matrix_t The type of the alignment matrix; must model std::ranges::input_range and its
+     *                            std::ranges::range_reference_t type must model std::ranges::random_access_range.
+     * \tparam index_matrix_t The type of the index matrix; must model std::ranges::input_range and its
+     *                            std::ranges::range_reference_t type must model std::ranges::random_access_range.
+     *
+     * \param[in] sequence1 The first sequence to compute the alignment for.
+     * \param[in] sequence2 The second sequence to compute the alignment for.
+     * \param[in] alignment_matrix The alignment matrix to compute; all cells must be initialised with
+     *                             seqan3::detail::pairwise_alignment_algorithm_x_drop::minus_infinity.
+     * \param[in] index_matrix The index matrix corresponding to the alignment matrix.
+     */
+    template <std::ranges::forward_range sequence1_t,
+              std::ranges::forward_range sequence2_t,
+              std::ranges::input_range alignment_matrix_t,
+              std::ranges::input_range index_matrix_t>
+        requires std::ranges::random_access_range<std::ranges::range_reference_t<alignment_matrix_t>>
+              && std::ranges::random_access_range<std::ranges::range_reference_t<index_matrix_t>>
+    void compute_matrix(sequence1_t && sequence1,
+                        sequence2_t && sequence2,
+                        alignment_matrix_t && alignment_matrix,
+                        index_matrix_t && index_matrix)
+    {
+        // ---------------------------------------------------------------------
+        // Initialisation phase: initialise first column until the score drops.
+        // ---------------------------------------------------------------------
+
+        this->reset_optimum(); // Reset the tracker for the new alignment computation.
+
+        size_t const row_count = std::ranges::distance(sequence2) + 1;
+        auto alignment_matrix_it = alignment_matrix.begin();
+        auto indexed_matrix_it = index_matrix.begin();
+
+        initialise_column(*alignment_matrix_it, *indexed_matrix_it, row_count);
+
+        // ---------------------------------------------------------------------
+        // Iteration phase: compute the columns until the extension stops.
+        // ---------------------------------------------------------------------
+
+        size_t column = 0;
+        for (auto alphabet1 : sequence1)
+        {
+            if (first_active_row == end_active_row) // All cells of the previous column were pruned.
+                break;
+
+            auto [column_score, column_row] = compute_column(*++alignment_matrix_it,
+                                                             *++indexed_matrix_it,
+                                                             this->scoring_scheme_profile_column(alphabet1),
+                                                             sequence2);
+
+            if (is_z_dropped(column_score, column_row, ++column))
+                break;
+        }
+    }
+
+    /*!\brief Initialise the first column of the alignment matrix.
+     * \tparam alignment_column_t The type of the alignment column; must model std::ranges::random_access_range.
+     * \tparam cell_index_column_t The type of the indexed column; must model std::ranges::random_access_range.
+     *
+     * \param[in] alignment_column The current alignment matrix column to compute.
+     * \param[in] cell_index_column The current index matrix column to get the respective cell indices.
+     * \param[in] row_count The number of rows of the alignment matrix.
+     *
+     * \details
+     *
+     * Computes the cells of the first column until the first cell is pruned.
+     */
+    template <std::ranges::random_access_range alignment_column_t,
+              std::ranges::random_access_range cell_index_column_t>
+    void initialise_column(alignment_column_t && alignment_column,
+                           cell_index_column_t && cell_index_column,
+                           size_t const row_count)
+    {
+        auto first_column_it = alignment_column.begin();
+        auto cell_index_column_it = cell_index_column.begin();
+        *first_column_it = this->track_cell(this->initialise_origin_cell(), *cell_index_column_it);
+
+        size_t row = 1;
+        for (; row < row_count; ++row)
+        {
+            auto cell =
+                this->track_cell(this->initialise_first_column_cell(*++first_column_it), *++cell_index_column_it);
+
+            if (is_x_dropped(cell.best_score()))
+            {
+                *first_column_it = pruned_cell();
+                break;
+            }
+
+            *first_column_it = cell;
+        }
+
+        first_active_row = 0;
+        end_active_row = row;
+    }
+
+    /*!\brief Computes the active rows of any column of the alignment matrix except the first one.
+     * \tparam alignment_column_t The type of the alignment column; must model std::ranges::random_access_range.
+     * \tparam cell_index_column_t The type of the indexed column; must model std::ranges::random_access_range.
+     * \tparam alphabet1_t The type of the current symbol of sequence1.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::forward_range.
+     *
+     * \param[in] alignment_column The current alignment matrix column to compute.
+     * \param[in] cell_index_column The current index matrix column to get the respective cell indices.
+     * \param[in] alphabet1 The current symbol of sequence1.
+     * \param[in] sequence2 The second sequence to align against `alphabet1`.
+     *
+     * \returns The best score of the column and its row.
+     *
+     * \details
+     *
+     * Computes all rows that can be reached from a cell of the previous column that was not pruned. Below the last
+     * such row, the computation continues as long as the cells are not pruned, since they can be reached with a
+     * vertical gap. Afterwards, the active rows are set to the rows of the first and the last cell that were not
+     * pruned.
+     */
+    template <std::ranges::random_access_range alignment_column_t,
+              std::ranges::random_access_range cell_index_column_t,
+              typename alphabet1_t,
+              std::ranges::forward_range sequence2_t>
+    std::pair<score_type, size_t> compute_column(alignment_column_t && alignment_column,
+                                                 cell_index_column_t && cell_index_column,
+                                                 alphabet1_t const & alphabet1,
+                                                 sequence2_t && sequence2)
+    {
+        size_t const row_count = std::ranges::distance(sequence2) + 1;
+        size_t row = first_active_row;
+        size_t const previous_end_row = end_active_row;
+
+        std::pair<score_type, size_t> column_optimum{minus_infinity(), row};
+        first_active_row = row_count;
+        end_active_row = 0;
+
+        // Updates the active rows and the column optimum with the computed cell or prunes it.
+        auto update = [&](auto && alignment_cell, auto && cell)
+        {
+            score_type const score = cell.best_score();
+
+            if (is_x_dropped(score))
+            {
+                alignment_cell = pruned_cell();
+                return false;
+            }
+
+            alignment_cell = cell;
+            first_active_row = std::min(first_active_row, row);
+            end_active_row = row + 1;
+            if (score >= column_optimum.first)
+                column_optimum = {score, row};
+
+            return true;
+        };
+
+        // ---------------------------------------------------------------------
+        // Initial phase: prepare column and compute the first active cell
+        // ---------------------------------------------------------------------
+
+        auto alignment_column_it = std::ranges::next(alignment_column.begin(), row);
+        auto cell_index_column_it = std::ranges::next(cell_index_column.begin(), row);
+        score_type diagonal = minus_infinity();
+        bool is_alive = false;
+
+        if (row == 0)
+        {
+            auto cell = *alignment_column_it;
+            diagonal = cell.best_score();
+            is_alive = update(*alignment_column_it,
+                              this->track_cell(this->initialise_first_row_cell(cell), *cell_index_column_it));
+            ++alignment_column_it;
+            ++cell_index_column_it;
+            ++row;
+        }
+        else
+        {
+            // The cell above is outside of the active rows. Overwriting it resets the vertical score.
+            *std::ranges::prev(alignment_column_it) = pruned_cell();
+        }
+
+        // ---------------------------------------------------------------------
+        // Iteration phase: iterate over the active rows and compute each cell
+        // ---------------------------------------------------------------------
+
+        auto sequence2_it = std::ranges::next(std::ranges::begin(sequence2), row - 1);
+        for (; row < row_count && (row <= previous_end_row || is_alive); ++row)
+        {
+            auto cell = *alignment_column_it;
+            score_type next_diagonal = cell.best_score();
+            is_alive = update(*alignment_column_it,
+                              this->track_cell(this->compute_inner_cell(diagonal,
+                                                                        cell,
+                                                                        this->scoring_scheme.score(alphabet1,
+                                                                                                   *sequence2_it)),
+                                               *cell_index_column_it));
+            diagonal = next_diagonal;
+            ++alignment_column_it;
+            ++cell_index_column_it;
+            ++sequence2_it;
+        }
+
+        if (first_active_row == row_count) // All cells were pruned.
+            first_active_row = end_active_row = 0;
+
+        return column_optimum;
+    }
+
+    //!\brief Returns a cell whose scores are all minus infinity.
+    auto pruned_cell() const noexcept
+    {
+        return decltype(this->initialise_origin_cell()){minus_infinity(), minus_infinity(), minus_infinity()};
+    }
+
+    //!\brief Checks whether the given score is more than the X-drop value below the best score seen so far.
+    bool is_x_dropped(score_type const score) const noexcept
+    {
+        return score < this->optimal_score - x_drop_score;
+    }
+
+    /*!\brief Checks whether the extension stops after the given column according to the Z-drop condition.
+     * \param[in] column_score The best score of the current column.
+     * \param[in] column_row The row of the best score of the current column.
+     * \param[in] column The index of the current column.
+     */
+    bool is_z_dropped(score_type const column_score, size_t const column_row, size_t const column) const noexcept
+    {
+        if constexpr (!alignment_configuration_t::template exists<align_cfg::z_drop>())
+        {
+            return false;
+        }
+        else
+        {
+            int64_t const diagonal_distance = std::abs((static_cast<int64_t>(column_row) - static_cast<int64_t>(column))
+                                                       - (static_cast<int64_t>(this->optimal_coordinate.row)
+                                                          - static_cast<int64_t>(this->optimal_coordinate.col)));
+            int64_t const gap_extension = -static_cast<int64_t>(this->gap_extension_score);
+
+            return static_cast<int64_t>(this->optimal_score) - column_score
+                 > z_drop_score + gap_extension * diagonal_distance;
+        }
+    }
+};
+
+} // namespace seqan3::detail
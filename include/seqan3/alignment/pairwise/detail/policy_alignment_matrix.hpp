@@ -13,6 +13,7 @@
 
 #include <seqan3/alignment/exception.hpp>
 #include <seqan3/alignment/matrix/detail/coordinate_matrix.hpp>
+#include <seqan3/alignment/matrix/detail/release_excess_memory.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/core/configuration/configuration.hpp>
 #include <seqan3/core/detail/template_inspection.hpp>
@@ -129,7 +130,8 @@ protected:
      *
      * Acquires a thread local alignment and index matrix. Initialises the matrices with the given
      * sequence sizes and the initial score value. In the banded alignment, the alignment matrix is reduced to
-     * the column count times the band size.
+     * the column count times the band size. The memory of the matrices is reused by subsequent calls on the same
+     * thread until seqan3::detail::policy_alignment_matrix::release_matrices releases it after a large alignment.
      *
      * ### Exception
      *
@@ -149,8 +151,7 @@ protected:
         if constexpr (traits_t::is_banded)
             check_valid_band_configuration(sequence1_size, sequence2_size);
 
-        static thread_local alignment_matrix_t alignment_matrix{};
-        static thread_local coordinate_matrix<matrix_index_type> index_matrix{};
+        auto & [alignment_matrix, index_matrix, cell_count] = thread_local_matrices();
 
         // Increase dimension by one for the initialisation of the matrix.
         size_t const column_count = sequence1_size + 1;
@@ -166,10 +167,26 @@ protected:
         }
 
         alignment_matrix.resize(column_index_type{column_count}, row_index_type{row_count}, initial_score);
+        cell_count = column_count * row_count;
 
         return std::tie(alignment_matrix, index_matrix);
     }
 
+    /*!\brief Releases the memory of the thread local matrices after a large alignment.
+     *
+     * \details
+     *
+     * Must be called after the alignment result was generated. If the matrices acquired last have more than
+     * seqan3::detail::retained_alignment_cell_count cells, their memory is released. Otherwise, it is kept for the
+     * next alignment computed by the same thread.
+     */
+    void release_matrices() const
+    {
+        auto & [alignment_matrix, index_matrix, cell_count] = thread_local_matrices();
+        release_excess_memory(alignment_matrix, cell_count);
+        release_excess_memory(index_matrix, cell_count);
+    }
+
     /*!\brief Checks whether the band is valid for the given sequence sizes.
      *
      * \param[in] sequence1_size The size of the first sequence.
@@ -201,5 +218,24 @@ protected:
                                                     "alignment configuration: "
                                                   + error_cause};
     }
+
+private:
+    //!\brief The matrices whose memory is reused by all alignments computed by the same thread.
+    struct matrices_type
+    {
+        //!\brief The alignment matrix.
+        alignment_matrix_t alignment_matrix{};
+        //!\brief The index matrix.
+        coordinate_matrix<matrix_index_type> index_matrix{};
+        //!\brief The number of cells of the alignment matrix acquired last.
+        size_t cell_count{};
+    };
+
+    //!\brief Returns the matrices of the calling thread.
+    static matrices_type & thread_local_matrices() noexcept
+    {
+        static thread_local matrices_type matrices{};
+        return matrices;
+    }
 };
 } // namespace seqan3::detail
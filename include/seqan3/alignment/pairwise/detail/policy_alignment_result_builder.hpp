@@ -9,7 +9,12 @@
 
 #pragma once
 
+#include <limits>
+#include <vector>
+
 #include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/matrix/detail/cigar_from_trace_path.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_concept.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/core/configuration/configuration.hpp>
 #include <seqan3/core/detail/empty_type.hpp>
@@ -40,6 +45,9 @@ protected:
 
     static_assert(!std::same_as<result_type, empty_type>, "The alignment result type was not configured.");
 
+    //!\brief The minimal score of seqan3::align_cfg::min_score if given.
+    int32_t min_score{std::numeric_limits<int32_t>::lowest()};
+
     /*!\name Constructors, destructor and assignment
      * \{
      */
@@ -51,10 +59,17 @@ protected:
     ~policy_alignment_result_builder() = default;                                                   //!< Defaulted.
 
     /*!\brief Construction and initialisation using the alignment configuration.
-     * \param[in] config The alignment configuration [not used in this context].
+     * \param[in] config The alignment configuration.
+     *
+     * \details
+     *
+     * Reads the minimal score of seqan3::align_cfg::min_score if given.
      */
-    policy_alignment_result_builder(alignment_configuration_t const & SEQAN3_DOXYGEN_ONLY(config))
-    {}
+    policy_alignment_result_builder([[maybe_unused]] alignment_configuration_t const & config)
+    {
+        if constexpr (traits_type::has_min_score)
+            min_score = get<align_cfg::min_score>(config).score;
+    }
     //!\}
 
     /*!\brief Builds the seqan3::alignment_result based on the given alignment result type and then invokes the
@@ -80,6 +95,10 @@ protected:
      * \ref seqan3_align_cfg_output_configurations "seqan3::align_cfg::output_*" configuration only the requested values
      * are stored. In some cases some additional work is done to generate the requested result. For example computing
      * the associated alignment from the traceback matrix.
+     *
+     * If seqan3::align_cfg::min_score is given and the score is below the minimal score, no traceback is computed.
+     * As for the edit distance, the score of the result is set to seqan3::detail::matrix_inf and the begin and end
+     * positions are set to the sizes of the sequences.
      */
     template <typename sequence_pair_t,
               typename index_t,
@@ -106,6 +125,33 @@ protected:
         if constexpr (traits_type::output_sequence2_id)
             result.data.sequence2_id = id;
 
+        if constexpr (traits_type::has_min_score)
+        {
+            if (score < min_score)
+            {
+                size_t const sequence1_size = std::ranges::distance(get<0>(sequence_pair));
+                size_t const sequence2_size = std::ranges::distance(get<1>(sequence_pair));
+
+                if constexpr (traits_type::compute_score)
+                    result.data.score = matrix_inf<std::remove_cvref_t<decltype(result.data.score)>>;
+
+                if constexpr (traits_type::compute_end_positions)
+                {
+                    result.data.end_positions.first = sequence1_size;
+                    result.data.end_positions.second = sequence2_size;
+                }
+
+                if constexpr (traits_type::compute_begin_positions)
+                {
+                    result.data.begin_positions.first = sequence1_size;
+                    result.data.begin_positions.second = sequence2_size;
+                }
+
+                callback(std::move(result));
+                return;
+            }
+        }
+
         if constexpr (traits_type::compute_score)
         {
             static_assert(!std::same_as<decltype(result.data.score), invalid_t>,
@@ -122,7 +168,25 @@ protected:
             result.data.end_positions.second = end_positions.row;
         }
 
-        if constexpr (traits_type::requires_trace_information)
+        if constexpr (traits_type::compute_cigar)
+        {
+            static_assert(!std::same_as<decltype(result.data.cigar_sequence), invalid_t>,
+                          "Invalid configuration. Expected result with CIGAR string!");
+
+            // The operations are written directly into the buffer owned by the result.
+            matrix_coordinate const begin_positions =
+                cigar_from_trace_path(alignment_matrix.trace_path(end_positions), result.data.cigar_sequence);
+
+            if constexpr (traits_type::compute_begin_positions)
+            {
+                result.data.begin_positions.first = begin_positions.col;
+                result.data.begin_positions.second = begin_positions.row;
+            }
+        }
+
+        // Unless the alignment is requested, the begin positions were already taken from the CIGAR string.
+        if constexpr (traits_type::compute_sequence_alignment
+                      || (traits_type::compute_begin_positions && !traits_type::compute_cigar))
         {
             aligned_sequence_builder builder{get<0>(sequence_pair), get<1>(sequence_pair)};
             auto aligned_sequence_result = builder(alignment_matrix.trace_path(end_positions));
@@ -132,6 +196,13 @@ protected:
                 result.data.begin_positions.first = aligned_sequence_result.first_sequence_slice_positions.first;
                 result.data.begin_positions.second = aligned_sequence_result.second_sequence_slice_positions.first;
             }
+
+            if constexpr (traits_type::compute_sequence_alignment)
+            {
+                static_assert(!std::same_as<decltype(result.data.alignment), invalid_t>,
+                              "Invalid configuration. Expected result with alignment!");
+                result.data.alignment = std::move(aligned_sequence_result.alignment);
+            }
         }
 
         callback(std::move(result));
@@ -10,11 +10,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <concepts>
 #include <limits>
 
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
 #include <seqan3/alignment/matrix/detail/coordinate_matrix.hpp>
 #include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/concept.hpp>
 #include <seqan3/core/configuration/configuration.hpp>
 #include <seqan3/core/detail/template_inspection.hpp>
 #include <seqan3/utility/tuple/concept.hpp>
@@ -173,6 +177,10 @@ public:
  * standard global alignment).
  * The optimum needs to be reset in between alignment computations in order to ensure that the correct result is
  * tracked.
+ *
+ * If seqan3::align_cfg::min_score is given, the alignment algorithm calls
+ * seqan3::detail::policy_optimum_tracker::is_min_score_unreachable after every column and stops the computation if no
+ * cell of the column can reach the minimal score anymore.
  */
 template <typename alignment_configuration_t, std::semiregular optimum_updater_t>
     requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
@@ -206,6 +214,30 @@ protected:
     //!\brief Whether cells of the last column shall be tracked.
     bool test_last_column_cell{false};
 
+    //!\brief Whether the upper bound of the reachable score is tracked for seqan3::align_cfg::min_score.
+    static constexpr bool tracks_reachable_score = traits_type::has_min_score && !traits_type::is_vectorised;
+    //!\brief Only the cells of every n-th column update the upper bound of the reachable score.
+    static constexpr size_t min_score_check_interval = 8;
+    //!\brief The type used to compute the upper bound of the reachable score without an overflow.
+    using reachable_score_type = std::conditional_t<std::integral<score_type>, int64_t, score_type>;
+
+    //!\brief The minimal score the alignment must reach.
+    reachable_score_type required_min_score{std::numeric_limits<reachable_score_type>::lowest()};
+    //!\brief The best score a single step of the alignment can add, i.e. the best non-negative substitution score.
+    reachable_score_type bound_max_step_score{};
+    //!\brief The gap open score of the configured gap costs.
+    reachable_score_type bound_gap_open_score{};
+    //!\brief The gap extension score of the configured gap costs.
+    reachable_score_type bound_gap_extension_score{};
+    //!\brief Whether the computation stops if the minimal score cannot be reached; false for positive gap scores.
+    bool prune_by_min_score{false};
+    //!\brief The number of columns that were computed since the alignment computation started.
+    size_t column_count{};
+    //!\brief The index of the last row of the alignment matrix.
+    size_t last_row_index{};
+    //!\brief The index of the last column of the alignment matrix.
+    size_t last_column_index{};
+
     /*!\name Constructors, destructor and assignment
      * \{
      */
@@ -222,13 +254,43 @@ protected:
      * \details
      *
      * Reads the state of seqan3::align_cfg::method_global and enables the tracking of the last row or column if
-     * requested. Otherwise, only the last cell will be tracked.
+     * requested. Otherwise, only the last cell will be tracked. If an extension alignment is computed
+     * (seqan3::align_cfg::x_drop or seqan3::align_cfg::z_drop), every cell is tracked, since the extension can end
+     * anywhere in the alignment matrix.
+     *
+     * If seqan3::align_cfg::min_score is given, the best substitution score of the scoring scheme is determined.
+     * The upper bound of the reachable score assumes that gaps never increase the score. Hence, the computation is not
+     * stopped early if a positive gap open or extension score is configured.
      */
     policy_optimum_tracker(alignment_configuration_t const & config)
     {
         auto method_global_config = config.get_or(align_cfg::method_global{});
         test_last_row_cell = method_global_config.free_end_gaps_sequence1_trailing;
         test_last_column_cell = method_global_config.free_end_gaps_sequence2_trailing;
+        test_every_cell = traits_type::is_extension;
+
+        if constexpr (tracks_reachable_score)
+        {
+            using alphabet_t = typename traits_type::scoring_scheme_alphabet_type;
+
+            auto const & scheme = get<align_cfg::scoring_scheme>(config).scheme;
+            for (size_t rank1 = 0; rank1 < alphabet_size<alphabet_t>; ++rank1)
+                for (size_t rank2 = 0; rank2 < alphabet_size<alphabet_t>; ++rank2)
+                    bound_max_step_score = std::max<reachable_score_type>(
+                        bound_max_step_score,
+                        scheme.score(assign_rank_to(rank1, alphabet_t{}), assign_rank_to(rank2, alphabet_t{})));
+
+            // Without a configured gap scheme, the gaps are only bounded by 0, which holds for the default gap costs.
+            if constexpr (alignment_configuration_t::template exists<align_cfg::gap_cost_affine>())
+            {
+                auto const & gap_cost = get<align_cfg::gap_cost_affine>(config);
+                bound_gap_open_score = gap_cost.open_score;
+                bound_gap_extension_score = gap_cost.extension_score;
+            }
+
+            required_min_score = get<align_cfg::min_score>(config).score;
+            prune_by_min_score = bound_gap_open_score <= 0 && bound_gap_extension_score <= 0;
+        }
     }
     //!\}
 
@@ -325,6 +387,105 @@ protected:
         optimal_coordinate = {};
     }
 
+    /*!\brief Prepares the check of seqan3::align_cfg::min_score for two sequences with the given sizes.
+     * \param[in] sequence1_size The size of the first sequence.
+     * \param[in] sequence2_size The size of the second sequence.
+     */
+    void reset_reachable_score(size_t const sequence1_size, size_t const sequence2_size) noexcept
+    {
+        last_row_index = sequence2_size;
+        last_column_index = sequence1_size;
+        column_count = 0;
+    }
+
+    /*!\brief Checks whether any cell of the last computed column can still reach the minimal score.
+     * \tparam alignment_column_t The type of the alignment column; must model std::ranges::input_range.
+     * \tparam cell_index_column_t The type of the indexed column; must model std::ranges::input_range.
+     *
+     * \param[in] alignment_column The last computed alignment matrix column.
+     * \param[in] cell_index_column The cell indices of the alignment matrix column.
+     * \param[in] cell_count The number of cells that were computed in this column.
+     *
+     * \returns `true` if the minimal score cannot be reached by any alignment that ends in a later column, `false`
+     *          otherwise.
+     *
+     * \details
+     *
+     * Must be called after every column of the alignment matrix. Since every alignment that ends in a later column
+     * passes through a cell of the given column, none of them can reach the minimal score if the upper bound of the
+     * reachable score of every cell is below it (see seqan3::detail::policy_optimum_tracker::reachable_score_bound).
+     * To keep the overhead for the alignments that reach the minimal score small, only the cells of every
+     * seqan3::detail::policy_optimum_tracker::min_score_check_interval-th column are checked.
+     */
+    template <std::ranges::input_range alignment_column_t, std::ranges::input_range cell_index_column_t>
+    bool is_min_score_unreachable(alignment_column_t && alignment_column,
+                                  cell_index_column_t && cell_index_column,
+                                  size_t const cell_count) noexcept
+    {
+        if (!prune_by_min_score || ++column_count % min_score_check_interval != 0)
+            return false;
+
+        auto alignment_column_it = alignment_column.begin();
+        auto cell_index_column_it = cell_index_column.begin();
+        for (size_t cell = 0; cell < cell_count; ++cell, ++alignment_column_it, ++cell_index_column_it)
+        {
+            if (reachable_score_bound(*alignment_column_it, *cell_index_column_it) >= required_min_score)
+                return false;
+        }
+
+        return true;
+    }
+
+    /*!\brief Returns an upper bound of the score of any alignment that leaves the column of the given cell in this
+     *        cell.
+     * \tparam cell_t The cell type of the alignment matrix; must have the member functions `best_score()` and
+     *                `horizontal_score()`.
+     *
+     * \param[in] cell The cell of the alignment matrix.
+     * \param[in] coordinate The matrix coordinate of the cell.
+     *
+     * \details
+     *
+     * From the given cell at most `min(last_row - row, last_column - column)` diagonal steps can follow and no other
+     * step increases the score. Unless the alignment may end in the last row or column, the difference of the
+     * remaining rows and columns must be bridged by gaps.
+     *
+     * Every alignment through the column has a last cell in this column, from which it continues with a diagonal or
+     * a horizontal step. Hence, the remaining vertical gaps must be opened in a later column and cost at least the
+     * gap open score plus the gap extension score for every gap position. A horizontal gap, on the other hand, might
+     * already be open in this cell. Its cost is bounded by the horizontal score of the cell, which is the score after
+     * opening or extending a horizontal gap by one position, plus the gap extension score for every further gap
+     * position. Adding the best substitution score for every diagonal step bounds the score of any alignment through
+     * this cell.
+     */
+    template <typename cell_t>
+    reachable_score_type reachable_score_bound(cell_t const & cell,
+                                               matrix_coordinate_type const & coordinate) const noexcept
+    {
+        size_t const remaining_rows = last_row_index - coordinate.row;
+        size_t const remaining_columns = last_column_index - coordinate.col;
+
+        reachable_score_type const diagonal_bound =
+            static_cast<reachable_score_type>(std::min(remaining_rows, remaining_columns)) * bound_max_step_score;
+        reachable_score_type const best_score = static_cast<reachable_score_type>(cell.best_score());
+
+        if (remaining_rows > remaining_columns && !(test_last_column_cell || test_every_cell))
+        {
+            reachable_score_type const gap_size = remaining_rows - remaining_columns;
+            return best_score + bound_gap_open_score + bound_gap_extension_score * gap_size + diagonal_bound;
+        }
+        else if (remaining_columns > remaining_rows && !(test_last_row_cell || test_every_cell))
+        {
+            reachable_score_type const gap_size = remaining_columns - remaining_rows;
+            reachable_score_type const horizontal_score = static_cast<reachable_score_type>(cell.horizontal_score());
+            return std::max(best_score + bound_gap_open_score + bound_gap_extension_score * gap_size,
+                            horizontal_score + bound_gap_extension_score * (gap_size - 1))
+                 + diagonal_bound;
+        }
+
+        return best_score + diagonal_bound;
+    }
+
     /*!\brief Handles the invocation of the optimum comparator and updater.
      * \tparam cell_t The cell type of the alignment matrix; must have a member function `best_score()`.
      *
@@ -14,14 +14,19 @@
 
 #include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/alignment/configuration/align_config_debug.hpp>
+#include <seqan3/alignment/configuration/align_config_drop.hpp>
+#include <seqan3/alignment/configuration/align_config_linear_memory.hpp>
 #include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
 #include <seqan3/alignment/configuration/align_config_on_result.hpp>
 #include <seqan3/alignment/configuration/align_config_output.hpp>
 #include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/alignment/configuration/align_config_parallel_tiles.hpp>
 #include <seqan3/alignment/configuration/align_config_result_type.hpp>
 #include <seqan3/alignment/configuration/align_config_score_type.hpp>
 #include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
 #include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
 #include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
 #include <seqan3/alignment/matrix/detail/trace_directions.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
@@ -110,8 +115,13 @@ private:
 public:
     //!\brief Flag to indicate vectorised mode.
     static constexpr bool is_vectorised = configuration_t::template exists<align_cfg::vectorised>();
+    //!\brief Flag indicating whether a single alignment is vectorised along the anti-diagonals.
+    static constexpr bool is_vectorised_anti_diagonal =
+        configuration_t::template exists<align_cfg::vectorised_anti_diagonal>();
     //!\brief Flag indicating whether parallel alignment mode is enabled.
     static constexpr bool is_parallel = configuration_t::template exists<align_cfg::parallel>();
+    //!\brief Flag indicating whether every single alignment is computed in parallel tiles.
+    static constexpr bool is_parallel_tiles = configuration_t::template exists<align_cfg::parallel_tiles>();
     //!\brief Flag indicating whether global alignment method is enabled.
     static constexpr bool is_global = configuration_t::template exists<seqan3::align_cfg::method_global>();
     //!\brief Flag indicating whether local alignment mode is enabled.
@@ -120,6 +130,15 @@ public:
     static constexpr bool is_banded = configuration_t::template exists<align_cfg::band_fixed_size>();
     //!\brief Flag indicating whether debug mode is enabled.
     static constexpr bool is_debug = configuration_t::template exists<detail::debug_mode>();
+    //!\brief Flag indicating whether the trace is computed in linear memory.
+    static constexpr bool is_linear_memory = configuration_t::template exists<align_cfg::linear_memory>();
+    //!\brief Flag indicating whether an extension alignment is computed with the X-drop or Z-drop heuristic.
+    static constexpr bool is_extension = configuration_t::template exists<align_cfg::x_drop>()
+                                      || configuration_t::template exists<align_cfg::z_drop>();
+    //!\brief Flag indicating whether alignments that do not reach a minimal score are discarded.
+    static constexpr bool has_min_score = configuration_t::template exists<align_cfg::min_score>();
+    //!\brief Flag indicating whether the global alignment is computed with the wavefront alignment algorithm.
+    static constexpr bool is_wavefront = configuration_t::template exists<align_cfg::wavefront>();
     //!\brief Flag indicating whether a user provided callback was given.
     static constexpr bool is_one_way_execution = configuration_t::template exists<align_cfg::on_result>();
     //!\brief The selected scoring scheme.
@@ -159,16 +178,19 @@ public:
         configuration_t::template exists<align_cfg::output_begin_position>();
     //!\brief Flag indicating whether the sequence alignment shall be computed.
     static constexpr bool compute_sequence_alignment = configuration_t::template exists<align_cfg::output_alignment>();
+    //!\brief Flag indicating whether the CIGAR string of the alignment shall be computed.
+    static constexpr bool compute_cigar = configuration_t::template exists<align_cfg::output_cigar>();
     //!\brief Flag indicating whether the id of the first sequence shall be returned.
     static constexpr bool output_sequence1_id = configuration_t::template exists<align_cfg::output_sequence1_id>();
     //!\brief Flag indicating whether the id of the second sequence shall be returned.
     static constexpr bool output_sequence2_id = configuration_t::template exists<align_cfg::output_sequence2_id>();
     //!\brief Flag indicating if any output option was set.
     static constexpr bool has_output_configuration = compute_score || compute_end_positions || compute_begin_positions
-                                                  || compute_sequence_alignment || output_sequence1_id
+                                                  || compute_sequence_alignment || compute_cigar || output_sequence1_id
                                                   || output_sequence2_id;
     //!\brief Flag indicating whether the trace matrix needs to be computed.
-    static constexpr bool requires_trace_information = compute_begin_positions || compute_sequence_alignment;
+    static constexpr bool requires_trace_information =
+        compute_begin_positions || compute_sequence_alignment || compute_cigar;
 };
 
 //------------------------------------------------------------------------------
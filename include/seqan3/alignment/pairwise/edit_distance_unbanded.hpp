@@ -15,6 +15,7 @@
 #include <utility>
 
 #include <seqan3/alignment/matrix/detail/advanceable_alignment_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/cigar_from_trace_path.hpp>
 #include <seqan3/alignment/matrix/detail/edit_distance_score_matrix_full.hpp>
 #include <seqan3/alignment/matrix/detail/edit_distance_trace_matrix_full.hpp>
 #include <seqan3/alignment/matrix/detail/matrix_concept.hpp>
@@ -735,6 +736,7 @@ private:
     friend class edit_distance_unbanded_trace_matrix_policy;
 
     using edit_traits::compute_begin_positions;
+    using edit_traits::compute_cigar;
     using edit_traits::compute_end_positions;
     using edit_traits::compute_matrix;
     using edit_traits::compute_score;
@@ -1056,7 +1058,7 @@ public:
         if constexpr (compute_end_positions)
             cached_end_positions = this->end_positions();
 
-        if constexpr (compute_begin_positions && !compute_sequence_alignment)
+        if constexpr (compute_begin_positions && !compute_sequence_alignment && !compute_cigar)
         {
             static_assert(compute_end_positions, "End positions required to compute the begin positions.");
             cached_begin_positions = this->begin_positions();
@@ -1076,6 +1078,22 @@ public:
         if constexpr (traits_type::compute_score)
             res_vt.score = this->score().value_or(matrix_inf<score_type>);
 
+        if constexpr (traits_type::compute_cigar)
+        {
+            if (this->is_valid())
+            {
+                auto [first, second] = cached_end_positions;
+                detail::matrix_coordinate const end_positions{detail::row_index_type{second},
+                                                              detail::column_index_type{first}};
+
+                // The operations are written directly into the buffer owned by the result.
+                detail::matrix_coordinate const begin_coordinate =
+                    cigar_from_trace_path(this->trace_matrix().trace_path(end_positions), res_vt.cigar_sequence);
+                cached_begin_positions.first = begin_coordinate.col;
+                cached_begin_positions.second = begin_coordinate.row;
+            }
+        }
+
         if constexpr (traits_type::compute_sequence_alignment)
         {
             if (this->is_valid())
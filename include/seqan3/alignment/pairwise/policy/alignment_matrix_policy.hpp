@@ -13,6 +13,7 @@
 #include <tuple>
 
 #include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/matrix/detail/release_excess_memory.hpp>
 #include <seqan3/alignment/pairwise/detail/alignment_algorithm_state.hpp>
 #include <seqan3/utility/type_traits/basic.hpp>
 #include <seqan3/utility/views/slice.hpp>
@@ -36,6 +37,12 @@ namespace seqan3::detail
  * iterators are used as a global state within this particular alignment instance and are accessed from the alignment
  * algorithm.
  *
+ * The memory of the matrices is owned by the calling thread. The matrices are borrowed from thread local storage
+ * when they are allocated and handed back after the alignment result was generated. Hence, subsequent alignments
+ * computed by the same thread reuse the memory instead of allocating new matrices, even if every alignment is
+ * computed by a different copy of the alignment algorithm as in the parallel execution. The memory of alignments with
+ * more than seqan3::detail::retained_alignment_cell_count cells is released instead.
+ *
  * \remarks The template parameters of this CRTP-policy are selected in the
  *          seqan3::detail::alignment_configurator::select_matrix_policy when selecting the alignment for the given
  *          configuration.
@@ -76,10 +83,11 @@ private:
      * corresponding matrix.
      */
     template <typename sequence1_t, typename sequence2_t>
-    constexpr void allocate_matrix(sequence1_t && sequence1, sequence2_t && sequence2)
+    void allocate_matrix(sequence1_t && sequence1, sequence2_t && sequence2)
     {
-        score_matrix = score_matrix_t{sequence1, sequence2};
-        trace_matrix = trace_matrix_t{sequence1, sequence2};
+        borrow_thread_local_matrices(sequence1, sequence2);
+        score_matrix.resize(sequence1, sequence2);
+        trace_matrix.resize(sequence1, sequence2);
 
         initialise_matrix_iterator();
     }
@@ -106,20 +114,62 @@ private:
      * can get the smallest possible value as an infinity.
      */
     template <typename sequence1_t, typename sequence2_t, typename score_t>
-    constexpr void allocate_matrix(sequence1_t && sequence1,
-                                   sequence2_t && sequence2,
-                                   align_cfg::band_fixed_size const & band,
-                                   alignment_algorithm_state<score_t> const & state)
+    void allocate_matrix(sequence1_t && sequence1,
+                         sequence2_t && sequence2,
+                         align_cfg::band_fixed_size const & band,
+                         alignment_algorithm_state<score_t> const & state)
     {
         assert(state.gap_extension_score <= 0); // We expect it to never be positive.
 
         score_t inf = std::numeric_limits<score_t>::lowest() - state.gap_extension_score;
-        score_matrix = score_matrix_t{sequence1, sequence2, band, inf};
-        trace_matrix = trace_matrix_t{sequence1, sequence2, band};
+        borrow_thread_local_matrices(sequence1, sequence2);
+        score_matrix.resize(sequence1, sequence2, band, inf);
+        trace_matrix.resize(sequence1, sequence2, band);
 
         initialise_matrix_iterator();
     }
 
+    /*!\brief Hands the memory of the matrices back to the calling thread.
+     *
+     * \details
+     *
+     * Must be called after the alignment result was generated. The next call to
+     * seqan3::detail::alignment_matrix_policy::allocate_matrix on the same thread reuses the memory, unless the
+     * alignment had more than seqan3::detail::retained_alignment_cell_count cells. In this case, the memory is
+     * released.
+     */
+    void release_matrix()
+    {
+        release_excess_memory(score_matrix, cell_count);
+        release_excess_memory(trace_matrix, cell_count);
+        thread_local_score_matrix() = std::move(score_matrix);
+        thread_local_trace_matrix() = std::move(trace_matrix);
+    }
+
+    //!\brief Moves the matrices of the calling thread into this policy and records the size of the alignment.
+    template <typename sequence1_t, typename sequence2_t>
+    void borrow_thread_local_matrices(sequence1_t && sequence1, sequence2_t && sequence2)
+    {
+        cell_count = (static_cast<size_t>(std::ranges::distance(sequence1)) + 1)
+                   * (static_cast<size_t>(std::ranges::distance(sequence2)) + 1);
+        score_matrix = std::move(thread_local_score_matrix());
+        trace_matrix = std::move(thread_local_trace_matrix());
+    }
+
+    //!\brief Returns the score matrix whose memory is reused by the calling thread.
+    static score_matrix_t & thread_local_score_matrix() noexcept
+    {
+        static thread_local score_matrix_t matrix{};
+        return matrix;
+    }
+
+    //!\brief Returns the trace matrix whose memory is reused by the calling thread.
+    static trace_matrix_t & thread_local_trace_matrix() noexcept
+    {
+        static thread_local trace_matrix_t matrix{};
+        return matrix;
+    }
+
     //!\brief Initialises the score and trace matrix iterator after allocating the matrices.
     constexpr void initialise_matrix_iterator() noexcept
     {
@@ -217,6 +267,7 @@ private:
 
     score_matrix_t score_matrix{}; //!< The scoring matrix.
     trace_matrix_t trace_matrix{}; //!< The trace matrix if needed.
+    size_t cell_count{};           //!< The number of cells of the current alignment.
 
     typename score_matrix_t::iterator score_matrix_iter{}; //!< The matrix iterator over the score matrix.
     typename trace_matrix_t::iterator trace_matrix_iter{}; //!< The matrix iterator over the trace matrix.
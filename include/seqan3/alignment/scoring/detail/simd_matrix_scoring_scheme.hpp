@@ -10,6 +10,7 @@
 #pragma once
 
 #include <concepts>
+#include <cstdint>
 
 #include <seqan3/alignment/configuration/align_config_method.hpp>
 #include <seqan3/alignment/scoring/scoring_scheme_concept.hpp>
@@ -33,7 +34,8 @@ namespace seqan3::detail
  * When scoring two seqan3::detail::simd vectors, this performs element-wise lookups of the compared simd vectors
  * using a [gather operation](https://en.wikipedia.org/wiki/Gather-scatter_(vector_addressing)) on the scoring scheme.
  * The given scoring scheme is first transferred into linear memory such that a simple index gather can be used to
- * retrieve the actual score.
+ * retrieve the actual score. The scores are stored as 32 bit values, such that the gather instructions of AVX2 and
+ * AVX512 can be used for 16 and 32 bit score types (see seqan3::detail::gather).
  * The index for the column vector of the alignment matrix must be precomputed using the
  * seqan3::detail::simd_matrix_scoring_scheme::make_score_profile member function.
  * This function computes the starting index of the respective matrix entry within the linearised
@@ -77,8 +79,8 @@ private:
     //!\brief The score used for the padding symbol (global -> increases score; local -> decreases score).
     static constexpr scalar_type score_for_padding_symbol = (is_global) ? 1 : -1;
 
-    //!\brief The scoring scheme stored as a linear array.
-    std::vector<scalar_type> scoring_scheme_data{};
+    //!\brief The scoring scheme stored as a linear array of 32 bit values to allow hardware gather instructions.
+    std::vector<int32_t> scoring_scheme_data{};
 
 public:
     //!\brief The padding symbol used to fill up smaller sequences in a simd batch.
@@ -124,7 +126,8 @@ public:
      *
      * ### Complexity
      *
-     * Linear in the length of one input vector (`score_profile` and `ranks` are equally sized).
+     * Linear in the length of one input vector (`score_profile` and `ranks` are equally sized). Constant if a
+     * hardware gather instruction is available for the simd type.
      *
      * ### Thread safety
      *
@@ -138,12 +141,7 @@ public:
                                  simd_alphabet_ranks_type const & ranks) const noexcept
     {
         simd_score_t const matrix_index = score_profile + ranks; // Compute the matrix indices for the lookup.
-        simd_score_t result{};
-
-        for (size_t idx = 0; idx < simd_traits<simd_score_t>::length; ++idx)
-            result[idx] = scoring_scheme_data.data()[matrix_index[idx]];
-
-        return result;
+        return gather(scoring_scheme_data.data(), matrix_index);
     }
     //!\}
 
@@ -17,3 +17,4 @@
 
 #include <seqan3/alphabet/container/bitpacked_sequence.hpp>
 #include <seqan3/alphabet/container/concatenated_sequences.hpp>
+#include <seqan3/alphabet/container/mapped_concatenated_sequences.hpp>
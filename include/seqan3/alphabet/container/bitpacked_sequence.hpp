@@ -9,17 +9,24 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <concepts>
 #include <iterator>
 #include <ranges>
 #include <type_traits>
+#include <vector>
 
 #include <seqan3/alphabet/detail/alphabet_proxy.hpp>
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/alphabet/range/bulk_conversion.hpp>
 #include <seqan3/alphabet/views/to_char.hpp>
 #include <seqan3/alphabet/views/to_rank.hpp>
 #include <seqan3/contrib/sdsl-lite.hpp>
 #include <seqan3/core/concept/cereal.hpp>
 #include <seqan3/core/range/detail/random_access_iterator.hpp>
+#include <seqan3/utility/detail/bit_packing.hpp>
 #include <seqan3/utility/math.hpp>
 #include <seqan3/utility/views/convert.hpp>
 
@@ -150,6 +157,41 @@ private:
     static constexpr bool has_same_value_type_v = true;
     //!\endcond
 
+    //!\brief The type of the ranks that are packed or unpacked at once.
+    using rank_buffer_value_type = std::conditional_t<(bits_per_letter <= 8u), uint8_t, uint64_t>;
+
+    //!\brief A buffer for the ranks that are packed or unpacked at once.
+    using rank_buffer_type = std::array<rank_buffer_value_type, 256>;
+
+    //!\brief Whether the object representation of the alphabet_type is its rank.
+    static constexpr bool stores_rank_as_byte = detail::byte_rank_alphabet<alphabet_type>;
+
+    //!\brief Whether the complement of every letter has the rank with all bits flipped, e.g. for seqan3::dna4.
+    static constexpr bool complement_flips_rank_bits() noexcept
+    {
+        if constexpr (!nucleotide_alphabet<alphabet_type> || !detail::writable_constexpr_semialphabet<alphabet_type>)
+        {
+            return false;
+        }
+        else
+        {
+            for (size_t rank = 0; rank < alphabet_size<alphabet_type>; ++rank)
+            {
+                alphabet_type const letter = assign_rank_to(rank, alphabet_type{});
+                if (seqan3::to_rank(seqan3::complement(letter)) != (detail::field_mask<bits_per_letter> ^ rank))
+                    return false;
+            }
+
+            return true;
+        }
+    }
+
+    //!\brief Whether the range stores letters of the alphabet_type contiguously.
+    template <typename range_t>
+    static constexpr bool is_contiguous_letter_range =
+        std::ranges::contiguous_range<range_t> && std::ranges::sized_range<range_t>
+        && std::same_as<std::ranges::range_value_t<range_t>, alphabet_type>;
+
 public:
     /*!\name Associated types
      * \{
@@ -835,10 +877,10 @@ public:
               && std::common_reference_with<std::iter_value_t<begin_iterator_type>, value_type>
     {
         auto const pos_as_num = std::distance(cbegin(), pos);
+        auto range = std::ranges::subrange<begin_iterator_type, end_iterator_type>{begin_it, end_it};
 
-        auto v = std::ranges::subrange<begin_iterator_type, end_iterator_type>{begin_it, end_it}
-               | views::convert<value_type> | views::to_rank;
-        data.insert(data.begin() + pos_as_num, std::ranges::begin(v), std::ranges::end(v));
+        insert_gap(pos_as_num, std::ranges::distance(range));
+        write_letters(pos_as_num, range);
 
         return begin() + pos_as_num;
     }
@@ -1068,6 +1110,315 @@ public:
     }
     //!\}
 
+    /*!\name Bulk operations
+     * \brief Operations that pack or unpack blocks of letters instead of accessing every letter through the proxy.
+     * \{
+     */
+    /*!\brief Assign the letters that the characters of a range are converted to.
+     * \tparam range_t The type of the range; must model std::ranges::forward_range and its reference type must be
+     *                 convertible to seqan3::alphabet_char_t<alphabet_type>.
+     * \param[in] range The characters.
+     *
+     * \details
+     *
+     * Computes the same as `assign(range | seqan3::views::char_to<alphabet_type>)`. Characters that are stored
+     * contiguously are converted with the byte shuffles of seqan3::bulk_char_to and then packed into words.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of `range`.
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee, i.e. guaranteed not to leak, but container may contain invalid data after exception is
+     * thrown.
+     *
+     * \experimentalapi{Experimental since version 3.5. This is a non-standard C++ extension.}
+     */
+    template <std::ranges::forward_range range_t>
+        requires writable_alphabet<alphabet_type>
+              && std::convertible_to<std::ranges::range_reference_t<range_t>, alphabet_char_t<alphabet_type>>
+    void assign_chars(range_t && range)
+    {
+        data.resize(std::ranges::distance(range));
+
+        if constexpr (detail::byte_convertible_ranges<range_t, rank_buffer_type> && stores_rank_as_byte
+                      && detail::writable_constexpr_alphabet<alphabet_type>
+                      && std::same_as<alphabet_char_t<alphabet_type>, char>)
+        {
+            uint8_t const * chars = reinterpret_cast<uint8_t const *>(std::ranges::data(range));
+            rank_buffer_type buffer;
+
+            for (size_type position = 0u; position < size(); position += buffer.size())
+            {
+                size_type const chunk_size = std::min<size_type>(buffer.size(), size() - position);
+                detail::byte_table_lookup<false>(chars + position,
+                                                 chunk_size,
+                                                 buffer.data(),
+                                                 detail::char_to_rank_lookup_table<alphabet_type>);
+                detail::pack_fields<bits_per_letter>(buffer.data(), chunk_size, data.data(), position);
+            }
+        }
+        else
+        {
+            write_ranks(0u,
+                        range,
+                        [](alphabet_char_t<alphabet_type> const chr)
+                        {
+                            return seqan3::to_rank(assign_char_to(chr, alphabet_type{}));
+                        });
+        }
+    }
+
+    /*!\brief Assign the letters with the ranks of a range.
+     * \tparam range_t The type of the range; must model std::ranges::forward_range and its reference type must be
+     *                 convertible to seqan3::alphabet_rank_t<alphabet_type>.
+     * \param[in] range The ranks; every rank must be smaller than seqan3::alphabet_size<alphabet_type>.
+     *
+     * \details
+     *
+     * Computes the same as `assign(range | seqan3::views::rank_to<alphabet_type>)`, but packs the ranks directly.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of `range`.
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee, i.e. guaranteed not to leak, but container may contain invalid data after exception is
+     * thrown.
+     *
+     * \experimentalapi{Experimental since version 3.5. This is a non-standard C++ extension.}
+     */
+    template <std::ranges::forward_range range_t>
+        requires std::convertible_to<std::ranges::range_reference_t<range_t>, alphabet_rank_t<alphabet_type>>
+    void assign_ranks(range_t && range)
+    {
+        data.resize(std::ranges::distance(range));
+
+        if constexpr (std::ranges::contiguous_range<range_t> && std::ranges::sized_range<range_t>
+                      && std::same_as<std::ranges::range_value_t<range_t>, rank_buffer_value_type>)
+        {
+            detail::pack_fields<bits_per_letter>(std::ranges::data(range), size(), data.data(), 0u);
+        }
+        else
+        {
+            write_ranks(0u,
+                        range,
+                        [](alphabet_rank_t<alphabet_type> const rank)
+                        {
+                            return static_cast<rank_buffer_value_type>(rank);
+                        });
+        }
+    }
+
+    /*!\brief Writes the characters of all letters to a range.
+     * \tparam range_t The type of the range; must model std::ranges::forward_range and
+     *                 seqan3::alphabet_char_t<alphabet_type> must be writable to it.
+     * \param[out] range The characters; must be at least as large as the container.
+     *
+     * \details
+     *
+     * Computes the same as copying `*this | seqan3::views::to_char` to `range`. The letters are unpacked in blocks and
+     * converted with the byte shuffles of seqan3::bulk_to_char if `range` stores the characters contiguously.
+     *
+     * ### Complexity
+     *
+     * Linear in size().
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee if writing to `range` does not throw.
+     *
+     * \experimentalapi{Experimental since version 3.5. This is a non-standard C++ extension.}
+     */
+    template <std::ranges::forward_range range_t>
+        requires alphabet<alphabet_type>
+              && std::indirectly_writable<std::ranges::iterator_t<range_t>, alphabet_char_t<alphabet_type>>
+    void copy_chars_to(range_t && range) const
+    {
+        assert(static_cast<size_type>(std::ranges::distance(range)) >= size());
+
+        auto it = std::ranges::begin(range);
+        for_each_rank_block(
+            [&it](rank_buffer_value_type const * ranks, size_t const count)
+            {
+                if constexpr (detail::byte_convertible_ranges<rank_buffer_type, range_t> && stores_rank_as_byte
+                              && detail::writable_constexpr_alphabet<alphabet_type>
+                              && std::same_as<alphabet_char_t<alphabet_type>, char>)
+                {
+                    detail::byte_table_lookup<false>(ranks,
+                                                     count,
+                                                     reinterpret_cast<uint8_t *>(std::to_address(it)),
+                                                     detail::rank_to_char_lookup_table<alphabet_type>);
+                    it += count;
+                }
+                else
+                {
+                    it = std::ranges::transform(ranks,
+                                                ranks + count,
+                                                it,
+                                                [](rank_buffer_value_type const rank)
+                                                {
+                                                    return seqan3::to_char(assign_rank_to(rank, alphabet_type{}));
+                                                })
+                             .out;
+                }
+            });
+    }
+
+    /*!\brief Writes the ranks of all letters to a range.
+     * \tparam range_t The type of the range; must model std::ranges::forward_range and
+     *                 seqan3::alphabet_rank_t<alphabet_type> must be writable to it.
+     * \param[out] range The ranks; must be at least as large as the container.
+     *
+     * \details
+     *
+     * Computes the same as copying `*this | seqan3::views::to_rank` to `range`, but unpacks the ranks in blocks.
+     *
+     * ### Complexity
+     *
+     * Linear in size().
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee if writing to `range` does not throw.
+     *
+     * \experimentalapi{Experimental since version 3.5. This is a non-standard C++ extension.}
+     */
+    template <std::ranges::forward_range range_t>
+        requires std::indirectly_writable<std::ranges::iterator_t<range_t>, alphabet_rank_t<alphabet_type>>
+    void copy_ranks_to(range_t && range) const
+    {
+        assert(static_cast<size_type>(std::ranges::distance(range)) >= size());
+
+        auto it = std::ranges::begin(range);
+        for_each_rank_block(
+            [&it](rank_buffer_value_type const * ranks, size_t const count)
+            {
+                it = std::ranges::transform(ranks,
+                                            ranks + count,
+                                            it,
+                                            [](rank_buffer_value_type const rank)
+                                            {
+                                                return static_cast<alphabet_rank_t<alphabet_type>>(rank);
+                                            })
+                         .out;
+            });
+    }
+
+    /*!\brief Replaces the sequence by its reverse complement.
+     *
+     * \details
+     *
+     * Computes the same as assigning `*this | std::views::reverse | seqan3::views::complement`. If the number of bits
+     * per letter is a power of two and the complement of a letter flips all bits of its rank, as for seqan3::dna4 and
+     * seqan3::rna4, the reverse complement is computed on whole words: the order of the words and of the letters
+     * within each word is reversed and all bits are flipped. Otherwise, the ranks are unpacked, reverse complemented
+     * and packed again.
+     *
+     * ### Complexity
+     *
+     * Linear in size().
+     *
+     * ### Exceptions
+     *
+     * Throws std::bad_alloc if the ranks cannot be unpacked. Basic exception guarantee.
+     *
+     * \experimentalapi{Experimental since version 3.5. This is a non-standard C++ extension.}
+     */
+    void reverse_complement()
+        requires nucleotide_alphabet<alphabet_type>
+    {
+        if constexpr (std::has_single_bit(bits_per_letter) && complement_flips_rank_bits())
+        {
+            size_type const bit_count = size() * bits_per_letter;
+            size_type const word_count = (bit_count + 63u) / 64u;
+            uint64_t * const words = data.data();
+
+            std::reverse(words, words + word_count);
+            for (size_type i = 0; i < word_count; ++i)
+                words[i] = ~detail::reverse_fields<bits_per_letter>(words[i]);
+
+            // The unused bits of the last word are now the lowest bits of the first word and are shifted out.
+            if (size_t const unused_bits = word_count * 64u - bit_count; unused_bits > 0u)
+            {
+                for (size_type i = 0; i + 1u < word_count; ++i)
+                    words[i] = (words[i] >> unused_bits) | (words[i + 1u] << (64u - unused_bits));
+
+                words[word_count - 1u] >>= unused_bits;
+            }
+        }
+        else
+        {
+            std::vector<rank_buffer_value_type> ranks(size());
+            copy_ranks_to(ranks);
+            std::ranges::reverse(ranks);
+            std::ranges::transform(ranks,
+                                   ranks.begin(),
+                                   [](rank_buffer_value_type const rank)
+                                   {
+                                       alphabet_type const letter = assign_rank_to(rank, alphabet_type{});
+                                       return static_cast<rank_buffer_value_type>(
+                                           seqan3::to_rank(seqan3::complement(letter)));
+                                   });
+            detail::pack_fields<bits_per_letter>(ranks.data(), ranks.size(), data.data(), 0u);
+        }
+    }
+
+    /*!\brief Returns the ranks of consecutive letters packed into one integer.
+     * \param[in] position The position of the first letter.
+     * \param[in] count The number of letters; at most `64 / b` for `b` bits per letter.
+     * \returns \f$\sum_{i=0}^{count-1} r_i \cdot 2^{b (count - 1 - i)}\f$ for the rank \f$r_i\f$ of the letter at
+     *          `position + i`, i.e. the first letter is stored in the most significant bits.
+     *
+     * \details
+     *
+     * The letters are read from at most two words, which allows to hash k-mers word by word. For alphabets whose size
+     * is a power of two, e.g. seqan3::dna4, the result is the hash that seqan3::views::kmer_hash computes for the
+     * ungapped k-mer of length `count` at `position`.
+     *
+     * ### Complexity
+     *
+     * Constant if the number of bits per letter is a power of two, otherwise linear in `count`.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     *
+     * \experimentalapi{Experimental since version 3.5. This is a non-standard C++ extension.}
+     */
+    uint64_t packed_ranks(size_type const position, size_type const count) const noexcept
+    {
+        assert(count * bits_per_letter <= 64u);
+        assert(position + count <= size());
+
+        if (count == 0u)
+            return 0u;
+
+        // int_vector::get_int returns the value type of the int_vector, which may be narrower than 64 bit.
+        size_type const bit = position * bits_per_letter;
+        uint64_t const fields =
+            contrib::sdsl::bits::read_int(data.data() + bit / 64u, bit % 64u, count * bits_per_letter);
+
+        if constexpr (std::has_single_bit(bits_per_letter))
+        {
+            return detail::reverse_fields<bits_per_letter>(fields) >> (64u - count * bits_per_letter);
+        }
+        else
+        {
+            uint64_t result{};
+            for (size_type i = 0; i < count; ++i)
+            {
+                uint64_t const rank = (fields >> (i * bits_per_letter)) & detail::field_mask<bits_per_letter>;
+                result = (result << bits_per_letter) | rank;
+            }
+
+            return result;
+        }
+    }
+    //!\}
+
     /*!\name Comparison operators
      * \{
      */
@@ -1140,6 +1491,101 @@ public:
         archive(data);
     }
     //!\endcond
+
+private:
+    /*!\brief Inserts `count` letters with rank 0 before `position`.
+     * \details
+     *
+     * The capacity grows geometrically and the letters behind `position` are moved in blocks of whole words.
+     */
+    void insert_gap(size_type const position, size_type const count)
+    {
+        size_type const old_size = size();
+        size_type const new_size = old_size + count;
+
+        if (new_size > capacity())
+            data.reserve(std::max<size_type>(new_size, 2u * capacity()));
+
+        data.resize(new_size);
+
+        // Move the suffix from the back, such that no letter is overwritten before it is moved.
+        rank_buffer_type buffer;
+        for (size_type source_end = old_size; source_end > position;)
+        {
+            size_type const chunk_size = std::min<size_type>(buffer.size(), source_end - position);
+            source_end -= chunk_size;
+            detail::unpack_fields<bits_per_letter>(data.data(), source_end, chunk_size, buffer.data());
+            detail::pack_fields<bits_per_letter>(buffer.data(), chunk_size, data.data(), source_end + count);
+        }
+    }
+
+    /*!\brief Writes the ranks of the given elements to the positions starting at `position`.
+     * \param[in] position The first position to write.
+     * \param[in] range The elements; the positions must exist.
+     * \param[in] to_rank_fn Returns the rank of an element.
+     * \details
+     *
+     * The elements are converted to ranks in blocks, which are packed with seqan3::detail::pack_fields.
+     */
+    template <std::ranges::input_range range_t, typename to_rank_fn_t>
+    void write_ranks(size_type position, range_t && range, to_rank_fn_t && to_rank_fn)
+    {
+        rank_buffer_type buffer;
+        auto it = std::ranges::begin(range);
+        auto const end = std::ranges::end(range);
+
+        while (it != end)
+        {
+            size_t chunk_size = 0u;
+            for (; chunk_size < buffer.size() && it != end; ++chunk_size, ++it)
+                buffer[chunk_size] = to_rank_fn(*it);
+
+            detail::pack_fields<bits_per_letter>(buffer.data(), chunk_size, data.data(), position);
+            position += chunk_size;
+        }
+    }
+
+    /*!\brief Writes the letters of a range to the positions starting at `position`.
+     * \param[in] position The first position to write.
+     * \param[in] range The letters; the positions must exist.
+     */
+    template <std::ranges::input_range range_t>
+    void write_letters(size_type const position, range_t && range)
+    {
+        if constexpr (stores_rank_as_byte && is_contiguous_letter_range<range_t>)
+        {
+            detail::pack_fields<bits_per_letter>(reinterpret_cast<uint8_t const *>(std::ranges::data(range)),
+                                                 std::ranges::size(range),
+                                                 data.data(),
+                                                 position);
+        }
+        else
+        {
+            write_ranks(position,
+                        range,
+                        [](auto && letter)
+                        {
+                            return seqan3::to_rank(static_cast<value_type>(letter));
+                        });
+        }
+    }
+
+    /*!\brief Calls `fn(ranks, count)` for consecutive blocks of the ranks of all letters.
+     * \details
+     *
+     * The ranks are unpacked with seqan3::detail::unpack_fields.
+     */
+    template <typename fn_t>
+    void for_each_rank_block(fn_t && fn) const
+    {
+        rank_buffer_type buffer;
+        for (size_type position = 0u; position < size(); position += buffer.size())
+        {
+            size_type const chunk_size = std::min<size_type>(buffer.size(), size() - position);
+            detail::unpack_fields<bits_per_letter>(data.data(), position, chunk_size, buffer.data());
+            fn(buffer.data(), chunk_size);
+        }
+    }
 };
 
 } // namespace seqan3
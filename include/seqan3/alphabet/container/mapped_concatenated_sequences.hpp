@@ -0,0 +1,685 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::mapped_concatenated_sequences.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/core/range/detail/random_access_iterator.hpp>
+#include <seqan3/utility/detail/bit_packing.hpp>
+#include <seqan3/utility/detail/integer_traits.hpp>
+#include <seqan3/utility/detail/memory_mapped_file.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The header of a file written by seqan3::mapped_concatenated_sequences::write.
+ * \ingroup alphabet_container
+ *
+ * \details
+ *
+ * All integers are stored in little endian byte order. The offsets are in bytes from the begin of the file.
+ */
+struct mapped_concatenated_sequences_header
+{
+    //!\brief The magic string that identifies the file format.
+    static constexpr std::array<char, 8> expected_magic{'S', 'Q', '3', 'C', 'O', 'N', 'C', 'T'};
+    //!\brief The version of the file format.
+    static constexpr uint32_t current_version{1u};
+
+    //!\brief Identifies the file format.
+    std::array<char, 8> magic{expected_magic};
+    //!\brief The version of the file format.
+    uint32_t version{current_version};
+    //!\brief The number of bits of every letter.
+    uint32_t bits_per_letter{};
+    //!\brief The size of the alphabet of the letters.
+    uint64_t alphabet_size{};
+    //!\brief The number of sequences.
+    uint64_t sequence_count{};
+    //!\brief The total number of letters of all sequences.
+    uint64_t letter_count{};
+    //!\brief Where the 64 bit words with the packed letters begin.
+    uint64_t letter_offset{};
+    //!\brief Where the `sequence_count + 1` 64 bit delimiters begin.
+    uint64_t delimiter_offset{};
+    //!\brief Reserved for future use; always 0.
+    uint64_t reserved{};
+};
+
+static_assert(sizeof(mapped_concatenated_sequences_header) == 64u);
+static_assert(std::is_trivially_copyable_v<mapped_concatenated_sequences_header>);
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief A read-only collection of sequences that are stored concatenated in a memory mapped file.
+ * \ingroup alphabet_container
+ * \tparam alphabet_type The alphabet of the letters; must satisfy seqan3::writable_semialphabet and std::regular.
+ *
+ * \details
+ *
+ * Like seqan3::concatenated_sequences, this container stores all sequences in one concatenation and the positions
+ * where the sequences begin. The data lives in a file that is written once with
+ * seqan3::mapped_concatenated_sequences::write and then mapped into memory instead of being read. Opening the file
+ * therefore takes constant time, the pages are only loaded when they are accessed and all processes that open the
+ * same file share the same physical memory.
+ *
+ * The letters are packed like in seqan3::bitpacked_sequence, i.e. every letter occupies
+ * `seqan3::detail::ceil_log2(seqan3::alphabet_size<alphabet_type>)` bits. The elements of the container are views
+ * that unpack the letters on access and never copy the data.
+ *
+ * ### File format
+ *
+ * The layout of the file is stable and independent of the platform:
+ *
+ *   1. a header of 64 bytes (see seqan3::detail::mapped_concatenated_sequences_header),
+ *   2. the letters as 64 bit words, where letter `i` occupies the bits `[i * b, (i + 1) * b)` and bit `j` is bit
+ *      `j % 64` of word `j / 64`,
+ *   3. `size() + 1` 64 bit delimiters, where sequence `i` consists of the letters `[delimiter[i], delimiter[i + 1])`.
+ *
+ * All integers are stored in little endian byte order; memory mapping is only supported on little endian platforms.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alphabet/container/mapped_concatenated_sequences.cpp
+ *
+ * ### Thread safety
+ *
+ * This container is never modified, so all member functions can be called concurrently.
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+template <writable_semialphabet alphabet_type>
+    requires std::regular<alphabet_type>
+class mapped_concatenated_sequences
+{
+private:
+    //!\brief The number of bits needed to represent a single letter of the alphabet_type.
+    static constexpr size_t bits_per_letter = detail::ceil_log2(alphabet_size<alphabet_type>);
+
+    static_assert(bits_per_letter > 0u && bits_per_letter <= 64u, "alphabet must be representable in [1, 64] bits.");
+
+    //!\brief The type that the ranks are packed from.
+    using rank_buffer_value_type = std::conditional_t<bits_per_letter <= 8u, uint8_t, uint64_t>;
+
+    //!\brief The number of letters that are packed at once when writing; a multiple of 64, such that whole words are
+    //!       written.
+    static constexpr size_t letter_block_size = 4096u;
+
+    //!\brief Reads a letter from the packed words.
+    struct letter_reader
+    {
+        //!\brief The packed words.
+        uint64_t const * words{nullptr};
+
+        //!\brief Returns the letter at `position`.
+        constexpr alphabet_type operator()(size_t const position) const noexcept
+        {
+            size_t const bit = position * bits_per_letter;
+            size_t const offset = bit % 64u;
+            uint64_t value = words[bit / 64u] >> offset;
+
+            if constexpr (64u % bits_per_letter != 0u)
+            {
+                if (offset + bits_per_letter > 64u)
+                    value |= words[bit / 64u + 1u] << (64u - offset);
+            }
+
+            value &= detail::field_mask<bits_per_letter>;
+            return assign_rank_to(static_cast<alphabet_rank_t<alphabet_type>>(value), alphabet_type{});
+        }
+    };
+
+    //!\brief The view over the positions of a range of letters.
+    using position_view_type = std::ranges::iota_view<size_t, size_t>;
+
+    //!\brief The mapped file.
+    detail::memory_mapped_file file{};
+    //!\brief The packed letters.
+    uint64_t const * words{nullptr};
+    //!\brief The delimiters; begins with 0, has size of size() + 1.
+    uint64_t const * delimiters{nullptr};
+    //!\brief The number of sequences.
+    size_t sequence_count{0u};
+    //!\brief The total number of letters.
+    size_t letter_count{0u};
+
+    //!\brief The number of 64 bit words that store `count` letters; does not overflow for any `count`.
+    static constexpr size_t word_count(size_t const count) noexcept
+    {
+        return count / 64u * bits_per_letter + ((count % 64u) * bits_per_letter + 63u) / 64u;
+    }
+
+public:
+    /*!\name Member types
+     * \{
+     */
+    /*!\brief A view over the letters of one sequence that unpacks the letters on access.
+     * \hideinitializer
+     * \details
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    using value_type = decltype(std::declval<position_view_type>() | std::views::transform(letter_reader{}));
+
+    /*!\brief Same as value_type.
+     * \hideinitializer
+     * \details
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    using reference = value_type;
+
+    /*!\brief Same as value_type.
+     * \hideinitializer
+     * \details
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    using const_reference = value_type;
+
+    /*!\brief The iterator type of this container (a random access iterator).
+     * \hideinitializer
+     * \details
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    using iterator = detail::random_access_iterator<mapped_concatenated_sequences const>;
+
+    /*!\brief The const iterator type of this container (a random access iterator).
+     * \hideinitializer
+     * \details
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    using const_iterator = iterator;
+
+    /*!\brief A signed integer type (usually std::ptrdiff_t)
+     * \hideinitializer
+     * \details
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    using difference_type = std::ptrdiff_t;
+
+    /*!\brief An unsigned integer type (usually std::size_t)
+     * \hideinitializer
+     * \details
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    using size_type = size_t;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    mapped_concatenated_sequences() = default;                                                 //!< Defaulted.
+    mapped_concatenated_sequences(mapped_concatenated_sequences const &) = delete;             //!< Deleted.
+    mapped_concatenated_sequences & operator=(mapped_concatenated_sequences const &) = delete; //!< Deleted.
+    ~mapped_concatenated_sequences() = default;                                                //!< Defaulted.
+
+    //!\brief Move constructor; `other` is empty afterwards.
+    mapped_concatenated_sequences(mapped_concatenated_sequences && other) noexcept
+    {
+        swap(other);
+    }
+
+    //!\brief Move assignment; `other` is empty afterwards.
+    mapped_concatenated_sequences & operator=(mapped_concatenated_sequences && other) noexcept
+    {
+        mapped_concatenated_sequences tmp{std::move(other)};
+        swap(tmp);
+        return *this;
+    }
+
+    /*!\brief Maps a file that was written by seqan3::mapped_concatenated_sequences::write.
+     * \param[in] path The path to the file.
+     * \throws std::filesystem::filesystem_error if the file cannot be opened or mapped.
+     * \throws std::runtime_error if the file is not a valid file for this `alphabet_type`.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Constant; only the header is read and the file size is checked. The delimiters are not checked for
+     * monotonicity.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    explicit mapped_concatenated_sequences(std::filesystem::path const & path) : file{path}
+    {
+        if constexpr (std::endian::native != std::endian::little)
+            throw std::runtime_error{"Memory mapped sequences are only supported on little endian platforms."};
+
+        detail::mapped_concatenated_sequences_header header{};
+        if (file.size() < sizeof(header))
+            throw std::runtime_error{"The file is too small to be a file of mapped concatenated sequences."};
+
+        std::memcpy(&header, file.data(), sizeof(header));
+
+        if (header.magic != header.expected_magic)
+            throw std::runtime_error{"The file is not a file of mapped concatenated sequences."};
+        if (header.version != header.current_version)
+            throw std::runtime_error{"Unsupported version " + std::to_string(header.version)
+                                     + " of the file of mapped concatenated sequences."};
+        if (header.bits_per_letter != bits_per_letter || header.alphabet_size != alphabet_size<alphabet_type>)
+            throw std::runtime_error{"The alphabet of the mapped concatenated sequences does not match the alphabet "
+                                     "of the container."};
+
+        // The counts are compared to the number of words in the file first, such that no value can overflow.
+        size_t const file_words = (file.size() - sizeof(header)) / 8u;
+        size_t const letter_words = word_count(header.letter_count);
+        bool const valid_layout = header.letter_offset == sizeof(header) && letter_words <= file_words
+                               && header.delimiter_offset == header.letter_offset + letter_words * 8u
+                               && header.sequence_count < file_words - letter_words;
+        if (!valid_layout)
+            throw std::runtime_error{"The file of mapped concatenated sequences is truncated or corrupted."};
+
+        // The mapping is page aligned and both offsets are multiples of 8.
+        words = reinterpret_cast<uint64_t const *>(file.data() + header.letter_offset);
+        delimiters = reinterpret_cast<uint64_t const *>(file.data() + header.delimiter_offset);
+        sequence_count = header.sequence_count;
+        letter_count = header.letter_count;
+
+        if (delimiters[0] != 0u || delimiters[sequence_count] != letter_count)
+            throw std::runtime_error{"The delimiters of the mapped concatenated sequences are corrupted."};
+    }
+    //!\}
+
+    /*!\brief Writes sequences to a file that can be mapped with seqan3::mapped_concatenated_sequences.
+     * \tparam rng_of_rng_type The type of the sequences; must model std::ranges::input_range and its reference type
+     *                         must model std::ranges::input_range over letters convertible to `alphabet_type`.
+     * \param[in] path The path to the file; an existing file is overwritten.
+     * \param[in] rng_of_rng The sequences.
+     * \throws std::filesystem::filesystem_error if the file cannot be written.
+     *
+     * \details
+     *
+     * The sequences are read once, so `rng_of_rng` may be a single pass range, e.g. the records of a
+     * seqan3::sequence_file_input piped through a view that selects the sequence. The letters are packed in blocks,
+     * only the delimiters are kept in memory until the end. Sequences of type seqan3::bitpacked_sequence are
+     * unpacked in blocks with seqan3::bitpacked_sequence::copy_ranks_to.
+     *
+     * ### Complexity
+     *
+     * Linear in the cumulative size of `rng_of_rng`.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    template <std::ranges::input_range rng_of_rng_type>
+        requires std::ranges::input_range<std::ranges::range_reference_t<rng_of_rng_type>>
+              && std::convertible_to<std::ranges::range_reference_t<std::ranges::range_reference_t<rng_of_rng_type>>,
+                                     alphabet_type>
+    static void write(std::filesystem::path const & path, rng_of_rng_type && rng_of_rng)
+    {
+        if constexpr (std::endian::native != std::endian::little)
+            throw std::runtime_error{"Memory mapped sequences are only supported on little endian platforms."};
+
+        std::ofstream stream{path, std::ios::binary | std::ios::trunc};
+        auto throw_if_failed = [&]()
+        {
+            if (!stream)
+                throw std::filesystem::filesystem_error{"Cannot write the mapped concatenated sequences.",
+                                                        path,
+                                                        std::make_error_code(std::errc::io_error)};
+        };
+        throw_if_failed();
+
+        detail::mapped_concatenated_sequences_header header{};
+        header.bits_per_letter = bits_per_letter;
+        header.alphabet_size = alphabet_size<alphabet_type>;
+        header.letter_offset = sizeof(header);
+        stream.write(reinterpret_cast<char const *>(&header), sizeof(header));
+
+        std::vector<uint64_t> sequence_delimiters{0u};
+        if constexpr (std::ranges::sized_range<rng_of_rng_type>)
+            sequence_delimiters.reserve(std::ranges::size(rng_of_rng) + 1u);
+
+        std::vector<rank_buffer_value_type> ranks(letter_block_size);
+        std::vector<uint64_t> block_words(word_count(letter_block_size));
+        size_t buffered{0u};
+
+        auto flush = [&]()
+        {
+            std::ranges::fill(block_words, 0u);
+            detail::pack_fields<bits_per_letter>(ranks.data(), buffered, block_words.data(), 0u);
+            stream.write(reinterpret_cast<char const *>(block_words.data()), word_count(buffered) * 8u);
+            buffered = 0u;
+        };
+
+        auto append = [&](rank_buffer_value_type const * first, size_t count)
+        {
+            while (count > 0u)
+            {
+                size_t const chunk = std::min(count, letter_block_size - buffered);
+                std::copy_n(first, chunk, ranks.data() + buffered);
+                buffered += chunk;
+                first += chunk;
+                count -= chunk;
+
+                if (buffered == letter_block_size)
+                    flush();
+            }
+        };
+
+        std::vector<rank_buffer_value_type> sequence_ranks{};
+        for (auto && sequence : rng_of_rng)
+        {
+            size_t length{0u};
+
+            if constexpr (std::same_as<std::remove_cvref_t<decltype(sequence)>, bitpacked_sequence<alphabet_type>>)
+            {
+                length = sequence.size();
+                sequence_ranks.resize(length);
+                sequence.copy_ranks_to(sequence_ranks);
+                append(sequence_ranks.data(), length);
+            }
+            else
+            {
+                for (auto && letter : sequence)
+                {
+                    alphabet_type const converted_letter = letter;
+                    ranks[buffered++] = static_cast<rank_buffer_value_type>(to_rank(converted_letter));
+                    ++length;
+
+                    if (buffered == letter_block_size)
+                        flush();
+                }
+            }
+
+            sequence_delimiters.push_back(sequence_delimiters.back() + length);
+        }
+
+        if (buffered > 0u)
+            flush();
+
+        header.sequence_count = sequence_delimiters.size() - 1u;
+        header.letter_count = sequence_delimiters.back();
+        header.delimiter_offset = header.letter_offset + word_count(header.letter_count) * 8u;
+
+        stream.write(reinterpret_cast<char const *>(sequence_delimiters.data()), sequence_delimiters.size() * 8u);
+        stream.seekp(0);
+        stream.write(reinterpret_cast<char const *>(&header), sizeof(header));
+        stream.flush();
+        throw_if_failed();
+    }
+
+    /*!\name Iterators
+     * \{
+     */
+    /*!\brief Returns an iterator to the first element of the container.
+     * \returns Iterator to the first element.
+     *
+     * If the container is empty, the returned iterator will be equal to end().
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    iterator begin() const noexcept
+    {
+        return iterator{*this, 0};
+    }
+
+    //!\copydoc begin()
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    /*!\brief Returns an iterator to the element following the last element of the container.
+     * \returns Iterator behind the last element.
+     *
+     * This element acts as a placeholder; attempting to dereference it results in undefined behaviour.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    iterator end() const noexcept
+    {
+        return iterator{*this, size()};
+    }
+
+    //!\copydoc end()
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    /*!\brief Return the i-th element as a view.
+     * \param i The element to retrieve.
+     * \throws std::out_of_range If you access an element behind the last.
+     * \returns A view over the letters of the i-th sequence.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * Throws std::out_of_range if `i >= size()`.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    reference at(size_type const i) const
+    {
+        if (i >= size())
+            throw std::out_of_range{"Trying to access element behind the last in mapped_concatenated_sequences."};
+        return (*this)[i];
+    }
+
+    /*!\brief Return the i-th element as a view.
+     * \param i The element to retrieve.
+     * \returns A view over the letters of the i-th sequence.
+     *
+     * Accessing an element behind the last causes undefined behaviour. In debug mode an assertion checks the size of
+     * the container.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    reference operator[](size_type const i) const noexcept
+    {
+        assert(i < size());
+        return position_view_type{delimiters[i], delimiters[i + 1u]} | std::views::transform(letter_reader{words});
+    }
+
+    /*!\brief Return the first element as a view. Calling front on an empty container is undefined.
+     * \returns A view over the letters of the first sequence.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    reference front() const noexcept
+    {
+        assert(size() > 0);
+        return (*this)[0];
+    }
+
+    /*!\brief Return the last element as a view. Calling back on an empty container is undefined.
+     * \returns A view over the letters of the last sequence.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    reference back() const noexcept
+    {
+        assert(size() > 0);
+        return (*this)[size() - 1];
+    }
+
+    /*!\brief Return the concatenation of all members.
+     * \returns A view over the letters of all sequences.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    value_type concat() const noexcept
+    {
+        return position_view_type{0u, letter_count} | std::views::transform(letter_reader{words});
+    }
+
+    /*!\brief Provides direct, unsafe access to the packed letters and the delimiters.
+     * \returns A pair of spans over the 64 bit words of the letters and over the `size() + 1` delimiters.
+     *
+     * \details
+     *
+     * The letters are packed as described in the file format above.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    std::pair<std::span<uint64_t const>, std::span<uint64_t const>> raw_data() const noexcept
+    {
+        if (delimiters == nullptr)
+            return {};
+
+        return {std::span<uint64_t const>{words, word_count(letter_count)},
+                std::span<uint64_t const>{delimiters, sequence_count + 1u}};
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    /*!\brief Checks whether the container is empty.
+     * \returns `true` if the container is empty, `false` otherwise.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /*!\brief Returns the number of elements in the container, i.e. std::distance(begin(), end()).
+     * \returns The number of elements in the container.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    size_type size() const noexcept
+    {
+        return sequence_count;
+    }
+
+    /*!\brief Returns the cumulative size of all elements in the container.
+     * \returns The cumulative size of elements in the container.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    size_type concat_size() const noexcept
+    {
+        return letter_count;
+    }
+    //!\}
+
+    /*!\brief Swaps the contents with that of another container.
+     * \param other The other container.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    void swap(mapped_concatenated_sequences & other) noexcept
+    {
+        file.swap(other.file);
+        std::swap(words, other.words);
+        std::swap(delimiters, other.delimiters);
+        std::swap(sequence_count, other.sequence_count);
+        std::swap(letter_count, other.letter_count);
+    }
+};
+
+} // namespace seqan3
@@ -15,5 +15,6 @@
 
 #pragma once
 
+#include <seqan3/alphabet/range/bulk_conversion.hpp>
 #include <seqan3/alphabet/range/hash.hpp>
 #include <seqan3/alphabet/range/sequence.hpp>
@@ -0,0 +1,342 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::bulk_char_to, seqan3::bulk_to_char, seqan3::bulk_to_rank, seqan3::bulk_complement and
+ *        seqan3::bulk_reverse_complement.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <ranges>
+#include <type_traits>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/utility/simd/detail/byte_table_lookup.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Whether the object representation of every letter is its rank as a single byte.
+ * \ingroup alphabet_range
+ */
+template <writable_constexpr_semialphabet alphabet_t>
+constexpr bool stores_rank_as_byte() noexcept
+{
+    if constexpr (sizeof(alphabet_t) != 1u || !std::is_trivially_copyable_v<alphabet_t>)
+    {
+        return false;
+    }
+    else
+    {
+        for (size_t rank = 0; rank < alphabet_size<alphabet_t>; ++rank)
+        {
+            alphabet_t const letter = assign_rank_to(rank, alphabet_t{});
+            if (std::bit_cast<uint8_t>(letter) != rank)
+                return false;
+        }
+
+        return true;
+    }
+}
+
+/*!\brief An alphabet whose letters can be converted as bytes by seqan3::detail::byte_table_lookup.
+ * \ingroup alphabet_range
+ *
+ * \details
+ *
+ * This is the case for all alphabets of SeqAn with at most 256 letters, including composite alphabets like
+ * seqan3::gapped and seqan3::qualified.
+ */
+template <typename alphabet_t>
+concept byte_rank_alphabet = writable_constexpr_semialphabet<alphabet_t> && stores_rank_as_byte<alphabet_t>();
+
+/*!\brief Whether the bulk algorithms can look up the elements of the given ranges with
+ *        seqan3::detail::byte_table_lookup.
+ * \ingroup alphabet_range
+ */
+template <typename input_t, typename output_t>
+concept byte_convertible_ranges =
+    std::ranges::contiguous_range<input_t> && std::ranges::sized_range<input_t>
+    && std::ranges::contiguous_range<output_t> && (sizeof(std::ranges::range_value_t<input_t>) == 1u)
+    && (sizeof(std::ranges::range_value_t<output_t>) == 1u);
+
+//!\brief The values of seqan3::detail::char_to_rank_lookup_table.
+//!\ingroup alphabet_range
+template <writable_constexpr_alphabet alphabet_t>
+constexpr std::array<uint8_t, 256> char_to_rank_values() noexcept
+{
+    std::array<uint8_t, 256> values{};
+    for (size_t chr = 0; chr < 256; ++chr)
+        values[chr] = to_rank(assign_char_to(static_cast<char>(chr), alphabet_t{}));
+
+    return values;
+}
+
+//!\brief The values of seqan3::detail::rank_to_char_lookup_table.
+//!\ingroup alphabet_range
+template <writable_constexpr_alphabet alphabet_t>
+constexpr std::array<uint8_t, 256> rank_to_char_values() noexcept
+{
+    std::array<uint8_t, 256> values{};
+    for (size_t rank = 0; rank < alphabet_size<alphabet_t>; ++rank)
+        values[rank] = static_cast<uint8_t>(to_char(assign_rank_to(rank, alphabet_t{})));
+
+    return values;
+}
+
+//!\brief The values of seqan3::detail::complement_lookup_table.
+//!\ingroup alphabet_range
+template <writable_constexpr_semialphabet alphabet_t>
+constexpr std::array<uint8_t, 256> complement_values() noexcept
+{
+    std::array<uint8_t, 256> values{};
+    for (size_t rank = 0; rank < alphabet_size<alphabet_t>; ++rank)
+        values[rank] = to_rank(seqan3::complement(assign_rank_to(rank, alphabet_t{})));
+
+    return values;
+}
+
+//!\brief The table that maps a character to the rank of the letter it is converted to.
+//!\ingroup alphabet_range
+template <writable_constexpr_alphabet alphabet_t>
+inline constexpr byte_lookup_table char_to_rank_lookup_table{char_to_rank_values<alphabet_t>()};
+
+//!\brief The table that maps a rank to the character of the letter.
+//!\ingroup alphabet_range
+template <writable_constexpr_alphabet alphabet_t>
+inline constexpr byte_lookup_table rank_to_char_lookup_table{rank_to_char_values<alphabet_t>()};
+
+//!\brief The table that maps a rank to the rank of the complement.
+//!\ingroup alphabet_range
+template <writable_constexpr_semialphabet alphabet_t>
+inline constexpr byte_lookup_table complement_lookup_table{complement_values<alphabet_t>()};
+
+//!\brief Looks up the bytes of the input range and writes them to the output range.
+//!\ingroup alphabet_range
+template <bool reverse, typename input_t, typename output_t>
+void lookup_bytes(input_t && input, output_t && output, byte_lookup_table const & table) noexcept
+{
+    byte_table_lookup<reverse>(reinterpret_cast<uint8_t const *>(std::ranges::data(input)),
+                               std::ranges::size(input),
+                               reinterpret_cast<uint8_t *>(std::ranges::data(output)),
+                               table);
+}
+
+/*!\brief Converts the elements one by one; the fallback of the bulk algorithms.
+ * \ingroup alphabet_range
+ *
+ * \details
+ *
+ * Stops at the end of the input or the output range, whichever comes first. Besides being safe for too small output
+ * ranges, this keeps GCC from warning about writes past the end of a node based output range like std::list, which
+ * it does for std::ranges::transform.
+ */
+template <typename input_t, typename output_t, typename function_t>
+void convert_elements(input_t && input, output_t && output, function_t && function)
+{
+    auto output_it = std::ranges::begin(output);
+    auto const output_end = std::ranges::end(output);
+    for (auto input_it = std::ranges::begin(input); input_it != std::ranges::end(input) && output_it != output_end;
+         ++input_it, ++output_it)
+        *output_it = function(*input_it);
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\name Bulk conversion
+ * \brief Converts whole ranges at once instead of element by element.
+ * \ingroup alphabet_range
+ *
+ * \details
+ *
+ * These algorithms compute the same as copying seqan3::views::char_to, seqan3::views::to_char,
+ * seqan3::views::to_rank and seqan3::views::complement into the output range. The output range must be at least as
+ * large as the input range.
+ *
+ * If both ranges are std::ranges::contiguous_range, e.g. a std::string and a std::vector over seqan3::dna4, and the
+ * alphabet stores its rank in a single byte, as all alphabets of SeqAn with at most 256 letters do, the elements are
+ * converted with SIMD byte shuffles through a table of 256 bytes: 64 bytes at once with AVX512 VBMI, and 32 bytes at
+ * once with AVX2 if the converted characters or ranks lie in a window of 64 consecutive values, which is the case for
+ * all alphabets with at most 64 letters. Otherwise, the elements are converted one by one.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alphabet/range/bulk_conversion.cpp
+ * \{
+ */
+
+/*!\brief Converts characters to letters of the alphabet of the output range; the bulk version of
+ *        seqan3::views::char_to.
+ * \param[in] input The characters.
+ * \param[out] output The letters; must be at least as large as `input`.
+ */
+template <std::ranges::input_range input_t, std::ranges::forward_range output_t>
+    requires writable_alphabet<std::ranges::range_reference_t<output_t>>
+          && std::convertible_to<std::ranges::range_reference_t<input_t>,
+                                 alphabet_char_t<std::ranges::range_value_t<output_t>>>
+void bulk_char_to(input_t && input, output_t && output)
+{
+    using alphabet_t = std::ranges::range_value_t<output_t>;
+
+    if constexpr (detail::byte_convertible_ranges<input_t, output_t> && detail::byte_rank_alphabet<alphabet_t>
+                  && detail::writable_constexpr_alphabet<alphabet_t>
+                  && std::same_as<alphabet_char_t<alphabet_t>, char>)
+    {
+        assert(std::ranges::size(output) >= std::ranges::size(input));
+        detail::lookup_bytes<false>(input, output, detail::char_to_rank_lookup_table<alphabet_t>);
+    }
+    else
+    {
+        detail::convert_elements(input,
+                                 output,
+                                 [](alphabet_char_t<alphabet_t> const chr)
+                                 {
+                                     return assign_char_to(chr, alphabet_t{});
+                                 });
+    }
+}
+
+/*!\brief Converts letters to their characters; the bulk version of seqan3::views::to_char.
+ * \param[in] input The letters.
+ * \param[out] output The characters; must be at least as large as `input`.
+ */
+template <std::ranges::input_range input_t, std::ranges::forward_range output_t>
+    requires alphabet<std::ranges::range_reference_t<input_t>>
+          && std::indirectly_writable<std::ranges::iterator_t<output_t>,
+                                      alphabet_char_t<std::ranges::range_value_t<input_t>>>
+void bulk_to_char(input_t && input, output_t && output)
+{
+    using alphabet_t = std::ranges::range_value_t<input_t>;
+
+    if constexpr (detail::byte_convertible_ranges<input_t, output_t> && detail::byte_rank_alphabet<alphabet_t>
+                  && detail::writable_constexpr_alphabet<alphabet_t>
+                  && std::same_as<alphabet_char_t<alphabet_t>, char>)
+    {
+        assert(std::ranges::size(output) >= std::ranges::size(input));
+        detail::lookup_bytes<false>(input, output, detail::rank_to_char_lookup_table<alphabet_t>);
+    }
+    else
+    {
+        detail::convert_elements(input,
+                                 output,
+                                 [](auto const & letter)
+                                 {
+                                     return to_char(letter);
+                                 });
+    }
+}
+
+/*!\brief Converts letters to their ranks; the bulk version of seqan3::views::to_rank.
+ * \param[in] input The letters.
+ * \param[out] output The ranks; must be at least as large as `input`.
+ */
+template <std::ranges::input_range input_t, std::ranges::forward_range output_t>
+    requires semialphabet<std::ranges::range_reference_t<input_t>>
+          && std::indirectly_writable<std::ranges::iterator_t<output_t>,
+                                      alphabet_rank_t<std::ranges::range_value_t<input_t>>>
+void bulk_to_rank(input_t && input, output_t && output)
+{
+    using alphabet_t = std::ranges::range_value_t<input_t>;
+
+    if constexpr (detail::byte_convertible_ranges<input_t, output_t> && detail::byte_rank_alphabet<alphabet_t>)
+    {
+        // The object representation is the rank.
+        assert(std::ranges::size(output) >= std::ranges::size(input));
+        std::ranges::copy(reinterpret_cast<uint8_t const *>(std::ranges::data(input)),
+                          reinterpret_cast<uint8_t const *>(std::ranges::data(input)) + std::ranges::size(input),
+                          reinterpret_cast<uint8_t *>(std::ranges::data(output)));
+    }
+    else
+    {
+        detail::convert_elements(input,
+                                 output,
+                                 [](auto const & letter)
+                                 {
+                                     return to_rank(letter);
+                                 });
+    }
+}
+
+/*!\brief Converts nucleotides to their complements; the bulk version of seqan3::views::complement.
+ * \param[in] input The nucleotides.
+ * \param[out] output The complements; must be at least as large as `input`. May be the same range as `input`.
+ */
+template <std::ranges::input_range input_t, std::ranges::forward_range output_t>
+    requires nucleotide_alphabet<std::ranges::range_reference_t<input_t>>
+          && std::indirectly_writable<std::ranges::iterator_t<output_t>, std::ranges::range_value_t<input_t>>
+void bulk_complement(input_t && input, output_t && output)
+{
+    using alphabet_t = std::ranges::range_value_t<input_t>;
+
+    if constexpr (detail::byte_convertible_ranges<input_t, output_t> && detail::byte_rank_alphabet<alphabet_t>
+                  && std::same_as<std::ranges::range_value_t<output_t>, alphabet_t>)
+    {
+        assert(std::ranges::size(output) >= std::ranges::size(input));
+        detail::lookup_bytes<false>(input, output, detail::complement_lookup_table<alphabet_t>);
+    }
+    else
+    {
+        detail::convert_elements(input,
+                                 output,
+                                 [](auto const & letter)
+                                 {
+                                     return seqan3::complement(letter);
+                                 });
+    }
+}
+
+/*!\brief Converts nucleotides to their reverse complement; the bulk version of
+ *        `std::views::reverse | seqan3::views::complement`.
+ * \param[in] input The nucleotides.
+ * \param[out] output The reverse complement; must be at least as large as `input`. May be the same range as
+ *                    `input`, but must not overlap it otherwise.
+ */
+template <std::ranges::bidirectional_range input_t, std::ranges::forward_range output_t>
+    requires nucleotide_alphabet<std::ranges::range_reference_t<input_t>>
+          && std::indirectly_writable<std::ranges::iterator_t<output_t>, std::ranges::range_value_t<input_t>>
+void bulk_reverse_complement(input_t && input, output_t && output)
+{
+    using alphabet_t = std::ranges::range_value_t<input_t>;
+
+    if constexpr (std::ranges::contiguous_range<input_t> && std::ranges::sized_range<input_t>
+                  && std::ranges::contiguous_range<output_t>)
+    {
+        // In place: complement and reverse.
+        if (static_cast<void const *>(std::ranges::data(input)) == static_cast<void const *>(std::ranges::data(output)))
+        {
+            bulk_complement(input, output);
+            std::ranges::reverse(std::ranges::data(output), std::ranges::data(output) + std::ranges::size(input));
+            return;
+        }
+    }
+
+    if constexpr (detail::byte_convertible_ranges<input_t, output_t> && detail::byte_rank_alphabet<alphabet_t>
+                  && std::same_as<std::ranges::range_value_t<output_t>, alphabet_t>)
+    {
+        assert(std::ranges::size(output) >= std::ranges::size(input));
+        detail::lookup_bytes<true>(input, output, detail::complement_lookup_table<alphabet_t>);
+    }
+    else
+    {
+        detail::convert_elements(input | std::views::reverse,
+                                 output,
+                                 [](auto const & letter)
+                                 {
+                                     return seqan3::complement(letter);
+                                 });
+    }
+}
+//!\}
+
+} // namespace seqan3
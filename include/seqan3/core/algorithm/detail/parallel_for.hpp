@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::parallel_for.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Invokes a function for every index of `[0, count)` on up to `thread_count` threads.
+ * \ingroup core_algorithm
+ *
+ * \tparam function_t The type of the function; must be invocable with a `size_t`.
+ *
+ * \param[in] count The number of indices.
+ * \param[in] thread_count The maximal number of threads, including the calling thread.
+ * \param[in] function The function that is invoked with every index exactly once.
+ *
+ * \details
+ *
+ * The indices are handed out one by one in increasing order, such that tasks of very different sizes are balanced
+ * over the threads. The calling thread takes part in the computation and the function returns once all indices are
+ * processed. If the function throws, the remaining indices are skipped and the first exception is rethrown.
+ */
+template <typename function_t>
+void parallel_for(size_t const count, size_t const thread_count, function_t && function)
+{
+    std::atomic<size_t> next_index{0};
+    std::exception_ptr exception{};
+    std::mutex exception_mutex{};
+
+    auto worker = [&]()
+    {
+        for (size_t index = next_index++; index < count; index = next_index++)
+        {
+            try
+            {
+                function(index);
+            }
+            catch (...)
+            {
+                std::lock_guard lock{exception_mutex};
+                if (!exception)
+                    exception = std::current_exception();
+                next_index = count;
+            }
+        }
+    };
+
+    size_t const worker_count = std::min(std::max<size_t>(thread_count, 1u), count);
+    std::vector<std::thread> workers{};
+    for (size_t thread_id = 1; thread_id < worker_count; ++thread_id)
+        workers.emplace_back(worker);
+
+    worker();
+
+    for (std::thread & thread : workers)
+        thread.join();
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+} // namespace seqan3::detail
@@ -15,6 +15,7 @@
 #include <string>
 #include <vector>
 
+#include <seqan3/alphabet/range/bulk_conversion.hpp>
 #include <seqan3/alphabet/views/char_to.hpp>
 #include <seqan3/core/debug_stream/range.hpp>
 #include <seqan3/core/range/detail/misc.hpp>
@@ -224,8 +225,7 @@ inline void format_sam_base::read_forward_range_field(std::string_view const str
     else
     {
         target.resize(str.size());
-        for (size_t i = 0; i < str.size(); ++i)
-            target[i] = assign_char_to(str[i], std::ranges::range_value_t<target_range_type>{});
+        bulk_char_to(str, target);
     }
 }
 
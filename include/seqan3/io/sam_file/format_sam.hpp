@@ -9,12 +9,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iterator>
 #include <ranges>
 #include <string>
 #include <vector>
 
 #include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/range/bulk_conversion.hpp>
 #include <seqan3/alphabet/views/to_char.hpp>
 #include <seqan3/io/sam_file/detail/cigar.hpp>
 #include <seqan3/io/sam_file/detail/format_sam_base.hpp>
@@ -473,18 +475,15 @@ format_sam::read_alignment_record(stream_type & stream,
 
         if (!seq_str.starts_with('*')) // * indicates missing sequence information
         {
-            seq.resize(seq_str.size());
             constexpr auto is_legal_alph = char_is_valid_for<seq_legal_alph_type>;
 
-            for (size_t i = 0; i < seq_str.size(); ++i)
-            {
-                if (!is_legal_alph(seq_str[i]))
-                    throw parse_error{std::string{"Encountered an unexpected letter: "} + "char_is_valid_for<"
-                                      + detail::type_name_as_string<seq_legal_alph_type>
-                                      + "> evaluated to false on " + detail::make_printable(seq_str[i])};
+            if (auto it = std::ranges::find_if_not(seq_str, is_legal_alph); it != seq_str.end())
+                throw parse_error{std::string{"Encountered an unexpected letter: "} + "char_is_valid_for<"
+                                  + detail::type_name_as_string<seq_legal_alph_type> + "> evaluated to false on "
+                                  + detail::make_printable(*it)};
 
-                seq[i] = assign_char_to(seq_str[i], std::ranges::range_value_t<seq_type>{});
-            }
+            seq.resize(seq_str.size());
+            bulk_char_to(seq_str, seq);
         }
     }
 
@@ -0,0 +1,397 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::window_minimum and seqan3::detail::window_minimum_batch.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <span>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The minimum of a sliding window over a stream of values in amortised constant time.
+ * \ingroup search
+ * \tparam value_t The type of the values; must model std::totally_ordered.
+ *
+ * \details
+ *
+ * This is the streaming variant of the algorithm of van Herk, Gil and Werman: the stream is divided into blocks of
+ * `window_size` values. Every window is the union of a suffix of the previous block and a prefix of the current block.
+ * The minimum of the prefix is updated with every value; the minima of all suffixes of a block are computed once the
+ * block is complete. Hence, a push takes two comparisons and a query one, and none of them is followed by a loop or a
+ * data dependent number of steps, so the compiler can use conditional moves instead of branches.
+ *
+ * If the minimum occurs several times in the window, its rightmost occurrence is reported.
+ *
+ * Only the values of the current block and the suffix minima of the previous block are stored. The memory is allocated
+ * once on construction.
+ *
+ * The positions of the values are counted from 0 in the order in which they are pushed.
+ */
+template <std::totally_ordered value_t>
+class window_minimum
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    window_minimum() = default;                                   //!< Defaulted.
+    window_minimum(window_minimum const &) = default;             //!< Defaulted.
+    window_minimum(window_minimum &&) = default;                  //!< Defaulted.
+    window_minimum & operator=(window_minimum const &) = default; //!< Defaulted.
+    window_minimum & operator=(window_minimum &&) = default;      //!< Defaulted.
+    ~window_minimum() = default;                                  //!< Defaulted.
+
+    /*!\brief Constructs an empty window of `window_size` values.
+     * \param[in] window_size The number of values in one window; must be greater than 0.
+     */
+    explicit window_minimum(size_t const window_size) :
+        window_size_{window_size},
+        block_values(window_size),
+        suffix_minima(window_size),
+        suffix_positions(window_size)
+    {
+        assert(window_size > 0u);
+    }
+    //!\}
+
+    /*!\brief Appends a value and removes the value that leaves the window.
+     * \param[in] value The value at position seqan3::detail::window_minimum::next_position.
+     */
+    void push(value_t const & value)
+    {
+        block_values[block_offset] = value;
+
+        // On ties, the right value wins.
+        bool const new_prefix_minimum = block_offset == 0u || !(prefix_minimum < value);
+        prefix_minimum = new_prefix_minimum ? value : prefix_minimum;
+        prefix_position = new_prefix_minimum ? next_position_ : prefix_position;
+
+        ++next_position_;
+
+        if (++block_offset == window_size_)
+        {
+            compute_suffix_minima();
+            block_offset = 0u;
+        }
+    }
+
+    //!\brief The minimum of the current window. At least one value must have been pushed.
+    value_t const & minimum() const noexcept
+    {
+        return prefix_is_minimum() ? prefix_minimum : suffix_minima[block_offset];
+    }
+
+    //!\brief The position of the rightmost minimum of the current window. At least one value must have been pushed.
+    size_t minimum_position() const noexcept
+    {
+        return prefix_is_minimum() ? prefix_position : suffix_positions[block_offset];
+    }
+
+    //!\brief The position that the next pushed value will have.
+    size_t next_position() const noexcept
+    {
+        return next_position_;
+    }
+
+    //!\brief The number of values in one window.
+    size_t window_size() const noexcept
+    {
+        return window_size_;
+    }
+
+private:
+    //!\brief The number of values in one window.
+    size_t window_size_{};
+    //!\brief The position of the next value.
+    size_t next_position_{};
+    //!\brief The offset of the next value in its block.
+    size_t block_offset{};
+
+    //!\brief The minimum of the current block.
+    value_t prefix_minimum{};
+    //!\brief The position of the rightmost minimum of the current block.
+    size_t prefix_position{};
+
+    //!\brief The values of the current block.
+    std::vector<value_t> block_values{};
+    //!\brief The minima of the suffixes of the previous block.
+    std::vector<value_t> suffix_minima{};
+    //!\brief The positions of the rightmost minima of the suffixes of the previous block.
+    std::vector<size_t> suffix_positions{};
+
+    /*!\brief Whether the minimum of the prefix of the current block is the minimum of the window.
+     *
+     * \details
+     *
+     * The window consists of the suffix of the previous block starting at `block_offset` and the prefix. If the
+     * window is a whole block, i.e. `block_offset` is 0, or there is no previous block, the suffix is empty. On ties,
+     * the prefix wins because it is to the right.
+     */
+    bool prefix_is_minimum() const noexcept
+    {
+        assert(next_position_ > 0u);
+        return block_offset == 0u || next_position_ < window_size_ || !(suffix_minima[block_offset] < prefix_minimum);
+    }
+
+    //!\brief Computes the suffix minima of the block that was just completed.
+    void compute_suffix_minima()
+    {
+        size_t const block_begin = next_position_ - window_size_;
+        size_t i = window_size_ - 1u;
+
+        suffix_minima[i] = block_values[i];
+        suffix_positions[i] = block_begin + i;
+
+        // On ties, the right value wins.
+        for (; i > 0u; --i)
+        {
+            bool const take = block_values[i - 1u] < suffix_minima[i];
+            suffix_minima[i - 1u] = take ? block_values[i - 1u] : suffix_minima[i];
+            suffix_positions[i - 1u] = take ? block_begin + i - 1u : suffix_positions[i];
+        }
+    }
+};
+
+/*!\brief Computes the minimisers of a whole sequence of values at once.
+ * \ingroup search
+ * \tparam value_t The type of the values; must be an unsigned integral type, e.g. the hash values of
+ *                 seqan3::views::kmer_hash.
+ *
+ * \details
+ *
+ * The result is the same as the one of seqan3::views::minimiser, but instead of the values, the positions of the
+ * minimisers in the sequence are reported.
+ *
+ * Like seqan3::detail::window_minimum, the minima of all windows are computed with the algorithm of van Herk, Gil and
+ * Werman, but the prefix and suffix minima of all blocks of a chunk are computed first. Combining the prefixes and
+ * suffixes is a loop without branches and dependencies between iterations, which the compiler vectorises. The final
+ * pass that reports a minimiser whenever it changes selects with masks instead of branches.
+ *
+ * The sequence is processed in chunks, such that the temporary arrays fit into the cache. They are kept between calls,
+ * so no memory is allocated after the first call.
+ */
+template <std::unsigned_integral value_t>
+class window_minimum_batch
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    window_minimum_batch() = default;                                         //!< Defaulted.
+    window_minimum_batch(window_minimum_batch const &) = default;             //!< Defaulted.
+    window_minimum_batch(window_minimum_batch &&) = default;                  //!< Defaulted.
+    window_minimum_batch & operator=(window_minimum_batch const &) = default; //!< Defaulted.
+    window_minimum_batch & operator=(window_minimum_batch &&) = default;      //!< Defaulted.
+    ~window_minimum_batch() = default;                                        //!< Defaulted.
+
+    /*!\brief Constructs the algorithm for windows of `window_size` values.
+     * \param[in] window_size The number of values in one window; must be greater than 0.
+     */
+    explicit window_minimum_batch(size_t const window_size) : window_size{window_size}
+    {
+        assert(window_size > 0u);
+    }
+    //!\}
+
+    /*!\brief Computes the positions of the minimisers of `values`.
+     * \param[in] values The values.
+     * \param[out] minimiser_positions The positions of the minimisers; must provide space for
+     *                                 `values.size() - window_size + 1` positions.
+     * \returns The number of minimisers.
+     *
+     * \details
+     *
+     * If `values` is shorter than the window, the whole sequence is one window.
+     */
+    size_t operator()(std::span<value_t const> const values, std::span<size_t> const minimiser_positions)
+    {
+        size_t count{};
+        size_t minimiser_position{};
+        value_t previous_minimum{};
+
+        auto report_minimisers = [&](size_t const chunk_begin, size_t const chunk_windows)
+        {
+            size_t window = 0u;
+            if (chunk_begin == 0u)
+            {
+                minimiser_position = window_minimum_positions[0];
+                previous_minimum = window_minima[0];
+                minimiser_positions[count++] = minimiser_position;
+                window = 1u;
+            }
+
+            // Report a minimiser whenever the previous one leaves the window or a smaller value enters the window.
+            // In both cases, the new minimiser is the rightmost minimum of the window. The position is always written
+            // but only kept if it is a new minimiser; count never exceeds the number of processed windows.
+            for (; window < chunk_windows; ++window)
+            {
+                bool const changed =
+                    (minimiser_position < chunk_begin + window) | (window_minima[window] < previous_minimum);
+                size_t const take = select_mask(changed);
+                previous_minimum = window_minima[window];
+                minimiser_position = (window_minimum_positions[window] & take) | (minimiser_position & ~take);
+                minimiser_positions[count] = minimiser_position;
+                count += changed;
+            }
+        };
+
+        [[maybe_unused]] size_t const window_count = for_each_chunk(values, report_minimisers);
+        assert(count <= window_count && window_count <= minimiser_positions.size());
+        return count;
+    }
+
+    /*!\brief Computes the minimum of every window of `values`.
+     * \param[in] values The values.
+     * \param[out] minima The minima; must provide space for `values.size() - window_size + 1` values.
+     * \returns The number of windows.
+     *
+     * \details
+     *
+     * If `values` is shorter than the window, the whole sequence is one window.
+     */
+    size_t minima(std::span<value_t const> const values, std::span<value_t> const minima)
+    {
+        auto copy_minima = [&](size_t const chunk_begin, size_t const chunk_windows)
+        {
+            assert(chunk_begin + chunk_windows <= minima.size());
+            std::ranges::copy_n(window_minima.begin(), chunk_windows, minima.begin() + chunk_begin);
+        };
+
+        return for_each_chunk(values, copy_minima);
+    }
+
+private:
+    //!\brief The number of values in one window.
+    size_t window_size{};
+
+    //!\brief The minima of the block prefixes.
+    std::vector<value_t> prefix_minima{};
+    //!\brief The positions of the minima of the block prefixes.
+    std::vector<size_t> prefix_positions{};
+    //!\brief The minima of the block suffixes.
+    std::vector<value_t> suffix_minima{};
+    //!\brief The positions of the minima of the block suffixes.
+    std::vector<size_t> suffix_positions{};
+    //!\brief The minima of the windows of the current chunk.
+    std::vector<value_t> window_minima{};
+    //!\brief The positions of the rightmost minima of the windows of the current chunk.
+    std::vector<size_t> window_minimum_positions{};
+
+    //!\brief All bits set if `condition` is true, no bits set otherwise. Selecting with masks avoids branches.
+    static constexpr size_t select_mask(bool const condition) noexcept
+    {
+        return -static_cast<size_t>(condition);
+    }
+
+    /*!\brief Computes the window minima chunk by chunk.
+     * \param[in] values The values.
+     * \param[in] callback Called with the position of the first window of a chunk and the number of its windows,
+     *                     after the minima of its windows have been computed.
+     * \returns The number of windows.
+     */
+    template <typename callback_t>
+    size_t for_each_chunk(std::span<value_t const> const values, callback_t && callback)
+    {
+        if (values.empty())
+            return 0u;
+
+        size_t const effective_window_size = std::min(window_size, values.size());
+        size_t const window_count = values.size() - effective_window_size + 1u;
+
+        // At least 4096 windows per chunk and a multiple of the window size, such that the blocks start at the chunk.
+        size_t const chunk_size = (4096u / effective_window_size + 1u) * effective_window_size;
+        resize_buffers(chunk_size + effective_window_size - 1u);
+
+        for (size_t chunk_begin = 0u; chunk_begin < window_count; chunk_begin += chunk_size)
+        {
+            size_t const chunk_windows = std::min(chunk_size, window_count - chunk_begin);
+            compute_window_minima(values.subspan(chunk_begin, chunk_windows + effective_window_size - 1u),
+                                  effective_window_size,
+                                  chunk_begin);
+            callback(chunk_begin, chunk_windows);
+        }
+
+        return window_count;
+    }
+
+    //!\brief Provides space for chunks of `size` values.
+    void resize_buffers(size_t const size)
+    {
+        if (prefix_minima.size() >= size)
+            return;
+
+        prefix_minima.resize(size);
+        prefix_positions.resize(size);
+        suffix_minima.resize(size);
+        suffix_positions.resize(size);
+        window_minima.resize(size);
+        window_minimum_positions.resize(size);
+    }
+
+    /*!\brief Computes the minima and the positions of the rightmost minima of all windows of a chunk.
+     * \param[in] chunk The values of the chunk.
+     * \param[in] block_size The window size.
+     * \param[in] offset The position of the first value of the chunk.
+     */
+    void compute_window_minima(std::span<value_t const> const chunk, size_t const block_size, size_t const offset)
+    {
+        size_t const size = chunk.size();
+
+        for (size_t block_begin = 0u; block_begin < size; block_begin += block_size)
+        {
+            size_t const block_end = std::min(block_begin + block_size, size);
+
+            // Prefix minima: on ties, the right value wins. The running minimum is kept in registers, because the
+            // compiler cannot rule out that the arrays alias the values.
+            value_t minimum = chunk[block_begin];
+            size_t position = offset + block_begin;
+            for (size_t i = block_begin; i < block_end; ++i)
+            {
+                value_t const value = chunk[i];
+                size_t const take = select_mask(value <= minimum);
+                minimum = std::min(value, minimum);
+                position = ((offset + i) & take) | (position & ~take);
+                prefix_minima[i] = minimum;
+                prefix_positions[i] = position;
+            }
+
+            // Suffix minima: on ties, the right value wins.
+            minimum = chunk[block_end - 1u];
+            position = offset + block_end - 1u;
+            for (size_t i = block_end; i > block_begin; --i)
+            {
+                value_t const value = chunk[i - 1u];
+                size_t const take = select_mask(value < minimum);
+                minimum = std::min(value, minimum);
+                position = ((offset + i - 1u) & take) | (position & ~take);
+                suffix_minima[i - 1u] = minimum;
+                suffix_positions[i - 1u] = position;
+            }
+        }
+
+        // The window [i, i + block_size) consists of the suffix starting at i and the prefix ending at
+        // i + block_size - 1. On ties, the prefix wins because it is to the right.
+        size_t const window_count = size - block_size + 1u;
+        value_t const * const prefix_minimum = prefix_minima.data() + block_size - 1u;
+        size_t const * const prefix_position = prefix_positions.data() + block_size - 1u;
+        for (size_t i = 0u; i < window_count; ++i)
+        {
+            size_t const take_prefix = select_mask(prefix_minimum[i] <= suffix_minima[i]);
+            window_minima[i] = std::min(prefix_minimum[i], suffix_minima[i]);
+            window_minimum_positions[i] = (prefix_position[i] & take_prefix) | (suffix_positions[i] & ~take_prefix);
+        }
+    }
+};
+
+} // namespace seqan3::detail
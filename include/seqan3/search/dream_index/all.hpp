@@ -8,11 +8,14 @@
  */
 
 /*!\defgroup search_dream_index DREAM Index
- * \brief Provides seqan3::interleaved_bloom_filter.
+ * \brief Provides seqan3::interleaved_bloom_filter, seqan3::counting_interleaved_bloom_filter and the memory mapped
+ *        seqan3::mapped_interleaved_bloom_filter.
  * \ingroup search
  * \see search
  */
 
 #pragma once
 
+#include <seqan3/search/dream_index/counting_interleaved_bloom_filter.hpp>
 #include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+#include <seqan3/search/dream_index/mapped_interleaved_bloom_filter.hpp>
@@ -0,0 +1,468 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::counting_interleaved_bloom_filter.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <ranges>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/utility/bloom_filter/bloom_filter_strong_types.hpp>
+#include <seqan3/utility/bloom_filter/detail/saturating_counters.hpp>
+
+#if SEQAN3_HAS_CEREAL
+#    include <cereal/types/vector.hpp>
+#endif // SEQAN3_HAS_CEREAL
+
+namespace seqan3
+{
+
+/*!\brief An Interleaved Bloom Filter with small saturating counters that estimates how often a value occurs in each
+ *        bin.
+ * \ingroup search_dream_index
+ * \tparam counter_bits The width of a counter in bits; must be 4 or 8. Defaults to 8.
+ * \implements seqan3::cerealisable
+ *
+ * \details
+ *
+ * The counting Interleaved Bloom Filter replaces each bit of a seqan3::interleaved_bloom_filter by a counter of
+ * `counter_bits` bits. The counters are interleaved in the same way as the bits of the
+ * seqan3::interleaved_bloom_filter: the `i`'th counters of all bins are adjacent to each other, so a query reads `h`
+ * contiguous rows of counters.
+ *
+ * Inserting a value into a bin increments the `h` counters of the bin the value is hashed to. A query returns, for each
+ * bin, the minimum of these counters. The count is never underestimated, but may be overestimated if other values of
+ * the same bin share all `h` counters with the queried one; a count of 0 means the value is not in the bin. Counters
+ * saturate at seqan3::counting_interleaved_bloom_filter::max_count, i.e. larger counts are reported as `max_count`.
+ * Both filters use the same hash functions, hence a bin contains a value iff the value is in the bin of a
+ * seqan3::interleaved_bloom_filter of the same size.
+ *
+ * A 4 bit counting Interleaved Bloom Filter needs four times, an 8 bit one eight times the memory of the
+ * seqan3::interleaved_bloom_filter. 4 bit counters suffice to distinguish absent, rare and frequent values, e.g. for
+ * abundance-aware prefiltering of expression data.
+ *
+ * ### Querying
+ *
+ * To query the counting Interleaved Bloom Filter, call seqan3::counting_interleaved_bloom_filter::counting_agent()
+ * and use the returned seqan3::counting_interleaved_bloom_filter::counting_agent_type. The agent computes the
+ * bin-wise minimum of the `h` rows with SIMD instructions.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/dream_index/counting_interleaved_bloom_filter.cpp
+ *
+ * ### Thread safety
+ *
+ * The counting Interleaved Bloom Filter promises the basic thread-safety by the STL that all
+ * calls to `const` member functions are safe from multiple threads (as long as no thread calls
+ * a non-`const` member function at the same time).
+ *
+ * Additionally, concurrent calls to `emplace` are safe iff each thread handles a multiple of 64 many bins, e.g.
+ * `thread_1` accesses bins 0-63, `thread_2` bins 64-127, and so on.
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+template <size_t counter_bits = 8>
+class counting_interleaved_bloom_filter
+{
+private:
+    //!\brief The operations on the counters.
+    using counters_t = detail::saturating_counters<counter_bits>;
+
+    //!\brief The number of bins specified by the user.
+    size_t bins{};
+    //!\brief The number of bins stored in a row (next multiple of 64 of `bins`).
+    size_t technical_bins{};
+    //!\brief The number of counters of each bin.
+    size_t bin_size_{};
+    //!\brief The number of bits to shift the hash value before doing multiplicative hashing.
+    size_t hash_shift{};
+    //!\brief The number of bytes of a row, i.e. of the `technical_bins` counters with the same index.
+    size_t row_bytes{};
+    //!\brief The number of hash functions.
+    size_t hash_funs{};
+    //!\brief The packed counters.
+    std::vector<uint8_t> data{};
+    //!\brief Precalculated seeds for multiplicative hashing. We use large irrational numbers for a uniform hashing.
+    static constexpr std::array<size_t, 5> hash_seeds{13'572'355'802'537'770'549ULL, // 2**64 / (e/2)
+                                                      13'043'817'825'332'782'213ULL, // 2**64 / sqrt(2)
+                                                      10'650'232'656'628'343'401ULL, // 2**64 / sqrt(3)
+                                                      16'499'269'484'942'379'435ULL, // 2**64 / (sqrt(5)/2)
+                                                      4'893'150'838'803'335'377ULL}; // 2**64 / (3*pi/5)
+
+    /*!\brief Perturbs a value and fits it into the vector.
+     * \param h The value to process.
+     * \param seed The seed to use.
+     * \returns The byte offset of a row within `data`.
+     * \sa seqan3::interleaved_bloom_filter
+     */
+    inline constexpr size_t hash_and_fit(size_t h, size_t const seed) const
+    {
+        h *= seed;
+        assert(hash_shift < 64);
+        h ^= h >> hash_shift;               // XOR and shift higher bits into lower bits
+        h *= 11'400'714'819'323'198'485ULL; // = 2^64 / golden_ration, to expand h to 64 bit range
+                                            // Use fastrange (integer modulo without division) if possible.
+#ifdef __SIZEOF_INT128__
+        h = static_cast<uint64_t>((static_cast<__uint128_t>(h) * static_cast<__uint128_t>(bin_size_)) >> 64);
+#else
+        h %= bin_size_;
+#endif
+        h *= row_bytes;
+        return h;
+    }
+
+public:
+    //!\brief The largest count that can be stored; larger counts saturate at this value.
+    static constexpr size_t max_count = counters_t::max_count;
+
+    template <std::unsigned_integral value_t>
+    class counting_agent_type; // documented upon definition below
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    counting_interleaved_bloom_filter() = default;                                                      //!< Defaulted.
+    counting_interleaved_bloom_filter(counting_interleaved_bloom_filter const &) = default;             //!< Defaulted.
+    counting_interleaved_bloom_filter & operator=(counting_interleaved_bloom_filter const &) = default; //!< Defaulted.
+    counting_interleaved_bloom_filter(counting_interleaved_bloom_filter &&) = default;                  //!< Defaulted.
+    counting_interleaved_bloom_filter & operator=(counting_interleaved_bloom_filter &&) = default;      //!< Defaulted.
+    ~counting_interleaved_bloom_filter() = default;                                                     //!< Defaulted.
+
+    /*!\brief Construct a counting Interleaved Bloom Filter.
+     * \param bins_ The number of bins.
+     * \param size The number of counters of each bin.
+     * \param funs The number of hash functions. Default 2. At least 1, at most 5.
+     * \throws std::logic_error If `bins_` or `size` is 0 or `funs` is not in `[1, 5]`.
+     */
+    counting_interleaved_bloom_filter(seqan3::bin_count bins_,
+                                      seqan3::bin_size size,
+                                      seqan3::hash_function_count funs = seqan3::hash_function_count{2u})
+    {
+        bins = bins_.get();
+        bin_size_ = size.get();
+        hash_funs = funs.get();
+
+        if (bins == 0)
+            throw std::logic_error{"The number of bins must be > 0."};
+        if (hash_funs == 0 || hash_funs > 5)
+            throw std::logic_error{"The number of hash functions must be > 0 and <= 5."};
+        if (bin_size_ == 0)
+            throw std::logic_error{"The size of a bin must be > 0."};
+
+        hash_shift = std::countl_zero(bin_size_);
+        technical_bins = ((bins + 63) >> 6) << 6; // = ceil(bins/64) * 64
+        row_bytes = counters_t::bytes_for(technical_bins);
+        data.resize(row_bytes * bin_size_);
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    /*!\brief Inserts a value into a specific bin.
+     * \param[in] value The raw numeric value to process.
+     * \param[in] bin The bin index to insert into.
+     * \param[in] count How often the value is inserted. Defaults to 1.
+     */
+    void emplace(size_t const value, bin_index const bin, size_t const count = 1u) noexcept
+    {
+        assert(bin.get() < bins);
+        for (size_t i = 0; i < hash_funs; ++i)
+        {
+            size_t const offset = hash_and_fit(value, hash_seeds[i]);
+            assert(offset < data.size());
+            counters_t::add(data.data() + offset, bin.get(), count);
+        }
+    }
+
+    /*!\brief Clears a specific bin.
+     * \param[in] bin The bin index to clear.
+     */
+    void clear(bin_index const bin) noexcept
+    {
+        assert(bin.get() < bins);
+        for (size_t offset = 0; offset < data.size(); offset += row_bytes)
+            counters_t::reset(data.data() + offset, bin.get());
+    }
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    /*!\brief Returns a seqan3::counting_interleaved_bloom_filter::counting_agent_type to be used for lookup.
+     * \tparam value_t The type of the counts; must model std::unsigned_integral. Defaults to `uint16_t`.
+     */
+    template <std::unsigned_integral value_t = uint16_t>
+    counting_agent_type<value_t> counting_agent() const
+    {
+        return counting_agent_type<value_t>{*this};
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    /*!\brief Returns the number of hash functions used in the counting Interleaved Bloom Filter.
+     * \returns The number of hash functions.
+     */
+    size_t hash_function_count() const noexcept
+    {
+        return hash_funs;
+    }
+
+    /*!\brief Returns the number of bins that the counting Interleaved Bloom Filter manages.
+     * \returns The number of bins.
+     */
+    size_t bin_count() const noexcept
+    {
+        return bins;
+    }
+
+    /*!\brief Returns the size of a single bin that the counting Interleaved Bloom Filter manages.
+     * \returns The number of counters of a single bin.
+     */
+    size_t bin_size() const noexcept
+    {
+        return bin_size_;
+    }
+
+    /*!\brief Returns the size of the underlying counters.
+     * \returns The size in bits of all counters.
+     */
+    size_t bit_size() const noexcept
+    {
+        return data.size() * 8u;
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    /*!\brief Test for equality.
+     * \param[in] lhs A `seqan3::counting_interleaved_bloom_filter`.
+     * \param[in] rhs `seqan3::counting_interleaved_bloom_filter` to compare to.
+     * \returns `true` if equal, `false` otherwise.
+     */
+    friend bool operator==(counting_interleaved_bloom_filter const & lhs,
+                           counting_interleaved_bloom_filter const & rhs) noexcept
+    {
+        return std::tie(lhs.bins, lhs.technical_bins, lhs.bin_size_, lhs.hash_shift, lhs.hash_funs, lhs.data)
+            == std::tie(rhs.bins, rhs.technical_bins, rhs.bin_size_, rhs.hash_shift, rhs.hash_funs, rhs.data);
+    }
+
+    /*!\brief Test for inequality.
+     * \param[in] lhs A `seqan3::counting_interleaved_bloom_filter`.
+     * \param[in] rhs `seqan3::counting_interleaved_bloom_filter` to compare to.
+     * \returns `true` if unequal, `false` otherwise.
+     */
+    friend bool operator!=(counting_interleaved_bloom_filter const & lhs,
+                           counting_interleaved_bloom_filter const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+
+    /*!\name Access
+     * \{
+     */
+    /*!\brief Provides direct, unsafe access to the underlying data structure.
+     * \returns A reference to the packed counters.
+     *
+     * \details
+     *
+     * \noapi{The exact representation of the data is implementation defined.}
+     */
+    constexpr std::vector<uint8_t> & raw_data() noexcept
+    {
+        return data;
+    }
+
+    //!\copydoc raw_data()
+    constexpr std::vector<uint8_t> const & raw_data() const noexcept
+    {
+        return data;
+    }
+    //!\}
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param[in] archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(bins);
+        archive(technical_bins);
+        archive(bin_size_);
+        archive(hash_shift);
+        archive(row_bytes);
+        archive(hash_funs);
+        archive(data);
+    }
+    //!\endcond
+};
+
+/*!\brief Manages abundance queries for the seqan3::counting_interleaved_bloom_filter.
+ * \tparam value_t The type of the counts; must model std::unsigned_integral.
+ *
+ * \details
+ *
+ * The `value_t` template parameter should be chosen in a way that no overflow occurs when adding up the counts of all
+ * values passed to `bulk_count`, e.g. `uint16_t` suffices for up to 257 values with 8 bit counters.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/dream_index/counting_interleaved_bloom_filter.cpp
+ */
+template <size_t counter_bits>
+template <std::unsigned_integral value_t>
+class counting_interleaved_bloom_filter<counter_bits>::counting_agent_type
+{
+private:
+    //!\brief The type of the augmented seqan3::counting_interleaved_bloom_filter.
+    using ibf_t = counting_interleaved_bloom_filter<counter_bits>;
+
+    //!\brief A pointer to the augmented seqan3::counting_interleaved_bloom_filter.
+    ibf_t const * ibf_ptr{nullptr};
+
+    //!\brief The bin-wise minimum of the rows of the last value.
+    std::vector<uint8_t> minimum_buffer;
+
+    //!\brief Stores the bin-wise minimum of the `h` rows of `value` in `minimum_buffer`.
+    void compute_minimum(size_t const value) noexcept
+    {
+        uint8_t const * data = ibf_ptr->data.data();
+        size_t const bytes = minimum_buffer.size();
+
+        std::ranges::copy_n(data + ibf_ptr->hash_and_fit(value, ibf_ptr->hash_seeds[0]), bytes, minimum_buffer.data());
+
+        for (size_t i = 1; i < ibf_ptr->hash_funs; ++i)
+        {
+            uint8_t const * row = data + ibf_ptr->hash_and_fit(value, ibf_ptr->hash_seeds[i]);
+            counters_t::minimum(minimum_buffer.data(), row, bytes);
+        }
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    counting_agent_type() = default;                                        //!< Defaulted.
+    counting_agent_type(counting_agent_type const &) = default;             //!< Defaulted.
+    counting_agent_type & operator=(counting_agent_type const &) = default; //!< Defaulted.
+    counting_agent_type(counting_agent_type &&) = default;                  //!< Defaulted.
+    counting_agent_type & operator=(counting_agent_type &&) = default;      //!< Defaulted.
+    ~counting_agent_type() = default;                                       //!< Defaulted.
+
+    /*!\brief Construct a counting_agent_type for an existing seqan3::counting_interleaved_bloom_filter.
+     * \private
+     * \param ibf The seqan3::counting_interleaved_bloom_filter.
+     */
+    explicit counting_agent_type(ibf_t const & ibf) :
+        ibf_ptr(std::addressof(ibf)),
+        minimum_buffer(counters_t::bytes_for(ibf.bin_count())),
+        result_buffer(ibf.bin_count())
+    {}
+    //!\}
+
+    //!\brief Stores the result of bulk_abundance() and bulk_count().
+    std::vector<value_t> result_buffer;
+
+    /*!\name Lookup
+     * \{
+     */
+    /*!\brief Determines how often a value (probably) occurs in each bin.
+     * \param[in] value The raw value to process.
+     * \returns For each bin, the minimum of the counters the value is hashed to.
+     *
+     * \attention The result of this function must always be bound via reference, e.g. `auto &`, to prevent copying.
+     * \attention Sequential calls to this function invalidate the previously returned reference.
+     *
+     * \details
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are not thread safe, please create a
+     * seqan3::counting_interleaved_bloom_filter::counting_agent_type for each thread.
+     */
+    [[nodiscard]] std::vector<value_t> const & bulk_abundance(size_t const value) & noexcept
+    {
+        assert(ibf_ptr != nullptr);
+        assert(result_buffer.size() == ibf_ptr->bin_count());
+
+        compute_minimum(value);
+        std::ranges::fill(result_buffer, 0);
+        counters_t::accumulate(result_buffer.data(), minimum_buffer.data(), result_buffer.size());
+
+        return result_buffer;
+    }
+
+    // `bulk_abundance` cannot be called on a temporary, since the object the returned reference points to
+    // is immediately destroyed.
+    [[nodiscard]] std::vector<value_t> const & bulk_abundance(size_t const value) && noexcept = delete;
+    //!\}
+
+    /*!\name Counting
+     * \{
+     */
+    /*!\brief Adds up, for each bin, the counts of all values in a range.
+     * \tparam value_range_t The type of the range of values. Must model std::ranges::input_range. The reference type
+     *                       must model std::unsigned_integral.
+     * \param[in] values The range of values to process.
+     * \returns For each bin, the sum of the counts that seqan3::counting_interleaved_bloom_filter::counting_agent_type
+     *          ::bulk_abundance returns for the values.
+     *
+     * \attention The result of this function must always be bound via reference, e.g. `auto &`, to prevent copying.
+     * \attention Sequential calls to this function invalidate the previously returned reference.
+     *
+     * \details
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are not thread safe, please create a
+     * seqan3::counting_interleaved_bloom_filter::counting_agent_type for each thread.
+     */
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] std::vector<value_t> const & bulk_count(value_range_t && values) & noexcept
+    {
+        assert(ibf_ptr != nullptr);
+        assert(result_buffer.size() == ibf_ptr->bin_count());
+
+        static_assert(std::ranges::input_range<value_range_t>, "The values must model input_range.");
+        static_assert(std::unsigned_integral<std::ranges::range_value_t<value_range_t>>,
+                      "An individual value must be an unsigned integral.");
+
+        std::ranges::fill(result_buffer, 0);
+
+        for (auto && value : values)
+        {
+            compute_minimum(value);
+            counters_t::accumulate(result_buffer.data(), minimum_buffer.data(), result_buffer.size());
+        }
+
+        return result_buffer;
+    }
+
+    // `bulk_count` cannot be called on a temporary, since the object the returned reference points to
+    // is immediately destroyed.
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] std::vector<value_t> const & bulk_count(value_range_t && values) && noexcept = delete;
+    //!\}
+};
+
+} // namespace seqan3
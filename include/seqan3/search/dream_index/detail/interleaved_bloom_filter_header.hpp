@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::interleaved_bloom_filter_header.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+namespace seqan3::detail
+{
+
+/*!\brief The header of a file written by seqan3::interleaved_bloom_filter::write.
+ * \ingroup search_dream_index
+ *
+ * \details
+ *
+ * All integers are stored in little endian byte order. The header is followed by `bin_size` rows of
+ * `ceil(shard_bin_count / 64)` 64 bit words each. Row `i` holds bit `i` of the bins
+ * `[first_bin, first_bin + shard_bin_count)` of the Interleaved Bloom Filter, bin `first_bin + j` in bit `j % 64` of
+ * word `j / 64`. Unused bits of the last word of a row are 0.
+ *
+ * The files are written by seqan3::interleaved_bloom_filter::write. Note that seqan3::interleaved_bloom_filter is
+ * deprecated; the format is kept stable regardless.
+ */
+struct interleaved_bloom_filter_header
+{
+    //!\brief The magic string that identifies the file format.
+    static constexpr std::array<char, 8> expected_magic{'S', 'Q', '3', 'I', 'B', 'F', 'S', 'H'};
+    //!\brief The version of the file format.
+    static constexpr uint32_t current_version{1u};
+
+    //!\brief Identifies the file format.
+    std::array<char, 8> magic{expected_magic};
+    //!\brief The version of the file format.
+    uint32_t version{current_version};
+    //!\brief The number of hash functions.
+    uint32_t hash_function_count{};
+    //!\brief The number of bins of the whole Interleaved Bloom Filter.
+    uint64_t bin_count{};
+    //!\brief The size of a bin in bits, i.e. the number of rows.
+    uint64_t bin_size{};
+    //!\brief The first bin stored in the file; a multiple of 64.
+    uint64_t first_bin{};
+    //!\brief The number of bins stored in the file.
+    uint64_t shard_bin_count{};
+    //!\brief Reserved for future use; always 0.
+    std::array<uint64_t, 2> reserved{};
+};
+
+static_assert(sizeof(interleaved_bloom_filter_header) == 64u);
+static_assert(std::is_trivially_copyable_v<interleaved_bloom_filter_header>);
+
+} // namespace seqan3::detail
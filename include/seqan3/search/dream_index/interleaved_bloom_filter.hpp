@@ -11,9 +11,12 @@
 
 #include <algorithm>
 #include <bit>
+#include <filesystem>
+#include <fstream>
 
 #include <seqan3/contrib/sdsl-lite.hpp>
 #include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/search/dream_index/detail/interleaved_bloom_filter_header.hpp>
 //Todo: When removing, the contents of the following header can be moved into utility/bloom_filter/bloom_filter.hpp
 #include <seqan3/utility/bloom_filter/bloom_filter_strong_types.hpp>
 
@@ -516,6 +519,93 @@ public:
     }
     //!\}
 
+    /*!\name Storage
+     * \{
+     */
+    /*!\brief Writes the bins `[first.get(), first.get() + count.get())` to a file that can be mapped with
+     *        seqan3::mapped_interleaved_bloom_filter.
+     * \param[in] path The path to the file; an existing file is overwritten.
+     * \param[in] first The first bin to write; must be a multiple of 64.
+     * \param[in] count The number of bins to write.
+     * \throws std::logic_error if `count` is 0, `first` is not a multiple of 64 or the bins exceed bin_count().
+     * \throws std::filesystem::filesystem_error if the file cannot be written.
+     * \throws std::runtime_error on big endian platforms.
+     *
+     * \details
+     *
+     * The file is a *shard* of the Interleaved Bloom Filter that only contains the given bins; see
+     * seqan3::detail::interleaved_bloom_filter_header for the format. Since a shard starts at a multiple of 64, its
+     * rows are a contiguous range of words of the rows of the Interleaved Bloom Filter and are copied without shifting.
+     * To spread the Interleaved Bloom Filter over several machines, write one shard per machine and merge the results
+     * of the shards, see seqan3::sharded_interleaved_bloom_filter.
+     *
+     * ### Example
+     *
+     * \include test/snippet/search/dream_index/mapped_interleaved_bloom_filter.cpp
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    void write(std::filesystem::path const & path, seqan3::bin_index const first, seqan3::bin_count const count) const
+    {
+        if constexpr (std::endian::native != std::endian::little)
+            throw std::runtime_error{"Memory mapped Interleaved Bloom Filters are only supported on little endian "
+                                     "platforms."};
+
+        if (count.get() == 0u)
+            throw std::logic_error{"A shard must contain at least one bin."};
+        if (first.get() % 64u != 0u)
+            throw std::logic_error{"The first bin of a shard must be a multiple of 64."};
+        if (count.get() > bins || first.get() > bins - count.get())
+            throw std::logic_error{"The bins of a shard must be smaller than the number of bins."};
+
+        detail::interleaved_bloom_filter_header header{};
+        header.hash_function_count = hash_funs;
+        header.bin_count = bins;
+        header.bin_size = bin_size_;
+        header.first_bin = first.get();
+        header.shard_bin_count = count.get();
+
+        std::ofstream stream{path, std::ios::binary | std::ios::trunc};
+        stream.write(reinterpret_cast<char const *>(&header), sizeof(header));
+
+        // The bits of the last word that belong to bins of the next shard or to no bin are cleared.
+        size_t const words = (count.get() + 63u) >> 6;
+        uint64_t const last_word_mask = (count.get() % 64u == 0u) ? -1ULL : (1ULL << (count.get() % 64u)) - 1u;
+        std::vector<uint64_t> row(words);
+
+        for (size_t offset = first.get(); offset < data.size(); offset += technical_bins)
+        {
+            for (size_t word = 0; word < words; ++word)
+                row[word] = data.get_int(offset + (word << 6));
+            row.back() &= last_word_mask;
+
+            stream.write(reinterpret_cast<char const *>(row.data()), words * sizeof(uint64_t));
+        }
+        stream.flush();
+
+        if (!stream)
+            throw std::filesystem::filesystem_error{"Cannot write the Interleaved Bloom Filter.",
+                                                    path,
+                                                    std::make_error_code(std::errc::io_error)};
+    }
+
+    /*!\brief Writes all bins to a file that can be mapped with seqan3::mapped_interleaved_bloom_filter.
+     * \param[in] path The path to the file; an existing file is overwritten.
+     * \throws std::filesystem::filesystem_error if the file cannot be written.
+     * \throws std::runtime_error on big endian platforms.
+     *
+     * \details
+     *
+     * The same as `write(path, seqan3::bin_index{0u}, seqan3::bin_count{bin_count()})`.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    void write(std::filesystem::path const & path) const
+    {
+        write(path, seqan3::bin_index{0u}, seqan3::bin_count{bins});
+    }
+    //!\}
+
     /*!\cond DEV
      * \brief Serialisation support function.
      * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
@@ -557,6 +647,77 @@ private:
     //!\brief A pointer to the augmented seqan3::interleaved_bloom_filter.
     ibf_t const * ibf_ptr{nullptr};
 
+    //!\brief The number of values whose rows are computed before the first of them is looked up.
+    static constexpr size_t batch_size = 64u;
+
+    //!\brief The number of values between prefetching the rows of a value and looking it up.
+    static constexpr size_t prefetch_distance = 8u;
+
+    //!\brief Computes the positions of the rows of `value` and stores them in `bloom_filter_indices`.
+    void hash(size_t const value, size_t * bloom_filter_indices) const noexcept
+    {
+        for (size_t i = 0; i < ibf_ptr->hash_funs; ++i)
+            bloom_filter_indices[i] = ibf_ptr->hash_and_fit(value, ibf_ptr->hash_seeds[i]);
+    }
+
+    //!\brief Prefetches the rows starting at `bloom_filter_indices` (uncompressed only).
+    void prefetch(size_t const * bloom_filter_indices) const noexcept
+    {
+        if constexpr (data_layout_mode == data_layout::uncompressed)
+        {
+            // A row consists of `bin_words` words; eight words make up a cache line.
+            for (size_t i = 0; i < ibf_ptr->hash_funs; ++i)
+            {
+                uint64_t const * row = ibf_ptr->data.data() + (bloom_filter_indices[i] >> 6);
+                for (size_t word = 0; word < ibf_ptr->bin_words; word += 8u)
+                    __builtin_prefetch(row + word);
+            }
+        }
+    }
+
+    //!\brief Stores the bitwise AND of the rows starting at `bloom_filter_indices` in #result_buffer.
+    void reduce(size_t * bloom_filter_indices) noexcept
+    {
+        size_t const hash_funs = ibf_ptr->hash_funs;
+        size_t const bin_words = ibf_ptr->bin_words;
+
+        if constexpr (data_layout_mode == data_layout::uncompressed)
+        {
+            // Rows start at multiples of 64, hence they can be read word by word.
+            std::array<uint64_t const *, 5> rows;
+            for (size_t i = 0; i < hash_funs; ++i)
+            {
+                assert(bloom_filter_indices[i] + (bin_words << 6) <= ibf_ptr->data.size());
+                rows[i] = ibf_ptr->data.data() + (bloom_filter_indices[i] >> 6);
+            }
+
+            uint64_t * const result = result_buffer.data.data();
+            for (size_t batch = 0; batch < bin_words; ++batch)
+            {
+                uint64_t tmp{-1ULL};
+                for (size_t i = 0; i < hash_funs; ++i)
+                    tmp &= rows[i][batch];
+
+                result[batch] = tmp;
+            }
+        }
+        else
+        {
+            for (size_t batch = 0; batch < bin_words; ++batch)
+            {
+                size_t tmp{-1ULL};
+                for (size_t i = 0; i < hash_funs; ++i)
+                {
+                    assert(bloom_filter_indices[i] < ibf_ptr->data.size());
+                    tmp &= ibf_ptr->data.get_int(bloom_filter_indices[i]);
+                    bloom_filter_indices[i] += 64;
+                }
+
+                result_buffer.data.set_int(batch << 6, tmp);
+            }
+        }
+    }
+
 public:
     class binning_bitvector;
 
@@ -607,30 +768,83 @@ public:
         assert(result_buffer.size() == ibf_ptr->bin_count());
 
         std::array<size_t, 5> bloom_filter_indices;
-        std::memcpy(&bloom_filter_indices, &ibf_ptr->hash_seeds, sizeof(size_t) * ibf_ptr->hash_funs);
+        hash(value, bloom_filter_indices.data());
+        reduce(bloom_filter_indices.data());
 
-        for (size_t i = 0; i < ibf_ptr->hash_funs; ++i)
-            bloom_filter_indices[i] = ibf_ptr->hash_and_fit(value, bloom_filter_indices[i]);
+        return result_buffer;
+    }
+
+    // `bulk_contains` cannot be called on a temporary, since the object the returned reference points to
+    // is immediately destroyed.
+    [[nodiscard]] binning_bitvector const & bulk_contains(size_t const value) && noexcept = delete;
 
-        for (size_t batch = 0; batch < ibf_ptr->bin_words; ++batch)
+    /*!\brief Determines set membership of all values in a range.
+     * \tparam value_range_t The type of the range of values. Must model std::ranges::input_range. The reference type
+     *                       must model std::unsigned_integral.
+     * \tparam on_result_t The type of the callback. Must be invocable with a `binning_bitvector const &`.
+     * \param[in] values The range of values to process.
+     * \param[in] on_result Called with the result of each value, in the order of `values`.
+     *
+     * \details
+     *
+     * The result passed to `on_result` is the same as that of `bulk_contains(value)` and is only valid during the
+     * call. Instead of looking up one value after another, the values are processed in batches of 64: the rows of all
+     * values of a batch are computed first. While the values are looked up, the rows of the value 8 positions ahead
+     * are prefetched, such that the memory accesses of different values overlap without exceeding the number of cache
+     * misses that can be outstanding at once. This hides most of the memory latency if the Interleaved Bloom Filter
+     * is much larger than the cache.
+     *
+     * ### Example
+     *
+     * \include test/snippet/search/dream_index/membership_agent_bulk_contains_range.cpp
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are not thread safe, please create a
+     * seqan3::interleaved_bloom_filter::membership_agent_type for each thread.
+     */
+    template <std::ranges::range value_range_t, typename on_result_t>
+        requires std::invocable<on_result_t &, binning_bitvector const &>
+    void bulk_contains(value_range_t && values, on_result_t && on_result) &
+    {
+        assert(ibf_ptr != nullptr);
+        assert(result_buffer.size() == ibf_ptr->bin_count());
+
+        static_assert(std::ranges::input_range<value_range_t>, "The values must model input_range.");
+        static_assert(std::unsigned_integral<std::ranges::range_value_t<value_range_t>>,
+                      "An individual value must be an unsigned integral.");
+
+        std::array<size_t, batch_size * 5> bloom_filter_indices;
+        size_t const stride = ibf_ptr->hash_funs;
+        size_t count{};
+
+        // Only a limited number of cache misses can be outstanding at once. Hence, the rows of a value are prefetched
+        // `prefetch_distance` values before they are needed instead of prefetching the rows of the whole batch at once.
+        auto flush = [&]()
         {
-            size_t tmp{-1ULL};
-            for (size_t i = 0; i < ibf_ptr->hash_funs; ++i)
+            for (size_t i = 0; i < std::min(prefetch_distance, count); ++i)
+                prefetch(bloom_filter_indices.data() + i * stride);
+
+            for (size_t i = 0; i < count; ++i)
             {
-                assert(bloom_filter_indices[i] < ibf_ptr->data.size());
-                tmp &= ibf_ptr->data.get_int(bloom_filter_indices[i]);
-                bloom_filter_indices[i] += 64;
+                if (i + prefetch_distance < count)
+                    prefetch(bloom_filter_indices.data() + (i + prefetch_distance) * stride);
+
+                reduce(bloom_filter_indices.data() + i * stride);
+                on_result(std::as_const(result_buffer));
             }
+            count = 0;
+        };
 
-            result_buffer.data.set_int(batch << 6, tmp);
-        }
+        for (auto && value : values)
+        {
+            hash(value, bloom_filter_indices.data() + count * stride);
 
-        return result_buffer;
+            if (++count == batch_size)
+                flush();
+        }
+        flush();
     }
-
-    // `bulk_contains` cannot be called on a temporary, since the object the returned reference points to
-    // is immediately destroyed.
-    [[nodiscard]] binning_bitvector const & bulk_contains(size_t const value) && noexcept = delete;
     //!\}
 };
 
@@ -981,6 +1195,9 @@ public:
      *
      * \details
      *
+     * The values are looked up in batches whose memory accesses overlap, see
+     * seqan3::interleaved_bloom_filter::membership_agent_type::bulk_contains.
+     *
      * ### Example
      *
      * \include test/snippet/search/dream_index/counting_agent.cpp
@@ -1002,8 +1219,11 @@ public:
 
         std::ranges::fill(result_buffer, 0);
 
-        for (auto && value : values)
-            result_buffer += membership_agent.bulk_contains(value);
+        membership_agent.bulk_contains(std::forward<value_range_t>(values),
+                                       [this](auto const & membership)
+                                       {
+                                           result_buffer += membership;
+                                       });
 
         return result_buffer;
     }
@@ -0,0 +1,598 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::mapped_interleaved_bloom_filter and seqan3::sharded_interleaved_bloom_filter.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/search/dream_index/detail/interleaved_bloom_filter_header.hpp>
+#include <seqan3/utility/detail/memory_mapped_file.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A read-only shard of a seqan3::interleaved_bloom_filter that is stored in a memory mapped file.
+ * \ingroup search_dream_index
+ *
+ * \details
+ *
+ * The file is written with seqan3::interleaved_bloom_filter::write and contains either all bins or a contiguous range
+ * of bins, a *shard*, of an Interleaved Bloom Filter. Opening it takes constant time, the pages are only loaded when
+ * they are accessed and all processes that open the same file share the same physical memory. Since the bits of all
+ * bins are interleaved, a range of bins cannot be loaded from a file that contains all bins without reading the whole
+ * file. Hence, each shard is written to its own file and a query node maps only the shards of the bins it serves.
+ *
+ * The counts of a shard refer to the bins `[first_bin(), first_bin() + bin_count())` of the Interleaved Bloom Filter.
+ * To merge the results of several shards, e.g. of shards on different machines, copy the counts of each shard to the
+ * position `first_bin()` of a vector of size total_bin_count(). seqan3::sharded_interleaved_bloom_filter does this
+ * for shards that are mapped by the same process.
+ *
+ * Memory mapping is only supported on little endian platforms.
+ *
+ * Note that the writer, seqan3::interleaved_bloom_filter, is deprecated. The file format is independent of it, see
+ * seqan3::detail::interleaved_bloom_filter_header.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/dream_index/mapped_interleaved_bloom_filter.cpp
+ *
+ * ### Thread safety
+ *
+ * The filter is never modified, so all member functions can be called concurrently. Create a
+ * seqan3::mapped_interleaved_bloom_filter::counting_agent_type for each thread.
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+class mapped_interleaved_bloom_filter
+{
+private:
+    //!\brief The mapped file.
+    detail::memory_mapped_file file{};
+    //!\brief The rows of the shard.
+    uint64_t const * rows{nullptr};
+    //!\brief The number of bins of the whole Interleaved Bloom Filter.
+    size_t total_bins{};
+    //!\brief The first bin of the shard.
+    size_t first_bin_{};
+    //!\brief The number of bins of the shard.
+    size_t bins{};
+    //!\brief The size of a bin in bits.
+    size_t bin_size_{};
+    //!\brief The number of bits to shift the hash value before doing multiplicative hashing.
+    size_t hash_shift{};
+    //!\brief The number of 64 bit words of a row.
+    size_t row_words{};
+    //!\brief The number of hash functions.
+    size_t hash_funs{};
+    //!\brief Precalculated seeds for multiplicative hashing, the same as the ones of seqan3::interleaved_bloom_filter.
+    static constexpr std::array<size_t, 5> hash_seeds{13'572'355'802'537'770'549ULL, // 2**64 / (e/2)
+                                                      13'043'817'825'332'782'213ULL, // 2**64 / sqrt(2)
+                                                      10'650'232'656'628'343'401ULL, // 2**64 / sqrt(3)
+                                                      16'499'269'484'942'379'435ULL, // 2**64 / (sqrt(5)/2)
+                                                      4'893'150'838'803'335'377ULL}; // 2**64 / (3*pi/5)
+
+    /*!\brief Perturbs a value and fits it into the rows.
+     * \param h The value to process.
+     * \param seed The seed to use.
+     * \returns The first word of a row.
+     * \sa seqan3::interleaved_bloom_filter
+     */
+    inline constexpr size_t hash_and_fit(size_t h, size_t const seed) const
+    {
+        h *= seed;
+        assert(hash_shift < 64);
+        h ^= h >> hash_shift;               // XOR and shift higher bits into lower bits
+        h *= 11'400'714'819'323'198'485ULL; // = 2^64 / golden_ration, to expand h to 64 bit range
+                                            // Use fastrange (integer modulo without division) if possible.
+#ifdef __SIZEOF_INT128__
+        h = static_cast<uint64_t>((static_cast<__uint128_t>(h) * static_cast<__uint128_t>(bin_size_)) >> 64);
+#else
+        h %= bin_size_;
+#endif
+        h *= row_words;
+        return h;
+    }
+
+public:
+    template <std::unsigned_integral value_t>
+    class counting_agent_type; // documented upon definition below
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    mapped_interleaved_bloom_filter() = default;                                                    //!< Defaulted.
+    mapped_interleaved_bloom_filter(mapped_interleaved_bloom_filter const &) = delete;             //!< Deleted.
+    mapped_interleaved_bloom_filter & operator=(mapped_interleaved_bloom_filter const &) = delete; //!< Deleted.
+    ~mapped_interleaved_bloom_filter() = default;                                                   //!< Defaulted.
+
+    //!\brief Move constructor; `other` is empty afterwards.
+    mapped_interleaved_bloom_filter(mapped_interleaved_bloom_filter && other) noexcept
+    {
+        swap(other);
+    }
+
+    //!\brief Move assignment; `other` is empty afterwards.
+    mapped_interleaved_bloom_filter & operator=(mapped_interleaved_bloom_filter && other) noexcept
+    {
+        mapped_interleaved_bloom_filter tmp{std::move(other)};
+        swap(tmp);
+        return *this;
+    }
+
+    /*!\brief Maps a file that was written by seqan3::interleaved_bloom_filter::write.
+     * \param[in] path The path to the file.
+     * \throws std::filesystem::filesystem_error if the file cannot be opened or mapped.
+     * \throws std::runtime_error if the file is not a valid Interleaved Bloom Filter.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Constant; only the header and the file size are checked.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    explicit mapped_interleaved_bloom_filter(std::filesystem::path const & path) : file{path}
+    {
+        if constexpr (std::endian::native != std::endian::little)
+            throw std::runtime_error{"Memory mapped Interleaved Bloom Filters are only supported on little endian "
+                                     "platforms."};
+
+        detail::interleaved_bloom_filter_header header{};
+        if (file.size() < sizeof(header))
+            throw std::runtime_error{"The file is too small to be an Interleaved Bloom Filter."};
+
+        std::memcpy(&header, file.data(), sizeof(header));
+
+        if (header.magic != header.expected_magic)
+            throw std::runtime_error{"The file is not an Interleaved Bloom Filter."};
+        if (header.version != header.current_version)
+            throw std::runtime_error{"Unsupported version " + std::to_string(header.version)
+                                     + " of the Interleaved Bloom Filter."};
+        // Written such that no value of the header can overflow.
+        if (header.hash_function_count == 0u || header.hash_function_count > 5u || header.bin_size == 0u
+            || header.shard_bin_count == 0u || header.first_bin % 64u != 0u || header.shard_bin_count > header.bin_count
+            || header.first_bin > header.bin_count - header.shard_bin_count)
+            throw std::runtime_error{"The Interleaved Bloom Filter is corrupted."};
+
+        size_t const words = (header.shard_bin_count >> 6) + (header.shard_bin_count % 64u != 0u);
+        size_t const row_bytes = words * sizeof(uint64_t);
+        if ((file.size() - sizeof(header)) % row_bytes != 0u
+            || (file.size() - sizeof(header)) / row_bytes != header.bin_size)
+            throw std::runtime_error{"The Interleaved Bloom Filter is truncated or corrupted."};
+
+        // The mapping is page aligned and the rows begin at a multiple of 8.
+        rows = reinterpret_cast<uint64_t const *>(file.data() + sizeof(header));
+        total_bins = header.bin_count;
+        first_bin_ = header.first_bin;
+        bins = header.shard_bin_count;
+        bin_size_ = header.bin_size;
+        hash_shift = std::countl_zero(bin_size_);
+        row_words = words;
+        hash_funs = header.hash_function_count;
+    }
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    /*!\brief Returns a seqan3::mapped_interleaved_bloom_filter::counting_agent_type to be used for counting.
+     * \tparam value_t The type of the counts; must model std::unsigned_integral. Defaults to `uint16_t`.
+     */
+    template <std::unsigned_integral value_t = uint16_t>
+    counting_agent_type<value_t> counting_agent() const
+    {
+        return counting_agent_type<value_t>{*this};
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Returns the number of hash functions.
+    size_t hash_function_count() const noexcept
+    {
+        return hash_funs;
+    }
+
+    //!\brief Returns the number of bins of this shard.
+    size_t bin_count() const noexcept
+    {
+        return bins;
+    }
+
+    //!\brief Returns the first bin of this shard, i.e. the offset of its bins in the Interleaved Bloom Filter.
+    size_t first_bin() const noexcept
+    {
+        return first_bin_;
+    }
+
+    //!\brief Returns the number of bins of the whole Interleaved Bloom Filter.
+    size_t total_bin_count() const noexcept
+    {
+        return total_bins;
+    }
+
+    //!\brief Returns the size of a single bin in bits.
+    size_t bin_size() const noexcept
+    {
+        return bin_size_;
+    }
+    //!\}
+
+    //!\brief Swaps the contents with `other`.
+    void swap(mapped_interleaved_bloom_filter & other) noexcept
+    {
+        file.swap(other.file);
+        std::swap(rows, other.rows);
+        std::swap(total_bins, other.total_bins);
+        std::swap(first_bin_, other.first_bin_);
+        std::swap(bins, other.bins);
+        std::swap(bin_size_, other.bin_size_);
+        std::swap(hash_shift, other.hash_shift);
+        std::swap(row_words, other.row_words);
+        std::swap(hash_funs, other.hash_funs);
+    }
+};
+
+/*!\brief Manages counting ranges of values for the seqan3::mapped_interleaved_bloom_filter.
+ * \tparam value_t The type of the counts; must model std::unsigned_integral.
+ *
+ * \details
+ *
+ * The `value_t` template parameter should be chosen in a way that no overflow occurs if all values of a call to
+ * `bulk_count` are contained in a bin.
+ */
+template <std::unsigned_integral value_t>
+class mapped_interleaved_bloom_filter::counting_agent_type
+{
+private:
+    //!\brief A pointer to the augmented seqan3::mapped_interleaved_bloom_filter.
+    mapped_interleaved_bloom_filter const * ibf_ptr{nullptr};
+
+    //!\brief The number of values whose rows are computed before the first of them is looked up.
+    static constexpr size_t batch_size = 64u;
+
+    //!\brief The number of values between prefetching the rows of a value and looking it up.
+    static constexpr size_t prefetch_distance = 8u;
+
+    //!\brief Prefetches the rows starting at `row_indices`.
+    void prefetch(size_t const * row_indices) const noexcept
+    {
+        // Eight words make up a cache line.
+        for (size_t i = 0; i < ibf_ptr->hash_funs; ++i)
+            for (size_t word = 0; word < ibf_ptr->row_words; word += 8u)
+                __builtin_prefetch(ibf_ptr->rows + row_indices[i] + word);
+    }
+
+    //!\brief The bits of the last word of a row that belong to bins.
+    uint64_t last_word_mask{};
+
+    //!\brief Increments the count of each bin whose bits are set in all rows starting at `row_indices`.
+    void add(size_t const * row_indices) noexcept
+    {
+        std::array<uint64_t const *, 5> row;
+        for (size_t i = 0; i < ibf_ptr->hash_funs; ++i)
+            row[i] = ibf_ptr->rows + row_indices[i];
+
+        for (size_t word = 0; word < ibf_ptr->row_words; ++word)
+        {
+            uint64_t bits{-1ULL};
+            for (size_t i = 0; i < ibf_ptr->hash_funs; ++i)
+                bits &= row[i][word];
+
+            // The unused bits are 0 in a valid file; masking them guards against writing past the counts.
+            if (word + 1u == ibf_ptr->row_words)
+                bits &= last_word_mask;
+
+            for (value_t * const counts = result_buffer.data() + (word << 6); bits != 0u; bits &= bits - 1u)
+                ++counts[std::countr_zero(bits)];
+        }
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    counting_agent_type() = default;                                        //!< Defaulted.
+    counting_agent_type(counting_agent_type const &) = default;             //!< Defaulted.
+    counting_agent_type & operator=(counting_agent_type const &) = default; //!< Defaulted.
+    counting_agent_type(counting_agent_type &&) = default;                  //!< Defaulted.
+    counting_agent_type & operator=(counting_agent_type &&) = default;      //!< Defaulted.
+    ~counting_agent_type() = default;                                       //!< Defaulted.
+
+    /*!\brief Construct a counting_agent_type for an existing seqan3::mapped_interleaved_bloom_filter.
+     * \private
+     * \param ibf The seqan3::mapped_interleaved_bloom_filter.
+     */
+    explicit counting_agent_type(mapped_interleaved_bloom_filter const & ibf) :
+        ibf_ptr(std::addressof(ibf)),
+        last_word_mask{ibf.bins % 64u == 0u ? -1ULL : (1ULL << (ibf.bins % 64u)) - 1u},
+        result_buffer(ibf.bin_count())
+    {}
+    //!\}
+
+    //!\brief Stores the result of bulk_count().
+    std::vector<value_t> result_buffer;
+
+    /*!\name Counting
+     * \{
+     */
+    /*!\brief Counts the occurrences in each bin of the shard for all values in a range.
+     * \tparam value_range_t The type of the range of values. Must model std::ranges::input_range. The reference type
+     *                       must model std::unsigned_integral.
+     * \param[in] values The range of values to process.
+     * \returns The counts of the bins of the shard; `result[i]` is the count of bin `first_bin() + i`.
+     *
+     * \attention The result of this function must always be bound via reference, e.g. `auto &`, to prevent copying.
+     * \attention Sequential calls to this function invalidate the previously returned reference.
+     *
+     * \details
+     *
+     * The values are processed in batches of 64. The rows of a value are prefetched while previous values are looked
+     * up, such that the memory accesses of different values overlap.
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are not thread safe, please create a
+     * seqan3::mapped_interleaved_bloom_filter::counting_agent_type for each thread.
+     */
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] std::vector<value_t> const & bulk_count(value_range_t && values) & noexcept
+    {
+        assert(ibf_ptr != nullptr);
+        assert(result_buffer.size() == ibf_ptr->bin_count());
+
+        static_assert(std::ranges::input_range<value_range_t>, "The values must model input_range.");
+        static_assert(std::unsigned_integral<std::ranges::range_value_t<value_range_t>>,
+                      "An individual value must be an unsigned integral.");
+
+        std::ranges::fill(result_buffer, 0);
+
+        std::array<size_t, batch_size * 5> row_indices;
+        size_t const stride = ibf_ptr->hash_funs;
+        size_t count{};
+
+        auto flush = [&]()
+        {
+            for (size_t i = 0; i < std::min(prefetch_distance, count); ++i)
+                prefetch(row_indices.data() + i * stride);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (i + prefetch_distance < count)
+                    prefetch(row_indices.data() + (i + prefetch_distance) * stride);
+
+                add(row_indices.data() + i * stride);
+            }
+            count = 0;
+        };
+
+        for (auto && value : values)
+        {
+            size_t * const indices = row_indices.data() + count * stride;
+            for (size_t i = 0; i < stride; ++i)
+                indices[i] = ibf_ptr->hash_and_fit(value, hash_seeds[i]);
+
+            if (++count == batch_size)
+                flush();
+        }
+        flush();
+
+        return result_buffer;
+    }
+
+    // `bulk_count` cannot be called on a temporary, since the object the returned reference points to
+    // is immediately destroyed.
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] std::vector<value_t> const & bulk_count(value_range_t && values) && noexcept = delete;
+    //!\}
+};
+
+/*!\brief An Interleaved Bloom Filter that consists of several seqan3::mapped_interleaved_bloom_filter shards.
+ * \ingroup search_dream_index
+ *
+ * \details
+ *
+ * The shards must be written from the same seqan3::interleaved_bloom_filter and must not overlap. They do not need to
+ * cover all bins: bins that are not part of any shard are never counted. Hence, a query node can map only the shards
+ * of the bins it serves. Each shard is mapped with seqan3::mapped_interleaved_bloom_filter, and the counts of all
+ * shards are merged into one vector over all bins of the Interleaved Bloom Filter.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/dream_index/mapped_interleaved_bloom_filter.cpp
+ *
+ * ### Thread safety
+ *
+ * The filter is never modified, so all member functions can be called concurrently. Create a
+ * seqan3::sharded_interleaved_bloom_filter::counting_agent_type for each thread.
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+class sharded_interleaved_bloom_filter
+{
+private:
+    //!\brief The shards, ordered by their first bin.
+    std::vector<mapped_interleaved_bloom_filter> shards{};
+
+public:
+    template <std::unsigned_integral value_t>
+    class counting_agent_type; // documented upon definition below
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sharded_interleaved_bloom_filter() = default;                                                     //!< Defaulted.
+    sharded_interleaved_bloom_filter(sharded_interleaved_bloom_filter const &) = delete;             //!< Deleted.
+    sharded_interleaved_bloom_filter & operator=(sharded_interleaved_bloom_filter const &) = delete; //!< Deleted.
+    sharded_interleaved_bloom_filter(sharded_interleaved_bloom_filter &&) = default;                  //!< Defaulted.
+    sharded_interleaved_bloom_filter & operator=(sharded_interleaved_bloom_filter &&) = default;      //!< Defaulted.
+    ~sharded_interleaved_bloom_filter() = default;                                                    //!< Defaulted.
+
+    /*!\brief Maps the shards stored in the files at `paths`.
+     * \param[in] paths The paths to files written by seqan3::interleaved_bloom_filter::write, in any order.
+     * \throws std::filesystem::filesystem_error if a file cannot be opened or mapped.
+     * \throws std::runtime_error if a file is not a valid Interleaved Bloom Filter.
+     * \throws std::invalid_argument if `paths` is empty, or if the shards overlap or do not belong to the same
+     *         Interleaved Bloom Filter.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    explicit sharded_interleaved_bloom_filter(std::vector<std::filesystem::path> const & paths)
+    {
+        if (paths.empty())
+            throw std::invalid_argument{"At least one shard is required."};
+
+        shards.reserve(paths.size());
+        for (std::filesystem::path const & path : paths)
+            shards.emplace_back(path);
+
+        std::ranges::sort(shards, std::ranges::less{}, &mapped_interleaved_bloom_filter::first_bin);
+
+        for (size_t i = 1; i < shards.size(); ++i)
+        {
+            mapped_interleaved_bloom_filter const & previous = shards[i - 1];
+            mapped_interleaved_bloom_filter const & current = shards[i];
+
+            if (current.total_bin_count() != previous.total_bin_count() || current.bin_size() != previous.bin_size()
+                || current.hash_function_count() != previous.hash_function_count())
+                throw std::invalid_argument{"The shards belong to different Interleaved Bloom Filters."};
+            if (previous.first_bin() + previous.bin_count() > current.first_bin())
+                throw std::invalid_argument{"The shards overlap."};
+        }
+    }
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    /*!\brief Returns a seqan3::sharded_interleaved_bloom_filter::counting_agent_type to be used for counting.
+     * \tparam value_t The type of the counts; must model std::unsigned_integral. Defaults to `uint16_t`.
+     */
+    template <std::unsigned_integral value_t = uint16_t>
+    counting_agent_type<value_t> counting_agent() const
+    {
+        return counting_agent_type<value_t>{*this};
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Returns the number of bins of the whole Interleaved Bloom Filter.
+    size_t bin_count() const noexcept
+    {
+        return shards.empty() ? 0u : shards.front().total_bin_count();
+    }
+
+    //!\brief Returns the shards, ordered by their first bin.
+    std::vector<mapped_interleaved_bloom_filter> const & shard_list() const noexcept
+    {
+        return shards;
+    }
+    //!\}
+};
+
+/*!\brief Manages counting ranges of values for the seqan3::sharded_interleaved_bloom_filter.
+ * \tparam value_t The type of the counts; must model std::unsigned_integral.
+ */
+template <std::unsigned_integral value_t>
+class sharded_interleaved_bloom_filter::counting_agent_type
+{
+private:
+    //!\brief The agents of the shards.
+    std::vector<mapped_interleaved_bloom_filter::counting_agent_type<value_t>> agents{};
+    //!\brief The first bin of each shard.
+    std::vector<size_t> first_bins{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    counting_agent_type() = default;                                        //!< Defaulted.
+    counting_agent_type(counting_agent_type const &) = default;             //!< Defaulted.
+    counting_agent_type & operator=(counting_agent_type const &) = default; //!< Defaulted.
+    counting_agent_type(counting_agent_type &&) = default;                  //!< Defaulted.
+    counting_agent_type & operator=(counting_agent_type &&) = default;      //!< Defaulted.
+    ~counting_agent_type() = default;                                       //!< Defaulted.
+
+    /*!\brief Construct a counting_agent_type for an existing seqan3::sharded_interleaved_bloom_filter.
+     * \private
+     * \param ibf The seqan3::sharded_interleaved_bloom_filter.
+     */
+    explicit counting_agent_type(sharded_interleaved_bloom_filter const & ibf) : result_buffer(ibf.bin_count())
+    {
+        for (mapped_interleaved_bloom_filter const & shard : ibf.shard_list())
+        {
+            agents.push_back(shard.counting_agent<value_t>());
+            first_bins.push_back(shard.first_bin());
+        }
+    }
+    //!\}
+
+    //!\brief Stores the result of bulk_count().
+    std::vector<value_t> result_buffer;
+
+    /*!\name Counting
+     * \{
+     */
+    /*!\brief Counts the occurrences in each bin for all values in a range.
+     * \tparam value_range_t The type of the range of values. Must model std::ranges::forward_range. The reference
+     *                       type must model std::unsigned_integral.
+     * \param[in] values The range of values to process.
+     * \returns The counts of all bins of the Interleaved Bloom Filter; bins of no shard have count 0.
+     *
+     * \attention The result of this function must always be bound via reference, e.g. `auto &`, to prevent copying.
+     * \attention Sequential calls to this function invalidate the previously returned reference.
+     *
+     * \details
+     *
+     * The values are counted in each shard and the counts are copied to the bins of the shard.
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are not thread safe, please create a
+     * seqan3::sharded_interleaved_bloom_filter::counting_agent_type for each thread.
+     */
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] std::vector<value_t> const & bulk_count(value_range_t && values) & noexcept
+    {
+        static_assert(std::ranges::forward_range<value_range_t>, "The values must model forward_range.");
+        static_assert(std::unsigned_integral<std::ranges::range_value_t<value_range_t>>,
+                      "An individual value must be an unsigned integral.");
+
+        std::ranges::fill(result_buffer, 0);
+
+        for (size_t i = 0; i < agents.size(); ++i)
+            std::ranges::copy(agents[i].bulk_count(values), result_buffer.begin() + first_bins[i]);
+
+        return result_buffer;
+    }
+
+    // `bulk_count` cannot be called on a temporary, since the object the returned reference points to
+    // is immediately destroyed.
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] std::vector<value_t> const & bulk_count(value_range_t && values) && noexcept = delete;
+    //!\}
+};
+
+} // namespace seqan3
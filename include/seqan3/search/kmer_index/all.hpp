@@ -9,9 +9,7 @@
 
 /*!\defgroup search_kmer_index k-mer Index
  * \ingroup search
- * \brief Implementation of shapes for a k-mer Index.
- *
- * \note The k-mer index is not yet implemented.
+ * \brief Implementation of a k-mer Index with shapes and seed extraction.
  *
  * \details
  *
@@ -23,8 +21,19 @@
  * Usually the query length (k) is small and the underlying text is very large.
  * The parameter k and the position(s) of wildcards must be fixed at index creation with
  * seqan3::ungapped or seqan3::shape.
+ *
+ * Instead of all k-mers, often only a subset of seeds is indexed. seqan3::minimiser_extractor,
+ * seqan3::syncmer_extractor and seqan3::strobemer_extractor write minimisers, syncmers and randstrobes together with
+ * their positions and strands into flat arrays.
+ *
+ * seqan3::kmer_index maps the hash values of all k-mers or of the extracted seeds to their occurrences. It can be
+ * written to a file and mapped into memory with seqan3::mapped_kmer_index. seqan3::kmer_counter counts the k-mers of
+ * large sequence files with multiple threads and bounded memory.
  */
 
 #pragma once
 
+#include <seqan3/search/kmer_index/kmer_counter.hpp>
+#include <seqan3/search/kmer_index/kmer_index.hpp>
+#include <seqan3/search/kmer_index/seed_extraction.hpp>
 #include <seqan3/search/kmer_index/shape.hpp>
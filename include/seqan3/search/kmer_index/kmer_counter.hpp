@@ -0,0 +1,627 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::kmer_counter.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alphabet/container/concatenated_sequences.hpp>
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/core/algorithm/detail/parallel_for.hpp>
+#include <seqan3/search/kmer_index/shape.hpp>
+#include <seqan3/search/views/canonical_kmer_hash.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A k-mer and the number of its occurrences, as reported by seqan3::kmer_counter.
+ * \ingroup search_kmer_index
+ *
+ * \details
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+struct kmer_count
+{
+    //!\brief The hash value of the k-mer, see seqan3::views::kmer_hash and seqan3::views::canonical_kmer_hash.
+    uint64_t hash{};
+    //!\brief The number of occurrences.
+    uint64_t count{};
+
+    //!\brief Two counts are equal if all members are equal.
+    friend bool operator==(kmer_count const &, kmer_count const &) = default;
+};
+
+/*!\brief The parameters of seqan3::kmer_counter.
+ * \ingroup search_kmer_index
+ *
+ * \details
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+struct kmer_counter_parameters
+{
+    //!\brief The maximal number of threads.
+    size_t thread_count{1u};
+    /*!\brief The number of bytes that the counter may occupy in memory before the counts are written to disk.
+     *
+     * \details
+     *
+     * This covers the counts, the hash values that are not counted yet, the hash values of the threads, the current
+     * batch of sequences and the buffers that are used to merge the counts. It is checked after every batch.
+     */
+    size_t memory_limit{size_t{1} << 30};
+    //!\brief The directory that the counts are written to if they exceed the memory limit.
+    std::filesystem::path spill_directory{std::filesystem::temp_directory_path()};
+    //!\brief Whether a k-mer and its reverse complement are counted as the same k-mer; only for nucleotides.
+    bool canonical{true};
+    //!\brief The number of letters that are read and hashed at once.
+    size_t batch_size{size_t{1} << 22};
+};
+
+/*!\brief Counts the k-mers of sequences with multiple threads and bounded memory.
+ * \ingroup search_kmer_index
+ *
+ * \details
+ *
+ * The k-mers are identified by their hash values, which are unique for the k-mers of a shape whose hash values fit
+ * into 64 bits. If seqan3::kmer_counter_parameters::canonical is set, the hash values of
+ * seqan3::views::canonical_kmer_hash are counted, otherwise the ones of seqan3::views::kmer_hash.
+ *
+ * ### Algorithm
+ *
+ * The sequences are read in batches of about seqan3::kmer_counter_parameters::batch_size letters. Long sequences are
+ * cut into overlapping pieces, such that the threads hash pieces of the same size. Every thread distributes its hash
+ * values over 256 partitions by the upper bits of the hash value multiplied by an odd constant. Then every partition
+ * is processed by one task: its hash values are collected, and once there are at least as many as the partition has
+ * distinct k-mers, they are sorted, counted and merged into the sorted counts of the partition. No locks are needed
+ * and every hash value is sorted once in expectation.
+ *
+ * If the counter occupies more than seqan3::kmer_counter_parameters::memory_limit bytes after a batch, every
+ * partition writes its counts as a sorted run to a file in seqan3::kmer_counter_parameters::spill_directory and
+ * starts anew.
+ * The runs are merged partition by partition when the counts are read, so at most one partition of the runs is held
+ * in memory. The files are removed when the counter is destroyed.
+ *
+ * ### Results
+ *
+ * The counts are reported by for_each(), counts() and histogram(). They are ordered by partition and by hash value
+ * within a partition; the order does not depend on the number of threads or on the memory limit. More sequences can
+ * be counted after the counts were read.
+ *
+ * \include test/snippet/search/kmer_index/kmer_counter.cpp
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+class kmer_counter
+{
+private:
+    //!\brief The logarithm of the number of partitions.
+    static constexpr uint32_t partition_bits{8u};
+    //!\brief The number of partitions.
+    static constexpr size_t partition_count{size_t{1} << partition_bits};
+    //!\brief The number of k-mers in one piece of a long sequence.
+    static constexpr size_t piece_size{size_t{1} << 16};
+    //!\brief The number of hash values of a partition that are collected at least before they are counted.
+    static constexpr size_t min_pending_count{size_t{1} << 12};
+    //!\brief The number of counts that are read from a run at once.
+    static constexpr size_t run_buffer_size{size_t{1} << 12};
+
+    //!\brief The counts of the k-mers whose hash values fall into one partition.
+    struct partition
+    {
+        //!\brief Hash values that are not yet counted.
+        std::vector<uint64_t> pending{};
+        //!\brief The counts, ordered by hash value.
+        std::vector<kmer_count> counts{};
+        //!\brief The files with the counts that were written to disk, ordered by hash value.
+        std::vector<std::filesystem::path> runs{};
+    };
+
+    //!\brief A part of a sequence of the current batch; a piece of a long sequence overlaps with the next one.
+    struct piece
+    {
+        //!\brief The index of the sequence.
+        size_t sequence;
+        //!\brief The begin of the piece.
+        size_t begin;
+        //!\brief The end of the piece.
+        size_t end;
+    };
+
+    //!\brief Reads the counts of one run, or of the counts in memory, in blocks.
+    struct run_reader
+    {
+        //!\brief The file of the run; not open for the counts in memory.
+        std::ifstream stream{};
+        //!\brief The block that was read last.
+        std::vector<kmer_count> buffer{};
+        //!\brief The counts that are not consumed yet.
+        std::span<kmer_count const> current{};
+
+        //!\brief Reads the next block if the current one is consumed; returns false if there are no more counts.
+        bool refill()
+        {
+            if (!current.empty())
+                return true;
+            if (!stream.is_open())
+                return false;
+
+            buffer.resize(run_buffer_size);
+            stream.read(reinterpret_cast<char *>(buffer.data()), buffer.size() * sizeof(kmer_count));
+            current = std::span{buffer}.first(stream.gcount() / sizeof(kmer_count));
+            return !current.empty();
+        }
+    };
+
+    //!\brief The shape of the k-mers.
+    shape kmer_shape{};
+    //!\brief The parameters.
+    kmer_counter_parameters parameters{};
+    //!\brief The partitions; created when the first batch is counted.
+    std::vector<partition> partitions{};
+    //!\brief The hash values of every slice of the batch by partition; kept to avoid allocations.
+    std::vector<std::vector<std::vector<uint64_t>>> slice_hashes{};
+    //!\brief The directory that holds the runs; empty until the first run is written.
+    std::filesystem::path run_directory{};
+    //!\brief The number of times that the counts were written to disk.
+    size_t spill_count{};
+    //!\brief The number of counted k-mers.
+    uint64_t total_count_{};
+
+    //!\brief Returns the partition of a hash value.
+    static constexpr size_t partition_of(uint64_t const hash) noexcept
+    {
+        return (hash * 0x9E37'79B9'7F4A'7C15ULL) >> (64u - partition_bits);
+    }
+
+    //!\brief Returns the sequence of a range element, which is either a sequence or a record with a sequence.
+    template <typename element_t>
+    static decltype(auto) sequence_of(element_t && element)
+    {
+        if constexpr (requires { element.sequence(); })
+            return std::forward<element_t>(element).sequence();
+        else
+            return std::forward<element_t>(element);
+    }
+
+    //!\brief Sorts and counts the pending hash values of a partition and merges them into its counts.
+    static void count_pending(partition & part)
+    {
+        if (part.pending.empty())
+            return;
+
+        std::ranges::sort(part.pending);
+
+        std::vector<kmer_count> merged{};
+        merged.reserve(part.counts.size() + part.pending.size());
+
+        auto counted = part.counts.begin();
+        for (auto it = part.pending.begin(); it != part.pending.end();)
+        {
+            uint64_t const hash = *it;
+            auto next = std::next(it);
+            while (next != part.pending.end() && *next == hash)
+                ++next;
+
+            for (; counted != part.counts.end() && counted->hash < hash; ++counted)
+                merged.push_back(*counted);
+
+            uint64_t const previous = (counted != part.counts.end() && counted->hash == hash) ? (counted++)->count : 0u;
+            merged.push_back({hash, previous + static_cast<uint64_t>(next - it)});
+            it = next;
+        }
+        merged.insert(merged.end(), counted, part.counts.end());
+
+        part.counts = std::move(merged);
+        part.pending.clear();
+    }
+
+    /*!\brief Returns the number of bytes that the counter occupies.
+     * \param[in] batch_bytes The number of bytes of the current batch.
+     *
+     * \details
+     *
+     * Besides the partitions and the hash values of the threads, every thread may merge the counts of a partition,
+     * which needs a buffer of up to the size of the largest partition.
+     */
+    size_t memory_usage(size_t const batch_bytes) const noexcept
+    {
+        size_t bytes{batch_bytes};
+        size_t max_partition_size{};
+        for (partition const & part : partitions)
+        {
+            bytes += part.pending.capacity() * sizeof(uint64_t) + part.counts.capacity() * sizeof(kmer_count);
+            max_partition_size = std::max(max_partition_size, part.pending.size() + part.counts.size());
+        }
+
+        for (auto const & hashes_by_partition : slice_hashes)
+            for (std::vector<uint64_t> const & hashes : hashes_by_partition)
+                bytes += hashes.capacity() * sizeof(uint64_t);
+
+        size_t const merge_count = std::min(std::max<size_t>(parameters.thread_count, 1u), partition_count);
+        return bytes + merge_count * max_partition_size * sizeof(kmer_count);
+    }
+
+    //!\brief Creates a new directory for the runs in the spill directory.
+    void create_run_directory()
+    {
+        static std::atomic<uint64_t> counter{};
+        uint64_t const time = std::chrono::steady_clock::now().time_since_epoch().count();
+
+        for (size_t attempt = 0u; attempt < 100u; ++attempt)
+        {
+            std::filesystem::path const directory =
+                parameters.spill_directory
+                / ("seqan3_kmer_counter_" + std::to_string(time) + "_" + std::to_string(counter++));
+
+            if (std::filesystem::create_directory(directory))
+            {
+                run_directory = directory;
+                return;
+            }
+        }
+
+        throw std::filesystem::filesystem_error{"Cannot create a directory for the k-mer counts.",
+                                                parameters.spill_directory,
+                                                std::make_error_code(std::errc::file_exists)};
+    }
+
+    /*!\brief Writes the counts of every partition to a run file and frees the memory.
+     *
+     * \details
+     *
+     * The number of the run is taken before any file is written. If writing fails, the partitions that were written
+     * keep their run and the others keep their counts in memory, which are written to a new run next time.
+     */
+    void spill()
+    {
+        if (run_directory.empty())
+            create_run_directory();
+
+        size_t const run = spill_count++;
+        std::vector<std::vector<std::vector<uint64_t>>>{}.swap(slice_hashes);
+
+        auto spill_partition = [&](size_t const index)
+        {
+            partition & part = partitions[index];
+            count_pending(part);
+            std::vector<uint64_t>{}.swap(part.pending);
+
+            if (part.counts.empty())
+                return;
+
+            std::filesystem::path const path =
+                run_directory / ("partition_" + std::to_string(index) + "_run_" + std::to_string(run));
+            std::ofstream stream{path, std::ios::binary | std::ios::trunc};
+            stream.write(reinterpret_cast<char const *>(part.counts.data()), part.counts.size() * sizeof(kmer_count));
+            stream.flush();
+
+            if (!stream)
+                throw std::filesystem::filesystem_error{"Cannot write the k-mer counts.",
+                                                        path,
+                                                        std::make_error_code(std::errc::io_error)};
+
+            part.runs.push_back(path);
+            std::vector<kmer_count>{}.swap(part.counts);
+        };
+        detail::parallel_for(partition_count, parameters.thread_count, spill_partition);
+    }
+
+    //!\brief Counts the k-mers of one batch of sequences.
+    template <typename batch_t>
+    void count_batch(batch_t const & batch)
+    {
+        using alphabet_t = std::ranges::range_value_t<std::ranges::range_reference_t<batch_t>>;
+
+        if (partitions.empty())
+            partitions.resize(partition_count);
+
+        size_t const kmer_span = kmer_shape.size();
+        std::vector<piece> pieces{};
+        for (size_t sequence = 0u; sequence < batch.size(); ++sequence)
+        {
+            size_t const size = batch[sequence].size();
+            if (size < kmer_span)
+                continue;
+
+            size_t const kmer_count = size - kmer_span + 1u;
+            for (size_t begin = 0u; begin < kmer_count; begin += piece_size)
+                pieces.push_back({sequence, begin, std::min(begin + piece_size, kmer_count) + kmer_span - 1u});
+
+            total_count_ += kmer_count;
+        }
+
+        size_t const slice_count = std::min(std::max<size_t>(parameters.thread_count, 1u), pieces.size());
+        if (slice_hashes.size() < slice_count)
+            slice_hashes.resize(slice_count, std::vector<std::vector<uint64_t>>(partition_count));
+
+        auto hash_slice = [&](size_t const slice)
+        {
+            std::vector<std::vector<uint64_t>> & hashes = slice_hashes[slice];
+            size_t const first = slice * pieces.size() / slice_count;
+            size_t const last = (slice + 1u) * pieces.size() / slice_count;
+
+            for (piece const & current : std::span{pieces}.subspan(first, last - first))
+            {
+                auto const & sequence = batch[current.sequence];
+                std::ranges::subrange const letters{sequence.begin() + current.begin, sequence.begin() + current.end};
+
+                auto distribute = [&](auto && hash_view)
+                {
+                    for (uint64_t const hash : hash_view)
+                        hashes[partition_of(hash)].push_back(hash);
+                };
+
+                if constexpr (nucleotide_alphabet<alphabet_t>)
+                {
+                    if (parameters.canonical)
+                    {
+                        distribute(letters | views::canonical_kmer_hash(kmer_shape));
+                        continue;
+                    }
+                }
+
+                distribute(letters | views::kmer_hash(kmer_shape));
+            }
+        };
+        detail::parallel_for(slice_count, parameters.thread_count, hash_slice);
+
+        auto collect_partition = [&](size_t const index)
+        {
+            partition & part = partitions[index];
+            for (size_t slice = 0u; slice < slice_count; ++slice)
+            {
+                std::vector<uint64_t> & hashes = slice_hashes[slice][index];
+                part.pending.insert(part.pending.end(), hashes.begin(), hashes.end());
+                hashes.clear();
+            }
+
+            // Every hash value is counted once in expectation if the pending values outnumber the counts.
+            if (part.pending.size() >= std::max(part.counts.size(), min_pending_count))
+                count_pending(part);
+        };
+        detail::parallel_for(partition_count, parameters.thread_count, collect_partition);
+
+        auto const & [batch_letters, batch_delimiters] = batch.raw_data();
+        using delimiter_t = std::ranges::range_value_t<decltype(batch_delimiters)>;
+        size_t const batch_bytes =
+            batch_letters.capacity() * sizeof(alphabet_t) + batch_delimiters.capacity() * sizeof(delimiter_t);
+        if (memory_usage(batch_bytes) > parameters.memory_limit)
+            spill();
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    kmer_counter() = default;                                 //!< Defaulted.
+    kmer_counter(kmer_counter const &) = delete;             //!< Deleted, the counter owns the files of its runs.
+    kmer_counter & operator=(kmer_counter const &) = delete; //!< Deleted, the counter owns the files of its runs.
+
+    //!\brief Move constructor; `other` is empty afterwards.
+    kmer_counter(kmer_counter && other) noexcept :
+        kmer_shape{std::move(other.kmer_shape)},
+        parameters{std::move(other.parameters)},
+        partitions{std::exchange(other.partitions, std::vector<partition>{})},
+        slice_hashes{std::move(other.slice_hashes)},
+        run_directory{std::exchange(other.run_directory, std::filesystem::path{})},
+        spill_count{std::exchange(other.spill_count, 0u)},
+        total_count_{std::exchange(other.total_count_, 0u)}
+    {}
+
+    //!\brief Move assignment; `other` is empty afterwards.
+    kmer_counter & operator=(kmer_counter && other) noexcept
+    {
+        kmer_counter tmp{std::move(other)};
+        std::swap(kmer_shape, tmp.kmer_shape);
+        std::swap(parameters, tmp.parameters);
+        std::swap(partitions, tmp.partitions);
+        std::swap(slice_hashes, tmp.slice_hashes);
+        std::swap(run_directory, tmp.run_directory);
+        std::swap(spill_count, tmp.spill_count);
+        std::swap(total_count_, tmp.total_count_);
+        return *this;
+    }
+
+    //!\brief Removes the files of the runs.
+    ~kmer_counter()
+    {
+        if (!run_directory.empty())
+        {
+            std::error_code error{};
+            std::filesystem::remove_all(run_directory, error);
+        }
+    }
+
+    /*!\brief Constructs a counter for the k-mers of a shape.
+     * \param[in] kmer_shape The seqan3::shape of the k-mers.
+     * \param[in] parameters The seqan3::kmer_counter_parameters.
+     * \throws std::invalid_argument if the shape is empty or the batch size is 0.
+     */
+    explicit kmer_counter(shape const & kmer_shape, kmer_counter_parameters parameters = {}) :
+        kmer_shape{kmer_shape},
+        parameters{std::move(parameters)}
+    {
+        if (kmer_shape.count() == 0u)
+            throw std::invalid_argument{"The shape must contain at least one position."};
+        if (this->parameters.batch_size == 0u)
+            throw std::invalid_argument{"The batch size must be positive."};
+    }
+    //!\}
+
+    /*!\brief Counts the k-mers of sequences.
+     * \tparam sequences_t The type of the sequences; must model std::ranges::input_range. The elements must either
+     *                     model std::ranges::forward_range over a seqan3::semialphabet, or have a member function
+     *                     `sequence()` that returns such a range, e.g. the records of a seqan3::sequence_file_input.
+     * \param[in] sequences The sequences, e.g. a seqan3::sequence_file_input.
+     * \throws std::invalid_argument if canonical k-mers are counted over an alphabet that is not a
+     *         seqan3::nucleotide_alphabet, or if a hash value does not fit into 64 bits.
+     * \throws std::filesystem::filesystem_error if the counts cannot be written to disk.
+     *
+     * \details
+     *
+     * The sequences are read once and may be a single pass range. This function can be called repeatedly, e.g. once
+     * per file; the counts are accumulated.
+     *
+     * ### Complexity
+     *
+     * Linear in the number of k-mers in expectation, divided by the number of threads.
+     */
+    template <std::ranges::input_range sequences_t>
+    void count(sequences_t && sequences)
+    {
+        using sequence_t = std::remove_cvref_t<decltype(sequence_of(*std::ranges::begin(sequences)))>;
+        using alphabet_t = std::remove_cvref_t<std::ranges::range_reference_t<sequence_t>>;
+
+        if (parameters.canonical && !nucleotide_alphabet<alphabet_t>)
+            throw std::invalid_argument{"Canonical k-mers can only be counted for nucleotides."};
+
+        concatenated_sequences<std::vector<alphabet_t>> batch{};
+        size_t letter_count{};
+
+        for (auto && element : sequences)
+        {
+            batch.push_back(sequence_of(element));
+            letter_count += batch.back().size();
+
+            if (letter_count >= parameters.batch_size)
+            {
+                count_batch(batch);
+                batch.clear();
+                letter_count = 0u;
+            }
+        }
+
+        if (!batch.empty())
+            count_batch(batch);
+    }
+
+    /*!\brief Calls a function with every k-mer and its count.
+     * \param[in] function The function; invoked with a seqan3::kmer_count for every distinct k-mer.
+     * \throws std::filesystem::filesystem_error if the counts that were written to disk cannot be read.
+     *
+     * \details
+     *
+     * The k-mers are reported by partition and by hash value within a partition. The runs that were written to disk
+     * are merged one partition at a time.
+     */
+    template <typename function_t>
+        requires std::invocable<function_t &, kmer_count const &>
+    void for_each(function_t && function)
+    {
+        for (partition & part : partitions)
+        {
+            count_pending(part);
+
+            std::vector<run_reader> readers(part.runs.size() + 1u);
+            readers.back().current = part.counts;
+            for (size_t i = 0u; i < part.runs.size(); ++i)
+            {
+                readers[i].stream.open(part.runs[i], std::ios::binary);
+                if (!readers[i].stream)
+                    throw std::filesystem::filesystem_error{"Cannot read the k-mer counts.",
+                                                            part.runs[i],
+                                                            std::make_error_code(std::errc::io_error)};
+            }
+
+            std::erase_if(readers,
+                          [](run_reader & reader)
+                          {
+                              return !reader.refill();
+                          });
+
+            while (!readers.empty())
+            {
+                uint64_t hash = std::numeric_limits<uint64_t>::max();
+                for (run_reader const & reader : readers)
+                    hash = std::min(hash, reader.current.front().hash);
+
+                kmer_count merged{hash, 0u};
+                for (run_reader & reader : readers)
+                {
+                    if (reader.current.front().hash == hash)
+                    {
+                        merged.count += reader.current.front().count;
+                        reader.current = reader.current.subspan(1u);
+                    }
+                }
+
+                function(std::as_const(merged));
+
+                std::erase_if(readers,
+                              [](run_reader & reader)
+                              {
+                                  return !reader.refill();
+                              });
+            }
+        }
+    }
+
+    /*!\brief Returns all k-mers with their counts.
+     * \throws std::filesystem::filesystem_error if the counts that were written to disk cannot be read.
+     *
+     * \details
+     *
+     * The result holds every distinct k-mer; use for_each() or histogram() to keep the memory bounded.
+     */
+    std::vector<kmer_count> counts()
+    {
+        std::vector<kmer_count> result{};
+        for_each(
+            [&result](kmer_count const & count)
+            {
+                result.push_back(count);
+            });
+        return result;
+    }
+
+    /*!\brief Returns the abundance histogram.
+     * \param[in] max_count The largest count with its own entry.
+     * \returns A vector of size `max_count + 1`, where entry `i` is the number of distinct k-mers that occur `i`
+     *          times, and the last entry is the number of distinct k-mers that occur at least `max_count` times.
+     * \throws std::filesystem::filesystem_error if the counts that were written to disk cannot be read.
+     *
+     * \details
+     *
+     * The histogram is used, e.g., to choose a threshold that separates erroneous k-mers from genomic ones, or to
+     * estimate the genome size from the coverage.
+     */
+    std::vector<uint64_t> histogram(size_t const max_count = 255u)
+    {
+        std::vector<uint64_t> result(max_count + 1u);
+        for_each(
+            [&](kmer_count const & count)
+            {
+                ++result[std::min<uint64_t>(count.count, max_count)];
+            });
+        return result;
+    }
+
+    //!\brief Returns the number of counted k-mers, including repetitions.
+    uint64_t total_count() const noexcept
+    {
+        return total_count_;
+    }
+};
+
+} // namespace seqan3
@@ -0,0 +1,940 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::kmer_index, seqan3::mapped_kmer_index and seqan3::kmer_occurrence.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/core/algorithm/detail/parallel_for.hpp>
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/search/kmer_index/seed_extraction.hpp>
+#include <seqan3/search/kmer_index/shape.hpp>
+#include <seqan3/utility/detail/memory_mapped_file.hpp>
+
+namespace seqan3
+{
+
+/*!\brief An occurrence of a seed in the sequences of a seqan3::kmer_index.
+ * \ingroup search_kmer_index
+ *
+ * \details
+ *
+ * The sequence, the position and the strand are packed into one 64 bit integer, such that the occurrences can be
+ * stored in and mapped from a file without conversion. Occurrences are ordered by sequence, position and strand.
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+class kmer_occurrence
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr kmer_occurrence() = default;                                    //!< Defaulted.
+    constexpr kmer_occurrence(kmer_occurrence const &) = default;             //!< Defaulted.
+    constexpr kmer_occurrence(kmer_occurrence &&) = default;                  //!< Defaulted.
+    constexpr kmer_occurrence & operator=(kmer_occurrence const &) = default; //!< Defaulted.
+    constexpr kmer_occurrence & operator=(kmer_occurrence &&) = default;      //!< Defaulted.
+    ~kmer_occurrence() = default;                                             //!< Defaulted.
+
+    /*!\brief Constructs an occurrence.
+     * \param[in] sequence_id The index of the sequence.
+     * \param[in] position The begin position of the seed in the sequence; must be smaller than 2^31.
+     * \param[in] reverse_complement Whether the seed was hashed from the reverse complement.
+     */
+    constexpr kmer_occurrence(uint32_t const sequence_id,
+                              uint32_t const position,
+                              bool const reverse_complement) noexcept :
+        value{(static_cast<uint64_t>(sequence_id) << 32) | (static_cast<uint64_t>(position) << 1) | reverse_complement}
+    {}
+    //!\}
+
+    //!\brief The largest position that can be stored.
+    static constexpr uint32_t max_position = std::numeric_limits<uint32_t>::max() >> 1;
+
+    //!\brief The index of the sequence.
+    constexpr uint32_t sequence_id() const noexcept
+    {
+        return static_cast<uint32_t>(value >> 32);
+    }
+
+    //!\brief The begin position of the seed in the sequence.
+    constexpr uint32_t position() const noexcept
+    {
+        return static_cast<uint32_t>(value) >> 1;
+    }
+
+    //!\brief Whether the seed was hashed from the reverse complement of the sequence.
+    constexpr bool reverse_complement() const noexcept
+    {
+        return value & 1u;
+    }
+
+    //!\brief Compares the sequence, the position and the strand.
+    friend constexpr auto operator<=>(kmer_occurrence const &, kmer_occurrence const &) = default;
+
+    //!\cond DEV
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(value);
+    }
+    //!\endcond
+
+private:
+    //!\brief The sequence in the upper 32 bits, the position in bits [1, 32) and the strand in bit 0.
+    uint64_t value{};
+};
+
+static_assert(sizeof(kmer_occurrence) == 8u);
+static_assert(std::is_trivially_copyable_v<kmer_occurrence>);
+
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+/*!\brief The header of a file written by seqan3::kmer_index::write.
+ * \ingroup search_kmer_index
+ *
+ * \details
+ *
+ * All integers are stored in little endian byte order. The header is followed by the directory, the keys, the key
+ * offsets and the occurrences of the seqan3::detail::kmer_index_table.
+ */
+struct kmer_index_header
+{
+    //!\brief The magic string that identifies the file format.
+    static constexpr std::array<char, 8> expected_magic{'S', 'Q', '3', 'K', 'M', 'E', 'R', 'I'};
+    //!\brief The version of the file format.
+    static constexpr uint32_t current_version{1u};
+
+    //!\brief Identifies the file format.
+    std::array<char, 8> magic{expected_magic};
+    //!\brief The version of the file format.
+    uint32_t version{current_version};
+    //!\brief The logarithm of the number of buckets.
+    uint32_t bucket_bits{};
+    //!\brief The number of indexed sequences.
+    uint64_t sequence_count{};
+    //!\brief The number of distinct hash values.
+    uint64_t key_count{};
+    //!\brief The number of occurrences.
+    uint64_t occurrence_count{};
+    //!\brief Reserved for future use; always 0.
+    std::array<uint64_t, 3> reserved{};
+};
+
+static_assert(sizeof(kmer_index_header) == 64u);
+static_assert(std::is_trivially_copyable_v<kmer_index_header>);
+
+/*!\brief The lookup structure of seqan3::kmer_index and seqan3::mapped_kmer_index.
+ * \ingroup search_kmer_index
+ *
+ * \details
+ *
+ * The hash values are multiplied by an odd constant, which scrambles their bits and keeps them distinct. The upper
+ * `bucket_bits` bits of such a key select one of `2^bucket_bits` buckets. The distinct keys are stored sorted, such
+ * that the keys of bucket `b` are `keys[directory[b], directory[b + 1])`, and the occurrences of `keys[i]` are
+ * `occurrences[key_offsets[i], key_offsets[i + 1])`. There are about four occurrences per bucket, so a lookup reads
+ * one directory entry, scans a few keys and reads two offsets.
+ *
+ * The table does not own the memory; the arrays are either vectors or a memory mapped file.
+ */
+struct kmer_index_table
+{
+    //!\brief The odd constant that the hash values are multiplied by.
+    static constexpr uint64_t key_multiplier{0x9E37'79B9'7F4A'7C15ULL};
+    //!\brief The number of queries whose memory accesses are interleaved by the batched lookup.
+    static constexpr size_t batch_size{16u};
+
+    //!\brief The logarithm of the number of buckets; in [1, 63].
+    uint32_t bucket_bits{1u};
+    //!\brief Where the keys of each bucket begin; `2^bucket_bits + 1` entries.
+    std::span<uint64_t const> directory{};
+    //!\brief The distinct keys, ordered by key.
+    std::span<uint64_t const> keys{};
+    //!\brief Where the occurrences of each key begin; one more entry than there are keys.
+    std::span<uint64_t const> key_offsets{};
+    //!\brief The occurrences of all keys.
+    std::span<kmer_occurrence const> occurrences{};
+
+    //!\brief Returns the key of a hash value.
+    static constexpr uint64_t key_of(uint64_t const hash) noexcept
+    {
+        return hash * key_multiplier;
+    }
+
+    //!\brief Returns the bucket of a key.
+    constexpr size_t bucket_of(uint64_t const key) const noexcept
+    {
+        return key >> (64u - bucket_bits);
+    }
+
+    //!\brief Returns the occurrences of the key at `index`; empty if `index` is `keys.size()`.
+    std::span<kmer_occurrence const> occurrences_at(size_t const index) const noexcept
+    {
+        if (index == keys.size())
+            return {};
+
+        return occurrences.subspan(key_offsets[index], key_offsets[index + 1u] - key_offsets[index]);
+    }
+
+    //!\brief Returns the index of `key` in `keys[first, last)` or `keys.size()` if it is not contained.
+    size_t find_key(uint64_t const key, size_t first, size_t const last) const noexcept
+    {
+        for (; first < last; ++first)
+            if (keys[first] == key)
+                return first;
+
+        return keys.size();
+    }
+
+    //!\brief Returns the occurrences of a hash value.
+    std::span<kmer_occurrence const> find(uint64_t const hash) const noexcept
+    {
+        uint64_t const key = key_of(hash);
+        size_t const bucket = bucket_of(key);
+        return occurrences_at(find_key(key, directory[bucket], directory[bucket + 1u]));
+    }
+
+    /*!\brief Looks up many hash values with interleaved memory accesses.
+     * \param[in] hashes The hash values; a random access range.
+     * \param[out] results The occurrences of `hashes[i]` are written to `results[i]`.
+     *
+     * \details
+     *
+     * Every lookup is a chain of dependent loads that most likely miss the cache for a large index. The queries are
+     * processed in batches: first the directory entries of all queries of the batch are prefetched, then their keys,
+     * then their key offsets. The memory latencies of the queries of one batch overlap instead of adding up.
+     */
+    template <typename hashes_t>
+    void find(hashes_t && hashes, std::span<std::span<kmer_occurrence const>> const results) const noexcept
+    {
+        size_t const hash_count = std::ranges::size(hashes);
+        std::array<uint64_t, batch_size> batch_keys;
+        std::array<size_t, batch_size> batch_indices;
+
+        for (size_t first = 0u; first < hash_count; first += batch_size)
+        {
+            size_t const count = std::min(batch_size, hash_count - first);
+
+            for (size_t i = 0u; i < count; ++i)
+            {
+                batch_keys[i] = key_of(hashes[first + i]);
+                batch_indices[i] = bucket_of(batch_keys[i]);
+                __builtin_prefetch(directory.data() + batch_indices[i]);
+            }
+
+            for (size_t i = 0u; i < count; ++i)
+                __builtin_prefetch(keys.data() + directory[batch_indices[i]]);
+
+            for (size_t i = 0u; i < count; ++i)
+            {
+                size_t const bucket = batch_indices[i];
+                batch_indices[i] = find_key(batch_keys[i], directory[bucket], directory[bucket + 1u]);
+                __builtin_prefetch(key_offsets.data() + batch_indices[i]);
+            }
+
+            for (size_t i = 0u; i < count; ++i)
+                results[first + i] = occurrences_at(batch_indices[i]);
+        }
+    }
+};
+
+/*!\brief The hash values that can be looked up in a seqan3::kmer_index in one call.
+ * \ingroup search_kmer_index
+ */
+template <typename hashes_t>
+concept kmer_index_hashes =
+    std::ranges::random_access_range<hashes_t> && std::ranges::sized_range<hashes_t>
+    && std::convertible_to<std::ranges::range_reference_t<hashes_t>, uint64_t>;
+
+/*!\brief An extractor that writes the seeds of a sequence of type `sequence_t` into a span of seqan3::kmer_seed, e.g.
+ *        seqan3::minimiser_extractor.
+ * \ingroup search_kmer_index
+ */
+template <typename extractor_t, typename sequence_t>
+concept seed_extractor_for = std::copy_constructible<extractor_t>
+                          && std::invocable<extractor_t &, sequence_t, std::span<kmer_seed>>
+                          && std::convertible_to<std::invoke_result_t<extractor_t &, sequence_t, std::span<kmer_seed>>,
+                                                 size_t>;
+
+//!\brief Throws if `results` cannot hold the results of `hash_count` queries.
+inline void check_kmer_index_results(size_t const hash_count, size_t const result_count)
+{
+    if (result_count < hash_count)
+        throw std::invalid_argument{"The result buffer must be at least as large as the number of hash values."};
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief An index that maps the hash values of k-mers, minimisers or other seeds to their occurrences.
+ * \ingroup search_kmer_index
+ * \implements seqan3::cerealisable
+ *
+ * \details
+ *
+ * The index is built from a collection of sequences and a seed extractor, e.g. seqan3::minimiser_extractor,
+ * seqan3::syncmer_extractor or seqan3::strobemer_extractor. Every extracted seed is stored with its sequence,
+ * position and strand as seqan3::kmer_occurrence. Queries look up a hash value and return all of its occurrences
+ * ordered by sequence and position; the hash values of a query sequence are computed with the same extractor.
+ * When constructed with a seqan3::shape, every k-mer is indexed by the hash value of
+ * seqan3::views::canonical_kmer_hash.
+ *
+ * For short exact seeds, a lookup is much faster than a backward search in a seqan3::fm_index: it reads one
+ * directory entry, a few keys and two offsets, which are stored in flat arrays. Many lookups can be issued at once,
+ * such that the memory accesses of different queries overlap.
+ *
+ * ### Construction
+ *
+ * The seeds of the sequences are extracted by up to `thread_count` threads, one sequence per task. The seeds are then
+ * partitioned by the upper bits of their keys and every part is sorted into its buckets by another task. The index
+ * does not depend on the number of threads.
+ *
+ * ### Serialisation
+ *
+ * The index can be serialised with cereal, or written to a file with seqan3::kmer_index::write and mapped into
+ * memory with seqan3::mapped_kmer_index, which takes constant time and shares the memory between processes.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/kmer_index/kmer_index.cpp
+ *
+ * ### Thread safety
+ *
+ * All const member functions can be called concurrently.
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+class kmer_index
+{
+private:
+    //!\brief A seed with its key.
+    struct entry
+    {
+        //!\brief The key of the hash value.
+        uint64_t key;
+        //!\brief The occurrence.
+        kmer_occurrence occurrence;
+    };
+
+    //!\brief The number of parts that the entries are sorted in is at most `2^max_part_bits`.
+    static constexpr uint32_t max_part_bits{8u};
+    //!\brief The largest bucket that is sorted by insertion sort during the construction.
+    static constexpr size_t max_insertion_sort_size{16u};
+
+    //!\brief The number of sequences.
+    uint64_t sequence_count_{};
+    //!\brief The logarithm of the number of buckets.
+    uint32_t bucket_bits{1u};
+    //!\brief Where the keys of each bucket begin.
+    std::vector<uint64_t> directory{0u, 0u, 0u};
+    //!\brief The distinct keys.
+    std::vector<uint64_t> keys{};
+    //!\brief Where the occurrences of each key begin.
+    std::vector<uint64_t> key_offsets{0u};
+    //!\brief The occurrences.
+    std::vector<kmer_occurrence> occurrences{};
+
+    //!\brief Returns the lookup structure over the members.
+    detail::kmer_index_table table() const noexcept
+    {
+        return {bucket_bits, directory, keys, key_offsets, occurrences};
+    }
+
+    //!\brief Extracts the seeds of every sequence and converts them to entries.
+    template <typename sequences_t, typename extractor_t>
+    static std::vector<std::vector<entry>>
+    extract_entries(sequences_t const & sequences, extractor_t const & extractor, size_t const thread_count)
+    {
+        std::vector<std::vector<entry>> sequence_entries(std::ranges::size(sequences));
+
+        auto extract_sequence = [&](size_t const sequence_id)
+        {
+            auto && sequence = sequences[sequence_id];
+            extractor_t local_extractor{extractor};
+            std::vector<kmer_seed> seeds(std::ranges::size(sequence));
+            seeds.resize(local_extractor(sequence, seeds));
+
+            std::vector<entry> & entries = sequence_entries[sequence_id];
+            entries.reserve(seeds.size());
+            for (kmer_seed const & seed : seeds)
+            {
+                if (seed.position > kmer_occurrence::max_position)
+                    throw std::invalid_argument{"The positions of the seeds must be smaller than 2^31."};
+
+                entries.push_back({detail::kmer_index_table::key_of(seed.hash),
+                                   kmer_occurrence{static_cast<uint32_t>(sequence_id),
+                                                   seed.position,
+                                                   seed.reverse_complement}});
+            }
+        };
+        detail::parallel_for(sequence_entries.size(), thread_count, extract_sequence);
+
+        return sequence_entries;
+    }
+
+    /*!\brief Sorts the entries of one part by bucket and groups equal keys within each bucket.
+     * \param[in,out] part_entries The entries whose keys share the upper bits, ordered by occurrence.
+     * \param[in] bucket_bits The logarithm of the number of buckets of the index.
+     * \param[in] bucket_count The number of buckets of the part.
+     * \returns The number of distinct keys.
+     *
+     * \details
+     *
+     * The order of the keys within a bucket does not matter for the lookup. Hence, the entries are distributed over
+     * the buckets by a stable counting sort, and every bucket is sorted by key with a stable sort, which keeps the
+     * occurrences of a key in order. A bucket holds a few entries if the keys are spread evenly and is sorted by
+     * insertion sort. Repetitive sequences, e.g. periodic ones, put many entries into a single bucket, which is sorted
+     * by std::stable_sort instead. The runtime is \f$O(n \log n)\f$ in the worst case and linear in expectation
+     * for evenly spread keys.
+     */
+    static size_t sort_part(std::span<entry> const part_entries, uint32_t const bucket_bits, size_t const bucket_count)
+    {
+        auto bucket_of = [bucket_shift = 64u - bucket_bits, mask = bucket_count - 1u](uint64_t const key) -> size_t
+        {
+            return (key >> bucket_shift) & mask;
+        };
+
+        std::vector<size_t> bucket_offsets(bucket_count + 1u);
+        for (entry const & part_entry : part_entries)
+            ++bucket_offsets[bucket_of(part_entry.key) + 1u];
+        std::partial_sum(bucket_offsets.begin(), bucket_offsets.end(), bucket_offsets.begin());
+
+        std::vector<entry> sorted(part_entries.size());
+        for (entry const & part_entry : part_entries)
+            sorted[bucket_offsets[bucket_of(part_entry.key)]++] = part_entry;
+
+        // After the scatter, bucket_offsets[b] is the end of bucket b.
+        size_t distinct_keys{};
+        for (size_t bucket = 0u, begin = 0u; bucket < bucket_count; begin = bucket_offsets[bucket++])
+        {
+            size_t const end = bucket_offsets[bucket];
+            if (end - begin > max_insertion_sort_size)
+            {
+                std::ranges::stable_sort(sorted.begin() + begin,
+                                         sorted.begin() + end,
+                                         std::ranges::less{},
+                                         &entry::key);
+            }
+            else
+            {
+                for (size_t i = begin + 1u; i < end; ++i)
+                {
+                    entry const current = sorted[i];
+                    size_t j = i;
+                    for (; j > begin && sorted[j - 1u].key > current.key; --j)
+                        sorted[j] = sorted[j - 1u];
+                    sorted[j] = current;
+                }
+            }
+
+            for (size_t i = begin; i < end; ++i)
+                distinct_keys += (i == begin || sorted[i].key != sorted[i - 1u].key);
+        }
+
+        std::ranges::copy(sorted, part_entries.begin());
+        return distinct_keys;
+    }
+
+    //!\brief Builds the table from the entries of all sequences.
+    void build(std::vector<std::vector<entry>> sequence_entries, size_t const thread_count)
+    {
+        size_t const entry_count = std::transform_reduce(sequence_entries.begin(),
+                                                         sequence_entries.end(),
+                                                         size_t{},
+                                                         std::plus<>{},
+                                                         std::ranges::size);
+
+        // About four occurrences per bucket.
+        bucket_bits = std::clamp<uint32_t>(std::bit_width(entry_count / 4u), 1u, 63u);
+        uint32_t const part_bits = std::min(bucket_bits, max_part_bits);
+        size_t const part_count = size_t{1} << part_bits;
+        size_t const buckets_per_part = size_t{1} << (bucket_bits - part_bits);
+        auto part_of = [part_bits](uint64_t const key) -> size_t
+        {
+            return key >> (64u - part_bits);
+        };
+
+        // Partition the entries by the upper bits of their keys. Each group of consecutive sequences is counted and
+        // scattered by one task.
+        size_t const group_count = std::min(sequence_entries.size(), std::max<size_t>(thread_count, 1u) * 4u);
+        auto group_begin = [&](size_t const group)
+        {
+            return group * sequence_entries.size() / group_count;
+        };
+
+        std::vector<size_t> group_part_offsets(group_count * part_count);
+        auto count_group = [&](size_t const group)
+        {
+            size_t * const counts = group_part_offsets.data() + group * part_count;
+            for (size_t i = group_begin(group); i < group_begin(group + 1u); ++i)
+                for (entry const & sequence_entry : sequence_entries[i])
+                    ++counts[part_of(sequence_entry.key)];
+        };
+        detail::parallel_for(group_count, thread_count, count_group);
+
+        std::vector<size_t> part_offsets(part_count + 1u);
+        for (size_t part = 0u, offset = 0u; part < part_count; ++part)
+        {
+            part_offsets[part] = offset;
+            for (size_t group = 0u; group < group_count; ++group)
+                offset += std::exchange(group_part_offsets[group * part_count + part], offset);
+        }
+        part_offsets[part_count] = entry_count;
+
+        std::vector<entry> entries(entry_count);
+        auto scatter_group = [&](size_t const group)
+        {
+            size_t * const offsets = group_part_offsets.data() + group * part_count;
+            for (size_t i = group_begin(group); i < group_begin(group + 1u); ++i)
+            {
+                for (entry const & sequence_entry : sequence_entries[i])
+                    entries[offsets[part_of(sequence_entry.key)]++] = sequence_entry;
+
+                std::vector<entry>{}.swap(sequence_entries[i]);
+            }
+        };
+        detail::parallel_for(group_count, thread_count, scatter_group);
+
+        // Sort every part and count its distinct keys.
+        std::vector<size_t> part_key_offsets(part_count + 1u);
+        auto sort_into_buckets = [&](size_t const part)
+        {
+            std::span<entry> const part_entries{entries.begin() + part_offsets[part],
+                                                entries.begin() + part_offsets[part + 1u]};
+            part_key_offsets[part + 1u] = sort_part(part_entries, bucket_bits, buckets_per_part);
+        };
+        detail::parallel_for(part_count, thread_count, sort_into_buckets);
+        std::partial_sum(part_key_offsets.begin(), part_key_offsets.end(), part_key_offsets.begin());
+
+        size_t const key_count = part_key_offsets.back();
+        size_t const bucket_count = size_t{1} << bucket_bits;
+        directory.assign(bucket_count + 1u, key_count);
+        keys.resize(key_count);
+        key_offsets.resize(key_count + 1u);
+        key_offsets[key_count] = entry_count;
+        occurrences.resize(entry_count);
+
+        // Every part writes its keys, offsets, occurrences and the directory entries of its buckets.
+        detail::kmer_index_table const lookup = table();
+        auto write_part = [&](size_t const part)
+        {
+            size_t key_index = part_key_offsets[part];
+            size_t bucket = part * buckets_per_part;
+            size_t const last_bucket = bucket + buckets_per_part;
+
+            for (size_t i = part_offsets[part]; i < part_offsets[part + 1u]; ++i)
+            {
+                occurrences[i] = entries[i].occurrence;
+
+                if (i != part_offsets[part] && entries[i].key == entries[i - 1u].key)
+                    continue;
+
+                for (size_t const key_bucket = lookup.bucket_of(entries[i].key); bucket <= key_bucket; ++bucket)
+                    directory[bucket] = key_index;
+
+                keys[key_index] = entries[i].key;
+                key_offsets[key_index] = i;
+                ++key_index;
+            }
+
+            for (; bucket < last_bucket; ++bucket)
+                directory[bucket] = key_index;
+        };
+        detail::parallel_for(part_count, thread_count, write_part);
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    kmer_index() = default;                               //!< Defaulted.
+    kmer_index(kmer_index const &) = default;             //!< Defaulted.
+    kmer_index(kmer_index &&) = default;                  //!< Defaulted.
+    kmer_index & operator=(kmer_index const &) = default; //!< Defaulted.
+    kmer_index & operator=(kmer_index &&) = default;      //!< Defaulted.
+    ~kmer_index() = default;                              //!< Defaulted.
+
+    /*!\brief Indexes the seeds of a collection of sequences.
+     * \tparam sequences_t The type of the sequences; must model std::ranges::random_access_range and
+     *                     std::ranges::sized_range, and every sequence must model std::ranges::sized_range, e.g.
+     *                     seqan3::concatenated_sequences.
+     * \tparam extractor_t The type of the extractor, e.g. seqan3::minimiser_extractor.
+     * \param[in] sequences The sequences; sequence `i` gets the id `i`.
+     * \param[in] extractor The extractor; it is copied for every sequence.
+     * \param[in] thread_count The maximal number of threads used for the construction.
+     * \throws std::invalid_argument if there are more than 2^32 sequences or a seed has a position of at least 2^31.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Expected linear in the number of seeds, divided by the number of threads. Every seed needs up to 32 bytes of
+     * memory during the construction, and about 10 bytes plus 16 bytes per distinct hash value afterwards.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    template <detail::seed_sequence_collection sequences_t, typename extractor_t>
+        requires std::ranges::random_access_range<sequences_t> && std::ranges::sized_range<sequences_t>
+              && std::ranges::sized_range<std::ranges::range_reference_t<sequences_t>>
+              && detail::seed_extractor_for<extractor_t, std::ranges::range_reference_t<sequences_t const>>
+    kmer_index(sequences_t const & sequences, extractor_t const & extractor, size_t const thread_count = 1u)
+    {
+        if (std::ranges::size(sequences) > std::numeric_limits<uint32_t>::max())
+            throw std::invalid_argument{"A k-mer index can hold at most 2^32 sequences."};
+
+        sequence_count_ = std::ranges::size(sequences);
+        build(extract_entries(sequences, extractor, thread_count), thread_count);
+    }
+
+    /*!\brief Indexes all k-mers of a collection of sequences.
+     * \param[in] sequences The sequences; sequence `i` gets the id `i`.
+     * \param[in] kmer_shape The seqan3::shape of the k-mers.
+     * \param[in] thread_count The maximal number of threads used for the construction.
+     * \throws std::invalid_argument if there are more than 2^32 sequences or a sequence is at least 2^31 long.
+     *
+     * \details
+     *
+     * The k-mers are indexed by the hash values of seqan3::views::canonical_kmer_hash with `kmer_shape`.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    template <detail::seed_sequence_collection sequences_t>
+        requires std::ranges::random_access_range<sequences_t> && std::ranges::sized_range<sequences_t>
+              && std::ranges::sized_range<std::ranges::range_reference_t<sequences_t>>
+    kmer_index(sequences_t const & sequences, shape const & kmer_shape, size_t const thread_count = 1u) :
+        kmer_index{sequences,
+                   // With a window of a single k-mer, every k-mer is a minimiser.
+                   minimiser_extractor{kmer_shape, window_size{kmer_shape.size()}, seed{0u}},
+                   thread_count}
+    {}
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    /*!\brief Returns all occurrences of a hash value, ordered by sequence and position.
+     * \param[in] hash The hash value.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Expected constant.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    std::span<kmer_occurrence const> find(uint64_t const hash) const noexcept
+    {
+        return table().find(hash);
+    }
+
+    /*!\brief Looks up many hash values at once.
+     * \tparam hashes_t The type of the hash values; must model std::ranges::random_access_range and
+     *                  std::ranges::sized_range over values convertible to `uint64_t`.
+     * \param[in] hashes The hash values, e.g. `seeds | std::views::transform(&seqan3::kmer_seed::hash)`.
+     * \param[out] results The occurrences of `hashes[i]` are written to `results[i]`.
+     * \throws std::invalid_argument if `results` is smaller than `hashes`.
+     *
+     * \details
+     *
+     * The result is the same as calling find(uint64_t) for every hash value, but the memory accesses of up to 16
+     * queries are interleaved with prefetching, which hides most of the memory latency for indices that do not fit
+     * into the cache.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    template <detail::kmer_index_hashes hashes_t>
+    void find(hashes_t && hashes, std::span<std::span<kmer_occurrence const>> const results) const
+    {
+        detail::check_kmer_index_results(std::ranges::size(hashes), results.size());
+        table().find(hashes, results);
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Returns the number of occurrences.
+    size_t size() const noexcept
+    {
+        return occurrences.size();
+    }
+
+    //!\brief Returns the number of distinct hash values.
+    size_t key_count() const noexcept
+    {
+        return keys.size();
+    }
+
+    //!\brief Returns the number of indexed sequences.
+    size_t sequence_count() const noexcept
+    {
+        return sequence_count_;
+    }
+    //!\}
+
+    /*!\brief Writes the index to a file that can be mapped with seqan3::mapped_kmer_index.
+     * \param[in] path The path to the file; an existing file is overwritten.
+     * \throws std::filesystem::filesystem_error if the file cannot be written.
+     * \throws std::runtime_error on big endian platforms.
+     *
+     * \details
+     *
+     * The file consists of a seqan3::detail::kmer_index_header of 64 bytes, followed by the directory, the keys, the
+     * key offsets and the occurrences as arrays of 64 bit integers in little endian byte order.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    void write(std::filesystem::path const & path) const
+    {
+        if constexpr (std::endian::native != std::endian::little)
+            throw std::runtime_error{"Memory mapped k-mer indices are only supported on little endian platforms."};
+
+        detail::kmer_index_header header{};
+        header.bucket_bits = bucket_bits;
+        header.sequence_count = sequence_count_;
+        header.key_count = keys.size();
+        header.occurrence_count = occurrences.size();
+
+        std::ofstream stream{path, std::ios::binary | std::ios::trunc};
+        auto write_bytes = [&stream](void const * data, size_t const size)
+        {
+            stream.write(static_cast<char const *>(data), size);
+        };
+
+        write_bytes(&header, sizeof(header));
+        write_bytes(directory.data(), directory.size() * sizeof(uint64_t));
+        write_bytes(keys.data(), keys.size() * sizeof(uint64_t));
+        write_bytes(key_offsets.data(), key_offsets.size() * sizeof(uint64_t));
+        write_bytes(occurrences.data(), occurrences.size() * sizeof(kmer_occurrence));
+        stream.flush();
+
+        if (!stream)
+            throw std::filesystem::filesystem_error{"Cannot write the k-mer index.",
+                                                    path,
+                                                    std::make_error_code(std::errc::io_error)};
+    }
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param[in] archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(sequence_count_);
+        archive(bucket_bits);
+        archive(directory);
+        archive(keys);
+        archive(key_offsets);
+        archive(occurrences);
+    }
+    //!\endcond
+};
+
+/*!\brief A read-only seqan3::kmer_index that is stored in a memory mapped file.
+ * \ingroup search_kmer_index
+ *
+ * \details
+ *
+ * The file is written with seqan3::kmer_index::write. Opening it takes constant time, the pages are only loaded when
+ * they are accessed and all processes that open the same file share the same physical memory. The lookups are the
+ * same as the ones of seqan3::kmer_index.
+ *
+ * Memory mapping is only supported on little endian platforms.
+ *
+ * ### Thread safety
+ *
+ * This index is never modified, so all member functions can be called concurrently.
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+class mapped_kmer_index
+{
+private:
+    //!\brief The mapped file.
+    detail::memory_mapped_file file{};
+    //!\brief The lookup structure over the mapped file.
+    detail::kmer_index_table table{};
+    //!\brief The number of sequences.
+    size_t sequence_count_{};
+
+    //!\brief The directory of an empty index.
+    static constexpr std::array<uint64_t, 3> empty_directory{};
+    //!\brief The key offsets of an empty index.
+    static constexpr std::array<uint64_t, 1> empty_key_offsets{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief Constructs an empty index.
+    mapped_kmer_index() noexcept
+    {
+        table.directory = empty_directory;
+        table.key_offsets = empty_key_offsets;
+    }
+
+    mapped_kmer_index(mapped_kmer_index const &) = delete;             //!< Deleted.
+    mapped_kmer_index & operator=(mapped_kmer_index const &) = delete; //!< Deleted.
+    ~mapped_kmer_index() = default;                                    //!< Defaulted.
+
+    //!\brief Move constructor; `other` is empty afterwards.
+    mapped_kmer_index(mapped_kmer_index && other) noexcept : mapped_kmer_index{}
+    {
+        swap(other);
+    }
+
+    //!\brief Move assignment; `other` is empty afterwards.
+    mapped_kmer_index & operator=(mapped_kmer_index && other) noexcept
+    {
+        mapped_kmer_index tmp{std::move(other)};
+        swap(tmp);
+        return *this;
+    }
+
+    /*!\brief Maps a file that was written by seqan3::kmer_index::write.
+     * \param[in] path The path to the file.
+     * \throws std::filesystem::filesystem_error if the file cannot be opened or mapped.
+     * \throws std::runtime_error if the file is not a valid k-mer index.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Constant; only the header and the file size are checked.
+     *
+     * \experimentalapi{Experimental since version 3.5.}
+     */
+    explicit mapped_kmer_index(std::filesystem::path const & path) : file{path}
+    {
+        if constexpr (std::endian::native != std::endian::little)
+            throw std::runtime_error{"Memory mapped k-mer indices are only supported on little endian platforms."};
+
+        detail::kmer_index_header header{};
+        if (file.size() < sizeof(header))
+            throw std::runtime_error{"The file is too small to be a k-mer index."};
+
+        std::memcpy(&header, file.data(), sizeof(header));
+
+        if (header.magic != header.expected_magic)
+            throw std::runtime_error{"The file is not a k-mer index."};
+        if (header.version != header.current_version)
+            throw std::runtime_error{"Unsupported version " + std::to_string(header.version) + " of the k-mer index."};
+        if (header.bucket_bits == 0u || header.bucket_bits > 63u)
+            throw std::runtime_error{"The k-mer index is corrupted."};
+
+        // Every array is taken from the remaining words, such that no value of the header can overflow.
+        size_t remaining_words = (file.size() - sizeof(header)) / sizeof(uint64_t);
+        auto take_words = [&remaining_words](uint64_t const count)
+        {
+            if (count > remaining_words)
+                throw std::runtime_error{"The k-mer index is truncated or corrupted."};
+            remaining_words -= count;
+        };
+
+        size_t const directory_size = (uint64_t{1} << header.bucket_bits) + 1u;
+        take_words(directory_size);
+        take_words(header.key_count);
+        take_words(header.key_count);
+        take_words(1u);
+        take_words(header.occurrence_count);
+        if (remaining_words != 0u || (file.size() - sizeof(header)) % sizeof(uint64_t) != 0u)
+            throw std::runtime_error{"The k-mer index is truncated or corrupted."};
+
+        // The mapping is page aligned and all arrays begin at multiples of 8.
+        uint64_t const * words = reinterpret_cast<uint64_t const *>(file.data() + sizeof(header));
+        table.bucket_bits = header.bucket_bits;
+        table.directory = {words, directory_size};
+        words += directory_size;
+        table.keys = {words, header.key_count};
+        words += header.key_count;
+        table.key_offsets = {words, header.key_count + 1u};
+        words += header.key_count + 1u;
+        table.occurrences = {reinterpret_cast<kmer_occurrence const *>(words), header.occurrence_count};
+        sequence_count_ = header.sequence_count;
+
+        if (table.directory.back() != header.key_count || table.key_offsets.back() != header.occurrence_count)
+            throw std::runtime_error{"The k-mer index is corrupted."};
+    }
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    //!\copydoc seqan3::kmer_index::find(uint64_t const) const
+    std::span<kmer_occurrence const> find(uint64_t const hash) const noexcept
+    {
+        return table.find(hash);
+    }
+
+    //!\copydoc seqan3::kmer_index::find(hashes_t &&, std::span<std::span<kmer_occurrence const>> const) const
+    template <detail::kmer_index_hashes hashes_t>
+    void find(hashes_t && hashes, std::span<std::span<kmer_occurrence const>> const results) const
+    {
+        detail::check_kmer_index_results(std::ranges::size(hashes), results.size());
+        table.find(hashes, results);
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\copydoc seqan3::kmer_index::size
+    size_t size() const noexcept
+    {
+        return table.occurrences.size();
+    }
+
+    //!\copydoc seqan3::kmer_index::key_count
+    size_t key_count() const noexcept
+    {
+        return table.keys.size();
+    }
+
+    //!\copydoc seqan3::kmer_index::sequence_count
+    size_t sequence_count() const noexcept
+    {
+        return sequence_count_;
+    }
+    //!\}
+
+    //!\brief Swaps the contents with `other`.
+    void swap(mapped_kmer_index & other) noexcept
+    {
+        file.swap(other.file);
+        std::swap(table, other.table);
+        std::swap(sequence_count_, other.sequence_count_);
+    }
+};
+
+} // namespace seqan3
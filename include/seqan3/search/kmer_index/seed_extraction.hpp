@@ -0,0 +1,576 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::kmer_seed, seqan3::minimiser_extractor, seqan3::syncmer_extractor and
+ *        seqan3::strobemer_extractor.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/search/detail/window_minimum.hpp>
+#include <seqan3/search/kmer_index/shape.hpp>
+#include <seqan3/search/views/canonical_kmer_hash.hpp>
+#include <seqan3/search/views/minimiser_hash.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A seed as reported by seqan3::minimiser_extractor, seqan3::syncmer_extractor and
+ *        seqan3::strobemer_extractor.
+ * \ingroup search_kmer_index
+ *
+ * \details
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+struct kmer_seed
+{
+    //!\brief The canonical hash value, XORed with the seed of the extractor.
+    uint64_t hash{};
+    //!\brief The begin position of the (first) k-mer in the sequence.
+    uint32_t position{};
+    //!\brief Whether the hash value is the one of the reverse complement of the (first) k-mer.
+    bool reverse_complement{};
+
+    //!\brief Two seeds are equal if all members are equal.
+    friend bool operator==(kmer_seed const &, kmer_seed const &) = default;
+};
+
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+/*!\brief A sequence that seeds can be extracted from.
+ * \ingroup search_kmer_index
+ */
+template <typename sequence_t>
+concept seed_sequence = std::ranges::viewable_range<sequence_t> && std::ranges::input_range<sequence_t>
+                     && nucleotide_alphabet<std::ranges::range_reference_t<sequence_t>>;
+
+/*!\brief A collection of sequences that seeds can be extracted from, e.g. seqan3::concatenated_sequences.
+ * \ingroup search_kmer_index
+ */
+template <typename sequences_t>
+concept seed_sequence_collection =
+    std::ranges::input_range<sequences_t> && seed_sequence<std::ranges::range_reference_t<sequences_t>>;
+
+/*!\brief The canonical hash values of all k-mers of a sequence and their strands.
+ * \ingroup search_kmer_index
+ *
+ * \details
+ *
+ * The buffers are kept between sequences, such that no memory is allocated once they are large enough.
+ */
+struct canonical_kmer_hashes
+{
+    //!\brief The canonical hash values.
+    std::vector<uint64_t> hashes{};
+    //!\brief Whether the hash value is the one of the reverse complement.
+    std::vector<uint8_t> reverse_complement{};
+
+    /*!\brief Hashes all k-mers of `sequence` with seqan3::views::canonical_kmer_hash.
+     * \throws std::invalid_argument if the sequence has more than 2^32 k-mers.
+     */
+    template <typename sequence_t>
+    void assign(sequence_t && sequence, shape const & kmer_shape, uint64_t const seed)
+    {
+        hashes.clear();
+        reverse_complement.clear();
+
+        canonical_kmer_hash_view kmer_view{std::forward<sequence_t>(sequence), kmer_shape, seed};
+        for (auto it = kmer_view.begin(); it != kmer_view.end(); ++it)
+        {
+            hashes.push_back(*it);
+            reverse_complement.push_back(it.is_reverse_complement());
+        }
+
+        if (hashes.size() > std::numeric_limits<uint32_t>::max())
+            throw std::invalid_argument{"The positions of the seeds must fit into 32 bits."};
+    }
+
+    //!\brief Returns the seed of the k-mer at `position`.
+    kmer_seed seed_at(size_t const position) const noexcept
+    {
+        return {hashes[position], static_cast<uint32_t>(position), reverse_complement[position] != 0u};
+    }
+};
+
+/*!\brief Extracts the seeds of all sequences of a collection and records where the seeds of each sequence begin.
+ * \ingroup search_kmer_index
+ * \param[in] extractor The extractor; called with every sequence and the unused part of `seeds`.
+ * \param[in] sequences The sequences.
+ * \param[out] seeds The seeds of all sequences.
+ * \param[out] seed_offsets The seeds of sequence `i` are `seeds[seed_offsets[i], seed_offsets[i + 1])`; must provide
+ *                          space for one more offset than there are sequences.
+ * \returns The total number of seeds.
+ * \throws std::invalid_argument if `seed_offsets` is too small.
+ */
+template <typename extractor_t, typename sequences_t>
+size_t extract_seed_collection(extractor_t & extractor,
+                               sequences_t && sequences,
+                               std::span<kmer_seed> const seeds,
+                               std::span<size_t> const seed_offsets)
+{
+    size_t count{};
+    size_t sequence_index{};
+
+    for (auto && sequence : sequences)
+    {
+        if (sequence_index + 1u >= seed_offsets.size())
+            throw std::invalid_argument{"The seed offsets must provide space for the number of sequences plus one."};
+
+        seed_offsets[sequence_index++] = count;
+        count += extractor(std::forward<decltype(sequence)>(sequence), seeds.subspan(count));
+    }
+
+    if (sequence_index >= seed_offsets.size())
+        throw std::invalid_argument{"The seed offsets must provide space for the number of sequences plus one."};
+
+    seed_offsets[sequence_index] = count;
+    return count;
+}
+
+/*!\brief Writes the seeds of the selected k-mers to `seeds`.
+ * \ingroup search_kmer_index
+ * \param[in] kmers The hash values of the k-mers.
+ * \param[in] kmer_count The number of k-mers to consider.
+ * \param[in] is_selected Returns whether the k-mer at a position is selected.
+ * \param[out] seeds The seeds.
+ * \returns The number of seeds.
+ * \throws std::invalid_argument if `seeds` is too small.
+ *
+ * \details
+ *
+ * The seed is written unconditionally and only kept if the k-mer is selected, such that the loop has no data dependent
+ * branches.
+ */
+template <typename predicate_t>
+size_t write_selected_seeds(canonical_kmer_hashes const & kmers,
+                            size_t const kmer_count,
+                            predicate_t && is_selected,
+                            std::span<kmer_seed> const seeds)
+{
+    size_t count{};
+
+    for (size_t position = 0u; position < kmer_count; ++position)
+    {
+        bool const selected = is_selected(position);
+
+        if (count == seeds.size()) [[unlikely]]
+        {
+            if (selected)
+                throw std::invalid_argument{"The seed buffer is too small."};
+            continue;
+        }
+
+        seeds[count] = kmers.seed_at(position);
+        count += selected;
+    }
+
+    return count;
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief Extracts the minimisers of sequences with their positions and strands into a caller-provided buffer.
+ * \ingroup search_kmer_index
+ *
+ * \details
+ *
+ * The hash values of the minimisers are the same as the ones of seqan3::views::minimiser_hash with the same shape,
+ * window size and seed. In addition, the begin position of the k-mer and whether the hash value is the one of its
+ * reverse complement are reported.
+ *
+ * Instead of chaining lazy views, the canonical hash values of all k-mers are computed in one pass over the sequence,
+ * and the minimisers are found with a branch-free sliding window minimum over the whole array of hash values, see
+ * seqan3::detail::window_minimum_batch. The buffers are kept by the extractor, such that no memory is allocated once
+ * they are large enough; use one extractor per thread.
+ *
+ * \include test/snippet/search/kmer_index/seed_extraction.cpp
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+class minimiser_extractor
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    minimiser_extractor() = default;                                        //!< Defaulted.
+    minimiser_extractor(minimiser_extractor const &) = default;             //!< Defaulted.
+    minimiser_extractor(minimiser_extractor &&) = default;                  //!< Defaulted.
+    minimiser_extractor & operator=(minimiser_extractor const &) = default; //!< Defaulted.
+    minimiser_extractor & operator=(minimiser_extractor &&) = default;      //!< Defaulted.
+    ~minimiser_extractor() = default;                                       //!< Defaulted.
+
+    /*!\brief Constructs an extractor for the given shape, window size and seed.
+     * \param[in] kmer_shape  The seqan3::shape of the k-mers.
+     * \param[in] window_size The number of letters in one window.
+     * \param[in] seed        The value that the hash values are XORed with to randomise the order.
+     * \throws std::invalid_argument if the size of the shape is greater than the `window_size`.
+     */
+    minimiser_extractor(shape const & kmer_shape,
+                        seqan3::window_size const window_size,
+                        seqan3::seed const seed = seqan3::seed{0x8F'3F'73'B5'CF'1C'9A'DE}) :
+        kmer_shape{kmer_shape},
+        seed_value{seed.get()}
+    {
+        if (kmer_shape.size() > window_size.get())
+            throw std::invalid_argument{"The size of the shape cannot be greater than the window size."};
+
+        window_minimum = detail::window_minimum_batch<uint64_t>{window_size.get() - kmer_shape.size() + 1u};
+    }
+    //!\}
+
+    /*!\brief Extracts the minimisers of a sequence.
+     * \param[in] sequence The sequence; the reference type must model seqan3::nucleotide_alphabet.
+     * \param[out] seeds The minimisers, ordered by position.
+     * \returns The number of minimisers.
+     * \throws std::invalid_argument if `seeds` is too small or the sequence has more than 2^32 k-mers.
+     */
+    template <detail::seed_sequence sequence_t>
+    size_t operator()(sequence_t && sequence, std::span<kmer_seed> const seeds)
+    {
+        kmers.assign(std::forward<sequence_t>(sequence), kmer_shape, seed_value);
+
+        minimiser_positions.resize(kmers.hashes.size());
+        size_t const count = window_minimum(kmers.hashes, minimiser_positions);
+
+        if (count > seeds.size())
+            throw std::invalid_argument{"The seed buffer is too small."};
+
+        for (size_t i = 0u; i < count; ++i)
+            seeds[i] = kmers.seed_at(minimiser_positions[i]);
+
+        return count;
+    }
+
+    /*!\brief Extracts the minimisers of all sequences of a collection, e.g. a seqan3::concatenated_sequences.
+     * \param[in] sequences The sequences.
+     * \param[out] seeds The minimisers of all sequences.
+     * \param[out] seed_offsets The minimisers of sequence `i` are `seeds[seed_offsets[i], seed_offsets[i + 1])`;
+     *                          must provide space for one more offset than there are sequences.
+     * \returns The total number of minimisers.
+     * \throws std::invalid_argument if `seeds` or `seed_offsets` is too small.
+     */
+    template <detail::seed_sequence_collection sequences_t>
+    size_t operator()(sequences_t && sequences, std::span<kmer_seed> const seeds, std::span<size_t> const seed_offsets)
+    {
+        return detail::extract_seed_collection(*this, std::forward<sequences_t>(sequences), seeds, seed_offsets);
+    }
+
+private:
+    //!\brief The shape of the k-mers.
+    shape kmer_shape{};
+    //!\brief The seed.
+    uint64_t seed_value{};
+    //!\brief The hash values of the current sequence.
+    detail::canonical_kmer_hashes kmers{};
+    //!\brief Computes the minimisers of the hash values.
+    detail::window_minimum_batch<uint64_t> window_minimum{};
+    //!\brief The positions of the minimisers of the current sequence.
+    std::vector<size_t> minimiser_positions{};
+};
+
+/*!\brief The kind of syncmers extracted by seqan3::syncmer_extractor.
+ * \ingroup search_kmer_index
+ *
+ * \details
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+enum class syncmer_kind : uint8_t
+{
+    //!\brief The smallest s-mer is at the given offset of the k-mer.
+    open,
+    //!\brief The smallest s-mer is the first or the last s-mer of the k-mer.
+    closed
+};
+
+/*!\brief The parameters of seqan3::syncmer_extractor.
+ * \ingroup search_kmer_index
+ *
+ * \details
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+struct syncmer_parameters
+{
+    //!\brief The size of the k-mers.
+    uint8_t kmer_size{15u};
+    //!\brief The size of the s-mers; must be smaller than the size of the k-mers.
+    uint8_t smer_size{9u};
+    //!\brief Open or closed syncmers.
+    syncmer_kind kind{syncmer_kind::closed};
+    //!\brief The offset of the smallest s-mer in an open syncmer; must be at most `kmer_size - smer_size`.
+    uint8_t offset{0u};
+    //!\brief The value that the hash values are XORed with to randomise the order.
+    uint64_t seed{0x8F'3F'73'B5'CF'1C'9A'DE};
+};
+
+/*!\brief Extracts the syncmers of sequences with their positions and strands into a caller-provided buffer.
+ * \ingroup search_kmer_index
+ *
+ * \details
+ *
+ * A k-mer is a syncmer if the smallest of its `k - s + 1` s-mers, compared by their canonical hash values, is at a
+ * fixed position: the first or the last one for closed syncmers, and the given offset for open syncmers
+ * (Edgar, 2021). Unlike minimisers, whether a k-mer is a syncmer does not depend on its neighbours.
+ *
+ * The canonical hash values of the k-mers and of the s-mers are computed in one pass each, and the smallest s-mer of
+ * every k-mer is found with a branch-free sliding window minimum, see seqan3::detail::window_minimum_batch. The
+ * sequence must therefore be a forward range. The buffers are kept by the extractor, such that no memory is allocated
+ * once they are large enough; use one extractor per thread.
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+class syncmer_extractor
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    syncmer_extractor() = default;                                      //!< Defaulted.
+    syncmer_extractor(syncmer_extractor const &) = default;             //!< Defaulted.
+    syncmer_extractor(syncmer_extractor &&) = default;                  //!< Defaulted.
+    syncmer_extractor & operator=(syncmer_extractor const &) = default; //!< Defaulted.
+    syncmer_extractor & operator=(syncmer_extractor &&) = default;      //!< Defaulted.
+    ~syncmer_extractor() = default;                                     //!< Defaulted.
+
+    /*!\brief Constructs an extractor with the given parameters.
+     * \param[in] parameters The seqan3::syncmer_parameters.
+     * \throws std::invalid_argument if the s-mers are empty or not smaller than the k-mers, or if the offset of open
+     *         syncmers is too large.
+     */
+    explicit syncmer_extractor(syncmer_parameters const & parameters) : parameters{parameters}
+    {
+        if (parameters.smer_size == 0u || parameters.smer_size >= parameters.kmer_size)
+            throw std::invalid_argument{"The size of the s-mers must be in [1, kmer_size)."};
+
+        if (parameters.kind == syncmer_kind::open && parameters.offset > parameters.kmer_size - parameters.smer_size)
+            throw std::invalid_argument{"The offset of an open syncmer must be at most kmer_size - smer_size."};
+
+        window_minimum = detail::window_minimum_batch<uint64_t>{parameters.kmer_size - parameters.smer_size + 1u};
+    }
+    //!\}
+
+    /*!\brief Extracts the syncmers of a sequence.
+     * \param[in] sequence The sequence; must model std::ranges::forward_range and the reference type must model
+     *                     seqan3::nucleotide_alphabet.
+     * \param[out] seeds The syncmers, ordered by position.
+     * \returns The number of syncmers.
+     * \throws std::invalid_argument if `seeds` is too small or the sequence has more than 2^32 k-mers.
+     */
+    template <detail::seed_sequence sequence_t>
+        requires std::ranges::forward_range<sequence_t>
+    size_t operator()(sequence_t && sequence, std::span<kmer_seed> const seeds)
+    {
+        auto sequence_view = std::views::all(std::forward<sequence_t>(sequence));
+        kmers.assign(sequence_view, ungapped{parameters.kmer_size}, parameters.seed);
+        smers.assign(sequence_view, ungapped{parameters.smer_size}, parameters.seed);
+
+        size_t const kmer_count = kmers.hashes.size();
+        if (kmer_count == 0u)
+            return 0u;
+
+        smer_minima.resize(smers.hashes.size());
+        window_minimum.minima(smers.hashes, smer_minima);
+
+        uint64_t const * const smer_hashes = smers.hashes.data();
+        uint64_t const * const minima = smer_minima.data();
+        size_t const last_smer = parameters.kmer_size - parameters.smer_size;
+
+        if (parameters.kind == syncmer_kind::closed)
+        {
+            auto is_closed_syncmer = [&](size_t const i)
+            {
+                return (smer_hashes[i] == minima[i]) | (smer_hashes[i + last_smer] == minima[i]);
+            };
+
+            return detail::write_selected_seeds(kmers, kmer_count, is_closed_syncmer, seeds);
+        }
+
+        size_t const offset = parameters.offset;
+        auto is_open_syncmer = [&](size_t const i)
+        {
+            return smer_hashes[i + offset] == minima[i];
+        };
+
+        return detail::write_selected_seeds(kmers, kmer_count, is_open_syncmer, seeds);
+    }
+
+    /*!\brief Extracts the syncmers of all sequences of a collection, e.g. a seqan3::concatenated_sequences.
+     * \param[in] sequences The sequences.
+     * \param[out] seeds The syncmers of all sequences.
+     * \param[out] seed_offsets The syncmers of sequence `i` are `seeds[seed_offsets[i], seed_offsets[i + 1])`;
+     *                          must provide space for one more offset than there are sequences.
+     * \returns The total number of syncmers.
+     * \throws std::invalid_argument if `seeds` or `seed_offsets` is too small.
+     */
+    template <detail::seed_sequence_collection sequences_t>
+        requires std::ranges::forward_range<std::ranges::range_reference_t<sequences_t>>
+    size_t operator()(sequences_t && sequences, std::span<kmer_seed> const seeds, std::span<size_t> const seed_offsets)
+    {
+        return detail::extract_seed_collection(*this, std::forward<sequences_t>(sequences), seeds, seed_offsets);
+    }
+
+private:
+    //!\brief The parameters.
+    syncmer_parameters parameters{};
+    //!\brief The hash values of the k-mers of the current sequence.
+    detail::canonical_kmer_hashes kmers{};
+    //!\brief The hash values of the s-mers of the current sequence.
+    detail::canonical_kmer_hashes smers{};
+    //!\brief Computes the smallest s-mer of every k-mer.
+    detail::window_minimum_batch<uint64_t> window_minimum{};
+    //!\brief The hash value of the smallest s-mer of every k-mer.
+    std::vector<uint64_t> smer_minima{};
+};
+
+/*!\brief The parameters of seqan3::strobemer_extractor.
+ * \ingroup search_kmer_index
+ *
+ * \details
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+struct strobemer_parameters
+{
+    //!\brief The size of both strobes.
+    uint8_t strobe_size{15u};
+    //!\brief The smallest distance between the begin positions of the first and the second strobe.
+    uint32_t window_min{16u};
+    //!\brief The largest distance between the begin positions of the first and the second strobe.
+    uint32_t window_max{50u};
+    //!\brief The value that the hash values are XORed with to randomise the order.
+    uint64_t seed{0x8F'3F'73'B5'CF'1C'9A'DE};
+};
+
+/*!\brief Extracts the randstrobes of order 2 of sequences with their positions and strands into a caller-provided
+ *        buffer.
+ * \ingroup search_kmer_index
+ *
+ * \details
+ *
+ * A randstrobe of order 2 (Sahlin, 2021) consists of the k-mer at position `i`, the first strobe, and the k-mer at a
+ * position `j` in `[i + window_min, i + window_max]`, the second strobe, that minimises the XOR of the canonical hash
+ * values of both strobes. The smallest `j` wins ties. Towards the end of the sequence, the window is truncated; no
+ * randstrobe starts at positions `i` for which `i + window_min` is not the begin of a k-mer.
+ *
+ * The hash value of a randstrobe is the canonical hash value of the first strobe XORed with the canonical hash value
+ * of the second strobe rotated by one bit. The position and the strand are the ones of the first strobe.
+ *
+ * The canonical hash values of all k-mers are computed in one pass over the sequence. The second strobe is found with
+ * a minimum over the window, followed by a search for its first occurrence, both of which the compiler vectorises.
+ * The buffers are kept by the extractor, such that no memory is allocated once they are large enough; use one
+ * extractor per thread.
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+class strobemer_extractor
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    strobemer_extractor() = default;                                        //!< Defaulted.
+    strobemer_extractor(strobemer_extractor const &) = default;             //!< Defaulted.
+    strobemer_extractor(strobemer_extractor &&) = default;                  //!< Defaulted.
+    strobemer_extractor & operator=(strobemer_extractor const &) = default; //!< Defaulted.
+    strobemer_extractor & operator=(strobemer_extractor &&) = default;      //!< Defaulted.
+    ~strobemer_extractor() = default;                                       //!< Defaulted.
+
+    /*!\brief Constructs an extractor with the given parameters.
+     * \param[in] parameters The seqan3::strobemer_parameters.
+     * \throws std::invalid_argument if the strobes are empty or the window is empty.
+     */
+    explicit strobemer_extractor(strobemer_parameters const & parameters) : parameters{parameters}
+    {
+        if (parameters.strobe_size == 0u)
+            throw std::invalid_argument{"The size of the strobes must be greater than 0."};
+
+        if (parameters.window_min == 0u || parameters.window_min > parameters.window_max)
+            throw std::invalid_argument{"The window of the second strobe must satisfy 0 < window_min <= window_max."};
+    }
+    //!\}
+
+    /*!\brief Extracts the randstrobes of a sequence.
+     * \param[in] sequence The sequence; the reference type must model seqan3::nucleotide_alphabet.
+     * \param[out] seeds The randstrobes, ordered by position.
+     * \returns The number of randstrobes.
+     * \throws std::invalid_argument if `seeds` is too small or the sequence has more than 2^32 k-mers.
+     */
+    template <detail::seed_sequence sequence_t>
+    size_t operator()(sequence_t && sequence, std::span<kmer_seed> const seeds)
+    {
+        kmers.assign(std::forward<sequence_t>(sequence), ungapped{parameters.strobe_size}, parameters.seed);
+
+        size_t const kmer_count = kmers.hashes.size();
+        if (kmer_count <= parameters.window_min)
+            return 0u;
+
+        size_t const count = kmer_count - parameters.window_min;
+        if (count > seeds.size())
+            throw std::invalid_argument{"The seed buffer is too small."};
+
+        uint64_t const * const hashes = kmers.hashes.data();
+
+        for (size_t i = 0u; i < count; ++i)
+        {
+            uint64_t const first = hashes[i];
+            size_t const window_begin = i + parameters.window_min;
+            size_t const window_end = std::min<size_t>(i + parameters.window_max + 1u, kmer_count);
+
+            uint64_t minimum = std::numeric_limits<uint64_t>::max();
+            for (size_t j = window_begin; j < window_end; ++j)
+                minimum = std::min(minimum, first ^ hashes[j]);
+
+            size_t j = window_begin;
+            while ((first ^ hashes[j]) != minimum)
+                ++j;
+
+            seeds[i] = kmers.seed_at(i);
+            seeds[i].hash = first ^ std::rotl(hashes[j], 1);
+        }
+
+        return count;
+    }
+
+    /*!\brief Extracts the randstrobes of all sequences of a collection, e.g. a seqan3::concatenated_sequences.
+     * \param[in] sequences The sequences.
+     * \param[out] seeds The randstrobes of all sequences.
+     * \param[out] seed_offsets The randstrobes of sequence `i` are `seeds[seed_offsets[i], seed_offsets[i + 1])`;
+     *                          must provide space for one more offset than there are sequences.
+     * \returns The total number of randstrobes.
+     * \throws std::invalid_argument if `seeds` or `seed_offsets` is too small.
+     */
+    template <detail::seed_sequence_collection sequences_t>
+    size_t operator()(sequences_t && sequences, std::span<kmer_seed> const seeds, std::span<size_t> const seed_offsets)
+    {
+        return detail::extract_seed_collection(*this, std::forward<sequences_t>(sequences), seeds, seed_offsets);
+    }
+
+private:
+    //!\brief The parameters.
+    strobemer_parameters parameters{};
+    //!\brief The hash values of the k-mers of the current sequence.
+    detail::canonical_kmer_hashes kmers{};
+};
+
+} // namespace seqan3
@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <seqan3/search/views/canonical_kmer_hash.hpp>
 #include <seqan3/search/views/kmer_hash.hpp>
 #include <seqan3/search/views/minimiser.hpp>
 #include <seqan3/search/views/minimiser_hash.hpp>
@@ -0,0 +1,692 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::views::canonical_kmer_hash.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/core/range/detail/adaptor_from_functor.hpp>
+#include <seqan3/core/range/type_traits.hpp>
+#include <seqan3/search/kmer_index/shape.hpp>
+#include <seqan3/utility/detail/bit_packing.hpp>
+#include <seqan3/utility/detail/integer_traits.hpp>
+#include <seqan3/utility/detail/type_name_as_string.hpp>
+#include <seqan3/utility/math.hpp>
+#include <seqan3/utility/range/concept.hpp>
+
+namespace seqan3::detail
+{
+// ---------------------------------------------------------------------------------------------------------------------
+// canonical_kmer_hash_view class
+// ---------------------------------------------------------------------------------------------------------------------
+
+/*!\brief The type returned by seqan3::views::canonical_kmer_hash.
+ * \tparam urng_t The type of the underlying range, must model std::ranges::input_range, the reference type must model
+ *                seqan3::nucleotide_alphabet.
+ * \implements std::ranges::view
+ * \implements std::ranges::input_range
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * Note that most members of this class are generated by std::ranges::view_interface which is not yet documented here.
+ */
+template <std::ranges::view urng_t>
+class canonical_kmer_hash_view : public std::ranges::view_interface<canonical_kmer_hash_view<urng_t>>
+{
+private:
+    static_assert(std::ranges::input_range<urng_t>, "The canonical_kmer_hash_view only works on input_ranges.");
+    static_assert(nucleotide_alphabet<std::ranges::range_reference_t<urng_t>>,
+                  "The reference type of the underlying range must model seqan3::nucleotide_alphabet.");
+
+    //!\brief The alphabet type of the underlying range.
+    using alphabet_t = std::remove_cvref_t<std::ranges::range_value_t<urng_t>>;
+
+    //!\brief The alphabet size.
+    static constexpr size_t sigma{alphabet_size<alphabet_t>};
+
+    //!\brief The number of bits of a rank in the windows.
+    static constexpr size_t bits_per_rank{ceil_log2(sigma)};
+
+    //!\brief Whether the hash values can be extracted from the windows with bit operations.
+    static constexpr bool sigma_is_power_of_two{std::has_single_bit(sigma)};
+
+    //!\brief The rank of the complement of every rank.
+    static constexpr std::array<uint8_t, sigma> complement_rank = []()
+    {
+        std::array<uint8_t, sigma> ranks{};
+        for (size_t rank = 0; rank < sigma; ++rank)
+            ranks[rank] = seqan3::to_rank(seqan3::complement(assign_rank_to(rank, alphabet_t{})));
+        return ranks;
+    }();
+
+    /*!\brief The values that are needed to hash a k-mer; shared by all iterators of the view.
+     *
+     * \details
+     *
+     * Position `i` of the shape corresponds to the field `size - 1 - i` of the windows of the iterator, i.e. to the
+     * bits `[(size - 1 - i) * bits_per_rank, (size - i) * bits_per_rank)`. The last position of the shape is always
+     * hashed, like in seqan3::views::kmer_hash.
+     */
+    struct hash_parameters
+    {
+        //!\brief The bits of the lower 64 bits of a window that belong to a position of the shape.
+        uint64_t shape_mask_low{0};
+        //!\brief The bits of the upper 64 bits of a window that belong to a position of the shape.
+        uint64_t shape_mask_high{0};
+        //!\brief The factor of the first position of an ungapped shape, i.e. `sigma^(size - 1)`.
+        uint64_t roll_factor{0};
+        //!\brief The value that all hash values are XORed with before the minimum is taken.
+        uint64_t seed{0};
+        //!\brief The size of the shape.
+        uint8_t size{0};
+        //!\brief Whether the shape is ungapped.
+        bool ungapped{true};
+    };
+
+    //!\brief The underlying range.
+    urng_t urange;
+
+    //!\brief The shape to use.
+    shape shape_;
+
+    //!\brief The precomputed values for hashing.
+    hash_parameters parameters{};
+
+    template <bool const_range>
+    class basic_iterator;
+
+    //!\brief The maximum shape count for the given alphabet.
+    static inline int max_shape_count = 64 / std::log2(sigma);
+
+    //!\brief Checks that the shape is not too long for the given alphabet and precomputes the hash parameters.
+    void initialise(uint64_t const seed)
+    {
+        if (shape_.count() > max_shape_count)
+        {
+            std::string message{"The shape is too long for the given alphabet.\n"};
+            message += "Alphabet: ";
+            message += detail::type_name_as_string<alphabet_t>;
+            message += "\nMaximum shape count: ";
+            message += std::to_string(max_shape_count);
+            message += "\nGiven shape count: ";
+            message += std::to_string(shape_.count());
+            throw std::invalid_argument{message};
+        }
+
+        if (shape_.size() * bits_per_rank > 128u)
+        {
+            throw std::invalid_argument{"The size of the shape times " + std::to_string(bits_per_rank)
+                                        + " bits per letter must not exceed 128 bits for canonical hashing."};
+        }
+
+        parameters.seed = seed;
+        parameters.size = shape_.size();
+        parameters.ungapped = shape_.all();
+
+        if (parameters.ungapped)
+            parameters.roll_factor = pow(sigma, shape_.size() - 1u);
+
+        for (size_t i{0}; i < shape_.size(); ++i)
+        {
+            if (!shape_[i] && i + 1u < shape_.size())
+                continue;
+
+            size_t const bit = (shape_.size() - 1u - i) * bits_per_rank;
+            uint64_t const field = field_mask<bits_per_rank>;
+            if (bit < 64u)
+                parameters.shape_mask_low |= field << bit;
+            if (bit + bits_per_rank > 64u)
+                parameters.shape_mask_high |= (bit < 64u) ? field >> (64u - bit) : field << (bit - 64u);
+        }
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    canonical_kmer_hash_view()
+        requires std::default_initializable<urng_t>
+    = default;                                                                            //!< Defaulted.
+    canonical_kmer_hash_view(canonical_kmer_hash_view const & rhs) = default;             //!< Defaulted.
+    canonical_kmer_hash_view(canonical_kmer_hash_view && rhs) = default;                  //!< Defaulted.
+    canonical_kmer_hash_view & operator=(canonical_kmer_hash_view const & rhs) = default; //!< Defaulted.
+    canonical_kmer_hash_view & operator=(canonical_kmer_hash_view && rhs) = default;      //!< Defaulted.
+    ~canonical_kmer_hash_view() = default;                                                //!< Defaulted.
+
+    /*!\brief Construct from a view, a given shape and a seed.
+     * \param[in] urange_ The underlying range.
+     * \param[in] s_      The seqan3::shape to use for hashing.
+     * \param[in] seed    The value that the hash values of both strands are XORed with before the minimum is taken.
+     * \throws std::invalid_argument if hashes resulting from the shape/alphabet combination cannot be represented in
+     *         `uint64_t`, i.e. \f$s>\frac{64}{\log_2\sigma}\f$ with shape size \f$s\f$ and alphabet size \f$\sigma\f$,
+     *         or if the span of the shape exceeds 128 bits.
+     */
+    explicit canonical_kmer_hash_view(urng_t urange_, shape const & s_, uint64_t const seed = 0u) :
+        urange{std::move(urange_)},
+        shape_{s_}
+    {
+        initialise(seed);
+    }
+
+    /*!\brief Construct from a non-view that can be view-wrapped, a given shape and a seed.
+     * \param[in] urange_ The underlying range.
+     * \param[in] s_      The seqan3::shape to use for hashing.
+     * \param[in] seed    The value that the hash values of both strands are XORed with before the minimum is taken.
+     * \throws std::invalid_argument if hashes resulting from the shape/alphabet combination cannot be represented in
+     *         `uint64_t`, i.e. \f$s>\frac{64}{\log_2\sigma}\f$ with shape size \f$s\f$ and alphabet size \f$\sigma\f$,
+     *         or if the span of the shape exceeds 128 bits.
+     */
+    template <typename rng_t>
+        requires (!std::same_as<std::remove_cvref_t<rng_t>, canonical_kmer_hash_view>)
+                  && std::ranges::viewable_range<rng_t>
+                  && std::constructible_from<urng_t, std::ranges::ref_view<std::remove_reference_t<rng_t>>>
+    explicit canonical_kmer_hash_view(rng_t && urange_, shape const & s_, uint64_t const seed = 0u) :
+        urange{std::views::all(std::forward<rng_t>(urange_))},
+        shape_{s_}
+    {
+        initialise(seed);
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    /*!\brief Returns an iterator to the first element of the range.
+     * \returns Iterator to the first element.
+     *
+     * \details
+     *
+     * The first k-mer is read from the underlying range.
+     *
+     * ### Complexity
+     *
+     * Linear in size of shape.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    auto begin() noexcept
+    {
+        return basic_iterator<false>{std::ranges::begin(urange), std::ranges::end(urange), parameters};
+    }
+
+    //!\copydoc begin()
+    auto begin() const noexcept
+        requires const_iterable_range<urng_t>
+    {
+        return basic_iterator<true>{std::ranges::begin(urange), std::ranges::end(urange), parameters};
+    }
+
+    /*!\brief Returns a sentinel that marks the end of the range.
+     * \returns std::default_sentinel.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    std::default_sentinel_t end() const noexcept
+    {
+        return std::default_sentinel;
+    }
+    //!\}
+
+    /*!\brief Returns the size of the range, if the underlying range is a std::ranges::sized_range.
+     * \returns Size of range.
+     */
+    auto size()
+        requires std::ranges::sized_range<urng_t>
+    {
+        using size_type = std::ranges::range_size_t<urng_t>;
+        return std::max<size_type>(std::ranges::size(urange) + 1, shape_.size()) - shape_.size();
+    }
+
+    //!\copydoc size()
+    auto size() const
+        requires std::ranges::sized_range<urng_t const>
+    {
+        using size_type = std::ranges::range_size_t<urng_t const>;
+        return std::max<size_type>(std::ranges::size(urange) + 1, shape_.size()) - shape_.size();
+    }
+};
+
+/*!\brief Iterator for calculating canonical hash values via a given seqan3::shape.
+ * \tparam urng_t Type of the text. Must model std::ranges::input_range. Reference type must model
+ *                seqan3::nucleotide_alphabet.
+ *
+ * \details
+ *
+ * The iterator reads every letter of the text exactly once and keeps the ranks of the current k-mer in a window of at
+ * most 128 bits, once in the order of the text and once complemented in reverse order. The hash value of the
+ * reverse complement is therefore updated together with the hash value of the k-mer:
+ *
+ *   * If the alphabet size is a power of two, both hash values are extracted from the windows with
+ *     seqan3::detail::extract_bits, i.e. a `pext` instruction per 64 bits.
+ *   * Otherwise, the hash values of ungapped shapes are rolled and the ones of gapped shapes are recomputed from the
+ *     windows.
+ *
+ * \experimentalapi
+ */
+template <std::ranges::view urng_t>
+template <bool const_range>
+class canonical_kmer_hash_view<urng_t>::basic_iterator
+{
+private:
+    //!\brief The iterator type of the underlying range.
+    using it_t = maybe_const_iterator_t<const_range, urng_t>;
+    //!\brief The sentinel type of the underlying range.
+    using sentinel_t = maybe_const_sentinel_t<const_range, urng_t>;
+
+    template <bool other_const_range>
+    friend class basic_iterator;
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Type for distances between iterators.
+    using difference_type = std::iter_difference_t<it_t>;
+    //!\brief Value type of this iterator.
+    using value_type = size_t;
+    //!\brief The pointer type.
+    using pointer = void;
+    //!\brief Reference to `value_type`.
+    using reference = value_type;
+    //!\brief Tag this class as a forward iterator if the underlying iterator is one, as an input iterator otherwise.
+    using iterator_concept =
+        std::conditional_t<std::forward_iterator<it_t>, std::forward_iterator_tag, std::input_iterator_tag>;
+    //!\brief Same as iterator_concept.
+    using iterator_category = iterator_concept;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    basic_iterator()
+        requires std::default_initializable<it_t>
+    = default;                                                    //!< Defaulted.
+    basic_iterator(basic_iterator const &) = default;             //!< Defaulted.
+    basic_iterator(basic_iterator &&) = default;                  //!< Defaulted.
+    basic_iterator & operator=(basic_iterator const &) = default; //!< Defaulted.
+    basic_iterator & operator=(basic_iterator &&) = default;      //!< Defaulted.
+    ~basic_iterator() = default;                                  //!< Defaulted.
+
+    //!\brief Allow iterator on a const range to be constructible from an iterator over a non-const range.
+    basic_iterator(basic_iterator<!const_range> const & it)
+        requires const_range
+        :
+        text_it{it.text_it},
+        text_end{it.text_end},
+        parameters{it.parameters},
+        forward_window{it.forward_window},
+        reverse_window{it.reverse_window},
+        forward_hash{it.forward_hash},
+        reverse_hash{it.reverse_hash},
+        at_end{it.at_end}
+    {}
+
+    /*!\brief Construct from the begin and end of the text and the hash parameters; reads the first k-mer.
+     * \param[in] it_start    Iterator pointing to the first position of the text.
+     * \param[in] it_end      Sentinel pointing to the end of the text.
+     * \param[in] parameters_ The hash parameters of the view.
+     */
+    basic_iterator(it_t it_start, sentinel_t it_end, hash_parameters const & parameters_) :
+        text_it{std::move(it_start)},
+        text_end{std::move(it_end)},
+        parameters{parameters_}
+    {
+        for (size_t i{0}; i < parameters.size; ++i)
+        {
+            if (text_it == text_end)
+            {
+                at_end = true;
+                return;
+            }
+
+            push_back(to_rank(*text_it));
+            ++text_it;
+        }
+
+        hash_full();
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Compare to the end of the range.
+    friend bool operator==(basic_iterator const & lhs, std::default_sentinel_t const &) noexcept
+    {
+        return lhs.at_end;
+    }
+
+    //!\brief Compare to another basic_iterator.
+    friend bool operator==(basic_iterator const & lhs, basic_iterator const & rhs) noexcept
+        requires std::forward_iterator<it_t>
+    {
+        return std::tie(lhs.text_it, lhs.at_end) == std::tie(rhs.text_it, rhs.at_end);
+    }
+    //!\}
+
+    //!\brief Pre-increment.
+    basic_iterator & operator++() noexcept
+    {
+        if (text_it == text_end)
+        {
+            at_end = true;
+            return *this;
+        }
+
+        hash_next(to_rank(*text_it));
+        ++text_it;
+        return *this;
+    }
+
+    //!\brief Post-increment.
+    basic_iterator operator++(int) noexcept
+        requires std::forward_iterator<it_t>
+    {
+        basic_iterator tmp{*this};
+        ++(*this);
+        return tmp;
+    }
+
+    //!\brief Post-increment for input iterators.
+    void operator++(int) noexcept
+        requires (!std::forward_iterator<it_t>)
+    {
+        ++(*this);
+    }
+
+    //!\brief Return the canonical hash value, i.e. the smaller hash value of the k-mer and its reverse complement.
+    value_type operator*() const noexcept
+    {
+        return std::min(forward_hash ^ parameters.seed, reverse_hash ^ parameters.seed);
+    }
+
+    //!\brief Whether the canonical hash value is the one of the reverse complement. False for palindromes.
+    bool is_reverse_complement() const noexcept
+    {
+        return (reverse_hash ^ parameters.seed) < (forward_hash ^ parameters.seed);
+    }
+
+    //!\brief Return the underlying iterator. It points behind the last letter of the current k-mer.
+    constexpr it_t const & base() const & noexcept
+    {
+        return text_it;
+    }
+
+    //!\brief Return the underlying iterator. It points behind the last letter of the current k-mer.
+    constexpr it_t base() &&
+    {
+        return std::move(text_it);
+    }
+
+private:
+    //!\brief 128 bits of packed ranks; the field `i` occupies the bits `[i * bits_per_rank, (i + 1) * bits_per_rank)`.
+    struct rank_window
+    {
+        //!\brief The lower 64 bits.
+        uint64_t low{0};
+        //!\brief The upper 64 bits.
+        uint64_t high{0};
+    };
+
+    //!\brief Iterator behind the last letter of the current k-mer.
+    it_t text_it{};
+    //!\brief The end of the text.
+    sentinel_t text_end{};
+    //!\brief The hash parameters of the view.
+    hash_parameters parameters{};
+    //!\brief The ranks of the k-mer; position `i` of the k-mer is stored in the field `size - 1 - i`.
+    rank_window forward_window{};
+    //!\brief The complemented ranks of the k-mer; position `i` of the k-mer is stored in the field `i`.
+    rank_window reverse_window{};
+    //!\brief The hash value of the k-mer.
+    uint64_t forward_hash{0};
+    //!\brief The hash value of the reverse complement of the k-mer.
+    uint64_t reverse_hash{0};
+    //!\brief Whether the iterator points to the end.
+    bool at_end{false};
+
+    //!\brief Returns the field `field` of a window.
+    static constexpr uint64_t read_field(rank_window const & window, size_t const field) noexcept
+    {
+        size_t const bit = field * bits_per_rank;
+        if (bit >= 64u)
+            return (window.high >> (bit - 64u)) & field_mask<bits_per_rank>;
+
+        uint64_t value = window.low >> bit;
+        if (bit + bits_per_rank > 64u)
+            value |= window.high << (64u - bit);
+        return value & field_mask<bits_per_rank>;
+    }
+
+    //!\brief Appends the rank of the next letter of the text to the windows.
+    void push_back(uint64_t const rank) noexcept
+    {
+        size_t const bit_count = parameters.size * bits_per_rank;
+
+        // Shift the rank into the lowest bits of the forward window and drop the bits above the k-mer.
+        forward_window.high = (forward_window.high << bits_per_rank) | (forward_window.low >> (64u - bits_per_rank));
+        forward_window.low = (forward_window.low << bits_per_rank) | rank;
+        if (bit_count <= 64u)
+        {
+            forward_window.high = 0u;
+            if (bit_count < 64u)
+                forward_window.low &= field_mask_of(bit_count);
+        }
+        else if (bit_count < 128u)
+        {
+            forward_window.high &= field_mask_of(bit_count - 64u);
+        }
+
+        // Shift the complemented rank into the highest field of the reverse window.
+        uint64_t const complemented = complement_rank[rank];
+        size_t const bit = bit_count - bits_per_rank;
+        reverse_window.low = (reverse_window.low >> bits_per_rank) | (reverse_window.high << (64u - bits_per_rank));
+        reverse_window.high >>= bits_per_rank;
+        if (bit < 64u)
+        {
+            reverse_window.low |= complemented << bit;
+            if (bit + bits_per_rank > 64u)
+                reverse_window.high |= complemented >> (64u - bit);
+        }
+        else
+        {
+            reverse_window.high |= complemented << (bit - 64u);
+        }
+    }
+
+    //!\brief Extracts the positions of the shape from a window of an alphabet whose size is a power of two.
+    uint64_t extract_hash(rank_window const & window) const noexcept
+    {
+        uint64_t hash = extract_bits(window.low, parameters.shape_mask_low);
+
+        if (parameters.shape_mask_high != 0u)
+            hash |= extract_bits(window.high, parameters.shape_mask_high) << std::popcount(parameters.shape_mask_low);
+
+        return hash;
+    }
+
+    //!\brief Computes the hash value of a window by looking at each position of the shape.
+    uint64_t horner_hash(rank_window const & window) const noexcept
+    {
+        uint64_t hash{0};
+
+        for (size_t field = parameters.size; field-- > 0u;)
+        {
+            size_t const bit = field * bits_per_rank;
+            uint64_t const & mask = (bit < 64u) ? parameters.shape_mask_low : parameters.shape_mask_high;
+
+            if ((mask >> (bit % 64u)) & 1u)
+                hash = hash * sigma + read_field(window, field);
+        }
+
+        return hash;
+    }
+
+    //!\brief Computes both hash values from the windows.
+    void hash_full() noexcept
+    {
+        if constexpr (sigma_is_power_of_two)
+        {
+            forward_hash = extract_hash(forward_window);
+            reverse_hash = extract_hash(reverse_window);
+        }
+        else
+        {
+            forward_hash = horner_hash(forward_window);
+            reverse_hash = horner_hash(reverse_window);
+        }
+    }
+
+    //!\brief Moves the k-mer by one letter and updates both hash values.
+    void hash_next(uint64_t const rank) noexcept
+    {
+        if constexpr (!sigma_is_power_of_two)
+        {
+            if (parameters.ungapped)
+            {
+                // The first letter of the k-mer leaves, its complement is the last letter of the reverse complement.
+                uint64_t const leaving = read_field(forward_window, parameters.size - 1u);
+                forward_hash = (forward_hash - leaving * parameters.roll_factor) * sigma + rank;
+                reverse_hash = (reverse_hash - complement_rank[leaving]) / sigma
+                             + complement_rank[rank] * parameters.roll_factor;
+                push_back(rank);
+                return;
+            }
+        }
+
+        push_back(rank);
+        hash_full();
+    }
+};
+
+//!\brief A deduction guide for the view class template.
+template <std::ranges::viewable_range rng_t>
+canonical_kmer_hash_view(rng_t &&, shape const & shape_) -> canonical_kmer_hash_view<std::views::all_t<rng_t>>;
+
+//!\brief A deduction guide for the view class template.
+template <std::ranges::viewable_range rng_t>
+canonical_kmer_hash_view(rng_t &&,
+                         shape const & shape_,
+                         uint64_t const seed) -> canonical_kmer_hash_view<std::views::all_t<rng_t>>;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// canonical_kmer_hash_fn (adaptor definition)
+// ---------------------------------------------------------------------------------------------------------------------
+
+//!\brief views::canonical_kmer_hash's range adaptor object type (non-closure).
+//!\ingroup search_views
+struct canonical_kmer_hash_fn
+{
+    //!\brief Store the shape and return a range adaptor closure object.
+    constexpr auto operator()(shape const & shape_) const
+    {
+        return adaptor_from_functor{*this, shape_};
+    }
+
+    /*!\brief            Call the view's constructor with the underlying view and a seqan3::shape as argument.
+     * \param[in] urange The input range to process. Must model std::ranges::viewable_range and the reference type
+     *                   of the range must model seqan3::nucleotide_alphabet.
+     * \param[in] shape_ The seqan3::shape to use for hashing.
+     * \throws std::invalid_argument if resulting hash values would be too big for a 64 bit integer.
+     * \returns          A range of converted elements.
+     */
+    template <std::ranges::range urng_t>
+    constexpr auto operator()(urng_t && urange, shape const & shape_) const
+    {
+        static_assert(std::ranges::viewable_range<urng_t>,
+                      "The range parameter to views::canonical_kmer_hash cannot be a temporary of a non-view range.");
+        static_assert(std::ranges::input_range<urng_t>,
+                      "The range parameter to views::canonical_kmer_hash must model std::ranges::input_range.");
+        static_assert(nucleotide_alphabet<std::ranges::range_reference_t<urng_t>>,
+                      "The range parameter to views::canonical_kmer_hash must be over elements of "
+                      "seqan3::nucleotide_alphabet.");
+
+        return canonical_kmer_hash_view{std::forward<urng_t>(urange), shape_};
+    }
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3::views
+{
+/*!\brief               Computes the canonical hash value for each position of a range via a given shape.
+ * \tparam urng_t       The type of the range being processed. See below for requirements. [template parameter is
+ *                      omitted in pipe notation]
+ * \param[in] urange    The range being processed. [parameter is omitted in pipe notation]
+ * \param[in] shape     The seqan3::shape that determines how to compute the hash value.
+ * \returns             A range of std::size_t where each value is the canonical hash of the resp. k-mer.
+ *                      See below for the properties of the returned range.
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * The canonical hash value of a k-mer is the smaller one of the hash value of the k-mer and the hash value of its
+ * reverse complement, both computed like seqan3::views::kmer_hash. It is the same for both strands of a sequence.
+ * The result equals the element-wise minimum of `urange | seqan3::views::kmer_hash(shape)` and
+ * `urange | seqan3::views::complement | std::views::reverse | seqan3::views::kmer_hash(shape) | std::views::reverse`,
+ * but the text is read only once and does not need to be bidirectional, e.g. reads can be hashed while they are
+ * streamed.
+ *
+ * \attention
+ * For the alphabet size \f$\sigma\f$ of the alphabet of `urange` and the number of 1s \f$s\f$ of `shape` it must hold
+ * that \f$s \le \frac{64}{\log_2\sigma}\f$, i.e. hashes resulting from the shape/alphabet combination can be
+ * represented in an `uint64_t`. Additionally, the size of the shape times \f$\lceil\log_2\sigma\rceil\f$ must not
+ * exceed 128.
+ *
+ * ### View properties
+ *
+ * | Concepts and traits              | `urng_t` (underlying range type)   | `rrng_t` (returned range type)   |
+ * |----------------------------------|:----------------------------------:|:--------------------------------:|
+ * | std::ranges::input_range         | *required*                         | *preserved*                      |
+ * | std::ranges::forward_range       |                                    | *preserved*                      |
+ * | std::ranges::bidirectional_range |                                    | *lost*                           |
+ * | std::ranges::random_access_range |                                    | *lost*                           |
+ * | std::ranges::contiguous_range    |                                    | *lost*                           |
+ * |                                  |                                    |                                  |
+ * | std::ranges::viewable_range      | *required*                         | *guaranteed*                     |
+ * | std::ranges::view                |                                    | *guaranteed*                     |
+ * | std::ranges::sized_range         |                                    | *preserved*                      |
+ * | std::ranges::common_range        |                                    | *lost*                           |
+ * | std::ranges::output_range        |                                    | *lost*                           |
+ * | seqan3::const_iterable_range     |                                    | *preserved*                      |
+ * |                                  |                                    |                                  |
+ * | std::ranges::range_reference_t   | seqan3::nucleotide_alphabet        | std::size_t                      |
+ *
+ * See the \link views views submodule documentation \endlink for detailed descriptions of the view properties.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/views/canonical_kmer_hash.cpp
+ *
+ * \hideinitializer
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+inline constexpr auto canonical_kmer_hash = detail::canonical_kmer_hash_fn{};
+
+} // namespace seqan3::views
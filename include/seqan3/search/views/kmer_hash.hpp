@@ -12,6 +12,7 @@
 #include <seqan3/alphabet/concept.hpp>
 #include <seqan3/alphabet/range/hash.hpp>
 #include <seqan3/search/kmer_index/shape.hpp>
+#include <seqan3/utility/detail/bit_packing.hpp>
 #include <seqan3/utility/math.hpp>
 
 namespace seqan3::detail
@@ -49,6 +50,27 @@ private:
     template <bool const_range>
     class basic_iterator;
 
+    /*!\brief The packed ranks of `[text_left, text_right)` that are used to hash gapped shapes.
+     *
+     * \details
+     *
+     * The rank at `text_right - 1` of the seqan3::detail::kmer_hash_view::basic_iterator occupies the lowest bits of
+     * `low`, the bits above 64 are stored in `high`. The masks select the bits of the positions of the shape.
+     */
+    struct packed_window
+    {
+        //!\brief The lower 64 bits of the window.
+        uint64_t low{0};
+        //!\brief The upper 64 bits of the window.
+        uint64_t high{0};
+        //!\brief The bits of `low` that belong to a position of the shape.
+        uint64_t shape_mask_low{0};
+        //!\brief The bits of `high` that belong to a position of the shape.
+        uint64_t shape_mask_high{0};
+        //!\brief The number of bits of the window; 0 if the window is not used.
+        uint8_t bit_count{0};
+    };
+
     //!\brief The maximum shape count for the given alphabet.
     static inline int max_shape_count = 64 / std::log2(alphabet_size<std::ranges::range_reference_t<urng_t>>);
 
@@ -222,6 +244,12 @@ public:
  * To avoid dereferencing the sentinel when iterating, the basic_iterator computes the hash value up until
  * the second to last position and performs the addition of the last position upon
  * access (\ref operator* and \ref operator[]).
+ *
+ * Ungapped shapes are hashed with a rolling hash. For gapped shapes over alphabets whose size is a power of two, the
+ * ranks of the last `shape.size() - 1` positions are kept in a window of at most 128 bits with \f$\log_2\sigma\f$ bits
+ * per rank. Every step shifts one rank into the window and extracts the positions of the shape with a `pext`
+ * instruction per 64 bits (see seqan3::detail::extract_bits), so only one letter of the text is accessed per step.
+ * Other gapped shapes are hashed by looking at every position.
  */
 template <std::ranges::view urng_t>
 template <bool const_range>
@@ -271,6 +299,7 @@ public:
         :
         hash_value{std::move(it.hash_value)},
         roll_factor{std::move(it.roll_factor)},
+        window{std::move(it.window)},
         shape_{std::move(it.shape_)},
         text_left{std::move(it.text_left)},
         text_right{std::move(it.text_right)}
@@ -301,7 +330,10 @@ public:
         // distance(text_left, text_right) = 2
         if (shape_.size() <= std::ranges::distance(text_left, text_right) + 1)
         {
-            roll_factor = pow(sigma, static_cast<size_t>(std::ranges::size(shape_) - 1));
+            // Only ungapped shapes use the roll factor; the span of gapped shapes may exceed 64 bits.
+            if (shape_.all())
+                roll_factor = pow(sigma, static_cast<size_t>(std::ranges::size(shape_) - 1));
+            init_window();
             hash_full();
         }
     }
@@ -344,7 +376,10 @@ public:
         // distance(text_left, text_right) = 2
         if (shape_.size() <= std::ranges::distance(text_left, it_end) + 1)
         {
-            roll_factor = pow(sigma, static_cast<size_t>(std::ranges::size(shape_) - 1));
+            // Only ungapped shapes use the roll factor; the span of gapped shapes may exceed 64 bits.
+            if (shape_.all())
+                roll_factor = pow(sigma, static_cast<size_t>(std::ranges::size(shape_) - 1));
+            init_window();
             hash_full();
         }
 
@@ -569,6 +604,14 @@ private:
     //!\brief The factor for the left most position of the hash value.
     size_t roll_factor{0};
 
+    //!\brief The number of bits of a rank if the alphabet size is a power of two, 0 otherwise.
+    static constexpr size_t bits_per_rank = std::has_single_bit(static_cast<size_t>(sigma))
+                                              ? static_cast<size_t>(std::countr_zero(static_cast<size_t>(sigma)))
+                                              : 0u;
+
+    //!\brief The window for gapped shapes.
+    packed_window window{};
+
     //!\brief The shape to use.
     shape shape_;
 
@@ -581,7 +624,11 @@ private:
     //!\brief Increments iterator by 1.
     void hash_forward()
     {
-        if (shape_.all())
+        if (window.bit_count > 0u)
+        {
+            window_roll_forward();
+        }
+        else if (shape_.all())
         {
             hash_roll_forward();
         }
@@ -609,7 +656,11 @@ private:
     void hash_backward()
         requires std::bidirectional_iterator<it_t>
     {
-        if (shape_.all())
+        if (window.bit_count > 0u)
+        {
+            window_roll_backward();
+        }
+        else if (shape_.all())
         {
             hash_roll_backward();
         }
@@ -636,6 +687,21 @@ private:
         text_right = text_left;
         hash_value = 0;
 
+        if (window.bit_count > 0u)
+        {
+            window.low = 0;
+            window.high = 0;
+
+            for (size_t i{0}; i < shape_.size() - 1u; ++i)
+            {
+                window_push_back(to_rank(*text_right));
+                std::ranges::advance(text_right, 1);
+            }
+
+            hash_window();
+            return;
+        }
+
         for (size_t i{0}; i < shape_.size() - 1u; ++i)
         {
             hash_value += shape_[i] * to_rank(*text_right);
@@ -644,6 +710,104 @@ private:
         }
     }
 
+    //!\brief Enables the window for gapped shapes over alphabets whose size is a power of two if it fits 128 bits.
+    void init_window()
+    {
+        if constexpr (bits_per_rank > 0u)
+        {
+            size_t const bit_count = (shape_.size() - 1u) * bits_per_rank;
+
+            if (shape_.all() || bit_count > 128u)
+                return;
+
+            window = packed_window{};
+            window.bit_count = bit_count;
+
+            // Position i of the shape is stored in the field shape_.size() - 2 - i of the window.
+            for (size_t i{0}; i < shape_.size() - 1u; ++i)
+            {
+                if (!shape_[i])
+                    continue;
+
+                size_t const bit = (shape_.size() - 2u - i) * bits_per_rank;
+                uint64_t & mask = (bit < 64u) ? window.shape_mask_low : window.shape_mask_high;
+                mask |= field_mask<bits_per_rank> << (bit % 64u);
+            }
+        }
+    }
+
+    //!\brief Shifts a rank into the lowest bits of the window and drops the rank in the highest bits.
+    void window_push_back(uint64_t const rank) noexcept
+    {
+        if constexpr (bits_per_rank > 0u)
+        {
+            window.high = (window.high << bits_per_rank) | (window.low >> (64u - bits_per_rank));
+            window.low = (window.low << bits_per_rank) | rank;
+
+            if (window.bit_count <= 64u)
+            {
+                window.high = 0u;
+                if (window.bit_count < 64u)
+                    window.low &= field_mask_of(window.bit_count);
+            }
+            else if (window.bit_count < 128u)
+            {
+                window.high &= field_mask_of(window.bit_count - 64u);
+            }
+        }
+    }
+
+    //!\brief Shifts a rank into the highest bits of the window and drops the rank in the lowest bits.
+    void window_push_front(uint64_t const rank) noexcept
+    {
+        if constexpr (bits_per_rank > 0u)
+        {
+            window.low = (window.low >> bits_per_rank) | (window.high << (64u - bits_per_rank));
+            window.high >>= bits_per_rank;
+
+            size_t const bit = window.bit_count - bits_per_rank;
+            if (bit < 64u)
+                window.low |= rank << bit;
+            else
+                window.high |= rank << (bit - 64u);
+        }
+    }
+
+    //!\brief Extracts the positions of the shape from the window.
+    void hash_window() noexcept
+    {
+        uint64_t hash = extract_bits(window.low, window.shape_mask_low);
+
+        if (window.shape_mask_high != 0u)
+            hash |= extract_bits(window.high, window.shape_mask_high) << std::popcount(window.shape_mask_low);
+
+        // The last position of the shape is added on access.
+        hash_value = hash << bits_per_rank;
+    }
+
+    //!\brief Calculates the next hash value by shifting the next rank into the window.
+    void window_roll_forward()
+    {
+        window_push_back(to_rank(*text_right));
+        hash_window();
+
+        std::ranges::advance(text_left, 1);
+        std::ranges::advance(text_right, 1);
+    }
+
+    /*!\brief Calculates the previous hash value by shifting the previous rank into the window.
+     * \attention This function is only available if `it_t` models std::bidirectional_iterator.
+     */
+    void window_roll_backward()
+        requires std::bidirectional_iterator<it_t>
+    {
+        std::ranges::advance(text_left, -1);
+        std::ranges::advance(text_right, -1);
+
+        window_push_front(to_rank(*text_left));
+        hash_window();
+    }
+
     //!\brief Calculates the next hash value via rolling hash.
     void hash_roll_forward()
     {
@@ -10,11 +10,11 @@
 #pragma once
 
 #include <algorithm>
-#include <deque>
 
 #include <seqan3/core/detail/empty_type.hpp>
 #include <seqan3/core/range/detail/adaptor_from_functor.hpp>
 #include <seqan3/core/range/type_traits.hpp>
+#include <seqan3/search/detail/window_minimum.hpp>
 #include <seqan3/utility/range/concept.hpp>
 #include <seqan3/utility/type_traits/lazy_conditional.hpp>
 
@@ -265,6 +265,7 @@ public:
         requires const_range
         :
         minimiser_value{std::move(it.minimiser_value)},
+        minimiser_position{it.minimiser_position},
         urng1_iterator{std::move(it.urng1_iterator)},
         urng1_sentinel{std::move(it.urng1_sentinel)},
         urng2_iterator{std::move(it.urng2_iterator)},
@@ -306,8 +307,8 @@ public:
     //!\brief Compare to another basic_iterator.
     friend bool operator==(basic_iterator const & lhs, basic_iterator const & rhs)
     {
-        return (lhs.urng1_iterator == rhs.urng1_iterator) && (rhs.urng2_iterator == rhs.urng2_iterator)
-            && (lhs.window_values.size() == rhs.window_values.size());
+        return (lhs.urng1_iterator == rhs.urng1_iterator) && (lhs.urng2_iterator == rhs.urng2_iterator)
+            && (lhs.window_values.window_size() == rhs.window_values.window_size());
     }
 
     //!\brief Compare to another basic_iterator.
@@ -378,8 +379,8 @@ private:
     //!\brief The minimiser value.
     value_type minimiser_value{};
 
-    //!\brief The offset relative to the beginning of the window where the minimizer value is found.
-    size_t minimiser_position_offset{};
+    //!\brief The position of the minimiser value, counted from the beginning of the underlying range.
+    size_t minimiser_position{};
 
     //!\brief Iterator to the rightmost value of one window.
     urng1_iterator_t urng1_iterator{};
@@ -388,8 +389,15 @@ private:
     //!\brief Iterator to the rightmost value of one window of the second range.
     urng2_iterator_t urng2_iterator{};
 
-    //!\brief Stored values per window. It is necessary to store them, because a shift can remove the current minimiser.
-    std::deque<value_type> window_values{};
+    /*!\brief The candidates for the minimiser of the current and the following windows.
+     *
+     * \details
+     *
+     * A shift can remove the current minimiser, so the values of the window are needed to find the next one.
+     * seqan3::detail::window_minimum stores them in memory that is allocated once and finds the minimum of every
+     * window in amortised constant time.
+     */
+    window_minimum<value_type> window_values{};
 
     //!\brief Increments iterator by 1.
     void next_unique_minimiser()
@@ -421,22 +429,24 @@ private:
         if (window_size == 0u)
             return;
 
+        window_values = window_minimum<value_type>{window_size};
+
         for (size_t i = 0u; i < window_size - 1u; ++i)
         {
-            window_values.push_back(window_value());
+            window_values.push(window_value());
             advance_window();
         }
-        window_values.push_back(window_value());
-        auto minimiser_it = std::ranges::min_element(window_values, std::less_equal<value_type>{});
-        minimiser_value = *minimiser_it;
-        minimiser_position_offset = std::distance(std::begin(window_values), minimiser_it);
+        window_values.push(window_value());
+        minimiser_value = window_values.minimum();
+        minimiser_position = window_values.minimum_position();
     }
 
     /*!\brief Calculates the next minimiser value.
      * \returns True, if new minimiser is found or end is reached. Otherwise returns false.
      * \details
      * For the following windows, we remove the first window value (is now not in window_values) and add the new
-     * value that results from the window shifting.
+     * value that results from the window shifting. If the current minimiser leaves the window, the new minimiser is
+     * the rightmost minimum of the window.
      */
     bool next_minimiser()
     {
@@ -445,26 +455,24 @@ private:
             return true;
 
         value_type const new_value = window_value();
+        size_t const new_position = window_values.next_position();
 
-        window_values.pop_front();
-        window_values.push_back(new_value);
+        window_values.push(new_value);
 
-        if (minimiser_position_offset == 0)
+        if (minimiser_position + window_values.window_size() == new_position)
         {
-            auto minimiser_it = std::ranges::min_element(window_values, std::less_equal<value_type>{});
-            minimiser_value = *minimiser_it;
-            minimiser_position_offset = std::distance(std::begin(window_values), minimiser_it);
+            minimiser_value = window_values.minimum();
+            minimiser_position = window_values.minimum_position();
             return true;
         }
 
         if (new_value < minimiser_value)
         {
             minimiser_value = new_value;
-            minimiser_position_offset = window_values.size() - 1;
+            minimiser_position = new_position;
             return true;
         }
 
-        --minimiser_position_offset;
         return false;
     }
 };
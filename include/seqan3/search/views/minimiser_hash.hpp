@@ -9,9 +9,8 @@
 
 #pragma once
 
-#include <seqan3/alphabet/views/complement.hpp>
 #include <seqan3/core/detail/strong_type.hpp>
-#include <seqan3/search/views/kmer_hash.hpp>
+#include <seqan3/search/views/canonical_kmer_hash.hpp>
 #include <seqan3/search/views/minimiser.hpp>
 
 namespace seqan3
@@ -62,7 +61,7 @@ struct minimiser_hash_fn
 
     /*!\brief Call the view's constructor with the underlying view, a seqan3::shape and a window size as argument.
      * \param[in] urange      The input range to process. Must model std::ranges::viewable_range and the reference type
-     *                        of the range must model seqan3::semialphabet.
+     *                        of the range must model seqan3::nucleotide_alphabet.
      * \param[in] shape       The seqan3::shape to use for hashing.
      * \param[in] window_size The size of the window.
      * \param[in] seed        The seed to use.
@@ -79,29 +78,17 @@ struct minimiser_hash_fn
                       "The range parameter to views::minimiser_hash cannot be a temporary of a non-view range.");
         static_assert(std::ranges::forward_range<urng_t>,
                       "The range parameter to views::minimiser_hash must model std::ranges::forward_range.");
-        static_assert(semialphabet<std::ranges::range_reference_t<urng_t>>,
-                      "The range parameter to views::minimiser_hash must be over elements of seqan3::semialphabet.");
+        static_assert(nucleotide_alphabet<std::ranges::range_reference_t<urng_t>>,
+                      "The range parameter to views::minimiser_hash must be over elements of "
+                      "seqan3::nucleotide_alphabet.");
 
         if (shape.size() > window_size.get())
             throw std::invalid_argument{"The size of the shape cannot be greater than the window size."};
 
-        auto forward_strand = std::forward<urng_t>(urange) | seqan3::views::kmer_hash(shape)
-                            | std::views::transform(
-                                  [seed](uint64_t i)
-                                  {
-                                      return i ^ seed.get();
-                                  });
-
-        auto reverse_strand = std::forward<urng_t>(urange) | seqan3::views::complement | std::views::reverse
-                            | seqan3::views::kmer_hash(shape)
-                            | std::views::transform(
-                                  [seed](uint64_t i)
-                                  {
-                                      return i ^ seed.get();
-                                  })
-                            | std::views::reverse;
-
-        return seqan3::detail::minimiser_view(forward_strand, reverse_strand, window_size.get() - shape.size() + 1);
+        // Hashes both strands in a single pass and returns the smaller hash value after applying the seed.
+        auto canonical_hashes = canonical_kmer_hash_view{std::forward<urng_t>(urange), shape, seed.get()};
+
+        return seqan3::detail::minimiser_view(std::move(canonical_hashes), window_size.get() - shape.size() + 1);
     }
 };
 
@@ -175,7 +162,7 @@ namespace seqan3::views
  * | std::ranges::output_range        |                                    | *lost*                           |
  * | seqan3::const_iterable_range     |                                    | *preserved*                      |
  * |                                  |                                    |                                  |
- * | std::ranges::range_reference_t   | seqan3::semialphabet               | std::size_t                      |
+ * | std::ranges::range_reference_t   | seqan3::nucleotide_alphabet        | std::size_t                      |
  *
  * See the \link views views submodule documentation \endlink for detailed descriptions of the view properties.
  *
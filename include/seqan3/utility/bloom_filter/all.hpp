@@ -14,3 +14,4 @@
 #pragma once
 
 #include <seqan3/utility/bloom_filter/bloom_filter.hpp>
+#include <seqan3/utility/bloom_filter/counting_bloom_filter.hpp>
@@ -9,6 +9,9 @@
 
 #pragma once
 
+#include <array>
+#include <span>
+
 #include <seqan3/contrib/sdsl-lite.hpp>
 #include <seqan3/core/concept/cereal.hpp>
 //Todo: When removing search/dream_index/interleaved_bloom_filter.hpp, the contents of the following header can be
@@ -20,6 +23,7 @@ namespace seqan3
 
 /*!\brief The Bloom Filter. A data structure that efficiently answers set-membership queries.
  * \tparam data_layout_mode_ Indicates whether the underlying data type is compressed. See seqan3::data_layout.
+ * \tparam layout_ Indicates where the bits of a value are stored. See seqan3::bloom_filter_layout.
  * \implements seqan3::cerealisable
  * \ingroup utility_bloom_filter
  *
@@ -65,6 +69,34 @@ namespace seqan3
  * Filter provides a lighter data structure and a more simple interface (for example, the use of agents for determining
  * and counting membership is not necessary in this case).
  *
+ * ### Blocked layout
+ *
+ * With the default seqan3::bloom_filter_layout::standard, the `h` hash functions address positions in the whole
+ * bitvector, so a query for a value that is not in the cache may cause `h` cache misses. With
+ * seqan3::bloom_filter_layout::blocked, the bitvector is divided into blocks of 512 bits, i.e. 64 bytes or one cache
+ * line. A first hash function selects the block and all `h` bits of a value are set in this block. Hence, a query
+ * causes at most one cache miss. The size of a blocked Bloom Filter is rounded up to a multiple of 512 bits.
+ *
+ * Since the number of values per block varies, a blocked Bloom Filter has a higher false positive rate than a standard
+ * Bloom Filter of the same size. Let `m` be the size in bits, `n` the number of inserted values and `k` the number of
+ * hash functions. The false positive rate of the standard layout is about \f$(1 - e^{-kn/m})^k\f$. For the blocked
+ * layout, the number of values `i` in a block is Poisson distributed with mean \f$\lambda = 512n/m\f$ and the false
+ * positive rate is about \f$\sum_i \frac{\lambda^i e^{-\lambda}}{i!} (1 - (1 - \frac{1}{512})^{ki})^k\f$:
+ *
+ * | bits per value (m/n) | k | standard | blocked |
+ * |:--------------------:|:-:|:--------:|:-------:|
+ * | 8                    | 2 | 4.89 %   | 4.94 %  |
+ * | 8                    | 3 | 3.06 %   | 3.14 %  |
+ * | 8                    | 4 | 2.40 %   | 2.51 %  |
+ * | 16                   | 2 | 1.38 %   | 1.42 %  |
+ * | 16                   | 3 | 0.50 %   | 0.54 %  |
+ * | 16                   | 4 | 0.24 %   | 0.27 %  |
+ * | 16                   | 5 | 0.14 %   | 0.17 %  |
+ *
+ * Use the blocked layout if the Bloom Filter does not fit into the cache and queries dominate the running time.
+ * To query many values at once, use seqan3::bloom_filter::bulk_contains, which additionally overlaps the memory
+ * accesses of several values.
+ *
  * ### Compression
  *
  * The Bloom Filter can be compressed by passing `seqan3::data_layout::compressed` as template argument.
@@ -81,12 +113,13 @@ namespace seqan3
  * \sa seqan3::interleaved_bloom_filter
  *
  */
-template <data_layout data_layout_mode_ = data_layout::uncompressed>
+template <data_layout data_layout_mode_ = data_layout::uncompressed,
+          bloom_filter_layout layout_ = bloom_filter_layout::standard>
 class bloom_filter
 {
 private:
     //!\cond
-    template <data_layout data_layout_mode>
+    template <data_layout data_layout_mode, bloom_filter_layout layout>
     friend class bloom_filter;
     //!\endcond
 
@@ -131,9 +164,89 @@ private:
         return h;
     }
 
+    /*!\brief Returns the position of the first bit of the block of a value (blocked layout only).
+     * \param h The value to process.
+     * \returns A multiple of seqan3::bloom_filter::block_size that is smaller than `size_in_bits`.
+     */
+    inline constexpr size_t block_of(size_t h) const noexcept
+    {
+        h *= hash_seeds[0];
+        h ^= h >> hash_shift;
+        h *= 11'400'714'819'323'198'485ULL;
+        size_t const block_count = size_in_bits / block_size;
+#ifdef __SIZEOF_INT128__
+        h = static_cast<uint64_t>((static_cast<__uint128_t>(h) * static_cast<__uint128_t>(block_count)) >> 64);
+#else
+        h %= block_count;
+#endif
+        return h * block_size;
+    }
+
+    /*!\brief Returns the position of the i-th bit of a value within its block (blocked layout only).
+     * \param h The value to process.
+     * \param i The index of the hash function.
+     * \returns A position smaller than seqan3::bloom_filter::block_size.
+     *
+     * \details
+     *
+     * A second multiplicative hash value provides nine bits for the position of each hash function within the block.
+     */
+    static inline constexpr size_t block_position(size_t h, size_t const i) noexcept
+    {
+        h *= hash_seeds[1];
+        h ^= h >> 32;
+        h *= 11'400'714'819'323'198'485ULL;
+        return (h >> (55 - 9 * i)) & (block_size - 1);
+    }
+
+    /*!\brief Checks whether all bits of a value are set in the block starting at `block` (blocked layout only).
+     * \param block The position of the first bit of the block.
+     * \param value The value to process.
+     */
+    inline bool block_contains(size_t const block, size_t const value) const noexcept
+    {
+        assert(block + block_size <= data.size());
+
+        // All bits lie in the same cache line. Checking all of them without branching keeps the loop short, which
+        // lets the processor overlap the memory accesses of consecutive queries.
+        bool found = true;
+        for (size_t i = 0; i < hash_funs; ++i)
+            found &= data[block + block_position(value, i)];
+        return found;
+    }
+
+    //!\brief The number of values of a batch of seqan3::bloom_filter::bulk_contains and seqan3::bloom_filter::count.
+    static constexpr size_t batch_size = 16u;
+
+    /*!\brief Checks whether up to #batch_size values are present (blocked layout only).
+     * \param values The values.
+     * \param count The number of values; at most #batch_size.
+     * \param on_result Called with the index and the result of each value.
+     */
+    template <typename on_result_t>
+    void contains_batch(size_t const * values, size_t const count, on_result_t && on_result) const noexcept
+    {
+        assert(count <= batch_size);
+
+        std::array<size_t, batch_size> blocks;
+        for (size_t i = 0; i < count; ++i)
+        {
+            blocks[i] = block_of(values[i]);
+            if constexpr (data_layout_mode == data_layout::uncompressed)
+                __builtin_prefetch(data.data() + (blocks[i] >> 6));
+        }
+
+        for (size_t i = 0; i < count; ++i)
+            on_result(i, block_contains(blocks[i], values[i]));
+    }
+
 public:
     //!\brief Indicates whether the Bloom Filter is compressed.
     static constexpr data_layout data_layout_mode = data_layout_mode_;
+    //!\brief Indicates where the bits of a value are stored.
+    static constexpr bloom_filter_layout layout = layout_;
+    //!\brief The number of bits of a block of the seqan3::bloom_filter_layout::blocked layout.
+    static constexpr size_t block_size = 512u;
 
     /*!\name Constructors, destructor and assignment
      * \{
@@ -153,6 +266,9 @@ public:
      *
      * \details
      *
+     * For the seqan3::bloom_filter_layout::blocked layout, the size is rounded up to a multiple of
+     * seqan3::bloom_filter::block_size.
+     *
      * ### Example
      *
      * \include test/snippet/utility/bloom_filter/bloom_filter_constructor.cpp
@@ -168,6 +284,9 @@ public:
         if (size_in_bits == 0)
             throw std::logic_error{"The size of a bloom filter must be > 0."};
 
+        if constexpr (layout == bloom_filter_layout::blocked)
+            size_in_bits = (size_in_bits + block_size - 1) / block_size * block_size;
+
         hash_shift = std::countl_zero(size_in_bits);
         data = seqan3::contrib::sdsl::bit_vector(size_in_bits);
     }
@@ -183,7 +302,7 @@ public:
      *
      * \include test/snippet/utility/bloom_filter/bloom_filter_constructor_compressed.cpp
      */
-    bloom_filter(bloom_filter<data_layout::uncompressed> const & bf)
+    bloom_filter(bloom_filter<data_layout::uncompressed, layout> const & bf)
         requires (data_layout_mode == data_layout::compressed)
     {
         std::tie(size_in_bits, hash_shift, hash_funs) = std::tie(bf.size_in_bits, bf.hash_shift, bf.hash_funs);
@@ -209,6 +328,14 @@ public:
     void emplace(size_t const value) noexcept
         requires (data_layout_mode == data_layout::uncompressed)
     {
+        if constexpr (layout == bloom_filter_layout::blocked)
+        {
+            size_t const block = block_of(value);
+            for (size_t i = 0; i < hash_funs; ++i)
+                data[block + block_position(value, i)] = 1;
+            return;
+        }
+
         for (size_t i = 0; i < hash_funs; ++i)
         {
             size_t idx = hash_and_fit(value, hash_seeds[i]);
@@ -252,6 +379,9 @@ public:
      */
     bool contains(size_t const value) const noexcept
     {
+        if constexpr (layout == bloom_filter_layout::blocked)
+            return block_contains(block_of(value), value);
+
         for (size_t i = 0; i < hash_funs; i++)
         {
             size_t idx = hash_and_fit(value, hash_seeds[i]);
@@ -261,6 +391,45 @@ public:
         }
         return true;
     }
+
+    /*!\brief Checks for several values whether they are present in the Bloom Filter.
+     * \param[in] values The raw numeric values to process.
+     * \param[out] results The results; `results[i]` is set to `contains(values[i])`. Must be at least as large as
+     *                     `values`.
+     *
+     * \details
+     *
+     * For the seqan3::bloom_filter_layout::blocked layout, the values are processed in batches: the blocks of all
+     * values of a batch are prefetched before they are compared with the masks of the values, such that the memory
+     * accesses of different values overlap.
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are thread safe.
+     */
+    void bulk_contains(std::span<size_t const> const values, std::span<bool> const results) const noexcept
+    {
+        assert(results.size() >= values.size());
+
+        if constexpr (layout == bloom_filter_layout::blocked)
+        {
+            for (size_t i = 0; i < values.size(); i += batch_size)
+            {
+                size_t const count = std::min(batch_size, values.size() - i);
+                contains_batch(values.data() + i,
+                               count,
+                               [&results, i](size_t const j, bool const result)
+                               {
+                                   results[i + j] = result;
+                               });
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < values.size(); ++i)
+                results[i] = contains(values[i]);
+        }
+    }
     //!\}
 
     /*!\name Counting
@@ -290,8 +459,31 @@ public:
 
         size_t result = 0;
 
-        for (auto && value : values)
-            result += contains(value);
+        if constexpr (layout == bloom_filter_layout::blocked)
+        {
+            auto on_result = [&result](size_t, bool const found)
+            {
+                result += found;
+            };
+
+            std::array<size_t, batch_size> batch;
+            size_t count = 0;
+            for (auto && value : values)
+            {
+                batch[count++] = value;
+                if (count == batch_size)
+                {
+                    contains_batch(batch.data(), count, on_result);
+                    count = 0;
+                }
+            }
+            contains_batch(batch.data(), count, on_result);
+        }
+        else
+        {
+            for (auto && value : values)
+                result += contains(value);
+        }
 
         return result;
     }
@@ -25,6 +25,17 @@ enum data_layout : bool
     compressed    //!< The Interleaved Bloom Filter is compressed.
 };
 
+/*!\brief Determines where the hash functions of a seqan3::bloom_filter store the bits of a value.
+ * \ingroup utility_bloom_filter
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+enum class bloom_filter_layout : bool
+{
+    standard, //!< Each hash function addresses the whole bitvector.
+    blocked   //!< All hash functions address the same block of 512 bits, i.e. a single cache line.
+};
+
 //!\brief A strong type that represents the number of bins for the seqan3::interleaved_bloom_filter.
 //!\ingroup utility_bloom_filter
 struct bin_count : public detail::strong_type<size_t, bin_count, detail::strong_type_skill::convert>
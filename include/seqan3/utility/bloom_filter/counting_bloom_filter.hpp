@@ -0,0 +1,314 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::counting_bloom_filter.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <ranges>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/utility/bloom_filter/bloom_filter_strong_types.hpp>
+#include <seqan3/utility/bloom_filter/detail/saturating_counters.hpp>
+
+#if SEQAN3_HAS_CEREAL
+#    include <cereal/types/vector.hpp>
+#endif // SEQAN3_HAS_CEREAL
+
+namespace seqan3
+{
+
+/*!\brief A Bloom Filter with small saturating counters that estimates how often a value was inserted.
+ * \tparam counter_bits The width of a counter in bits; must be 4 or 8. Defaults to 8.
+ * \implements seqan3::cerealisable
+ * \ingroup utility_bloom_filter
+ *
+ * \details
+ *
+ * The counting Bloom Filter replaces each bit of a seqan3::bloom_filter by a counter of `counter_bits` bits.
+ * Inserting a value increments the `h` counters the value is hashed to, and querying a value returns the minimum of
+ * these counters. Like the presence reported by a seqan3::bloom_filter, the count is never underestimated but may be
+ * overestimated if other values share all `h` counters with the queried one. Counters saturate at
+ * seqan3::counting_bloom_filter::max_count, i.e. larger counts are reported as `max_count`.
+ *
+ * Both filters use the same hash functions, so a seqan3::counting_bloom_filter and a seqan3::bloom_filter of the same
+ * size and number of hash functions report the same presence for all values. A 4 bit counting Bloom Filter needs four
+ * times, an 8 bit one eight times the memory of the seqan3::bloom_filter.
+ *
+ * ### Example
+ *
+ * \include test/snippet/utility/bloom_filter/counting_bloom_filter.cpp
+ *
+ * ### Thread safety
+ *
+ * The counting Bloom Filter promises the basic thread-safety by the STL that all
+ * calls to `const` member functions are safe from multiple threads (as long as no thread calls
+ * a non-`const` member function at the same time).
+ *
+ * \sa seqan3::bloom_filter
+ * \sa seqan3::counting_interleaved_bloom_filter
+ *
+ * \experimentalapi{Experimental since version 3.5.}
+ */
+template <size_t counter_bits = 8>
+class counting_bloom_filter
+{
+private:
+    //!\brief The operations on the counters.
+    using counters_t = detail::saturating_counters<counter_bits>;
+
+    //!\brief The number of counters.
+    size_t size_in_counters{};
+    //!\brief The number of bits to shift the hash value before doing multiplicative hashing.
+    size_t hash_shift{};
+    //!\brief The number of hash functions.
+    size_t hash_funs{};
+    //!\brief The packed counters.
+    std::vector<uint8_t> data{};
+    //!\brief Precalculated seeds for multiplicative hashing. We use large irrational numbers for a uniform hashing.
+    static constexpr std::array<size_t, 5> hash_seeds{13'572'355'802'537'770'549ULL, // 2**64 / (e/2)
+                                                      13'043'817'825'332'782'213ULL, // 2**64 / sqrt(2)
+                                                      10'650'232'656'628'343'401ULL, // 2**64 / sqrt(3)
+                                                      16'499'269'484'942'379'435ULL, // 2**64 / (sqrt(5)/2)
+                                                      4'893'150'838'803'335'377ULL}; // 2**64 / (3*pi/5)
+
+    /*!\brief Perturbs a value and fits it into the vector.
+     * \param h The value to process.
+     * \param seed The seed to use.
+     * \returns The index of a counter.
+     * \sa seqan3::bloom_filter
+     */
+    inline constexpr size_t hash_and_fit(size_t h, size_t const seed) const
+    {
+        h *= seed;
+        h ^= h >> hash_shift;               // XOR and shift higher bits into lower bits
+        h *= 11'400'714'819'323'198'485ULL; // = 2^64 / golden_ration, to expand h to 64 bit range
+                                            // Use fastrange (integer modulo without division) if possible.
+#ifdef __SIZEOF_INT128__
+        h = static_cast<uint64_t>((static_cast<__uint128_t>(h) * static_cast<__uint128_t>(size_in_counters)) >> 64);
+#else
+        h %= size_in_counters;
+#endif
+        return h;
+    }
+
+public:
+    //!\brief The largest count that can be stored; larger counts saturate at this value.
+    static constexpr size_t max_count = counters_t::max_count;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    counting_bloom_filter() = default;                                          //!< Defaulted.
+    counting_bloom_filter(counting_bloom_filter const &) = default;             //!< Defaulted.
+    counting_bloom_filter & operator=(counting_bloom_filter const &) = default; //!< Defaulted.
+    counting_bloom_filter(counting_bloom_filter &&) = default;                  //!< Defaulted.
+    counting_bloom_filter & operator=(counting_bloom_filter &&) = default;      //!< Defaulted.
+    ~counting_bloom_filter() = default;                                         //!< Defaulted.
+
+    /*!\brief Construct a counting Bloom Filter.
+     * \param size The number of counters.
+     * \param funs The number of hash functions. Default 2. At least 1, at most 5.
+     * \throws std::logic_error If `size` is 0 or `funs` is not in `[1, 5]`.
+     */
+    counting_bloom_filter(seqan3::bin_size size, seqan3::hash_function_count funs = seqan3::hash_function_count{2u})
+    {
+        size_in_counters = size.get();
+        hash_funs = funs.get();
+
+        if (hash_funs == 0 || hash_funs > 5)
+            throw std::logic_error{"The number of hash functions must be > 0 and <= 5."};
+        if (size_in_counters == 0)
+            throw std::logic_error{"The size of a bloom filter must be > 0."};
+
+        hash_shift = std::countl_zero(size_in_counters);
+        data.resize(counters_t::bytes_for(size_in_counters));
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    /*!\brief Inserts a value into the counting Bloom Filter.
+     * \param[in] value The raw numeric value to process.
+     * \param[in] count How often the value is inserted. Defaults to 1.
+     */
+    void emplace(size_t const value, size_t const count = 1u) noexcept
+    {
+        for (size_t i = 0; i < hash_funs; ++i)
+        {
+            size_t const idx = hash_and_fit(value, hash_seeds[i]);
+            assert(idx < size_in_counters);
+            counters_t::add(data.data(), idx, count);
+        }
+    }
+
+    //!\brief Remove all values from the counting Bloom Filter by setting all counters to 0.
+    void reset() noexcept
+    {
+        std::ranges::fill(data, 0u);
+    }
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    /*!\brief Returns how often a value was (probably) inserted.
+     * \param[in] value The raw numeric value to process.
+     * \returns The minimum of the counters the value is hashed to; at most seqan3::counting_bloom_filter::max_count.
+     */
+    size_t abundance(size_t const value) const noexcept
+    {
+        size_t result = max_count;
+        for (size_t i = 0; i < hash_funs; ++i)
+        {
+            size_t const idx = hash_and_fit(value, hash_seeds[i]);
+            assert(idx < size_in_counters);
+            result = std::min(result, counters_t::get(data.data(), idx));
+        }
+        return result;
+    }
+
+    /*!\brief Check whether a value is present in the counting Bloom Filter.
+     * \param[in] value The raw numeric value to process.
+     */
+    bool contains(size_t const value) const noexcept
+    {
+        return abundance(value) > 0u;
+    }
+    //!\}
+
+    /*!\name Counting
+     * \{
+     */
+    /*!\brief Counts the occurrences for all values in a range.
+     * \tparam value_range_t The type of the range of values. Must model std::ranges::input_range. The reference type
+     *                       must model std::unsigned_integral.
+     * \param[in] values The range of values to process.
+     * \returns The number of values that are present in the counting Bloom Filter.
+     *
+     * \details
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are thread safe.
+     */
+    template <std::ranges::range value_range_t>
+    size_t count(value_range_t && values) const noexcept
+    {
+        static_assert(std::ranges::input_range<value_range_t>, "The values must model input_range.");
+        static_assert(std::unsigned_integral<std::ranges::range_value_t<value_range_t>>,
+                      "An individual value must be an unsigned integral.");
+
+        size_t result = 0;
+
+        for (auto && value : values)
+            result += contains(value);
+
+        return result;
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    /*!\brief Returns the number of hash functions used in the counting Bloom Filter.
+     * \returns The number of hash functions.
+     */
+    size_t hash_function_count() const noexcept
+    {
+        return hash_funs;
+    }
+
+    /*!\brief Returns the number of counters.
+     * \returns The number of counters.
+     */
+    size_t counter_count() const noexcept
+    {
+        return size_in_counters;
+    }
+
+    /*!\brief Returns the size of the underlying counters.
+     * \returns The size in bits of all counters.
+     */
+    size_t bit_size() const noexcept
+    {
+        return size_in_counters * counter_bits;
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    /*!\brief Test for equality.
+     * \param[in] lhs A `seqan3::counting_bloom_filter`.
+     * \param[in] rhs `seqan3::counting_bloom_filter` to compare to.
+     * \returns `true` if equal, `false` otherwise.
+     */
+    friend bool operator==(counting_bloom_filter const & lhs, counting_bloom_filter const & rhs) noexcept
+    {
+        return std::tie(lhs.size_in_counters, lhs.hash_shift, lhs.hash_funs, lhs.data)
+            == std::tie(rhs.size_in_counters, rhs.hash_shift, rhs.hash_funs, rhs.data);
+    }
+
+    /*!\brief Test for inequality.
+     * \param[in] lhs A `seqan3::counting_bloom_filter`.
+     * \param[in] rhs `seqan3::counting_bloom_filter` to compare to.
+     * \returns `true` if unequal, `false` otherwise.
+     */
+    friend bool operator!=(counting_bloom_filter const & lhs, counting_bloom_filter const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+
+    /*!\name Access
+     * \{
+     */
+    /*!\brief Provides direct, unsafe access to the underlying data structure.
+     * \returns A reference to the packed counters.
+     *
+     * \details
+     *
+     * \noapi{The exact representation of the data is implementation defined.}
+     */
+    constexpr std::vector<uint8_t> & raw_data() noexcept
+    {
+        return data;
+    }
+
+    //!\copydoc raw_data()
+    constexpr std::vector<uint8_t> const & raw_data() const noexcept
+    {
+        return data;
+    }
+    //!\}
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param[in] archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(size_in_counters);
+        archive(hash_shift);
+        archive(hash_funs);
+        archive(data);
+    }
+    //!\endcond
+};
+
+} // namespace seqan3
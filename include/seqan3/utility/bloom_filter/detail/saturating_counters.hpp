@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::saturating_counters.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Operations on rows of packed saturating counters, as used by the counting Bloom Filters.
+ * \ingroup utility_bloom_filter
+ * \tparam counter_bits The width of a counter in bits; must be 4 or 8.
+ *
+ * \details
+ *
+ * A row is a byte array that stores one counter per byte (8 bit) or two counters per byte (4 bit). In the latter case,
+ * the counters are stored in blocks of 64 counters and 32 bytes: counter `i < 32` of a block is stored in the low and
+ * counter `i + 32` in the high nibble of byte `i` of the block. Hence, unpacking a block only needs contiguous loads
+ * and stores. Counters saturate at #max_count instead of wrapping around, hence the minimum over several counters never
+ * underestimates a count.
+ *
+ * If SIMD instructions are available, the row-wise kernels process seqan3::simd::simd_type_t<uint8_t> many bytes at
+ * once. Nibbles are compared by splitting a byte into its masked halves, which keeps all comparisons byte-wise.
+ */
+template <size_t counter_bits>
+struct saturating_counters
+{
+    static_assert(counter_bits == 4 || counter_bits == 8, "Only 4 and 8 bit counters are supported.");
+
+    //!\brief The largest value a counter can hold.
+    static constexpr size_t max_count = (size_t{1} << counter_bits) - 1u;
+
+    //!\brief The number of bytes needed to store `count` many counters.
+    static constexpr size_t bytes_for(size_t const count) noexcept
+    {
+        if constexpr (counter_bits == 8)
+            return count;
+        else
+            return ((count + 63u) >> 6) << 5; // = ceil(count / 64) * 32
+    }
+
+    //!\brief Returns the byte that stores counter `i` (4 bit only).
+    static constexpr size_t byte_of(size_t const i) noexcept
+    {
+        return ((i >> 6) << 5) | (i & 31u);
+    }
+
+    //!\brief Returns the shift of counter `i` within its byte (4 bit only).
+    static constexpr size_t shift_of(size_t const i) noexcept
+    {
+        return (i & 32u) >> 3;
+    }
+
+    //!\brief Returns the value of counter `i` in `row`.
+    static constexpr size_t get(uint8_t const * row, size_t const i) noexcept
+    {
+        if constexpr (counter_bits == 8)
+            return row[i];
+        else
+            return (row[byte_of(i)] >> shift_of(i)) & 0x0Fu;
+    }
+
+    //!\brief Adds `count` to counter `i` in `row`, saturating at #max_count.
+    static constexpr void add(uint8_t * row, size_t const i, size_t const count) noexcept
+    {
+        size_t const value = std::min(get(row, i) + std::min(count, max_count), max_count);
+
+        if constexpr (counter_bits == 8)
+        {
+            row[i] = static_cast<uint8_t>(value);
+        }
+        else
+        {
+            size_t const shift = shift_of(i);
+            uint8_t & byte = row[byte_of(i)];
+            byte = static_cast<uint8_t>((byte & ~(0x0Fu << shift)) | (value << shift));
+        }
+    }
+
+    //!\brief Sets counter `i` in `row` to 0.
+    static constexpr void reset(uint8_t * row, size_t const i) noexcept
+    {
+        if constexpr (counter_bits == 8)
+            row[i] = 0u;
+        else
+            row[byte_of(i)] &= static_cast<uint8_t>(~(0x0Fu << shift_of(i)));
+    }
+
+    /*!\brief Stores the counter-wise minimum of `target` and `source` in `target`.
+     * \param[in,out] target The first row and the result.
+     * \param[in] source The second row.
+     * \param[in] bytes The number of bytes to process.
+     */
+    static void minimum(uint8_t * target, uint8_t const * source, size_t const bytes) noexcept
+    {
+        using simd_t = simd::simd_type_t<uint8_t>;
+        constexpr size_t simd_length = simd_traits<simd_t>::length;
+
+        size_t i = 0;
+
+        // Without SIMD instructions, the scalar loop below is used; compilers may still vectorise it.
+        if constexpr (detail::is_native_builtin_simd_v<simd_t>)
+        {
+            for (; i + simd_length <= bytes; i += simd_length)
+            {
+                simd_t const lhs = simd::load<simd_t>(target + i);
+                simd_t const rhs = simd::load<simd_t>(source + i);
+
+                if constexpr (counter_bits == 8)
+                {
+                    simd::store(target + i, simd_t{lhs < rhs ? lhs : rhs});
+                }
+                else
+                {
+                    simd_t const low_mask = simd::fill<simd_t>(0x0Fu);
+                    simd_t const lhs_low = lhs & low_mask;
+                    simd_t const rhs_low = rhs & low_mask;
+                    simd_t const lhs_high = lhs ^ lhs_low;
+                    simd_t const rhs_high = rhs ^ rhs_low;
+                    simd_t const low = lhs_low < rhs_low ? lhs_low : rhs_low;
+                    simd_t const high = lhs_high < rhs_high ? lhs_high : rhs_high;
+                    simd::store(target + i, simd_t{low | high});
+                }
+            }
+        }
+
+        for (; i < bytes; ++i)
+        {
+            if constexpr (counter_bits == 8)
+                target[i] = std::min(target[i], source[i]);
+            else
+                target[i] = std::min<uint8_t>(target[i] & 0x0Fu, source[i] & 0x0Fu)
+                          | std::min<uint8_t>(target[i] & 0xF0u, source[i] & 0xF0u);
+        }
+    }
+
+    /*!\brief Adds the first `count` counters of `row` to `target`.
+     * \tparam value_t The type of the target values.
+     * \param[in,out] target The values to add to; must hold at least `count` elements.
+     * \param[in] row The row of counters.
+     * \param[in] count The number of counters to add.
+     */
+    template <typename value_t>
+    static void accumulate(value_t * target, uint8_t const * row, size_t const count) noexcept
+    {
+        if constexpr (counter_bits == 8)
+        {
+            for (size_t i = 0; i < count; ++i)
+                target[i] += row[i];
+        }
+        else
+        {
+            size_t const full_blocks = count >> 6;
+            for (size_t block = 0; block < full_blocks; ++block)
+            {
+                value_t * const out = target + (block << 6);
+                uint8_t const * const in = row + (block << 5);
+
+                for (size_t i = 0; i < 32u; ++i)
+                {
+                    out[i] += in[i] & 0x0Fu;
+                    out[i + 32u] += in[i] >> 4;
+                }
+            }
+
+            for (size_t i = full_blocks << 6; i < count; ++i)
+                target[i] += get(row, i);
+        }
+    }
+};
+
+} // namespace seqan3::detail
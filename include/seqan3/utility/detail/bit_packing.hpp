@@ -0,0 +1,288 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::pack_fields, seqan3::detail::unpack_fields, seqan3::detail::reverse_fields and
+ *        seqan3::detail::extract_bits.
+ */
+
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <seqan3/core/platform.hpp>
+
+#if defined(__BMI2__)
+#    include <immintrin.h>
+#endif
+
+namespace seqan3::detail
+{
+
+/*!\brief The mask of the lowest `field_width` bits.
+ * \ingroup utility
+ */
+template <size_t field_width>
+inline constexpr uint64_t field_mask = (field_width == 64u) ? ~uint64_t{} : (uint64_t{1} << field_width) - 1u;
+
+/*!\brief The mask of the lowest `bit_count` bits for `bit_count` in `[0, 64)`.
+ * \ingroup utility
+ */
+constexpr uint64_t field_mask_of(size_t const bit_count) noexcept
+{
+    return (uint64_t{1} << bit_count) - 1u;
+}
+
+/*!\brief A 64 bit word where the lowest `field_width` bits of every byte are set.
+ * \ingroup utility
+ */
+template <size_t field_width>
+inline constexpr uint64_t byte_field_mask = field_mask<field_width> * 0x0101010101010101ULL;
+
+/*!\brief Writes integers into the fields of a bit vector.
+ * \ingroup utility
+ * \tparam field_width The number of bits of every field.
+ * \tparam value_t The type of the integers.
+ * \param[in] values The integers; only the lowest `field_width` bits may be set.
+ * \param[in] count The number of integers.
+ * \param[out] words The 64 bit words of the bit vector.
+ * \param[in] first The first field to write.
+ *
+ * \details
+ *
+ * Field `i` occupies the bits `[i * field_width, (i + 1) * field_width)` of the bit vector, where bit `j` is bit
+ * `j % 64` of word `j / 64`. This is the layout of seqan3::contrib::sdsl::int_vector. The bits outside of the written
+ * fields are not modified.
+ *
+ * Every word is written once: if the field width divides 64, the fields of a word are assembled at once, with BMI2
+ * eight bytes are packed with a single `pext` instruction if the fields are narrower than a byte. Otherwise, the
+ * fields are collected in a 64 bit buffer that is written whenever it is full.
+ */
+template <size_t field_width, std::unsigned_integral value_t>
+inline void pack_fields(value_t const * values, size_t count, uint64_t * words, size_t first) noexcept
+{
+    static_assert(field_width > 0u && field_width <= 64u, "The field width must be in [1, 64].");
+
+    constexpr uint64_t mask = field_mask<field_width>;
+
+    if constexpr (64u % field_width == 0u)
+    {
+        constexpr size_t fields_per_word = 64u / field_width;
+
+        auto write_field = [words](size_t const field, uint64_t const value)
+        {
+            size_t const offset = (field % fields_per_word) * field_width;
+            uint64_t & word = words[field / fields_per_word];
+            word = (word & ~(mask << offset)) | (value << offset);
+        };
+
+        // Fill the first word up to its end.
+        for (; count > 0u && first % fields_per_word != 0u; --count, ++values, ++first)
+            write_field(first, *values);
+
+        uint64_t * word = words + first / fields_per_word;
+        for (; count >= fields_per_word; count -= fields_per_word, values += fields_per_word, first += fields_per_word)
+        {
+#if defined(__BMI2__)
+            if constexpr (sizeof(value_t) == 1u && field_width < 8u)
+            {
+                uint64_t packed{};
+                for (size_t i = 0; i < fields_per_word; i += 8u)
+                {
+                    uint64_t bytes;
+                    std::memcpy(&bytes, values + i, 8u);
+                    packed |= _pext_u64(bytes, byte_field_mask<field_width>) << (i * field_width);
+                }
+
+                *word++ = packed;
+                continue;
+            }
+#endif
+            uint64_t packed{};
+            for (size_t i = 0; i < fields_per_word; ++i)
+                packed |= static_cast<uint64_t>(values[i]) << (i * field_width);
+
+            *word++ = packed;
+        }
+
+        for (; count > 0u; --count, ++values, ++first)
+            write_field(first, *values);
+    }
+    else
+    {
+        // Fields cross word boundaries: collect the bits of whole words and write every word once.
+        size_t const first_bit = first * field_width;
+        uint64_t * word = words + first_bit / 64u;
+        size_t filled_bits = first_bit % 64u;
+        uint64_t buffer = (filled_bits == 0u) ? 0u : *word & field_mask_of(filled_bits);
+
+        for (; count > 0u; --count, ++values)
+        {
+            uint64_t const value = *values;
+            buffer |= value << filled_bits;
+            filled_bits += field_width;
+
+            if (filled_bits >= 64u)
+            {
+                *word++ = buffer;
+                filled_bits -= 64u;
+                buffer = (filled_bits == 0u) ? 0u : value >> (field_width - filled_bits);
+            }
+        }
+
+        if (filled_bits > 0u)
+            *word = (*word & ~field_mask_of(filled_bits)) | buffer;
+    }
+}
+
+/*!\brief Reads integers from the fields of a bit vector.
+ * \ingroup utility
+ * \tparam field_width The number of bits of every field.
+ * \tparam value_t The type of the integers.
+ * \param[in] words The 64 bit words of the bit vector.
+ * \param[in] first The first field to read.
+ * \param[in] count The number of integers.
+ * \param[out] values The integers.
+ *
+ * \details
+ *
+ * The inverse of seqan3::detail::pack_fields. With BMI2, eight fields that are narrower than a byte are spread to
+ * eight bytes with a single `pdep` instruction.
+ */
+template <size_t field_width, std::unsigned_integral value_t>
+inline void unpack_fields(uint64_t const * words, size_t first, size_t count, value_t * values) noexcept
+{
+    static_assert(field_width > 0u && field_width <= 64u, "The field width must be in [1, 64].");
+
+    constexpr uint64_t mask = field_mask<field_width>;
+
+    if constexpr (64u % field_width == 0u)
+    {
+        constexpr size_t fields_per_word = 64u / field_width;
+
+        auto read_field = [words](size_t const field) -> value_t
+        {
+            size_t const offset = (field % fields_per_word) * field_width;
+            return static_cast<value_t>((words[field / fields_per_word] >> offset) & mask);
+        };
+
+        for (; count > 0u && first % fields_per_word != 0u; --count, ++values, ++first)
+            *values = read_field(first);
+
+        uint64_t const * word = words + first / fields_per_word;
+        for (; count >= fields_per_word; count -= fields_per_word, values += fields_per_word, first += fields_per_word)
+        {
+            uint64_t const packed = *word++;
+#if defined(__BMI2__)
+            if constexpr (sizeof(value_t) == 1u && field_width < 8u)
+            {
+                for (size_t i = 0; i < fields_per_word; i += 8u)
+                {
+                    uint64_t const bytes = _pdep_u64(packed >> (i * field_width), byte_field_mask<field_width>);
+                    std::memcpy(values + i, &bytes, 8u);
+                }
+
+                continue;
+            }
+#endif
+            for (size_t i = 0; i < fields_per_word; ++i)
+                values[i] = static_cast<value_t>((packed >> (i * field_width)) & mask);
+        }
+
+        for (; count > 0u; --count, ++values, ++first)
+            *values = read_field(first);
+    }
+    else
+    {
+        // Fields cross word boundaries: read every word once and keep its remaining bits.
+        size_t const first_bit = first * field_width;
+        uint64_t const * word = words + first_bit / 64u;
+        size_t available_bits = 64u - first_bit % 64u;
+        uint64_t buffer = (count == 0u) ? 0u : *word >> (first_bit % 64u);
+
+        for (; count > 0u; --count, ++values)
+        {
+            if (available_bits >= field_width)
+            {
+                *values = static_cast<value_t>(buffer & mask);
+                buffer >>= field_width;
+                available_bits -= field_width;
+            }
+            else
+            {
+                uint64_t const next = *++word;
+                *values = static_cast<value_t>((buffer | (next << available_bits)) & mask);
+                buffer = next >> (field_width - available_bits);
+                available_bits += 64u - field_width;
+            }
+        }
+    }
+}
+
+/*!\brief Reverses the order of the fields of a word.
+ * \ingroup utility
+ * \tparam field_width The number of bits of every field; must be a power of two.
+ * \param[in] word The word.
+ * \returns The word with field `i` moved to field `64 / field_width - 1 - i`.
+ */
+template <size_t field_width>
+constexpr uint64_t reverse_fields(uint64_t word) noexcept
+{
+    static_assert(std::has_single_bit(field_width) && field_width <= 64u, "The field width must be a power of two.");
+
+    if constexpr (field_width <= 32u)
+        word = (word >> 32) | (word << 32);
+    if constexpr (field_width <= 16u)
+        word = ((word >> 16) & 0x0000'ffff'0000'ffffULL) | ((word & 0x0000'ffff'0000'ffffULL) << 16);
+    if constexpr (field_width <= 8u)
+        word = ((word >> 8) & 0x00ff'00ff'00ff'00ffULL) | ((word & 0x00ff'00ff'00ff'00ffULL) << 8);
+    if constexpr (field_width <= 4u)
+        word = ((word >> 4) & 0x0f0f'0f0f'0f0f'0f0fULL) | ((word & 0x0f0f'0f0f'0f0f'0f0fULL) << 4);
+    if constexpr (field_width <= 2u)
+        word = ((word >> 2) & 0x3333'3333'3333'3333ULL) | ((word & 0x3333'3333'3333'3333ULL) << 2);
+    if constexpr (field_width <= 1u)
+        word = ((word >> 1) & 0x5555'5555'5555'5555ULL) | ((word & 0x5555'5555'5555'5555ULL) << 1);
+
+    return word;
+}
+
+/*!\brief Gathers the bits of a word that are selected by a mask into the lowest bits.
+ * \ingroup utility
+ * \param[in] word The word.
+ * \param[in] mask The bits to extract.
+ * \returns The selected bits of `word`, where the lowest selected bit becomes bit 0.
+ *
+ * \details
+ *
+ * With BMI2, this is a single `pext` instruction. Otherwise, every run of consecutive set bits of the mask is
+ * extracted with a shift, so the runtime is linear in the number of runs.
+ */
+inline uint64_t extract_bits(uint64_t const word, uint64_t mask) noexcept
+{
+#if defined(__BMI2__)
+    return _pext_u64(word, mask);
+#else
+    uint64_t result{};
+    size_t result_bits{};
+
+    while (mask != 0u)
+    {
+        int const begin = std::countr_zero(mask);
+        int const length = std::countr_one(mask >> begin);
+        uint64_t const run_mask = (length == 64) ? ~uint64_t{} : field_mask_of(length);
+
+        result |= ((word >> begin) & run_mask) << result_bits;
+        result_bits += length;
+        mask &= ~(run_mask << begin);
+    }
+
+    return result;
+#endif
+}
+
+} // namespace seqan3::detail
@@ -0,0 +1,174 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::memory_mapped_file.
+ */
+
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+
+#if __has_include(<sys/mman.h>) && __has_include(<fcntl.h>) && __has_include(<unistd.h>)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#    define SEQAN3_HAS_MMAP 1
+#else
+#    define SEQAN3_HAS_MMAP 0
+#endif
+
+namespace seqan3::detail
+{
+
+/*!\brief A read-only mapping of a whole file into memory.
+ * \ingroup utility
+ *
+ * \details
+ *
+ * The file is mapped with `mmap` and `MAP_SHARED`, such that the pages are loaded on first access and shared by all
+ * processes that map the same file. On platforms without `mmap`, the file is read into memory instead.
+ *
+ * The mapping is aligned to the page size, in particular to 8 bytes.
+ */
+class memory_mapped_file
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    memory_mapped_file() = default;                                       //!< Defaulted.
+    memory_mapped_file(memory_mapped_file const &) = delete;              //!< Deleted.
+    memory_mapped_file & operator=(memory_mapped_file const &) = delete; //!< Deleted.
+
+    //!\brief Move constructor.
+    memory_mapped_file(memory_mapped_file && other) noexcept
+    {
+        swap(other);
+    }
+
+    //!\brief Move assignment.
+    memory_mapped_file & operator=(memory_mapped_file && other) noexcept
+    {
+        memory_mapped_file tmp{std::move(other)};
+        swap(tmp);
+        return *this;
+    }
+
+    //!\brief Unmaps the file.
+    ~memory_mapped_file()
+    {
+#if SEQAN3_HAS_MMAP
+        if (mapping != nullptr)
+            ::munmap(mapping, mapping_size);
+#endif
+    }
+
+    /*!\brief Maps the file at `path`.
+     * \param[in] path The path to the file.
+     * \throws std::filesystem::filesystem_error if the file cannot be opened or mapped.
+     */
+    explicit memory_mapped_file(std::filesystem::path const & path)
+    {
+#if SEQAN3_HAS_MMAP
+        int const file_descriptor = ::open(path.c_str(), O_RDONLY);
+        if (file_descriptor == -1)
+            throw_error("Cannot open the file.", path, errno);
+
+        struct stat file_status;
+        if (::fstat(file_descriptor, &file_status) == -1)
+        {
+            int const error = errno;
+            ::close(file_descriptor);
+            throw_error("Cannot determine the size of the file.", path, error);
+        }
+
+        mapping_size = static_cast<size_t>(file_status.st_size);
+        if (mapping_size > 0u)
+        {
+            void * const address = ::mmap(nullptr, mapping_size, PROT_READ, MAP_SHARED, file_descriptor, 0);
+            if (address == MAP_FAILED)
+            {
+                int const error = errno;
+                ::close(file_descriptor);
+                throw_error("Cannot map the file.", path, error);
+            }
+
+            mapping = address;
+        }
+
+        // The mapping stays valid after the file is closed.
+        ::close(file_descriptor);
+#else
+        std::ifstream file{path, std::ios::binary | std::ios::ate};
+        if (!file)
+            throw std::filesystem::filesystem_error{"Cannot open the file.",
+                                                    path,
+                                                    std::make_error_code(std::errc::io_error)};
+
+        mapping_size = static_cast<size_t>(file.tellg());
+        buffer.resize((mapping_size + sizeof(uint64_t) - 1u) / sizeof(uint64_t));
+        file.seekg(0);
+        file.read(reinterpret_cast<char *>(buffer.data()), mapping_size);
+#endif
+    }
+    //!\}
+
+    //!\brief The first byte of the file.
+    std::byte const * data() const noexcept
+    {
+#if SEQAN3_HAS_MMAP
+        return static_cast<std::byte const *>(mapping);
+#else
+        return reinterpret_cast<std::byte const *>(buffer.data());
+#endif
+    }
+
+    //!\brief The size of the file in bytes.
+    size_t size() const noexcept
+    {
+        return mapping_size;
+    }
+
+    //!\brief Swaps two mappings.
+    void swap(memory_mapped_file & other) noexcept
+    {
+#if SEQAN3_HAS_MMAP
+        std::swap(mapping, other.mapping);
+#else
+        std::swap(buffer, other.buffer);
+#endif
+        std::swap(mapping_size, other.mapping_size);
+    }
+
+private:
+#if SEQAN3_HAS_MMAP
+    //!\brief The begin of the mapping.
+    void * mapping{nullptr};
+
+    //!\brief Throws a std::filesystem::filesystem_error for the given value of `errno`.
+    [[noreturn]] static void throw_error(char const * message, std::filesystem::path const & path, int const error)
+    {
+        throw std::filesystem::filesystem_error{message, path, std::error_code{error, std::generic_category()}};
+    }
+#else
+    //!\brief The content of the file.
+    std::vector<uint64_t> buffer{};
+#endif
+
+    //!\brief The size of the file in bytes.
+    size_t mapping_size{0u};
+};
+
+} // namespace seqan3::detail
@@ -12,6 +12,7 @@
 #include <array>
 #include <cassert>
 #include <concepts>
+#include <cstdint>
 #include <utility>
 
 #include <seqan3/utility/simd/concept.hpp>
@@ -114,6 +115,45 @@ constexpr target_simd_t upcast_unsigned(source_simd_t const & src)
         static_assert(simd_traits<source_simd_t>::max_length <= 32, "simd type is not supported.");
 }
 
+/*!\brief Loads for every element of the given index vector the value at this index from the given table.
+ * \ingroup utility_simd
+ * \tparam simd_t The simd type; must model seqan3::simd::simd_concept.
+ * \param[in] table The table to gather the values from.
+ * \param[in] indices The indices of the values to gather; must be valid positions in `table`.
+ * \returns A simd vector where the i-th element is `table[indices[i]]` converted to the scalar type of `simd_t`.
+ *
+ * \details
+ *
+ * The table stores 32 bit values such that the gather instructions of AVX2 and AVX512 can be used for native simd
+ * vectors over 16 and 32 bit scalar types. All other simd types load the values element by element.
+ */
+template <simd::simd_concept simd_t>
+inline simd_t gather(int32_t const * table, simd_t const & indices)
+{
+    assert(table != nullptr);
+
+    using scalar_t = typename simd_traits<simd_t>::scalar_type;
+    constexpr bool has_gather_instruction = (sizeof(scalar_t) == 2 || sizeof(scalar_t) == 4)
+                                         && (simd_traits<simd_t>::max_length == 32
+                                             || simd_traits<simd_t>::max_length == 64);
+
+    if constexpr (is_builtin_simd_v<simd_t> && is_native_builtin_simd_v<simd_t> && has_gather_instruction)
+    {
+        if constexpr (simd_traits<simd_t>::max_length == 32)
+            return gather_avx2(table, indices);
+        else
+            return gather_avx512(table, indices);
+    }
+    else
+    {
+        simd_t result{};
+        for (size_t i = 0; i < simd_traits<simd_t>::length; ++i)
+            result[i] = static_cast<scalar_t>(table[indices[i]]);
+
+        return result;
+    }
+}
+
 /*!\brief Extracts one half of the given simd vector and stores the result in the lower half of the target vector.
  * \ingroup utility_simd
  * \tparam index An index value in the range of [0, 1].
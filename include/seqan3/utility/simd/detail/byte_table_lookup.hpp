@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides seqan3::detail::byte_lookup_table and seqan3::detail::byte_table_lookup.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <seqan3/core/platform.hpp>
+
+#if defined(__AVX2__)
+#    include <immintrin.h>
+#endif
+
+namespace seqan3::detail
+{
+
+/*!\brief A table that maps every byte to a byte, prepared for seqan3::detail::byte_table_lookup.
+ * \ingroup utility_simd
+ *
+ * \details
+ *
+ * Besides the 256 values, the table stores whether all bytes outside of a window of 64 consecutive bytes map to the
+ * same value. Byte shuffles only look up 16 values at once, so without AVX512 VBMI only such tables can be looked up
+ * with SIMD instructions. This covers the conversion of characters to ranks and of ranks to characters for all
+ * alphabets with at most 64 letters.
+ */
+struct byte_lookup_table
+{
+    //!\brief The value of every byte.
+    std::array<uint8_t, 256> values{};
+    //!\brief Whether all bytes outside of `[window_begin, window_begin + 64)` map to #default_value.
+    bool has_window{false};
+    //!\brief The first byte of the window.
+    uint8_t window_begin{};
+    //!\brief The value of all bytes outside of the window.
+    uint8_t default_value{};
+
+    //!\brief Constructs the table from the values and computes the window.
+    constexpr explicit byte_lookup_table(std::array<uint8_t, 256> const & table_values) : values{table_values}
+    {
+        for (uint8_t const candidate : {values[0], values[255]})
+        {
+            size_t first = 256;
+            size_t last = 0;
+            for (size_t i = 0; i < 256; ++i)
+            {
+                if (values[i] != candidate)
+                {
+                    first = (first == 256) ? i : first;
+                    last = i;
+                }
+            }
+
+            if (first == 256 || last - first < 64)
+            {
+                has_window = true;
+                window_begin = (first == 256) ? 0 : std::min<size_t>(first, 192);
+                default_value = candidate;
+                return;
+            }
+        }
+    }
+};
+
+/*!\brief Maps every byte of a buffer with a seqan3::detail::byte_lookup_table.
+ * \ingroup utility_simd
+ * \tparam reverse Whether the input is read from back to front.
+ * \param[in] input The input buffer.
+ * \param[in] size The number of bytes.
+ * \param[out] output The output buffer, which must not overlap the input unless it is the input and `reverse` is
+ *                    `false`.
+ * \param[in] table The seqan3::detail::byte_lookup_table.
+ *
+ * \details
+ *
+ * Writes `table.values[input[i]]` to `output[i]`, or `table.values[input[size - 1 - i]]` if `reverse` is `true`.
+ *
+ * With AVX512 VBMI, 64 bytes are looked up with two `vpermi2b` instructions, which select from 128 table entries each,
+ * and one blend. With AVX2, tables with a window (see seqan3::detail::byte_lookup_table) are looked up 32 bytes at a
+ * time with four `vpshufb` instructions, which select from 16 table entries each, and three blends. Otherwise and for
+ * the remaining bytes, the table is looked up byte by byte.
+ */
+template <bool reverse>
+inline void
+byte_table_lookup(uint8_t const * input, size_t const size, uint8_t * output, byte_lookup_table const & table) noexcept
+{
+    size_t position = 0;
+
+    // The begin of the next block of the input.
+    [[maybe_unused]] auto block_begin = [&](size_t const block_size)
+    {
+        return reverse ? input + size - position - block_size : input + position;
+    };
+
+#if defined(__AVX512VBMI__)
+    {
+        __m512i const table0 = _mm512_loadu_si512(table.values.data());
+        __m512i const table1 = _mm512_loadu_si512(table.values.data() + 64);
+        __m512i const table2 = _mm512_loadu_si512(table.values.data() + 128);
+        __m512i const table3 = _mm512_loadu_si512(table.values.data() + 192);
+        __m512i const reverse_index = _mm512_set_epi64(0x0001020304050607,
+                                                       0x08090a0b0c0d0e0f,
+                                                       0x1011121314151617,
+                                                       0x18191a1b1c1d1e1f,
+                                                       0x2021222324252627,
+                                                       0x28292a2b2c2d2e2f,
+                                                       0x3031323334353637,
+                                                       0x38393a3b3c3d3e3f);
+
+        for (; position + 64 <= size; position += 64)
+        {
+            __m512i bytes = _mm512_loadu_si512(block_begin(64));
+            if constexpr (reverse) // Same as _mm512_permutexvar_epi8, which triggers -Wmaybe-uninitialized in GCC 12.
+                bytes = _mm512_permutex2var_epi8(bytes, reverse_index, bytes);
+
+            // The lower seven bits select one of 128 entries, the highest bit selects the half of the table.
+            __m512i const low = _mm512_permutex2var_epi8(table0, bytes, table1);
+            __m512i const high = _mm512_permutex2var_epi8(table2, bytes, table3);
+            _mm512_storeu_si512(output + position, _mm512_mask_blend_epi8(_mm512_movepi8_mask(bytes), low, high));
+        }
+    }
+#elif defined(__AVX2__)
+    if (table.has_window)
+    {
+        auto broadcast = [&table](size_t const offset)
+        {
+            return _mm256_broadcastsi128_si256(
+                _mm_loadu_si128(reinterpret_cast<__m128i const *>(table.values.data() + table.window_begin + offset)));
+        };
+
+        __m256i const table0 = broadcast(0);
+        __m256i const table1 = broadcast(16);
+        __m256i const table2 = broadcast(32);
+        __m256i const table3 = broadcast(48);
+        __m256i const window_begin = _mm256_set1_epi8(static_cast<char>(table.window_begin));
+        __m256i const window_last = _mm256_set1_epi8(63);
+        __m256i const default_value = _mm256_set1_epi8(static_cast<char>(table.default_value));
+        __m256i const reverse_index = _mm256_set_epi64x(0x0001020304050607,
+                                                        0x08090a0b0c0d0e0f,
+                                                        0x0001020304050607,
+                                                        0x08090a0b0c0d0e0f);
+
+        for (; position + 32 <= size; position += 32)
+        {
+            __m256i bytes = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(block_begin(32)));
+            if constexpr (reverse)
+                bytes = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(bytes, reverse_index), 0x4e);
+
+            __m256i const index = _mm256_sub_epi8(bytes, window_begin);
+            __m256i const in_window = _mm256_cmpeq_epi8(_mm256_min_epu8(index, window_last), index);
+
+            // vpshufb uses the lower four bits; bits 4 and 5 select one of the four tables. A blend uses the highest
+            // bit of every byte, so the selecting bits are shifted there.
+            __m256i const bit4 = _mm256_slli_epi16(index, 3);
+            __m256i const bit5 = _mm256_slli_epi16(index, 2);
+            __m256i const lookup01 = _mm256_blendv_epi8(_mm256_shuffle_epi8(table0, index),
+                                                        _mm256_shuffle_epi8(table1, index),
+                                                        bit4);
+            __m256i const lookup23 = _mm256_blendv_epi8(_mm256_shuffle_epi8(table2, index),
+                                                        _mm256_shuffle_epi8(table3, index),
+                                                        bit4);
+            __m256i const lookup = _mm256_blendv_epi8(lookup01, lookup23, bit5);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + position),
+                                _mm256_blendv_epi8(default_value, lookup, in_window));
+        }
+    }
+#endif
+
+    for (; position < size; ++position)
+        output[position] = table.values[reverse ? input[size - 1 - position] : input[position]];
+}
+
+} // namespace seqan3::detail
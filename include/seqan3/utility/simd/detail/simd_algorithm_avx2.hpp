@@ -70,6 +70,12 @@ constexpr simd_t extract_quarter_avx2(simd_t const & src);
 template <uint8_t index, simd::simd_concept simd_t>
 constexpr simd_t extract_eighth_avx2(simd_t const & src);
 
+/*!\copydoc seqan3::detail::gather
+ * \attention This is the implementation for AVX2 intrinsics.
+ */
+template <simd::simd_concept simd_t>
+inline simd_t gather_avx2(int32_t const * table, simd_t const & indices);
+
 } // namespace seqan3::detail
 
 //-----------------------------------------------------------------------------
@@ -218,6 +224,24 @@ constexpr simd_t extract_eighth_avx2(simd_t const & src)
         _mm256_castsi128_si256(_mm_cvtsi32_si128(_mm256_extract_epi32(reinterpret_cast<__m256i const &>(src), index))));
 }
 
+template <simd::simd_concept simd_t>
+inline simd_t gather_avx2(int32_t const * table, simd_t const & indices)
+{
+    __m256i const & tmp = reinterpret_cast<__m256i const &>(indices);
+    if constexpr (simd_traits<simd_t>::length == 16) // epi16: gather both halves as epi32 and pack them again.
+    {
+        __m256i lo = _mm256_i32gather_epi32(table, _mm256_cvtepi16_epi32(_mm256_castsi256_si128(tmp)), 4);
+        __m256i hi = _mm256_i32gather_epi32(table, _mm256_cvtepi16_epi32(_mm256_extracti128_si256(tmp, 1)), 4);
+        // The pack operates on 128-bit lanes, so the 64-bit blocks must be reordered to [0, 2, 1, 3] afterwards.
+        return reinterpret_cast<simd_t>(_mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0b1101'1000));
+    }
+    else
+    {
+        static_assert(simd_traits<simd_t>::length == 8, "Expected 16 or 32 bit scalar type.");
+        return reinterpret_cast<simd_t>(_mm256_i32gather_epi32(table, tmp, 4));
+    }
+}
+
 } // namespace seqan3::detail
 
 #endif // __AVX2__
@@ -70,6 +70,12 @@ constexpr simd_t extract_quarter_avx512(simd_t const & src);
 template <uint8_t index, simd::simd_concept simd_t>
 constexpr simd_t extract_eighth_avx512(simd_t const & src);
 
+/*!\copydoc seqan3::detail::gather
+ * \attention This is the implementation for AVX512 intrinsics.
+ */
+template <simd::simd_concept simd_t>
+inline simd_t gather_avx512(int32_t const * table, simd_t const & indices);
+
 } // namespace seqan3::detail
 
 //-----------------------------------------------------------------------------
@@ -276,6 +282,24 @@ constexpr simd_t extract_eighth_avx512(simd_t const & src)
 }
 #    endif // defined(__AVX512DQ__)
 
+template <simd::simd_concept simd_t>
+inline simd_t gather_avx512(int32_t const * table, simd_t const & indices)
+{
+    __m512i const & tmp = reinterpret_cast<__m512i const &>(indices);
+    if constexpr (simd_traits<simd_t>::length == 32) // epi16: gather both halves as epi32 and truncate them again.
+    {
+        __m512i lo = _mm512_i32gather_epi32(_mm512_cvtepi16_epi32(_mm512_castsi512_si256(tmp)), table, 4);
+        __m512i hi = _mm512_i32gather_epi32(_mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(tmp, 1)), table, 4);
+        return reinterpret_cast<simd_t>(
+            _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtepi32_epi16(lo)), _mm512_cvtepi32_epi16(hi), 1));
+    }
+    else
+    {
+        static_assert(simd_traits<simd_t>::length == 16, "Expected 16 or 32 bit scalar type.");
+        return reinterpret_cast<simd_t>(_mm512_i32gather_epi32(tmp, table, 4));
+    }
+}
+
 } // namespace seqan3::detail
 
 #endif // __AVX512F__
@@ -201,6 +201,53 @@ BENCHMARK_TEMPLATE(seqan2_affine_dna4_omp_for, score)->UseRealTime();
 BENCHMARK_TEMPLATE(seqan2_affine_dna4_omp_for, trace)->UseRealTime();
 #endif // defined(SEQAN3_HAS_SEQAN2) && defined(_OPENMP) && !defined(_LIBCPP_VERSION) && !defined(__INTEL_LLVM_COMPILER)
 
+// ============================================================================
+//  affine; score; dna4; single long pair
+// ============================================================================
+
+inline constexpr size_t long_sequence_length = 20'000;
+
+constexpr auto banded_affine_cfg = affine_cfg
+                                 | seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-1000},
+                                                                      seqan3::align_cfg::upper_diagonal{1000}};
+
+// Aliases to beautify the benchmark output
+using full = decltype(affine_cfg);
+using banded = decltype(banded_affine_cfg);
+
+template <typename config_t>
+void seqan3_affine_dna4_parallel_tiles(benchmark::State & state)
+{
+    size_t const tile_size = state.range(0);
+    auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(long_sequence_length, 0, 0);
+    auto seq2 = seqan3::test::generate_sequence<seqan3::dna4>(long_sequence_length, 0, 1);
+
+    auto const cfg = []()
+    {
+        if constexpr (std::same_as<config_t, banded>)
+            return banded_affine_cfg;
+        else
+            return affine_cfg;
+    }();
+
+    int64_t total = 0;
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2),
+                                  cfg | score{}
+                                      | seqan3::align_cfg::parallel_tiles{std::thread::hardware_concurrency(),
+                                                                          static_cast<uint32_t>(tile_size)});
+        total += (*rng.begin()).score();
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)), cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["total"] = total;
+}
+
+BENCHMARK_TEMPLATE(seqan3_affine_dna4_parallel_tiles, full)->UseRealTime()->Arg(128)->Arg(256)->Arg(1024);
+BENCHMARK_TEMPLATE(seqan3_affine_dna4_parallel_tiles, banded)->UseRealTime()->Arg(128)->Arg(256)->Arg(1024);
+
 // ============================================================================
 //  instantiate tests
 // ============================================================================
@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/alignment/configuration/align_config_score_type.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/multiple/align_multiple.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+static auto const scoring_config =
+    seqan3::align_cfg::scoring_scheme{seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::blosum62}};
+static auto const gap_config =
+    seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-11}, seqan3::align_cfg::extension_score{-1}};
+
+inline constexpr size_t sequence_length = 200;
+
+// A protein family: mutated copies of a random ancestor with 20% substitutions, insertions and deletions.
+std::vector<std::vector<seqan3::aa27>> generate_family(size_t const count)
+{
+    std::vector<seqan3::aa27> const ancestor = seqan3::test::generate_sequence<seqan3::aa27>(sequence_length, 0, 0);
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<uint8_t> rank_distribution{0, seqan3::alphabet_size<seqan3::aa27> - 1};
+    std::uniform_int_distribution<size_t> error_distribution{0, 99};
+
+    std::vector<std::vector<seqan3::aa27>> family(count);
+    for (std::vector<seqan3::aa27> & sequence : family)
+    {
+        for (seqan3::aa27 symbol : ancestor)
+        {
+            if (size_t const error = error_distribution(generator); error >= 20)
+                sequence.push_back(symbol);
+            else if (error < 5)
+                sequence.insert(sequence.end(), {symbol, seqan3::aa27{}.assign_rank(rank_distribution(generator))});
+            else if (error < 15)
+                sequence.push_back(seqan3::aa27{}.assign_rank(rank_distribution(generator)));
+        }
+    }
+
+    return family;
+}
+
+uint32_t thread_count(benchmark::State const & state)
+{
+    return state.range(1) ? std::thread::hardware_concurrency() : 1u;
+}
+
+// ============================================================================
+//  stage 1: all-vs-all distances
+// ============================================================================
+
+void distance_matrix(benchmark::State & state)
+{
+    auto const family = generate_family(state.range(0));
+
+    for (auto _ : state)
+    {
+        auto distances =
+            seqan3::detail::compute_distance_matrix(family, scoring_config, gap_config, thread_count(state));
+        benchmark::DoNotOptimize(distances);
+    }
+
+    state.counters["pairs"] = family.size() * (family.size() - 1) / 2;
+}
+
+BENCHMARK(distance_matrix)->ArgsProduct({{100, 400}, {0, 1}})->UseRealTime();
+
+// ============================================================================
+//  stage 2: guide tree
+// ============================================================================
+
+template <seqan3::guide_tree_method method>
+void guide_tree(benchmark::State & state)
+{
+    size_t const count = state.range(0);
+    std::mt19937_64 generator{42};
+    std::uniform_real_distribution<float> distance_distribution{0.0f, 1.0f};
+
+    seqan3::detail::distance_matrix distances{count};
+    for (size_t i = 0; i < count; ++i)
+        for (size_t j = i + 1; j < count; ++j)
+            distances.at(i, j) = distance_distribution(generator);
+
+    for (auto _ : state)
+    {
+        if constexpr (method == seqan3::guide_tree_method::upgma)
+            benchmark::DoNotOptimize(seqan3::detail::upgma_guide_tree(distances));
+        else
+            benchmark::DoNotOptimize(seqan3::detail::neighbour_joining_guide_tree(distances, thread_count(state)));
+    }
+}
+
+BENCHMARK_TEMPLATE(guide_tree, seqan3::guide_tree_method::upgma)->ArgsProduct({{1000, 4000}, {0}})->UseRealTime();
+BENCHMARK_TEMPLATE(guide_tree, seqan3::guide_tree_method::neighbour_joining)
+    ->ArgsProduct({{1000}, {0, 1}})
+    ->UseRealTime();
+
+// ============================================================================
+//  stage 3: progressive profile alignment
+// ============================================================================
+
+void progressive_alignment(benchmark::State & state)
+{
+    auto const family = generate_family(state.range(0));
+    seqan3::detail::guide_tree const tree = seqan3::detail::upgma_guide_tree(
+        seqan3::detail::compute_distance_matrix(family, scoring_config, gap_config, 1u));
+    auto const profile_config =
+        seqan3::align_cfg::method_global{} | scoring_config | gap_config | seqan3::align_cfg::score_type<float>{};
+
+    using row_t = seqan3::gap_decorator<std::vector<seqan3::aa27> const &>;
+    for (auto _ : state)
+    {
+        std::vector<row_t> rows(family.begin(), family.end());
+        seqan3::detail::progressive_alignment<seqan3::aa27>(rows, tree, profile_config, thread_count(state));
+        benchmark::DoNotOptimize(rows);
+    }
+}
+
+BENCHMARK(progressive_alignment)->ArgsProduct({{100, 400}, {0, 1}})->UseRealTime();
+
+// ============================================================================
+//  all stages
+// ============================================================================
+
+template <seqan3::guide_tree_method method>
+void align_multiple(benchmark::State & state)
+{
+    auto const family = generate_family(state.range(0));
+    auto const config = scoring_config | gap_config | seqan3::align_cfg::parallel{thread_count(state)};
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(seqan3::align_multiple(family, config, method));
+}
+
+BENCHMARK_TEMPLATE(align_multiple, seqan3::guide_tree_method::upgma)->ArgsProduct({{100, 400}, {0, 1}})->UseRealTime();
+BENCHMARK_TEMPLATE(align_multiple, seqan3::guide_tree_method::neighbour_joining)
+    ->ArgsProduct({{400}, {0, 1}})
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <cstring>
 #include <numeric>
+#include <random>
 
 #include <seqan3/alphabet/all.hpp>
 #include <seqan3/test/performance/simd_dna4.hpp>
@@ -66,6 +67,43 @@ BENCHMARK_TEMPLATE(assign_char, seqan3::qualified<seqan3::dna4, seqan3::phred42>
 BENCHMARK_TEMPLATE(assign_char, seqan3::qualified<seqan3::dna5, seqan3::phred63>);
 BENCHMARK_TEMPLATE(assign_char, seqan3::qualified<seqan3::dna5, seqan3::phred94>);
 
+// Converts a whole text of random letters, as it is done when reading a sequence file.
+template <seqan3::alphabet alphabet_t, bool bulk>
+void assign_char_range(benchmark::State & state)
+{
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<size_t> rank_distribution{0, seqan3::alphabet_size<alphabet_t> - 1};
+
+    std::string text(1 << 20, ' ');
+    for (char & chr : text)
+        chr = seqan3::to_char(seqan3::assign_rank_to(rank_distribution(generator), alphabet_t{}));
+
+    std::vector<alphabet_t> sequence(text.size());
+    for (auto _ : state)
+    {
+        if constexpr (bulk)
+            seqan3::bulk_char_to(text, sequence);
+        else
+            std::ranges::copy(text | seqan3::views::char_to<alphabet_t>, sequence.begin());
+
+        benchmark::DoNotOptimize(sequence.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+
+BENCHMARK_TEMPLATE(assign_char_range, seqan3::dna4, false);
+BENCHMARK_TEMPLATE(assign_char_range, seqan3::dna4, true);
+BENCHMARK_TEMPLATE(assign_char_range, seqan3::dna5, false);
+BENCHMARK_TEMPLATE(assign_char_range, seqan3::dna5, true);
+BENCHMARK_TEMPLATE(assign_char_range, seqan3::aa27, false);
+BENCHMARK_TEMPLATE(assign_char_range, seqan3::aa27, true);
+BENCHMARK_TEMPLATE(assign_char_range, seqan3::phred42, false);
+BENCHMARK_TEMPLATE(assign_char_range, seqan3::phred42, true);
+BENCHMARK_TEMPLATE(assign_char_range, seqan3::phred94, false);
+BENCHMARK_TEMPLATE(assign_char_range, seqan3::phred94, true);
+
 #if SEQAN3_HAS_SEQAN2
 template <typename alphabet_t>
 void assign_char_seqan2(benchmark::State & state)
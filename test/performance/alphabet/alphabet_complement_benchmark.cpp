@@ -12,6 +12,7 @@
 #include <random>
 
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/range/bulk_conversion.hpp>
 #include <seqan3/alphabet/views/char_to.hpp>
 #include <seqan3/alphabet/views/complement.hpp>
 #include <seqan3/test/performance/simd_dna4.hpp>
@@ -22,7 +23,8 @@ enum class tag
     seqan3_dna4,
     seqan3_dna4_vector,
     seqan3_dna4_simd,
-    seqan3_dna4_simd_vector
+    seqan3_dna4_simd_vector,
+    seqan3_dna4_bulk
 };
 
 class allocator
@@ -103,6 +105,12 @@ static void seqan3_dna4_simd_vector(std::string_view sv, std::vector<seqan3::sim
     std::ranges::copy(revcomp, dest.begin());
 }
 
+static void seqan3_dna4_bulk(std::string_view sv, std::vector<seqan3::dna4> & forward, std::vector<seqan3::dna4> & dest)
+{
+    seqan3::bulk_char_to(sv, forward);
+    seqan3::bulk_reverse_complement(forward, dest);
+}
+
 template <tag id>
 void complement(benchmark::State & state)
 {
@@ -112,8 +120,11 @@ void complement(benchmark::State & state)
     generate_random_dna4_char_string(forward, length);
 
     auto sv = std::string_view{forward};
-    using alphabet_t = std::conditional_t<id == tag::seqan3_dna4_vector, seqan3::dna4, seqan3::simd_dna4>;
+    using alphabet_t = std::conditional_t<id == tag::seqan3_dna4_vector || id == tag::seqan3_dna4_bulk,
+                                          seqan3::dna4,
+                                          seqan3::simd_dna4>;
     std::vector<alphabet_t> vector(length);
+    std::vector<alphabet_t> forward_vector(length);
 
     for (auto _ : state)
     {
@@ -144,6 +155,11 @@ void complement(benchmark::State & state)
             seqan3_dna4_simd_vector(sv, vector);
             benchmark::DoNotOptimize(vector);
         }
+        else if constexpr (id == tag::seqan3_dna4_bulk)
+        {
+            seqan3_dna4_bulk(sv, forward_vector, vector);
+            benchmark::DoNotOptimize(vector);
+        }
         else
         {
             throw std::logic_error{"Invalid tag"};
@@ -156,3 +172,4 @@ BENCHMARK_TEMPLATE(complement, tag::seqan3_dna4);
 BENCHMARK_TEMPLATE(complement, tag::seqan3_dna4_vector);
 BENCHMARK_TEMPLATE(complement, tag::seqan3_dna4_simd);
 BENCHMARK_TEMPLATE(complement, tag::seqan3_dna4_simd_vector);
+BENCHMARK_TEMPLATE(complement, tag::seqan3_dna4_bulk);
@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/views/char_to.hpp>
+#include <seqan3/alphabet/views/complement.hpp>
+#include <seqan3/alphabet/views/to_char.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/utility/range/to.hpp>
+
+inline constexpr size_t sequence_size = 1'000'000;
+
+// Writes the letters of a std::vector element by element through the proxy or with assign().
+template <typename alphabet_t, bool bulk>
+void assign_letters(benchmark::State & state)
+{
+    std::vector<alphabet_t> const letters = seqan3::test::generate_sequence<alphabet_t>(sequence_size);
+    seqan3::bitpacked_sequence<alphabet_t> sequence(sequence_size, alphabet_t{});
+
+    for (auto _ : state)
+    {
+        if constexpr (bulk)
+            sequence.assign(letters);
+        else
+            std::copy(letters.begin(), letters.end(), sequence.begin());
+
+        benchmark::DoNotOptimize(sequence.raw_data().data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * sequence_size);
+}
+
+// Converts a text with seqan3::views::char_to or with assign_chars().
+template <typename alphabet_t, bool bulk>
+void assign_chars(benchmark::State & state)
+{
+    std::string const text = seqan3::test::generate_sequence<alphabet_t>(sequence_size) | seqan3::views::to_char
+                           | seqan3::ranges::to<std::string>();
+    seqan3::bitpacked_sequence<alphabet_t> sequence(sequence_size, alphabet_t{});
+
+    for (auto _ : state)
+    {
+        if constexpr (bulk)
+        {
+            sequence.assign_chars(text);
+        }
+        else
+        {
+            auto letters = text | seqan3::views::char_to<alphabet_t>;
+            std::copy(letters.begin(), letters.end(), sequence.begin());
+        }
+
+        benchmark::DoNotOptimize(sequence.raw_data().data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * sequence_size);
+}
+
+// Converts the letters to a text with seqan3::views::to_char or with copy_chars_to().
+template <typename alphabet_t, bool bulk>
+void copy_chars(benchmark::State & state)
+{
+    seqan3::bitpacked_sequence<alphabet_t> const sequence{seqan3::test::generate_sequence<alphabet_t>(sequence_size)};
+    std::string text(sequence_size, ' ');
+
+    for (auto _ : state)
+    {
+        if constexpr (bulk)
+            sequence.copy_chars_to(text);
+        else
+            std::ranges::copy(sequence | seqan3::views::to_char, text.begin());
+
+        benchmark::DoNotOptimize(text.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * sequence_size);
+}
+
+// Computes the reverse complement with seqan3::views::complement or with reverse_complement().
+template <typename alphabet_t, bool bulk>
+void reverse_complement(benchmark::State & state)
+{
+    seqan3::bitpacked_sequence<alphabet_t> sequence{seqan3::test::generate_sequence<alphabet_t>(sequence_size)};
+    seqan3::bitpacked_sequence<alphabet_t> reverse_complement_sequence(sequence_size, alphabet_t{});
+
+    for (auto _ : state)
+    {
+        if constexpr (bulk)
+        {
+            sequence.reverse_complement();
+        }
+        else
+        {
+            auto letters = sequence | std::views::reverse | seqan3::views::complement;
+            std::copy(letters.begin(), letters.end(), reverse_complement_sequence.begin());
+        }
+
+        benchmark::DoNotOptimize(sequence.raw_data().data());
+        benchmark::DoNotOptimize(reverse_complement_sequence.raw_data().data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * sequence_size);
+}
+
+BENCHMARK_TEMPLATE(assign_letters, seqan3::dna4, false);
+BENCHMARK_TEMPLATE(assign_letters, seqan3::dna4, true);
+BENCHMARK_TEMPLATE(assign_letters, seqan3::dna5, false);
+BENCHMARK_TEMPLATE(assign_letters, seqan3::dna5, true);
+BENCHMARK_TEMPLATE(assign_letters, seqan3::aa27, false);
+BENCHMARK_TEMPLATE(assign_letters, seqan3::aa27, true);
+
+BENCHMARK_TEMPLATE(assign_chars, seqan3::dna4, false);
+BENCHMARK_TEMPLATE(assign_chars, seqan3::dna4, true);
+BENCHMARK_TEMPLATE(assign_chars, seqan3::dna5, false);
+BENCHMARK_TEMPLATE(assign_chars, seqan3::dna5, true);
+BENCHMARK_TEMPLATE(assign_chars, seqan3::aa27, false);
+BENCHMARK_TEMPLATE(assign_chars, seqan3::aa27, true);
+
+BENCHMARK_TEMPLATE(copy_chars, seqan3::dna4, false);
+BENCHMARK_TEMPLATE(copy_chars, seqan3::dna4, true);
+BENCHMARK_TEMPLATE(copy_chars, seqan3::dna5, false);
+BENCHMARK_TEMPLATE(copy_chars, seqan3::dna5, true);
+BENCHMARK_TEMPLATE(copy_chars, seqan3::aa27, false);
+BENCHMARK_TEMPLATE(copy_chars, seqan3::aa27, true);
+
+BENCHMARK_TEMPLATE(reverse_complement, seqan3::dna4, false);
+BENCHMARK_TEMPLATE(reverse_complement, seqan3::dna4, true);
+BENCHMARK_TEMPLATE(reverse_complement, seqan3::dna5, false);
+BENCHMARK_TEMPLATE(reverse_complement, seqan3::dna5, true);
+
+BENCHMARK_MAIN();
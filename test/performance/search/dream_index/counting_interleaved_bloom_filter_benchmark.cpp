@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/search/dream_index/counting_interleaved_bloom_filter.hpp>
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+#include <seqan3/test/compatibility/benchmark.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/utility/views/zip.hpp>
+
+inline benchmark::Counter hashes_per_second(size_t const count)
+{
+    return benchmark::Counter(count, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1000);
+}
+
+static void arguments(benchmark::Benchmark * b)
+{
+    // Bins must be powers of two
+    for (int32_t bins : {64, 1024})
+    {
+        // Size of the filter will be 2^bits counters
+        for (int32_t bits = 15; bits <= 20; bits += 5)
+        {
+            // The counters per bin must fit in an int32_t
+            if (bits - std::countr_zero(static_cast<uint32_t>(bins)) < 32)
+                b->Args({bins, (1LL << bits) / bins, 2, 1000});
+        }
+    }
+}
+
+template <typename ibf_type>
+auto set_up(size_t bins, size_t bits, size_t hash_num, size_t sequence_length)
+{
+    auto bin_indices = seqan3::test::generate_numeric_sequence<size_t>(sequence_length, 0u, bins - 1);
+    auto hash_values = seqan3::test::generate_numeric_sequence<size_t>(sequence_length);
+    ibf_type ibf{seqan3::bin_count{bins}, seqan3::bin_size{bits}, seqan3::hash_function_count{hash_num}};
+
+    for (auto [hash, bin] : seqan3::views::zip(hash_values, bin_indices))
+        ibf.emplace(hash, seqan3::bin_index{bin});
+
+    return std::make_tuple(bin_indices, hash_values, ibf);
+}
+
+template <typename ibf_type>
+void emplace_benchmark(::benchmark::State & state)
+{
+    auto && [bin_indices, hash_values, ibf] =
+        set_up<ibf_type>(state.range(0), state.range(1), state.range(2), state.range(3));
+
+    for (auto _ : state)
+    {
+        for (auto [hash, bin] : seqan3::views::zip(hash_values, bin_indices))
+            ibf.emplace(hash, seqan3::bin_index{bin});
+    }
+
+    state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
+}
+
+template <typename ibf_type>
+void bulk_abundance_benchmark(::benchmark::State & state)
+{
+    auto && [bin_indices, hash_values, ibf] =
+        set_up<ibf_type>(state.range(0), state.range(1), state.range(2), state.range(3));
+    (void)bin_indices;
+
+    auto agent = ibf.counting_agent();
+    for (auto _ : state)
+    {
+        for (auto hash : hash_values)
+        {
+            auto & res = agent.bulk_abundance(hash);
+            benchmark::DoNotOptimize(res.data());
+        }
+    }
+
+    state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
+}
+
+template <typename ibf_type>
+void bulk_count_benchmark(::benchmark::State & state)
+{
+    auto && [bin_indices, hash_values, ibf] =
+        set_up<ibf_type>(state.range(0), state.range(1), state.range(2), state.range(3));
+    (void)bin_indices;
+
+    auto agent = ibf.counting_agent();
+    for (auto _ : state)
+    {
+        auto & res = agent.bulk_count(hash_values);
+        benchmark::DoNotOptimize(res.data());
+    }
+
+    state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
+}
+
+BENCHMARK_TEMPLATE(emplace_benchmark, seqan3::counting_interleaved_bloom_filter<4>)->Apply(arguments);
+BENCHMARK_TEMPLATE(emplace_benchmark, seqan3::counting_interleaved_bloom_filter<8>)->Apply(arguments);
+
+BENCHMARK_TEMPLATE(bulk_abundance_benchmark, seqan3::counting_interleaved_bloom_filter<4>)->Apply(arguments);
+BENCHMARK_TEMPLATE(bulk_abundance_benchmark, seqan3::counting_interleaved_bloom_filter<8>)->Apply(arguments);
+
+// The seqan3::interleaved_bloom_filter counts how many values are in each bin, which is the baseline for adding up
+// the counts of all values.
+BENCHMARK_TEMPLATE(bulk_count_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)
+    ->Apply(arguments);
+BENCHMARK_TEMPLATE(bulk_count_benchmark, seqan3::counting_interleaved_bloom_filter<4>)->Apply(arguments);
+BENCHMARK_TEMPLATE(bulk_count_benchmark, seqan3::counting_interleaved_bloom_filter<8>)->Apply(arguments);
+
+BENCHMARK_MAIN();
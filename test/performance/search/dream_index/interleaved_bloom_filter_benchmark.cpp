@@ -35,6 +35,12 @@ static void arguments(benchmark::Benchmark * b)
     }
 }
 
+// An Interleaved Bloom Filter of 128 MiB that does not fit into the cache, queried with many values.
+static void large_arguments(benchmark::Benchmark * b)
+{
+    b->Args({1024, 1LL << 20, 2, 1 << 20});
+}
+
 template <typename ibf_type>
 auto set_up(size_t bins, size_t bits, size_t hash_num, size_t sequence_length)
 {
@@ -44,6 +50,10 @@ auto set_up(size_t bins, size_t bits, size_t hash_num, size_t sequence_length)
                                              seqan3::bin_size{bits},
                                              seqan3::hash_function_count{hash_num});
 
+    // Writing the rows also makes sure that the memory of large filters is actually allocated.
+    for (auto [hash, bin] : seqan3::views::zip(hash_values, bin_indices))
+        tmp_ibf.emplace(hash, seqan3::bin_index{bin});
+
     ibf_type ibf{std::move(tmp_ibf)};
 
     return std::make_tuple(bin_indices, hash_values, ibf);
@@ -130,6 +140,26 @@ void bulk_contains_benchmark(::benchmark::State & state)
     state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
 }
 
+template <typename ibf_type>
+void bulk_contains_range_benchmark(::benchmark::State & state)
+{
+    auto && [bin_indices, hash_values, ibf] =
+        set_up<ibf_type>(state.range(0), state.range(1), state.range(2), state.range(3));
+    (void)bin_indices;
+
+    auto agent = ibf.membership_agent();
+    for (auto _ : state)
+    {
+        agent.bulk_contains(hash_values,
+                            [](auto const & res)
+                            {
+                                benchmark::DoNotOptimize(res);
+                            });
+    }
+
+    state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
+}
+
 template <typename ibf_type>
 void bulk_count_benchmark(::benchmark::State & state)
 {
@@ -158,9 +188,22 @@ BENCHMARK_TEMPLATE(bulk_contains_benchmark, seqan3::interleaved_bloom_filter<seq
 BENCHMARK_TEMPLATE(bulk_contains_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed>)
     ->Apply(arguments);
 
+BENCHMARK_TEMPLATE(bulk_contains_range_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)
+    ->Apply(arguments);
+BENCHMARK_TEMPLATE(bulk_contains_range_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed>)
+    ->Apply(arguments);
+
 BENCHMARK_TEMPLATE(bulk_count_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)
     ->Apply(arguments);
 BENCHMARK_TEMPLATE(bulk_count_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed>)
     ->Apply(arguments);
 
+// Looking up one value after another versus in prefetched batches.
+BENCHMARK_TEMPLATE(bulk_contains_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)
+    ->Apply(large_arguments);
+BENCHMARK_TEMPLATE(bulk_contains_range_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)
+    ->Apply(large_arguments);
+BENCHMARK_TEMPLATE(bulk_count_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)
+    ->Apply(large_arguments);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+#include <seqan3/search/dream_index/mapped_interleaved_bloom_filter.hpp>
+#include <seqan3/test/compatibility/benchmark.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/tmp_directory.hpp>
+#include <seqan3/utility/views/zip.hpp>
+
+inline benchmark::Counter hashes_per_second(size_t const count)
+{
+    return benchmark::Counter(count, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1000);
+}
+
+static void arguments(benchmark::Benchmark * b)
+{
+    // bins, bits per bin, number of hash functions, number of values, number of shards
+    for (int32_t shards : {1, 4})
+    {
+        b->Args({1024, 1LL << 12, 2, 1000, shards});
+        b->Args({1024, 1LL << 20, 2, 1 << 20, shards});
+    }
+}
+
+struct set_up
+{
+    seqan3::test::tmp_directory tmp{};
+    std::vector<size_t> hash_values{};
+    seqan3::interleaved_bloom_filter<> ibf{};
+    std::vector<std::filesystem::path> paths{};
+
+    explicit set_up(::benchmark::State const & state)
+    {
+        size_t const bins = state.range(0);
+        size_t const sequence_length = state.range(3);
+        size_t const shards = state.range(4);
+
+        auto bin_indices = seqan3::test::generate_numeric_sequence<size_t>(sequence_length, 0u, bins - 1);
+        hash_values = seqan3::test::generate_numeric_sequence<size_t>(sequence_length);
+        ibf = seqan3::interleaved_bloom_filter<>{seqan3::bin_count{bins},
+                                                 seqan3::bin_size{static_cast<size_t>(state.range(1))},
+                                                 seqan3::hash_function_count{static_cast<size_t>(state.range(2))}};
+
+        for (auto [hash, bin] : seqan3::views::zip(hash_values, bin_indices))
+            ibf.emplace(hash, seqan3::bin_index{bin});
+
+        size_t const shard_bins = bins / shards;
+        for (size_t shard = 0; shard < shards; ++shard)
+        {
+            paths.push_back(tmp.path() / (std::to_string(shard) + ".ibf"));
+            ibf.write(paths.back(), seqan3::bin_index{shard * shard_bins}, seqan3::bin_count{shard_bins});
+        }
+    }
+};
+
+void open_benchmark(::benchmark::State & state)
+{
+    set_up data{state};
+
+    for (auto _ : state)
+    {
+        seqan3::sharded_interleaved_bloom_filter sharded{data.paths};
+        benchmark::DoNotOptimize(sharded.bin_count());
+    }
+}
+
+void bulk_count_benchmark(::benchmark::State & state)
+{
+    set_up data{state};
+
+    auto agent = data.ibf.counting_agent();
+    for (auto _ : state)
+    {
+        auto & res = agent.bulk_count(data.hash_values);
+        benchmark::DoNotOptimize(res.data());
+    }
+
+    state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(data.hash_values));
+}
+
+void mapped_bulk_count_benchmark(::benchmark::State & state)
+{
+    set_up data{state};
+    seqan3::sharded_interleaved_bloom_filter sharded{data.paths};
+
+    auto agent = sharded.counting_agent();
+    for (auto _ : state)
+    {
+        auto & res = agent.bulk_count(data.hash_values);
+        benchmark::DoNotOptimize(res.data());
+    }
+
+    state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(data.hash_values));
+}
+
+BENCHMARK(open_benchmark)->Apply(arguments);
+// The in-memory seqan3::interleaved_bloom_filter is the baseline; it does not depend on the number of shards.
+BENCHMARK(bulk_count_benchmark)->Apply(arguments);
+BENCHMARK(mapped_bulk_count_benchmark)->Apply(arguments);
+
+BENCHMARK_MAIN();
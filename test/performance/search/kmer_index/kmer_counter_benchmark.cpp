@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <unordered_map>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/kmer_index/kmer_counter.hpp>
+#include <seqan3/search/views/canonical_kmer_hash.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+static constexpr size_t sequence_count{64u};
+static constexpr size_t sequence_length{1u << 16};
+
+static std::vector<std::vector<seqan3::dna4>> const & sequences()
+{
+    static std::vector<std::vector<seqan3::dna4>> const text = []()
+    {
+        std::vector<std::vector<seqan3::dna4>> result{};
+        for (size_t seed = 0; seed < sequence_count; ++seed)
+            result.push_back(seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0u, seed));
+        return result;
+    }();
+
+    return text;
+}
+
+static void set_counters(benchmark::State & state)
+{
+    state.counters["kmers/s"] = benchmark::Counter(sequence_count * sequence_length,
+                                                   benchmark::Counter::kIsIterationInvariantRate,
+                                                   benchmark::Counter::OneK::kIs1000);
+}
+
+// The baseline: a hash map over seqan3::views::canonical_kmer_hash.
+static void unordered_map(benchmark::State & state)
+{
+    for (auto _ : state)
+    {
+        std::unordered_map<uint64_t, uint64_t> counts{};
+        for (auto const & sequence : sequences())
+            for (uint64_t const hash : sequence | seqan3::views::canonical_kmer_hash(seqan3::ungapped{21}))
+                ++counts[hash];
+
+        benchmark::DoNotOptimize(counts.size());
+    }
+
+    set_counters(state);
+}
+
+BENCHMARK(unordered_map)->UseRealTime();
+
+static void kmer_counter(benchmark::State & state)
+{
+    seqan3::kmer_counter_parameters parameters{.thread_count = static_cast<size_t>(state.range(0)),
+                                               .memory_limit = static_cast<size_t>(state.range(1))};
+
+    for (auto _ : state)
+    {
+        seqan3::kmer_counter counter{seqan3::ungapped{21}, parameters};
+        counter.count(sequences());
+        benchmark::DoNotOptimize(counter.histogram());
+    }
+
+    set_counters(state);
+}
+
+// The second argument is the memory limit; with 16 MiB the counts are written to disk several times.
+BENCHMARK(kmer_counter)->Args({1, 1 << 30})->Args({4, 1 << 30})->Args({4, 1 << 24})->UseRealTime();
+
+BENCHMARK_MAIN();
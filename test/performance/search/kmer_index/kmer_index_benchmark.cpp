@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/container/concatenated_sequences.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/kmer_index/kmer_index.hpp>
+#include <seqan3/search/views/canonical_kmer_hash.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/utility/range/to.hpp>
+
+static constexpr size_t sequence_count{16u};
+static constexpr size_t sequence_length{1u << 18};
+static constexpr size_t query_count{1u << 16};
+
+static seqan3::concatenated_sequences<std::vector<seqan3::dna4>> const & sequences()
+{
+    static seqan3::concatenated_sequences<std::vector<seqan3::dna4>> const text = []()
+    {
+        seqan3::concatenated_sequences<std::vector<seqan3::dna4>> result{};
+        for (size_t seed = 0; seed < sequence_count; ++seed)
+            result.push_back(seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0u, seed));
+        return result;
+    }();
+
+    return text;
+}
+
+// Half of the queries occur in the text.
+static std::vector<uint64_t> queries(seqan3::shape const & kmer_shape)
+{
+    std::vector<uint64_t> hashes = seqan3::test::generate_sequence<seqan3::dna4>(query_count / 2u, 0u, 42u)
+                                 | seqan3::views::canonical_kmer_hash(kmer_shape)
+                                 | seqan3::ranges::to<std::vector>();
+    for (auto && sequence : sequences())
+    {
+        std::vector<uint64_t> const kmers =
+            sequence | seqan3::views::canonical_kmer_hash(kmer_shape) | seqan3::ranges::to<std::vector>();
+        for (size_t i = 0; i < kmers.size(); i += 256u)
+            hashes.push_back(kmers[i]);
+    }
+    return hashes;
+}
+
+static void construction(benchmark::State & state)
+{
+    size_t const thread_count = state.range(0);
+
+    for (auto _ : state)
+    {
+        seqan3::kmer_index index{sequences(), seqan3::ungapped{21}, thread_count};
+        benchmark::DoNotOptimize(index.size());
+    }
+
+    state.counters["kmers/s"] = benchmark::Counter(sequence_count * sequence_length,
+                                                   benchmark::Counter::kIsIterationInvariantRate,
+                                                   benchmark::Counter::OneK::kIs1000);
+}
+
+BENCHMARK(construction)->Arg(1)->Arg(4)->UseRealTime();
+
+template <bool bulk>
+static void find(benchmark::State & state)
+{
+    seqan3::kmer_index const index{sequences(), seqan3::ungapped{21}, 4u};
+    std::vector<uint64_t> const hashes = queries(seqan3::ungapped{21});
+    std::vector<std::span<seqan3::kmer_occurrence const>> results(hashes.size());
+    size_t occurrence_count{};
+
+    for (auto _ : state)
+    {
+        if constexpr (bulk)
+        {
+            index.find(hashes, results);
+        }
+        else
+        {
+            for (size_t i = 0; i < hashes.size(); ++i)
+                results[i] = index.find(hashes[i]);
+        }
+
+        for (auto const & occurrences : results)
+            occurrence_count += occurrences.size();
+    }
+
+    benchmark::DoNotOptimize(occurrence_count);
+    state.counters["queries/s"] = benchmark::Counter(hashes.size(),
+                                                     benchmark::Counter::kIsIterationInvariantRate,
+                                                     benchmark::Counter::OneK::kIs1000);
+}
+
+BENCHMARK_TEMPLATE(find, false);
+BENCHMARK_TEMPLATE(find, true);
+
+BENCHMARK_MAIN();
@@ -4,6 +4,8 @@
 
 #include <benchmark/benchmark.h>
 
+#include <array>
+
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/search/views/kmer_hash.hpp>
 #include <seqan3/test/compatibility/benchmark.hpp>
@@ -88,6 +90,44 @@ static void seqan_kmer_hash_gapped(benchmark::State & state)
     state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - k + 1);
 }
 
+// Spaced seeds as used by read mappers, with a span of 18, 32 and 50 positions.
+static void spaced_seed_arguments(benchmark::Benchmark * b)
+{
+    for (int32_t sequence_length : {1000, 50000})
+    {
+        for (int32_t seed : {0, 1, 2})
+        {
+            b->Args({sequence_length, seed});
+        }
+    }
+}
+
+static void seqan_kmer_hash_spaced_seed(benchmark::State & state)
+{
+    using seqan3::operator""_shape;
+
+    auto sequence_length = state.range(0);
+    assert(sequence_length > 0);
+    std::array<seqan3::shape, 3> const seeds{0b111010010100110111_shape,
+                                             0b11011011000011011011011000011011_shape,
+                                             0b11001011'10001101'10100111'00110111'01100011'01001101'01_shape};
+    seqan3::shape const & shape = seeds[state.range(1)];
+    auto seq = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+
+    size_t sum{0};
+
+    for (auto _ : state)
+    {
+        for (auto h : seq | seqan3::views::kmer_hash(shape))
+            benchmark::DoNotOptimize(sum += h);
+    }
+
+    // prevent complete optimisation
+    [[maybe_unused]] volatile auto fin = sum;
+
+    state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - shape.size() + 1);
+}
+
 static void naive_kmer_hash(benchmark::State & state)
 {
     auto sequence_length = state.range(0);
@@ -197,6 +237,7 @@ BENCHMARK(seqan2_kmer_hash_gapped)->Apply(arguments);
 
 BENCHMARK(seqan_kmer_hash_ungapped)->Apply(arguments);
 BENCHMARK(seqan_kmer_hash_gapped)->Apply(arguments);
+BENCHMARK(seqan_kmer_hash_spaced_seed)->Apply(spaced_seed_arguments);
 BENCHMARK(naive_kmer_hash)->Apply(arguments);
 
 BENCHMARK_MAIN();
@@ -5,10 +5,14 @@
 #include <benchmark/benchmark.h>
 
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/views/complement.hpp>
+#include <seqan3/search/detail/window_minimum.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
 #include <seqan3/search/views/minimiser_hash.hpp>
 #include <seqan3/test/compatibility/benchmark.hpp>
 #include <seqan3/test/performance/sequence_generator.hpp>
 #include <seqan3/test/performance/units.hpp>
+#include <seqan3/utility/range/to.hpp>
 #include <seqan3/utility/views/zip.hpp>
 
 #ifdef SEQAN3_HAS_SEQAN2
@@ -203,6 +207,51 @@ void compute_minimisers_on_poly_A_sequence(benchmark::State & state)
     state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - k + 1);
 }
 
+enum class window_method_tag
+{
+    view,
+    batch
+};
+
+// Computes the minimisers of precomputed hash values, i.e. only the sliding window minimum.
+template <window_method_tag tag, bool poly_A>
+void compute_window_minimisers(benchmark::State & state)
+{
+    auto sequence_length = state.range(0);
+    size_t k = static_cast<size_t>(state.range(1));
+    size_t w = static_cast<size_t>(state.range(2));
+    assert(sequence_length > 0);
+    assert(k > 0);
+    assert(w > k);
+    auto seq = poly_A ? std::vector<seqan3::dna4>(sequence_length)
+                      : seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    seqan3::shape const shape = seqan3::ungapped{static_cast<uint8_t>(k)};
+    std::vector<uint64_t> const hashes =
+        seq | seqan3::views::canonical_kmer_hash(shape) | seqan3::ranges::to<std::vector>();
+    size_t const hash_window_size = w - k + 1;
+
+    std::vector<size_t> positions(hashes.size());
+    seqan3::detail::window_minimum_batch<uint64_t> batch{hash_window_size};
+    size_t sum{0};
+
+    for (auto _ : state)
+    {
+        if constexpr (tag == window_method_tag::view)
+        {
+            for (auto h : hashes | seqan3::views::minimiser(hash_window_size))
+                benchmark::DoNotOptimize(sum += h);
+        }
+        else
+        {
+            size_t const count = batch(hashes, positions);
+            for (size_t i = 0; i < count; ++i)
+                benchmark::DoNotOptimize(sum += hashes[positions[i]]);
+        }
+    }
+
+    state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - k + 1);
+}
+
 #ifdef SEQAN3_HAS_SEQAN2
 BENCHMARK_TEMPLATE(compute_minimisers, method_tag::seqan2_ungapped)->Apply(arguments);
 BENCHMARK_TEMPLATE(compute_minimisers, method_tag::seqan2_gapped)->Apply(arguments);
@@ -215,4 +264,9 @@ BENCHMARK_TEMPLATE(compute_minimisers, method_tag::seqan3_gapped)->Apply(argumen
 BENCHMARK_TEMPLATE(compute_minimisers_on_poly_A_sequence, method_tag::seqan3_ungapped)->Apply(arguments);
 BENCHMARK_TEMPLATE(compute_minimisers_on_poly_A_sequence, method_tag::seqan3_gapped)->Apply(arguments);
 
+BENCHMARK_TEMPLATE(compute_window_minimisers, window_method_tag::view, false)->Apply(arguments);
+BENCHMARK_TEMPLATE(compute_window_minimisers, window_method_tag::batch, false)->Apply(arguments);
+BENCHMARK_TEMPLATE(compute_window_minimisers, window_method_tag::view, true)->Apply(arguments);
+BENCHMARK_TEMPLATE(compute_window_minimisers, window_method_tag::batch, true)->Apply(arguments);
+
 BENCHMARK_MAIN();
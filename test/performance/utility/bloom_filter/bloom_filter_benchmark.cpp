@@ -29,11 +29,20 @@ static void arguments(benchmark::Benchmark * b)
     }
 }
 
+// Filters that do not fit into the cache, queried with many values, to compare the layouts.
+static void layout_arguments(benchmark::Benchmark * b)
+{
+    for (int32_t bits : {20, 30})
+        b->Args({(1LL << bits), 3, 1 << 20});
+}
+
 template <typename bf_type>
 auto set_up(size_t bits, size_t hash_num, size_t sequence_length)
 {
     auto hash_values = seqan3::test::generate_numeric_sequence<size_t>(sequence_length);
-    seqan3::bloom_filter tmp_bf(seqan3::bin_size{bits}, seqan3::hash_function_count{hash_num});
+    seqan3::bloom_filter<seqan3::data_layout::uncompressed, bf_type::layout> tmp_bf(
+        seqan3::bin_size{bits},
+        seqan3::hash_function_count{hash_num});
 
     bf_type bf{std::move(tmp_bf)};
 
@@ -83,6 +92,21 @@ void contains_benchmark(::benchmark::State & state)
     state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
 }
 
+template <typename bf_type>
+void bulk_contains_benchmark(::benchmark::State & state)
+{
+    auto && [hash_values, bf] = set_up<bf_type>(state.range(0), state.range(1), state.range(2));
+    std::unique_ptr<bool[]> results{new bool[hash_values.size()]};
+
+    for (auto _ : state)
+    {
+        bf.bulk_contains(hash_values, std::span<bool>{results.get(), hash_values.size()});
+        benchmark::DoNotOptimize(results.get());
+    }
+
+    state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
+}
+
 template <typename bf_type>
 void count_benchmark(::benchmark::State & state)
 {
@@ -106,4 +130,18 @@ BENCHMARK_TEMPLATE(contains_benchmark, seqan3::bloom_filter<seqan3::data_layout:
 BENCHMARK_TEMPLATE(count_benchmark, seqan3::bloom_filter<seqan3::data_layout::uncompressed>)->Apply(arguments);
 BENCHMARK_TEMPLATE(count_benchmark, seqan3::bloom_filter<seqan3::data_layout::compressed>)->Apply(arguments);
 
+using standard_bf = seqan3::bloom_filter<seqan3::data_layout::uncompressed, seqan3::bloom_filter_layout::standard>;
+using blocked_bf = seqan3::bloom_filter<seqan3::data_layout::uncompressed, seqan3::bloom_filter_layout::blocked>;
+
+BENCHMARK_TEMPLATE(emplace_benchmark, blocked_bf)->Apply(arguments);
+BENCHMARK_TEMPLATE(contains_benchmark, blocked_bf)->Apply(arguments);
+BENCHMARK_TEMPLATE(count_benchmark, blocked_bf)->Apply(arguments);
+
+BENCHMARK_TEMPLATE(contains_benchmark, standard_bf)->Apply(layout_arguments);
+BENCHMARK_TEMPLATE(contains_benchmark, blocked_bf)->Apply(layout_arguments);
+BENCHMARK_TEMPLATE(bulk_contains_benchmark, standard_bf)->Apply(layout_arguments);
+BENCHMARK_TEMPLATE(bulk_contains_benchmark, blocked_bf)->Apply(layout_arguments);
+BENCHMARK_TEMPLATE(count_benchmark, standard_bf)->Apply(layout_arguments);
+BENCHMARK_TEMPLATE(count_benchmark, blocked_bf)->Apply(layout_arguments);
+
 BENCHMARK_MAIN();
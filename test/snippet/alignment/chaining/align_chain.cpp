@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <unordered_map>
+#include <vector>
+
+#include <seqan3/alignment/chaining/align_chain.hpp>
+#include <seqan3/alignment/chaining/chain_anchors.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    seqan3::dna4_vector reference{"ACGTGACTTACGGATCCATTAGCAGGCATCGATCAGTACCGATTACAGGTCA"_dna4};
+    seqan3::dna4_vector query{"TTTACGTGACTTACGGATCATTAGCAGGCATCGTTCAGTACCGATTACAGGTCA"_dna4};
+
+    // Anchors are shared 8-mers.
+    uint8_t const k = 8;
+    std::unordered_multimap<size_t, size_t> reference_kmers{};
+    size_t position = 0;
+    for (size_t hash : reference | seqan3::views::kmer_hash(seqan3::ungapped{k}))
+        reference_kmers.emplace(hash, position++);
+
+    std::vector<seqan3::anchor> anchors{};
+    position = 0;
+    for (size_t hash : query | seqan3::views::kmer_hash(seqan3::ungapped{k}))
+    {
+        auto [first, last] = reference_kmers.equal_range(hash);
+        for (; first != last; ++first)
+            anchors.push_back(seqan3::anchor{first->second, position, k});
+        ++position;
+    }
+
+    std::vector<seqan3::anchor_chain> chains = seqan3::chain_anchors(anchors, {.min_score = 20});
+
+    seqan3::nucleotide_scoring_scheme scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}};
+    seqan3::align_cfg::gap_cost_affine gap_costs{seqan3::align_cfg::open_score{-10},
+                                                 seqan3::align_cfg::extension_score{-1}};
+    auto const config = seqan3::align_cfg::scoring_scheme{scheme} | gap_costs;
+
+    seqan3::chain_alignment alignment = seqan3::align_chain(reference, query, chains[0], config);
+
+    seqan3::debug_stream << "score: " << alignment.score << '\n';
+    seqan3::debug_stream << "reference: [" << alignment.reference_begin_position << ", "
+                         << alignment.reference_end_position << ")\n";
+    seqan3::debug_stream << "cigar: " << alignment.cigar_sequence << '\n';
+}
@@ -0,0 +1,14 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <seqan3/alignment/configuration/align_config_linear_memory.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+
+int main()
+{
+    // Compute the alignment of a global alignment using only linear memory.
+    auto cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::output_alignment{}
+             | seqan3::align_cfg::linear_memory{};
+}
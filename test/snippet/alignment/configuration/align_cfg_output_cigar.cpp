@@ -0,0 +1,39 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <iostream>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    seqan3::dna4_vector reference = "ACGTGACTGACTTTACGTGACTGA"_dna4;
+    seqan3::dna4_vector read = "GACTGACTACGTCACTG"_dna4;
+
+    // Compute the CIGAR string of the local alignment without building the aligned sequences.
+    auto config = seqan3::align_cfg::method_local{}
+                | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                                      seqan3::mismatch_score{-3}}}
+                | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-5},
+                                                     seqan3::align_cfg::extension_score{-2}}
+                | seqan3::align_cfg::output_begin_position{} | seqan3::align_cfg::output_cigar{};
+
+    for (auto const & result : seqan3::align_pairwise(std::tie(reference, read), config))
+    {
+        std::cout << "Begin: (" << result.sequence1_begin_position() << ',' << result.sequence2_begin_position()
+                  << ")\n";
+        std::cout << "CIGAR: ";
+        for (auto const & operation : result.cigar_sequence())
+            std::cout << operation.to_string();
+        std::cout << '\n';
+    }
+}
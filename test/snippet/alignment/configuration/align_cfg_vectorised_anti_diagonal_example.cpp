@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <iostream>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    seqan3::dna4_vector sequence1 = "ACGTGAACTGACACGTGAACTGACACGTGAACTGAC"_dna4;
+    seqan3::dna4_vector sequence2 = "ACGTGACTGACACGTGAACTGACACGTGACCTGAC"_dna4;
+
+    // Compute the score of a single banded global alignment vectorised along the anti-diagonals.
+    auto config = seqan3::align_cfg::method_global{}
+                | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                                      seqan3::mismatch_score{-3}}}
+                | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-5},
+                                                     seqan3::align_cfg::extension_score{-2}}
+                | seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-4},
+                                                     seqan3::align_cfg::upper_diagonal{4}}
+                | seqan3::align_cfg::vectorised_anti_diagonal{} | seqan3::align_cfg::output_score{};
+
+    for (auto const & result : seqan3::align_pairwise(std::tie(sequence1, sequence2), config))
+        std::cout << "Score: " << result.score() << '\n';
+}
@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    seqan3::dna4_vector sequence1 = "ACGTGAACTGACACGTGAACTGACACGTGAACTGAC"_dna4;
+    seqan3::dna4_vector sequence2 = "ACGTGACTGACACGTGAACTGACACGTGACCTGAC"_dna4;
+
+    // Compute the global alignment of two similar sequences with the wavefront alignment algorithm.
+    auto config = seqan3::align_cfg::method_global{}
+                | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                                      seqan3::mismatch_score{-3}}}
+                | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-5},
+                                                     seqan3::align_cfg::extension_score{-2}}
+                | seqan3::align_cfg::wavefront{} | seqan3::align_cfg::output_score{}
+                | seqan3::align_cfg::output_alignment{};
+
+    for (auto const & result : seqan3::align_pairwise(std::tie(sequence1, sequence2), config))
+    {
+        seqan3::debug_stream << "Score: " << result.score() << '\n';
+        seqan3::debug_stream << result.alignment() << '\n';
+    }
+}
@@ -0,0 +1,33 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/multiple/align_multiple.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    std::vector<std::vector<seqan3::dna4>> sequences{"ACGTGACTTACG"_dna4,
+                                                     "ACGTACTTACG"_dna4,
+                                                     "ACGTGACTTTACG"_dna4,
+                                                     "AGTGACTTACG"_dna4};
+
+    auto const config =
+        seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                            seqan3::mismatch_score{-5}}}
+        | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10}, seqan3::align_cfg::extension_score{-1}}
+        | seqan3::align_cfg::parallel{4};
+
+    // One gapped row per sequence.
+    for (auto const & row : seqan3::align_multiple(sequences, config))
+        seqan3::debug_stream << row << '\n';
+}
@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <vector>
+
+#include <seqan3/alphabet/container/mapped_concatenated_sequences.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/test/tmp_directory.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    seqan3::test::tmp_directory tmp{};
+    auto file_name = tmp.path() / "reads.seqs"; // this is a temporary file path, use any other filename.
+
+    // Write the sequences once, e.g. from a seqan3::sequence_file_input.
+    std::vector<seqan3::dna4_vector> reads{"ACGT"_dna4, "GAGGA"_dna4, "TTA"_dna4};
+    seqan3::mapped_concatenated_sequences<seqan3::dna4>::write(file_name, reads);
+
+    // Opening the file maps it into memory; nothing is read until the sequences are accessed.
+    seqan3::mapped_concatenated_sequences<seqan3::dna4> mapped{file_name};
+    seqan3::debug_stream << mapped.size() << '\n'; // 3
+    seqan3::debug_stream << mapped[1] << '\n';     // GAGGA
+
+    for (auto && read : mapped)
+        seqan3::debug_stream << read.size() << ' '; // 4 5 3
+    seqan3::debug_stream << '\n';
+}
@@ -0,0 +1,28 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/range/bulk_conversion.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+int main()
+{
+    std::string const text{"ACGTTTGACcagt"};
+
+    // Converts the whole string at once, the same as `text | seqan3::views::char_to<seqan3::dna4>`.
+    std::vector<seqan3::dna4> sequence(text.size());
+    seqan3::bulk_char_to(text, sequence);
+    seqan3::debug_stream << sequence << '\n'; // ACGTTTGACCAGT
+
+    std::vector<seqan3::dna4> reverse_complement(sequence.size());
+    seqan3::bulk_reverse_complement(sequence, reverse_complement);
+    seqan3::debug_stream << reverse_complement << '\n'; // ACTGGTCAAACGT
+
+    std::string back(reverse_complement.size(), ' ');
+    seqan3::bulk_to_char(reverse_complement, back);
+    seqan3::debug_stream << back << '\n'; // ACTGGTCAAACGT
+}
@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/dream_index/counting_interleaved_bloom_filter.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    // Three bins with 8 bit counters.
+    seqan3::counting_interleaved_bloom_filter ibf{seqan3::bin_count{3u},
+                                                  seqan3::bin_size{8192u},
+                                                  seqan3::hash_function_count{2u}};
+
+    auto const sequence1 = "ACGTACGTACGTACGT"_dna4;
+    auto const sequence2 = "ACGTTTTTTT"_dna4;
+    auto hash_adaptor = seqan3::views::kmer_hash(seqan3::ungapped{4u});
+
+    // Insert all 4-mers of sequence1 into bin 0 and of sequence2 into bin 2.
+    for (auto && value : sequence1 | hash_adaptor)
+        ibf.emplace(value, seqan3::bin_index{0u});
+    for (auto && value : sequence2 | hash_adaptor)
+        ibf.emplace(value, seqan3::bin_index{2u});
+
+    auto agent = ibf.counting_agent();
+
+    // How often does ACGT occur in each bin?
+    size_t const acgt = ("ACGT"_dna4 | hash_adaptor)[0];
+    seqan3::debug_stream << agent.bulk_abundance(acgt) << '\n'; // [4,0,1]
+
+    // Sum of the counts of all 4-mers of sequence2 for each bin.
+    seqan3::debug_stream << agent.bulk_count(sequence2 | hash_adaptor) << '\n'; // [4,0,19]
+}
@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <vector>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+#include <seqan3/search/dream_index/mapped_interleaved_bloom_filter.hpp>
+#include <seqan3/test/tmp_directory.hpp>
+
+int main()
+{
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{100u}, seqan3::bin_size{8192u}};
+    ibf.emplace(126, seqan3::bin_index{0u});
+    ibf.emplace(712, seqan3::bin_index{3u});
+    ibf.emplace(712, seqan3::bin_index{70u});
+
+    // Write the bins 0-63 and 64-99 to two shards, e.g. one for each query node.
+    seqan3::test::tmp_directory tmp{};
+    auto first_shard = tmp.path() / "0.ibf"; // this is a temporary file path, use any other filename.
+    auto second_shard = tmp.path() / "1.ibf";
+    ibf.write(first_shard, seqan3::bin_index{0u}, seqan3::bin_count{64u});
+    ibf.write(second_shard, seqan3::bin_index{64u}, seqan3::bin_count{36u});
+
+    // A single shard only counts its own bins, starting at `first_bin()`.
+    seqan3::mapped_interleaved_bloom_filter shard{second_shard};
+    auto shard_agent = shard.counting_agent();
+    std::vector<size_t> const values{126, 712};
+    auto & shard_result = shard_agent.bulk_count(values);
+    seqan3::debug_stream << shard.first_bin() << ' ' << shard_result[70 - shard.first_bin()] << '\n'; // 64 1
+
+    // The counts of all shards are merged into one vector over all bins.
+    seqan3::sharded_interleaved_bloom_filter sharded{{first_shard, second_shard}};
+    auto agent = sharded.counting_agent();
+    auto & result = agent.bulk_count(values);
+    seqan3::debug_stream << result[0] << ' ' << result[3] << ' ' << result[70] << '\n'; // 1 1 1
+}
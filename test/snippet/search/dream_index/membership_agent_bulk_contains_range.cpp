@@ -0,0 +1,30 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <vector>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+
+int main()
+{
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{12u}, seqan3::bin_size{8192u}};
+    ibf.emplace(126, seqan3::bin_index{0u});
+    ibf.emplace(712, seqan3::bin_index{3u});
+    ibf.emplace(237, seqan3::bin_index{9u});
+
+    // Query many values at once, e.g. all minimisers of a read.
+    // The callback is invoked with the result of each value, in the order of the values.
+    std::vector<size_t> const values{712, 237, 1000};
+    auto agent = ibf.membership_agent();
+    agent.bulk_contains(values,
+                        [](auto const & result)
+                        {
+                            seqan3::debug_stream << result << '\n';
+                        });
+    // prints:
+    // [0,0,0,1,0,0,0,0,0,0,0,0]
+    // [0,0,0,0,0,0,0,0,0,1,0,0]
+    // [0,0,0,0,0,0,0,0,0,0,0,0]
+}
@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <sstream>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+#include <seqan3/search/kmer_index/kmer_counter.hpp>
+
+auto input = R"(>read1
+ACGTTTACGTA
+>read2
+TACGTAAACGT
+)";
+
+int main()
+{
+    // A seqan3::sequence_file_input can be counted directly.
+    seqan3::sequence_file_input fin{std::istringstream{input}, seqan3::format_fasta{}};
+
+    seqan3::kmer_counter counter{seqan3::ungapped{4}, {.thread_count = 2u, .memory_limit = size_t{1} << 28}};
+    counter.count(fin);
+
+    seqan3::debug_stream << counter.total_count() << '\n'; // 16
+
+    // How many distinct canonical 4-mers occur once, twice, three or more times.
+    seqan3::debug_stream << counter.histogram(3u) << '\n'; // [0,0,4,2]
+}
@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <vector>
+
+#include <seqan3/alphabet/container/concatenated_sequences.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/kmer_index/kmer_index.hpp>
+#include <seqan3/search/views/canonical_kmer_hash.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    seqan3::concatenated_sequences<std::vector<seqan3::dna4>> sequences{};
+    sequences.push_back("ACGTAGCTTACGATCG"_dna4);
+    sequences.push_back("TTCGATCGTAAGC"_dna4);
+
+    // Index all 4-mers with two threads.
+    seqan3::kmer_index index{sequences, seqan3::ungapped{4}, 2u};
+
+    // Look up the canonical hash values of the 4-mers of a query.
+    std::vector<seqan3::dna4> query{"GATCG"_dna4};
+    for (uint64_t hash : query | seqan3::views::canonical_kmer_hash(seqan3::ungapped{4}))
+    {
+        for (seqan3::kmer_occurrence const & occurrence : index.find(hash))
+            seqan3::debug_stream << '(' << occurrence.sequence_id() << ',' << occurrence.position() << ") ";
+        seqan3::debug_stream << '\n';
+    }
+    // (0,11) (1,3)
+    // (0,10) (0,12) (1,2) (1,4)    <- CGAT is the reverse complement of ATCG
+}
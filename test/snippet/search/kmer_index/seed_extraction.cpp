@@ -0,0 +1,32 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/kmer_index/seed_extraction.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    std::vector<seqan3::dna4> text{"ACGTAGCTTACGATCGATCAGT"_dna4};
+
+    // The seed buffer must be able to hold one seed per k-mer.
+    std::vector<seqan3::kmer_seed> seeds(text.size());
+
+    seqan3::minimiser_extractor minimisers{seqan3::ungapped{4}, seqan3::window_size{8}, seqan3::seed{0}};
+    seeds.resize(minimisers(text, seeds));
+    for (seqan3::kmer_seed const & seed : seeds)
+        seqan3::debug_stream << seed.position << ':' << seed.hash << ' ';
+    seqan3::debug_stream << '\n'; // 0:27 5:9 9:24 14:54 16:52 18:30
+
+    seeds.resize(text.size());
+    seqan3::syncmer_extractor syncmers{{.kmer_size = 6u, .smer_size = 2u, .seed = 0u}};
+    seeds.resize(syncmers(text, seeds));
+    for (seqan3::kmer_seed const & seed : seeds)
+        seqan3::debug_stream << seed.position << ' ';
+    seqan3::debug_stream << '\n'; // 0 2 3 7 9 12 15 16
+}
@@ -0,0 +1,25 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/views/canonical_kmer_hash.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    std::vector<seqan3::dna4> text{"ACGTAGC"_dna4};
+
+    seqan3::debug_stream << (text | seqan3::views::kmer_hash(seqan3::ungapped{3})) << '\n'; // [6,27,44,50,9]
+
+    // ACG and CGT are reverse complements of each other and get the same canonical hash value.
+    seqan3::debug_stream << (text | seqan3::views::canonical_kmer_hash(seqan3::ungapped{3})) << '\n'; // [6,6,44,28,9]
+
+    // The reverse complement of the text has the same canonical hash values in reverse order.
+    std::vector<seqan3::dna4> reverse_complement{"GCTACGT"_dna4};
+    seqan3::debug_stream << (reverse_complement | seqan3::views::canonical_kmer_hash(seqan3::ungapped{3}))
+                         << '\n'; // [9,28,44,6,6]
+}
@@ -0,0 +1,32 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+#include <seqan3/utility/bloom_filter/counting_bloom_filter.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    // A counting Bloom Filter with 4 bit counters, i.e. counts up to 15.
+    seqan3::counting_bloom_filter<4> cbf{seqan3::bin_size{8192u}, seqan3::hash_function_count{2u}};
+
+    auto const sequence = "ACGTACGTACGTACGTTT"_dna4;
+    auto kmers = seqan3::views::kmer_hash(seqan3::ungapped{4u});
+
+    // Insert all 4-mers of the sequence.
+    for (auto && value : sequence | kmers)
+        cbf.emplace(value);
+
+    // ACGT occurs four times, GTTT once and TTTT never.
+    seqan3::debug_stream << cbf.abundance(("ACGT"_dna4 | kmers)[0]) << '\n'; // 4
+    seqan3::debug_stream << cbf.abundance(("GTTT"_dna4 | kmers)[0]) << '\n'; // 1
+    seqan3::debug_stream << cbf.abundance(("TTTT"_dna4 | kmers)[0]) << '\n'; // 0
+
+    // Counts saturate at 15.
+    cbf.emplace(42u, 100u);
+    seqan3::debug_stream << cbf.abundance(42u) << '\n'; // 15
+}
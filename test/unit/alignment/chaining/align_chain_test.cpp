@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include <seqan3/alignment/chaining/align_chain.hpp>
+#include <seqan3/alignment/chaining/chain_anchors.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+#include <seqan3/utility/views/slice.hpp>
+
+using namespace seqan3::literals;
+
+static seqan3::nucleotide_scoring_scheme<int8_t> const scheme{seqan3::match_score{2}, seqan3::mismatch_score{-4}};
+
+static auto const config =
+    seqan3::align_cfg::scoring_scheme{scheme}
+    | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-4}, seqan3::align_cfg::extension_score{-2}};
+
+// Shared k-mers of the reference and the query.
+std::vector<seqan3::anchor>
+shared_kmers(std::vector<seqan3::dna4> const & reference, std::vector<seqan3::dna4> const & query, uint8_t const k)
+{
+    std::unordered_multimap<size_t, size_t> reference_kmers{};
+    size_t position = 0;
+    for (size_t hash : reference | seqan3::views::kmer_hash(seqan3::ungapped{k}))
+        reference_kmers.emplace(hash, position++);
+
+    std::vector<seqan3::anchor> anchors{};
+    position = 0;
+    for (size_t hash : query | seqan3::views::kmer_hash(seqan3::ungapped{k}))
+    {
+        auto [first, last] = reference_kmers.equal_range(hash);
+        for (; first != last; ++first)
+            anchors.push_back(seqan3::anchor{first->second, position, k});
+        ++position;
+    }
+
+    return anchors;
+}
+
+// Checks that the CIGAR string describes an alignment of the given regions and returns its score.
+int32_t validate(std::vector<seqan3::dna4> const & reference,
+                 std::vector<seqan3::dna4> const & query,
+                 seqan3::chain_alignment const & alignment)
+{
+    size_t reference_position = alignment.reference_begin_position;
+    size_t query_position = 0;
+    int32_t score = 0;
+
+    for (size_t i = 0; i < alignment.cigar_sequence.size(); ++i)
+    {
+        uint32_t const count = get<0>(alignment.cigar_sequence[i]);
+        char const operation = get<1>(alignment.cigar_sequence[i]).to_char();
+        EXPECT_GT(count, 0u);
+
+        if (operation == 'S')
+        {
+            EXPECT_TRUE(i == 0u || i + 1 == alignment.cigar_sequence.size());
+            EXPECT_EQ(query_position, (i == 0u) ? 0u : alignment.query_end_position);
+            query_position += count;
+            continue;
+        }
+
+        if (i > 0u)
+        {
+            EXPECT_NE(get<1>(alignment.cigar_sequence[i - 1]).to_char(), operation);
+        }
+
+        if (operation == 'M')
+        {
+            for (uint32_t j = 0; j < count; ++j)
+                score += scheme.score(reference[reference_position++], query[query_position++]);
+        }
+        else
+        {
+            EXPECT_TRUE(operation == 'I' || operation == 'D');
+            score += -4 - 2 * static_cast<int32_t>(count);
+            (operation == 'I' ? query_position : reference_position) += count;
+        }
+    }
+
+    EXPECT_EQ(reference_position, alignment.reference_end_position);
+    EXPECT_EQ(query_position, query.size());
+    return score;
+}
+
+TEST(align_chain, empty_chain)
+{
+    std::vector<seqan3::dna4> query{"ACGTACGT"_dna4};
+    seqan3::chain_alignment alignment = seqan3::align_chain("ACGT"_dna4, query, seqan3::anchor_chain{}, config);
+
+    EXPECT_EQ(alignment.score, 0);
+    EXPECT_EQ(alignment.cigar_sequence, (std::vector<seqan3::cigar>{{8, 'S'_cigar_operation}}));
+}
+
+TEST(align_chain, invalid_anchor)
+{
+    seqan3::anchor_chain chain{10, {{0, 0, 4}, {4, 3, 4}}};
+    EXPECT_THROW(seqan3::align_chain("ACGTACGT"_dna4, "ACGTAC"_dna4, chain, config), std::invalid_argument);
+}
+
+TEST(align_chain, one_sided_gaps)
+{
+    std::vector<seqan3::dna4> reference{"AAAACCCCGGGGTTTTACGTACGT"_dna4};
+    std::vector<seqan3::dna4> query{"TAAAACCCCTTTTACGTAACGT"_dna4};
+
+    seqan3::anchor_chain chain{0, {{0, 1, 8}, {12, 9, 4}, {14, 11, 6}, {20, 18, 4}}};
+    seqan3::chain_alignment alignment = seqan3::align_chain(reference, query, chain, config);
+
+    EXPECT_EQ(alignment.reference_begin_position, 0u);
+    EXPECT_EQ(alignment.reference_end_position, 24u);
+    EXPECT_EQ(alignment.query_begin_position, 1u);
+    EXPECT_EQ(alignment.query_end_position, 22u);
+    // The third anchor overlaps the second one and is shortened.
+    EXPECT_EQ(alignment.cigar_sequence,
+              (std::vector<seqan3::cigar>{{1, 'S'_cigar_operation},
+                                          {8, 'M'_cigar_operation},
+                                          {4, 'D'_cigar_operation},
+                                          {8, 'M'_cigar_operation},
+                                          {1, 'I'_cigar_operation},
+                                          {4, 'M'_cigar_operation}}));
+    EXPECT_EQ(alignment.score, validate(reference, query, alignment));
+    EXPECT_EQ(alignment.score, 20 * 2 - 4 - 2 * 4 - 4 - 2);
+}
+
+TEST(align_chain, mutated_read)
+{
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<uint8_t> rank_distribution{0, 3};
+    std::uniform_int_distribution<size_t> error_distribution{0, 99};
+
+    for (size_t repetition = 0; repetition < 3; ++repetition)
+    {
+        std::vector<seqan3::dna4> reference(20'000);
+        for (seqan3::dna4 & symbol : reference)
+            symbol.assign_rank(rank_distribution(generator));
+
+        // A read from the middle of the reference with 5% errors and random flanks.
+        std::vector<seqan3::dna4> query(50, 'A'_dna4);
+        for (size_t i = 5'000; i < 15'000; ++i)
+        {
+            if (size_t const error = error_distribution(generator); error >= 5)
+                query.push_back(reference[i]);
+            else if (error < 2)
+                query.insert(query.end(), {reference[i], seqan3::dna4{}.assign_rank(rank_distribution(generator))});
+            else if (error < 4)
+                query.push_back(seqan3::dna4{}.assign_rank(rank_distribution(generator)));
+        }
+        query.resize(query.size() + 50, 'T'_dna4);
+
+        std::vector<seqan3::anchor_chain> chains = seqan3::chain_anchors(shared_kmers(reference, query, 15));
+        ASSERT_FALSE(chains.empty());
+        EXPECT_GT(chains[0].score, 5'000);
+
+        seqan3::chain_alignment alignment = seqan3::align_chain(reference, query, chains[0], config);
+        EXPECT_EQ(alignment.score, validate(reference, query, alignment));
+        EXPECT_NEAR(alignment.reference_begin_position, 5'000u, 100u);
+        EXPECT_NEAR(alignment.reference_end_position, 15'000u, 100u);
+
+        // Aligning only the gaps between the anchors is as good as aligning the whole region.
+        auto reference_infix =
+            reference | seqan3::views::slice(alignment.reference_begin_position, alignment.reference_end_position);
+        auto query_infix = query | seqan3::views::slice(alignment.query_begin_position, alignment.query_end_position);
+        auto result = *seqan3::align_pairwise(std::tie(reference_infix, query_infix),
+                                              seqan3::align_cfg::method_global{} | config
+                                                  | seqan3::align_cfg::output_score{})
+                           .begin();
+        EXPECT_EQ(alignment.score, result.score());
+    }
+}
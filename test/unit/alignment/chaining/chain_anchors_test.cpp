@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <seqan3/alignment/chaining/chain_anchors.hpp>
+
+TEST(chain_anchors, empty)
+{
+    EXPECT_TRUE(seqan3::chain_anchors({}).empty());
+}
+
+TEST(chain_anchors, colinear)
+{
+    // Anchors on two nearby diagonals and some spurious ones, in random order.
+    std::vector<seqan3::anchor> anchors{{300, 290, 15},
+                                        {100, 100, 15},
+                                        {5000, 20, 15},
+                                        {200, 195, 15},
+                                        {120, 120, 15},
+                                        {40, 700, 15},
+                                        {250, 240, 15}};
+
+    std::vector<seqan3::anchor_chain> chains = seqan3::chain_anchors(anchors, {.min_score = 20});
+    ASSERT_EQ(chains.size(), 1u);
+
+    std::vector<seqan3::anchor> expected{{100, 100, 15},
+                                         {120, 120, 15},
+                                         {200, 195, 15},
+                                         {250, 240, 15},
+                                         {300, 290, 15}};
+    EXPECT_EQ(chains[0].anchors, expected);
+    // 5 * 15 minus the costs of the diagonal changes by 5, 5 and 0.
+    EXPECT_EQ(chains[0].score, 75 - 2 * static_cast<int32_t>(0.01 * 15 * 5 + 0.5 * std::log2(5.0)));
+
+    // Without a minimal score, every other anchor is a chain of its own.
+    EXPECT_EQ(seqan3::chain_anchors(anchors, {.min_score = 0}).size(), 3u);
+}
+
+TEST(chain_anchors, overlapping_anchors)
+{
+    // Consecutive k-mers on the same diagonal overlap; the overlap is not counted twice.
+    std::vector<seqan3::anchor> anchors{};
+    for (size_t i = 0; i < 30; ++i)
+        anchors.push_back({1000 + i, 10 + i, 15});
+
+    std::vector<seqan3::anchor_chain> chains = seqan3::chain_anchors(anchors);
+    ASSERT_EQ(chains.size(), 1u);
+    EXPECT_EQ(chains[0].anchors, anchors);
+    EXPECT_EQ(chains[0].score, 15 + 29);
+}
+
+TEST(chain_anchors, max_gap)
+{
+    std::vector<seqan3::anchor> anchors{{0, 0, 20}, {30, 30, 20}, {1000, 1000, 20}, {1030, 1030, 20}};
+
+    std::vector<seqan3::anchor_chain> chains = seqan3::chain_anchors(anchors, {.max_gap = 100, .min_score = 0});
+    ASSERT_EQ(chains.size(), 2u);
+    EXPECT_EQ(chains[0].score, 40);
+    EXPECT_EQ(chains[1].score, 40);
+
+    chains = seqan3::chain_anchors(anchors, {.max_gap = 1000, .min_score = 0});
+    ASSERT_EQ(chains.size(), 1u);
+    EXPECT_EQ(chains[0].anchors, anchors);
+    EXPECT_EQ(chains[0].score, 80);
+}
+
+TEST(chain_anchors, max_diagonal_difference)
+{
+    std::vector<seqan3::anchor> anchors{{0, 0, 20}, {200, 140, 20}};
+
+    EXPECT_EQ(seqan3::chain_anchors(anchors, {.max_diagonal_difference = 50, .min_score = 0}).size(), 2u);
+    EXPECT_EQ(seqan3::chain_anchors(anchors, {.max_diagonal_difference = 100, .min_score = 0}).size(), 1u);
+}
+
+TEST(chain_anchors, shared_anchors)
+{
+    // The second chain branches off the first one and ends in it.
+    std::vector<seqan3::anchor> anchors{{0, 0, 20}, {40, 40, 20}, {80, 80, 20}, {120, 120, 20}, {160, 159, 20}};
+    anchors.push_back({100, 130, 20});
+
+    std::vector<seqan3::anchor_chain> chains = seqan3::chain_anchors(anchors, {.min_score = 0});
+    ASSERT_EQ(chains.size(), 2u);
+    EXPECT_EQ(chains[0].anchors,
+              (std::vector<seqan3::anchor>{{0, 0, 20}, {40, 40, 20}, {80, 80, 20}, {120, 120, 20}, {160, 159, 20}}));
+    EXPECT_EQ(chains[0].score, 100);
+    EXPECT_EQ(chains[1].anchors, (std::vector<seqan3::anchor>{{100, 130, 20}}));
+    // The chain is scored relative to the anchor of the first chain it would continue.
+    EXPECT_EQ(chains[1].score, 20 - static_cast<int32_t>(0.01 * 20 * 30 + 0.5 * std::log2(30.0)));
+}
@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_drop.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+TEST(align_config_x_drop, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::x_drop>));
+}
+
+TEST(align_config_x_drop, configuration)
+{
+    {
+        seqan3::configuration cfg{seqan3::align_cfg::x_drop{}};
+        auto x_drop = std::get<seqan3::align_cfg::x_drop>(cfg);
+        EXPECT_TRUE((std::is_same_v<decltype(x_drop.score), int32_t>));
+        EXPECT_EQ(x_drop.score, std::numeric_limits<int32_t>::max());
+    }
+
+    {
+        seqan3::configuration cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::x_drop{20};
+        EXPECT_EQ(std::get<seqan3::align_cfg::x_drop>(cfg).score, 20);
+    }
+}
+
+TEST(align_config_z_drop, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::z_drop>));
+}
+
+TEST(align_config_z_drop, configuration)
+{
+    {
+        seqan3::configuration cfg{seqan3::align_cfg::z_drop{}};
+        auto z_drop = std::get<seqan3::align_cfg::z_drop>(cfg);
+        EXPECT_TRUE((std::is_same_v<decltype(z_drop.score), int32_t>));
+        EXPECT_EQ(z_drop.score, std::numeric_limits<int32_t>::max());
+    }
+
+    {
+        seqan3::configuration cfg = seqan3::align_cfg::x_drop{20} | seqan3::align_cfg::z_drop{100};
+        EXPECT_EQ(std::get<seqan3::align_cfg::x_drop>(cfg).score, 20);
+        EXPECT_EQ(std::get<seqan3::align_cfg::z_drop>(cfg).score, 100);
+    }
+}
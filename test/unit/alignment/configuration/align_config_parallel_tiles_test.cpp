@@ -0,0 +1,33 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_parallel_tiles.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+TEST(align_config_parallel_tiles, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::parallel_tiles>));
+}
+
+TEST(align_config_parallel_tiles, construction)
+{
+    seqan3::align_cfg::parallel_tiles default_tiles{};
+    EXPECT_FALSE(default_tiles.thread_count.has_value());
+    EXPECT_EQ(default_tiles.tile_size, 256u);
+
+    seqan3::align_cfg::parallel_tiles tiles{4u, 128u};
+    EXPECT_EQ(tiles.thread_count.value(), 4u);
+    EXPECT_EQ(tiles.tile_size, 128u);
+}
+
+TEST(align_config_parallel_tiles, configuration)
+{
+    seqan3::configuration cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::parallel_tiles{2u};
+
+    EXPECT_TRUE(decltype(cfg)::template exists<seqan3::align_cfg::parallel_tiles>());
+    EXPECT_EQ(std::get<seqan3::align_cfg::parallel_tiles>(cfg).thread_count.value(), 2u);
+}
@@ -15,3 +15,10 @@ TEST(align_config_vectorised, config_element)
     seqan3::configuration cfg{seqan3::align_cfg::vectorised{}};
     EXPECT_TRUE(decltype(cfg)::template exists<seqan3::align_cfg::vectorised>());
 }
+
+TEST(align_config_vectorised_anti_diagonal, config_element)
+{
+    seqan3::configuration cfg{seqan3::align_cfg::vectorised_anti_diagonal{}};
+    EXPECT_TRUE(decltype(cfg)::template exists<seqan3::align_cfg::vectorised_anti_diagonal>());
+    EXPECT_FALSE(decltype(cfg)::template exists<seqan3::align_cfg::vectorised>());
+}
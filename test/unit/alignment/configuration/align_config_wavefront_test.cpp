@@ -0,0 +1,22 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+TEST(align_config_wavefront, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::wavefront>));
+}
+
+TEST(align_config_wavefront, configuration)
+{
+    seqan3::configuration cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::wavefront{};
+
+    EXPECT_TRUE(decltype(cfg)::template exists<seqan3::align_cfg::wavefront>());
+    EXPECT_TRUE(decltype(cfg)::template exists<seqan3::align_cfg::method_global>());
+}
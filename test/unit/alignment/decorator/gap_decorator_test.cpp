@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
 #include <ranges>
 #include <vector>
 
@@ -316,3 +317,41 @@ TEST(gap_decorator, decorator_on_views)
     EXPECT_EQ(*dec3.begin(), 'C'_dna4);
     EXPECT_EQ(*(std::next(dec3.begin())), 'T'_dna4);
 }
+
+TEST(gap_decorator, random_gap_operations)
+{
+    std::mt19937_64 generator{42};
+    std::vector<seqan3::dna4> const sequence{"ACGTTGCAACGTAGCTAGCTAGCATCGATCGA"_dna4};
+
+    decorator_t dec{sequence};
+    std::vector<seqan3::gapped<seqan3::dna4>> expected{sequence.begin(), sequence.end()};
+
+    for (size_t operation = 0; operation < 2000; ++operation)
+    {
+        std::vector<size_t> gap_positions{};
+        for (size_t i = 0; i < expected.size(); ++i)
+            if (expected[i] == seqan3::gap{})
+                gap_positions.push_back(i);
+
+        if (gap_positions.empty() || (generator() % 2 == 0 && expected.size() < 200))
+        {
+            size_t const pos = generator() % (expected.size() + 1);
+            size_t const count = 1 + generator() % 3;
+            dec.insert_gap(std::next(dec.begin(), pos), count);
+            expected.insert(expected.begin() + pos, count, seqan3::gap{});
+        }
+        else
+        {
+            size_t const pos = gap_positions[generator() % gap_positions.size()];
+            dec.erase_gap(std::next(dec.begin(), pos));
+            expected.erase(expected.begin() + pos);
+        }
+
+        ASSERT_EQ(dec.size(), expected.size());
+        EXPECT_TRUE(std::ranges::equal(dec, expected));
+        EXPECT_TRUE(std::ranges::equal(dec | std::views::reverse, expected | std::views::reverse));
+
+        size_t const pos = generator() % expected.size();
+        EXPECT_EQ(dec[pos], expected[pos]);
+    }
+}
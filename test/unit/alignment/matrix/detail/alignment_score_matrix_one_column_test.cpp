@@ -87,3 +87,24 @@ struct iterator_fixture<inner_iterator> : alignment_matrix_base_test<test_type>
 };
 
 INSTANTIATE_TYPED_TEST_SUITE_P(score_matrix_inner_iterator, iterator_fixture, inner_iterator, );
+
+TEST(alignment_score_matrix_one_column, resize)
+{
+    seqan3::detail::alignment_score_matrix_one_column<int32_t> matrix{std::string{"acgt"}, std::string{"acgt"}, 3};
+
+    for (auto cell : *matrix.begin())
+        cell.current = 7;
+
+    // The matrix is reset as if it was constructed from the new sequences.
+    matrix.resize(std::string{"acgtacgt"}, std::string{"acgtac"}, -1);
+
+    size_t column_count = 0;
+    for (auto column : matrix)
+    {
+        EXPECT_EQ(std::ranges::distance(column), 7);
+        for (auto cell : column)
+            EXPECT_EQ(cell.current, -1);
+        ++column_count;
+    }
+    EXPECT_EQ(column_count, 9u);
+}
@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
 #include <type_traits>
 #include <utility>
 
@@ -125,3 +126,32 @@ TEST(trace_matrix, trace_path)
 
     EXPECT_TRUE(path.empty());
 }
+
+TEST(trace_matrix, resize)
+{
+    using seqan3::detail::trace_directions;
+
+    seqan3::align_cfg::band_fixed_size band{seqan3::align_cfg::lower_diagonal{-3},
+                                            seqan3::align_cfg::upper_diagonal{3}};
+    seqan3::detail::alignment_trace_matrix_full_banded<trace_directions> matrix{"acgt", "acgt", band};
+
+    for (auto column : matrix)
+        for (auto cell : column)
+            cell.current = trace_directions::diagonal;
+
+    // The matrix is reset as if it was constructed from the new sequences and band.
+    band = seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-1},
+                                              seqan3::align_cfg::upper_diagonal{2}};
+    matrix.resize(std::string{"acgtacgt"}, std::string{"acgtacg"}, band);
+
+    EXPECT_EQ(matrix.band_size, 4);
+
+    size_t column_count = 0;
+    for (auto column : matrix)
+    {
+        for (auto cell : column)
+            EXPECT_EQ(cell.current, trace_directions::none);
+        ++column_count;
+    }
+    EXPECT_EQ(column_count, 9u);
+}
@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
 #include <type_traits>
 #include <utility>
 
@@ -120,3 +121,27 @@ TEST(trace_matrix, trace_path)
 
     EXPECT_TRUE(path.empty());
 }
+
+TEST(trace_matrix, resize)
+{
+    using seqan3::detail::trace_directions;
+
+    seqan3::detail::alignment_trace_matrix_full<trace_directions> matrix{"acgt", "acgt"};
+
+    for (auto column : matrix)
+        for (auto cell : column)
+            cell.current = trace_directions::diagonal;
+
+    // The matrix is reset as if it was constructed from the new sequences.
+    matrix.resize(std::string{"acgtacgt"}, std::string{"acg"});
+
+    size_t column_count = 0;
+    for (auto column : matrix)
+    {
+        EXPECT_EQ(std::ranges::distance(column), 4);
+        for (auto cell : column)
+            EXPECT_EQ(cell.current, trace_directions::none);
+        ++column_count;
+    }
+    EXPECT_EQ(column_count, 9u);
+}
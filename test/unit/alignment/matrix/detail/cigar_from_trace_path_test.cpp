@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/cigar_from_trace_path.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/matrix/detail/trace_iterator.hpp>
+#include <seqan3/alignment/matrix/detail/two_dimensional_matrix.hpp>
+
+using seqan3::operator""_cigar_operation;
+using seqan3::operator|;
+
+struct cigar_from_trace_path_test : public ::testing::Test
+{
+    static constexpr seqan3::detail::trace_directions N = seqan3::detail::trace_directions::none;
+    static constexpr seqan3::detail::trace_directions D = seqan3::detail::trace_directions::diagonal;
+    static constexpr seqan3::detail::trace_directions U = seqan3::detail::trace_directions::up;
+    static constexpr seqan3::detail::trace_directions UO = seqan3::detail::trace_directions::up_open;
+    static constexpr seqan3::detail::trace_directions L = seqan3::detail::trace_directions::left;
+    static constexpr seqan3::detail::trace_directions LO = seqan3::detail::trace_directions::left_open;
+
+    // The same trace matrix as in the test of the seqan3::detail::aligned_sequence_builder.
+    seqan3::detail::two_dimensional_matrix<seqan3::detail::trace_directions> matrix{
+        seqan3::detail::number_rows{3},
+        seqan3::detail::number_cols{4},
+        std::vector{N, LO, L, L, UO, D | LO | UO, L, D | L | UO, U, LO | U, D, L}};
+
+    auto path(std::ptrdiff_t const row, std::ptrdiff_t const column)
+    {
+        seqan3::detail::matrix_offset const offset{seqan3::detail::row_index_type{row},
+                                                   seqan3::detail::column_index_type{column}};
+        using iterator_t = decltype(seqan3::detail::trace_iterator{matrix.begin() + offset});
+        return std::ranges::subrange<iterator_t, std::default_sentinel_t>{
+            seqan3::detail::trace_iterator{matrix.begin() + offset},
+            std::default_sentinel};
+    }
+
+    std::vector<seqan3::cigar> buffer{};
+};
+
+TEST_F(cigar_from_trace_path_test, build_from_2_3)
+{
+    // --ACG
+    // AG---
+    auto begin = seqan3::detail::cigar_from_trace_path(path(2, 3), buffer);
+
+    EXPECT_EQ(begin.row, 0u);
+    EXPECT_EQ(begin.col, 0u);
+    EXPECT_EQ(buffer, (std::vector<seqan3::cigar>{{2, 'I'_cigar_operation}, {3, 'D'_cigar_operation}}));
+}
+
+TEST_F(cigar_from_trace_path_test, build_from_2_2)
+{
+    // AC
+    // AG
+    auto begin = seqan3::detail::cigar_from_trace_path(path(2, 2), buffer);
+
+    EXPECT_EQ(begin.row, 0u);
+    EXPECT_EQ(begin.col, 0u);
+    EXPECT_EQ(buffer, (std::vector<seqan3::cigar>{{2, 'M'_cigar_operation}}));
+}
+
+TEST_F(cigar_from_trace_path_test, build_from_2_1)
+{
+    // A--
+    // -AG
+    auto begin = seqan3::detail::cigar_from_trace_path(path(2, 1), buffer);
+
+    EXPECT_EQ(begin.row, 0u);
+    EXPECT_EQ(begin.col, 0u);
+    EXPECT_EQ(buffer, (std::vector<seqan3::cigar>{{1, 'D'_cigar_operation}, {2, 'I'_cigar_operation}}));
+}
+
+TEST_F(cigar_from_trace_path_test, build_from_1_2)
+{
+    // -AC
+    // A--
+    auto begin = seqan3::detail::cigar_from_trace_path(path(1, 2), buffer);
+
+    EXPECT_EQ(begin.row, 0u);
+    EXPECT_EQ(begin.col, 0u);
+    EXPECT_EQ(buffer, (std::vector<seqan3::cigar>{{1, 'I'_cigar_operation}, {2, 'D'_cigar_operation}}));
+}
+
+TEST_F(cigar_from_trace_path_test, build_from_0_0)
+{
+    auto begin = seqan3::detail::cigar_from_trace_path(path(0, 0), buffer);
+
+    EXPECT_EQ(begin.row, 0u);
+    EXPECT_EQ(begin.col, 0u);
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST_F(cigar_from_trace_path_test, reuse_buffer)
+{
+    seqan3::detail::cigar_from_trace_path(path(2, 3), buffer);
+    size_t const capacity = buffer.capacity();
+
+    // The previous operations are overwritten, but the memory is kept.
+    seqan3::detail::cigar_from_trace_path(path(2, 2), buffer);
+    EXPECT_EQ(buffer, (std::vector<seqan3::cigar>{{2, 'M'_cigar_operation}}));
+    EXPECT_EQ(buffer.capacity(), capacity);
+}
@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/release_excess_memory.hpp>
+#include <seqan3/alignment/matrix/detail/trace_matrix_full.hpp>
+
+using seqan3::detail::retained_alignment_cell_count;
+
+TEST(release_excess_memory, vector)
+{
+    std::vector<int> buffer(1000u);
+    buffer.clear();
+    seqan3::detail::release_excess_memory(buffer);
+    EXPECT_EQ(buffer.capacity(), 1000u);
+
+    buffer.reserve(retained_alignment_cell_count);
+    seqan3::detail::release_excess_memory(buffer);
+    EXPECT_EQ(buffer.capacity(), retained_alignment_cell_count);
+
+    buffer.reserve(retained_alignment_cell_count + 1u);
+    seqan3::detail::release_excess_memory(buffer);
+    EXPECT_EQ(buffer.capacity(), 0u);
+}
+
+TEST(release_excess_memory, cell_count)
+{
+    std::vector<int> buffer(1000u);
+    seqan3::detail::release_excess_memory(buffer, retained_alignment_cell_count);
+    EXPECT_EQ(buffer.size(), 1000u);
+
+    seqan3::detail::release_excess_memory(buffer, retained_alignment_cell_count + 1u);
+    EXPECT_EQ(buffer.capacity(), 0u);
+
+    using seqan3::detail::column_index_type;
+    using seqan3::detail::row_index_type;
+    seqan3::detail::trace_matrix_full<seqan3::detail::trace_directions> matrix{};
+    matrix.resize(column_index_type{10u}, row_index_type{10u});
+    seqan3::detail::release_excess_memory(matrix, retained_alignment_cell_count + 1u);
+    EXPECT_EQ(std::ranges::distance(matrix), 0);
+}
@@ -0,0 +1,220 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <ranges>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/multiple/align_multiple.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/gap/gap.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/views/to_char.hpp>
+#include <seqan3/utility/range/to.hpp>
+
+using namespace seqan3::literals;
+
+static auto const dna4_config =
+    seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                        seqan3::mismatch_score{-5}}}
+    | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10}, seqan3::align_cfg::extension_score{-1}};
+
+static auto const aa27_config =
+    seqan3::align_cfg::scoring_scheme{seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::blosum62}}
+    | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-11}, seqan3::align_cfg::extension_score{-1}};
+
+// A family of mutated copies of a random ancestor.
+template <typename alphabet_t>
+std::vector<std::vector<alphabet_t>> generate_family(size_t const count, size_t const size, uint64_t const seed)
+{
+    std::mt19937_64 generator{seed};
+    std::uniform_int_distribution<size_t> rank_distribution{0, seqan3::alphabet_size<alphabet_t> - 1};
+    std::uniform_int_distribution<size_t> error_distribution{0, 99};
+
+    std::vector<alphabet_t> ancestor(size);
+    for (auto & symbol : ancestor)
+        symbol.assign_rank(rank_distribution(generator));
+
+    std::vector<std::vector<alphabet_t>> family{};
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::vector<alphabet_t> sequence{};
+        for (alphabet_t symbol : ancestor)
+        {
+            if (size_t const error = error_distribution(generator); error >= 15)
+                sequence.push_back(symbol);
+            else if (error < 5) // insertion
+                sequence.insert(sequence.end(), {symbol, alphabet_t{}.assign_rank(rank_distribution(generator))});
+            else if (error < 10) // substitution
+                sequence.push_back(alphabet_t{}.assign_rank(rank_distribution(generator)));
+            // otherwise deletion
+        }
+        family.push_back(std::move(sequence));
+    }
+
+    return family;
+}
+
+// All rows have the same size and contain the sequences in their order.
+template <typename sequences_t, typename rows_t>
+void expect_valid_alignment(sequences_t const & sequences, rows_t const & rows)
+{
+    ASSERT_EQ(rows.size(), sequences.size());
+
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+        EXPECT_EQ(rows[i].size(), rows[0].size());
+
+        auto ungapped = rows[i] | std::views::filter(
+                                      [](auto const symbol)
+                                      {
+                                          return symbol != seqan3::gap{};
+                                      })
+                      | seqan3::views::to_char | seqan3::ranges::to<std::string>();
+        EXPECT_EQ(ungapped, sequences[i] | seqan3::views::to_char | seqan3::ranges::to<std::string>());
+    }
+
+    // No column consists of gaps only.
+    for (size_t column = 0; column < rows[0].size(); ++column)
+    {
+        EXPECT_TRUE(std::ranges::any_of(rows,
+                                        [column](auto const & row)
+                                        {
+                                            return row[column] != seqan3::gap{};
+                                        }));
+    }
+}
+
+// The affine score of two rows of a multiple alignment.
+template <typename row_t, typename scheme_t>
+int32_t induced_score(row_t const & row1, row_t const & row2, scheme_t const & scheme)
+{
+    int32_t score = 0;
+    bool gap_in_row1 = false;
+    bool gap_in_row2 = false;
+    for (size_t column = 0; column < row1.size(); ++column)
+    {
+        bool const is_gap1 = row1[column] == seqan3::gap{};
+        bool const is_gap2 = row2[column] == seqan3::gap{};
+
+        if (is_gap1 && is_gap2)
+            continue;
+
+        if (is_gap1 || is_gap2)
+        {
+            score += ((is_gap1 && !gap_in_row1) || (is_gap2 && !gap_in_row2)) ? -11 : -1;
+        }
+        else
+        {
+            using alphabet_t = std::ranges::range_value_t<typename row_t::unaligned_sequence_type>;
+            score += scheme.score(seqan3::assign_rank_to(seqan3::to_rank(row1[column]), alphabet_t{}),
+                                  seqan3::assign_rank_to(seqan3::to_rank(row2[column]), alphabet_t{}));
+        }
+
+        gap_in_row1 = is_gap1;
+        gap_in_row2 = is_gap2;
+    }
+
+    return score;
+}
+
+TEST(align_multiple, two_sequences)
+{
+    // The alignment of two sequences is an optimal pairwise alignment.
+    for (uint64_t seed = 0; seed < 10; ++seed)
+    {
+        std::vector<std::vector<seqan3::dna4>> sequences = generate_family<seqan3::dna4>(2, 100, seed);
+        auto rows = seqan3::align_multiple(sequences, dna4_config);
+        expect_valid_alignment(sequences, rows);
+
+        auto pairwise = seqan3::align_pairwise(std::tie(sequences[0], sequences[1]),
+                                               seqan3::align_cfg::method_global{} | dna4_config
+                                                   | seqan3::align_cfg::output_score{});
+        EXPECT_EQ(induced_score(rows[0], rows[1], get<seqan3::align_cfg::scoring_scheme>(dna4_config).scheme),
+                  (*pairwise.begin()).score());
+    }
+}
+
+TEST(align_multiple, identical_sequences)
+{
+    std::vector<std::vector<seqan3::dna4>> sequences(5, "ACGTTGACCGATTACAGT"_dna4);
+    auto rows = seqan3::align_multiple(sequences, dna4_config);
+
+    expect_valid_alignment(sequences, rows);
+    EXPECT_EQ(rows[0].size(), sequences[0].size());
+}
+
+TEST(align_multiple, family)
+{
+    std::vector<std::vector<seqan3::dna4>> sequences = generate_family<seqan3::dna4>(40, 150, 42);
+
+    for (seqan3::guide_tree_method method : {seqan3::guide_tree_method::upgma,
+                                             seqan3::guide_tree_method::neighbour_joining})
+    {
+        auto rows = seqan3::align_multiple(sequences, dna4_config, method);
+        expect_valid_alignment(sequences, rows);
+
+        // The result does not depend on the number of threads.
+        auto parallel_rows =
+            seqan3::align_multiple(sequences, dna4_config | seqan3::align_cfg::parallel{4}, method);
+        for (size_t i = 0; i < rows.size(); ++i)
+            EXPECT_TRUE(std::ranges::equal(rows[i], parallel_rows[i]));
+    }
+}
+
+TEST(align_multiple, aa27)
+{
+    std::vector<std::vector<seqan3::aa27>> sequences = generate_family<seqan3::aa27>(20, 120, 7);
+
+    auto rows = seqan3::align_multiple(sequences,
+                                       seqan3::align_cfg::method_global{} | aa27_config
+                                           | seqan3::align_cfg::parallel{2},
+                                       seqan3::guide_tree_method::neighbour_joining);
+    expect_valid_alignment(sequences, rows);
+}
+
+TEST(align_multiple, empty_sequences)
+{
+    std::vector<std::vector<seqan3::dna4>> sequences{""_dna4, "ACGT"_dna4, ""_dna4, "AGT"_dna4};
+    auto rows = seqan3::align_multiple(sequences, dna4_config);
+    expect_valid_alignment(sequences, rows);
+    EXPECT_EQ(rows[0].size(), 4u);
+}
+
+TEST(align_multiple, trivial)
+{
+    std::vector<std::vector<seqan3::dna4>> sequences{};
+    EXPECT_TRUE(seqan3::align_multiple(sequences, dna4_config).empty());
+
+    sequences.push_back("ACGT"_dna4);
+    auto rows = seqan3::align_multiple(sequences, dna4_config);
+    ASSERT_EQ(rows.size(), 1u);
+    EXPECT_TRUE(std::ranges::equal(rows[0] | seqan3::views::to_char, std::string{"ACGT"}));
+}
+
+TEST(align_multiple, invalid_configuration)
+{
+    using namespace seqan3::align_cfg;
+
+    std::vector<std::vector<seqan3::dna4>> sequences{"ACGT"_dna4, "AGT"_dna4};
+
+    auto const free_end_gaps = method_global{free_end_gaps_sequence1_leading{true},
+                                             free_end_gaps_sequence2_leading{false},
+                                             free_end_gaps_sequence1_trailing{false},
+                                             free_end_gaps_sequence2_trailing{false}};
+    EXPECT_THROW(seqan3::align_multiple(sequences, free_end_gaps | dna4_config),
+                 seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(seqan3::align_multiple(sequences, dna4_config | parallel{}), std::runtime_error);
+}
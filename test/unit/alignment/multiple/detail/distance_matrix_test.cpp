@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/multiple/detail/distance_matrix.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using namespace seqan3::literals;
+
+TEST(distance_matrix, access)
+{
+    seqan3::detail::distance_matrix distances{4};
+    distances.at(0, 1) = 10;
+    distances.at(0, 2) = 1;
+    distances.at(0, 3) = 9;
+    distances.at(1, 2) = 9;
+    distances.at(1, 3) = 2;
+    distances.at(2, 3) = 10;
+
+    EXPECT_EQ(distances.dimension(), 4u);
+    EXPECT_EQ(distances(2, 2), 0.0f);
+    EXPECT_EQ(distances(3, 1), 2.0f);
+    EXPECT_EQ(distances(1, 3), 2.0f);
+
+    // The order of seqan3::views::pairwise_combine.
+    std::vector<float> expected{10, 1, 9, 9, 2, 10};
+    for (size_t index = 0; index < expected.size(); ++index)
+        EXPECT_EQ(distances[index], expected[index]);
+}
+
+TEST(distance_matrix, compute)
+{
+    auto const scoring_config = seqan3::align_cfg::scoring_scheme{
+        seqan3::nucleotide_scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}}};
+    auto const gap_config =
+        seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10}, seqan3::align_cfg::extension_score{-1}};
+
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<uint8_t> rank_distribution{0, 3};
+    std::uniform_int_distribution<size_t> size_distribution{0, 60};
+
+    std::vector<std::vector<seqan3::dna4>> sequences(21, "ACGTACGTACGT"_dna4);
+    for (size_t i = 1; i < sequences.size(); ++i)
+    {
+        sequences[i].resize(size_distribution(generator));
+        for (auto & symbol : sequences[i])
+            symbol.assign_rank(rank_distribution(generator));
+    }
+
+    for (uint32_t thread_count : {1u, 3u})
+    {
+        seqan3::detail::distance_matrix const distances =
+            seqan3::detail::compute_distance_matrix(sequences, scoring_config, gap_config, thread_count);
+        ASSERT_EQ(distances.dimension(), sequences.size());
+
+        for (size_t i = 0; i < sequences.size(); ++i)
+        {
+            for (size_t j = 0; j < sequences.size(); ++j)
+            {
+                if (i == j)
+                {
+                    EXPECT_EQ(distances(i, j), 0.0f);
+                    continue;
+                }
+
+                auto result = *seqan3::align_pairwise(std::tie(sequences[i], sequences[j]),
+                                                      seqan3::align_cfg::method_global{} | scoring_config | gap_config
+                                                          | seqan3::align_cfg::output_score{})
+                                   .begin();
+                float const normaliser = std::max(1.0f, 2.0f * (sequences[i].size() + sequences[j].size()));
+                EXPECT_FLOAT_EQ(distances(i, j), std::max(0.0f, 1.0f - result.score() / normaliser));
+            }
+        }
+    }
+
+    // Identical sequences.
+    std::vector<std::vector<seqan3::dna4>> identical(3, "ACGTTGCA"_dna4);
+    seqan3::detail::distance_matrix const distances =
+        seqan3::detail::compute_distance_matrix(identical, scoring_config, gap_config, 1u);
+    EXPECT_EQ(distances(0, 1), 0.0f);
+    EXPECT_EQ(distances(1, 2), 0.0f);
+}
@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/multiple/detail/guide_tree.hpp>
+
+using joins_t = std::vector<std::pair<size_t, size_t>>;
+
+// Two pairs of close sequences: {0, 2} and {1, 3}.
+seqan3::detail::distance_matrix two_pairs()
+{
+    seqan3::detail::distance_matrix distances{4};
+    distances.at(0, 1) = 10;
+    distances.at(0, 2) = 1;
+    distances.at(0, 3) = 9;
+    distances.at(1, 2) = 9;
+    distances.at(1, 3) = 2;
+    distances.at(2, 3) = 10;
+    return distances;
+}
+
+TEST(guide_tree, upgma)
+{
+    seqan3::detail::guide_tree tree = seqan3::detail::upgma_guide_tree(two_pairs());
+
+    EXPECT_EQ(tree.leaf_count, 4u);
+    EXPECT_EQ(tree.joins, (joins_t{{2, 0}, {3, 1}, {5, 4}}));
+}
+
+TEST(guide_tree, upgma_average_distance)
+{
+    // After joining 0 and 1, the cluster has the average distance 5 to 2 and 3, which are 6 apart.
+    seqan3::detail::distance_matrix distances{4};
+    distances.at(0, 1) = 1;
+    distances.at(0, 2) = 2;
+    distances.at(0, 3) = 8;
+    distances.at(1, 2) = 8;
+    distances.at(1, 3) = 2;
+    distances.at(2, 3) = 6;
+
+    seqan3::detail::guide_tree tree = seqan3::detail::upgma_guide_tree(distances);
+    EXPECT_EQ(tree.joins, (joins_t{{1, 0}, {2, 4}, {3, 5}}));
+}
+
+TEST(guide_tree, neighbour_joining)
+{
+    // An additive tree ((0:1, 1:1):1, (2:5, 3:1):1), where 2 evolves much faster. UPGMA joins 0 and 1 with 3 first.
+    seqan3::detail::distance_matrix distances{4};
+    distances.at(0, 1) = 2;
+    distances.at(0, 2) = 8;
+    distances.at(0, 3) = 4;
+    distances.at(1, 2) = 8;
+    distances.at(1, 3) = 4;
+    distances.at(2, 3) = 6;
+
+    for (uint32_t thread_count : {1u, 4u})
+    {
+        seqan3::detail::guide_tree tree = seqan3::detail::neighbour_joining_guide_tree(distances, thread_count);
+        EXPECT_EQ(tree.joins, (joins_t{{0, 1}, {4, 2}, {5, 3}}));
+    }
+
+    EXPECT_EQ(seqan3::detail::upgma_guide_tree(distances).joins, (joins_t{{1, 0}, {3, 4}, {5, 2}}));
+}
+
+TEST(guide_tree, trivial)
+{
+    EXPECT_TRUE(seqan3::detail::upgma_guide_tree(seqan3::detail::distance_matrix{0}).joins.empty());
+    EXPECT_TRUE(seqan3::detail::upgma_guide_tree(seqan3::detail::distance_matrix{1}).joins.empty());
+    EXPECT_TRUE(seqan3::detail::neighbour_joining_guide_tree(seqan3::detail::distance_matrix{1}, 1u).joins.empty());
+
+    seqan3::detail::distance_matrix distances{2};
+    distances.at(0, 1) = 3;
+    EXPECT_EQ(seqan3::detail::upgma_guide_tree(distances).joins, (joins_t{{1, 0}}));
+    EXPECT_EQ(seqan3::detail::neighbour_joining_guide_tree(distances, 1u).joins, (joins_t{{0, 1}}));
+}
+
+// Every node is joined exactly once and the children are created before their parents.
+void expect_valid_tree(seqan3::detail::guide_tree const & tree)
+{
+    ASSERT_EQ(tree.joins.size() + 1, tree.leaf_count);
+
+    std::vector<size_t> join_count(2 * tree.leaf_count - 1);
+    for (size_t join = 0; join < tree.joins.size(); ++join)
+    {
+        EXPECT_LT(tree.joins[join].first, tree.leaf_count + join);
+        EXPECT_LT(tree.joins[join].second, tree.leaf_count + join);
+        ++join_count[tree.joins[join].first];
+        ++join_count[tree.joins[join].second];
+    }
+
+    join_count.pop_back(); // The root.
+    EXPECT_EQ(join_count, std::vector<size_t>(2 * tree.leaf_count - 2, 1u));
+}
+
+TEST(guide_tree, random_distances)
+{
+    std::mt19937_64 generator{42};
+    std::uniform_real_distribution<float> distance_distribution{0.0f, 1.0f};
+
+    seqan3::detail::distance_matrix distances{300};
+    for (size_t i = 0; i < 300; ++i)
+        for (size_t j = i + 1; j < 300; ++j)
+            distances.at(i, j) = distance_distribution(generator);
+
+    expect_valid_tree(seqan3::detail::upgma_guide_tree(distances));
+
+    seqan3::detail::guide_tree const tree = seqan3::detail::neighbour_joining_guide_tree(distances, 1u);
+    expect_valid_tree(tree);
+    EXPECT_EQ(seqan3::detail::neighbour_joining_guide_tree(distances, 3u).joins, tree.joins);
+}
@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using namespace seqan3::literals;
+
+template <typename alphabet_t>
+std::vector<alphabet_t> random_sequence(std::mt19937_64 & generator, size_t const max_size)
+{
+    std::uniform_int_distribution<size_t> size_distribution{0, max_size};
+    std::uniform_int_distribution<size_t> rank_distribution{0, seqan3::alphabet_size<alphabet_t> - 1};
+
+    std::vector<alphabet_t> sequence(size_distribution(generator));
+    for (auto & symbol : sequence)
+        symbol.assign_rank(rank_distribution(generator));
+
+    return sequence;
+}
+
+// Compares the score and the end positions to the alignment that is not vectorised along the anti-diagonals.
+template <typename alphabet_t, typename config_t>
+void compare_to_default_algorithm(config_t const & config, size_t const max_size = 300)
+{
+    std::mt19937_64 generator{42};
+    auto const output_config = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+
+    for (size_t iteration = 0; iteration < 40; ++iteration)
+    {
+        std::vector<alphabet_t> const sequence1 = random_sequence<alphabet_t>(generator, max_size);
+        std::vector<alphabet_t> const sequence2 = random_sequence<alphabet_t>(generator, max_size);
+
+        auto expected = *seqan3::align_pairwise(std::tie(sequence1, sequence2), config | output_config).begin();
+        auto result = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                              config | output_config | seqan3::align_cfg::vectorised_anti_diagonal{})
+                           .begin();
+
+        EXPECT_EQ(result.score(), expected.score());
+        EXPECT_EQ(result.sequence1_end_position(), expected.sequence1_end_position());
+        EXPECT_EQ(result.sequence2_end_position(), expected.sequence2_end_position());
+    }
+}
+
+static auto const dna4_config =
+    seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                        seqan3::mismatch_score{-5}}}
+    | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10}, seqan3::align_cfg::extension_score{-1}};
+
+static auto const aa27_config =
+    seqan3::align_cfg::scoring_scheme{seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::blosum62}}
+    | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-11}, seqan3::align_cfg::extension_score{-1}};
+
+TEST(affine_anti_diagonal, global)
+{
+    compare_to_default_algorithm<seqan3::dna4>(seqan3::align_cfg::method_global{} | dna4_config);
+}
+
+TEST(affine_anti_diagonal, global_aa27)
+{
+    compare_to_default_algorithm<seqan3::aa27>(seqan3::align_cfg::method_global{} | aa27_config);
+}
+
+TEST(affine_anti_diagonal, semi_global)
+{
+    using namespace seqan3::align_cfg;
+
+    compare_to_default_algorithm<seqan3::dna4>(method_global{free_end_gaps_sequence1_leading{true},
+                                                             free_end_gaps_sequence2_leading{false},
+                                                             free_end_gaps_sequence1_trailing{true},
+                                                             free_end_gaps_sequence2_trailing{false}}
+                                               | dna4_config);
+    compare_to_default_algorithm<seqan3::dna4>(method_global{free_end_gaps_sequence1_leading{false},
+                                                             free_end_gaps_sequence2_leading{true},
+                                                             free_end_gaps_sequence1_trailing{false},
+                                                             free_end_gaps_sequence2_trailing{true}}
+                                               | dna4_config);
+    compare_to_default_algorithm<seqan3::dna4>(method_global{free_end_gaps_sequence1_leading{true},
+                                                             free_end_gaps_sequence2_leading{true},
+                                                             free_end_gaps_sequence1_trailing{true},
+                                                             free_end_gaps_sequence2_trailing{true}}
+                                               | dna4_config);
+}
+
+TEST(affine_anti_diagonal, local)
+{
+    compare_to_default_algorithm<seqan3::dna4>(seqan3::align_cfg::method_local{} | dna4_config);
+    compare_to_default_algorithm<seqan3::aa27>(seqan3::align_cfg::method_local{} | aa27_config);
+}
+
+TEST(affine_anti_diagonal, banded)
+{
+    using namespace seqan3::align_cfg;
+
+    // The band must contain the first and the last cell of the global alignment.
+    auto const band = band_fixed_size{lower_diagonal{-40}, upper_diagonal{40}};
+    auto const free_end_gaps = method_global{free_end_gaps_sequence1_leading{true},
+                                             free_end_gaps_sequence2_leading{true},
+                                             free_end_gaps_sequence1_trailing{true},
+                                             free_end_gaps_sequence2_trailing{true}};
+
+    compare_to_default_algorithm<seqan3::dna4>(free_end_gaps | dna4_config | band);
+    compare_to_default_algorithm<seqan3::dna4>(free_end_gaps | dna4_config
+                                               | band_fixed_size{lower_diagonal{-3}, upper_diagonal{8}});
+    compare_to_default_algorithm<seqan3::dna4>(free_end_gaps | dna4_config
+                                               | band_fixed_size{lower_diagonal{0}, upper_diagonal{0}});
+    compare_to_default_algorithm<seqan3::dna4>(method_local{} | dna4_config | band);
+    compare_to_default_algorithm<seqan3::dna4>(method_local{} | dna4_config
+                                               | band_fixed_size{lower_diagonal{-5}, upper_diagonal{20}});
+
+    std::vector<seqan3::dna4> const sequence1 = "ACGTACGTTTACGTACGTACGTACGTGGGACGTACGT"_dna4;
+    std::vector<seqan3::dna4> const sequence2 = "ACGTACGTACGTACGTACGTAACGTACGT"_dna4;
+    auto const config = method_global{} | dna4_config | band_fixed_size{lower_diagonal{-10}, upper_diagonal{10}}
+                      | output_score{} | output_end_position{};
+
+    auto expected = *seqan3::align_pairwise(std::tie(sequence1, sequence2), config).begin();
+    auto result =
+        *seqan3::align_pairwise(std::tie(sequence1, sequence2), config | vectorised_anti_diagonal{}).begin();
+
+    EXPECT_EQ(result.score(), expected.score());
+    EXPECT_EQ(result.sequence1_end_position(), sequence1.size());
+    EXPECT_EQ(result.sequence2_end_position(), sequence2.size());
+}
+
+TEST(affine_anti_diagonal, long_sequences)
+{
+    std::vector<seqan3::dna4> sequence1{};
+    std::vector<seqan3::dna4> sequence2{};
+    for (size_t i = 0; i < 2000; ++i)
+    {
+        sequence1.push_back(seqan3::dna4{}.assign_rank(i % 4));
+        if (i % 100 != 50) // Every 100th symbol is deleted.
+            sequence2.push_back(seqan3::dna4{}.assign_rank(i % 4));
+    }
+
+    auto const config = seqan3::align_cfg::method_global{} | dna4_config | seqan3::align_cfg::output_score{};
+    auto expected = *seqan3::align_pairwise(std::tie(sequence1, sequence2), config).begin();
+    auto result = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                          config | seqan3::align_cfg::vectorised_anti_diagonal{})
+                       .begin();
+
+    EXPECT_EQ(result.score(), expected.score());
+}
+
+TEST(affine_anti_diagonal, invalid_configuration)
+{
+    std::vector<seqan3::dna4> const sequence1 = "ACGTACGT"_dna4;
+    std::vector<seqan3::dna4> const sequence2 = "ACGTTACGT"_dna4;
+    auto const config = seqan3::align_cfg::method_global{} | dna4_config
+                      | seqan3::align_cfg::vectorised_anti_diagonal{};
+
+    // Requires the trace.
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                        config | seqan3::align_cfg::output_begin_position{}),
+                 seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence1, sequence2), config),
+                 seqan3::invalid_alignment_configuration);
+
+    // The band does not contain the last cell.
+    auto const band = seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{0},
+                                                         seqan3::align_cfg::upper_diagonal{0}};
+    auto alignment_range =
+        seqan3::align_pairwise(std::tie(sequence1, sequence2), config | band | seqan3::align_cfg::output_score{});
+    EXPECT_THROW(alignment_range.begin(), seqan3::invalid_alignment_configuration);
+}
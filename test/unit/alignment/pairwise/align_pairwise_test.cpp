@@ -10,6 +10,7 @@
 #include <type_traits>
 #include <utility>
 
+#include <seqan3/alignment/cigar_conversion/cigar_from_alignment.hpp>
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
@@ -263,6 +264,51 @@ TYPED_TEST(align_pairwise_test, collection_with_double_score_type)
     }
 }
 
+TYPED_TEST(align_pairwise_test, collection_cigar)
+{
+    using seqan3::operator""_cigar_operation;
+
+    auto seq1 = "ACGTGATG"_dna4;
+    auto seq2 = "AGTGATACT"_dna4;
+
+    auto p = std::tie(seq1, seq2);
+    std::vector<decltype(p)> vec{10, p};
+
+    // The edit distance.
+    seqan3::configuration cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme
+                              | seqan3::align_cfg::output_cigar{} | seqan3::align_cfg::output_begin_position{};
+    std::vector<seqan3::cigar> const expected{{1, 'M'_cigar_operation},
+                                              {1, 'D'_cigar_operation},
+                                              {6, 'M'_cigar_operation},
+                                              {2, 'I'_cigar_operation}};
+    for (auto && res : call_alignment<TypeParam>(vec, cfg))
+    {
+        EXPECT_EQ(res.cigar_sequence(), expected);
+        EXPECT_EQ(res.sequence1_begin_position(), 0u);
+        EXPECT_EQ(res.sequence2_begin_position(), 0u);
+
+        // The CIGAR string can be moved out of the result.
+        seqan3::cigar const * const data = res.cigar_sequence().data();
+        std::vector<seqan3::cigar> cigar_sequence = std::move(res).cigar_sequence();
+        EXPECT_EQ(cigar_sequence, expected);
+        EXPECT_EQ(cigar_sequence.data(), data);
+    }
+
+    // The global and local alignment with affine gaps.
+    auto const affine_cfg = seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{
+                                seqan3::match_score{4},
+                                seqan3::mismatch_score{-5}}}
+                          | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-2},
+                                                               seqan3::align_cfg::extension_score{-1}}
+                          | seqan3::align_cfg::output_cigar{} | seqan3::align_cfg::output_alignment{};
+
+    for (auto && res : call_alignment<TypeParam>(vec, seqan3::align_cfg::method_global{} | affine_cfg))
+        EXPECT_EQ(res.cigar_sequence(), seqan3::cigar_from_alignment(res.alignment()));
+
+    for (auto && res : call_alignment<TypeParam>(vec, seqan3::align_cfg::method_local{} | affine_cfg))
+        EXPECT_EQ(res.cigar_sequence(), seqan3::cigar_from_alignment(res.alignment()));
+}
+
 TYPED_TEST(align_pairwise_test, bug_1598)
 {
     // https://github.com/seqan/seqan3/issues/1598
@@ -280,6 +326,31 @@ TYPED_TEST(align_pairwise_test, bug_1598)
     auto results = seqan3::align_pairwise(std::tie(s1, s2), cfg);
 }
 
+TYPED_TEST(align_pairwise_test, local_alignment_without_begin_positions)
+{
+    using namespace std::literals;
+
+    auto seq1 = "TTTTACGTGATGTTTT"_dna4;
+    auto seq2 = "CCACGTGATGCC"_dna4;
+
+    // The alignment is built from the traceback, even if the begin positions are not requested.
+    seqan3::configuration cfg = seqan3::align_cfg::method_local{}
+                              | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{
+                                  seqan3::match_score{4},
+                                  seqan3::mismatch_score{-5}}}
+                              | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                                   seqan3::align_cfg::extension_score{-1}}
+                              | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_alignment{};
+
+    for (auto && res : call_alignment<TypeParam>(std::tie(seq1, seq2), cfg))
+    {
+        EXPECT_EQ(res.score(), 32);
+        auto && [gap1, gap2] = res.alignment();
+        EXPECT_RANGE_EQ(gap1 | seqan3::views::to_char, "ACGTGATG"sv);
+        EXPECT_RANGE_EQ(gap2 | seqan3::views::to_char, "ACGTGATG"sv);
+    }
+}
+
 TEST(align_pairwise_test, parallel_without_parameter)
 {
     auto seq1 = "ACGTGATG"_dna4;
@@ -4,11 +4,13 @@
 
 #include <gtest/gtest.h>
 
+#include <optional>
 #include <utility>
 #include <vector>
 
 #include <seqan3/alignment/aligned_sequence/debug_stream_alignment.hpp>
 #include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alphabet/cigar/cigar.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/core/debug_stream/tuple.hpp>
@@ -80,4 +82,28 @@ TEST(alignment_result_test, debug_streamable)
                   "        ATC-\n"
                   "}");
     }
+
+    { // Print id and score and CIGAR string
+        using seqan3::operator""_cigar_operation;
+
+        ostream.str("");
+        seqan3::detail::alignment_result_value_type<size_t,
+                                                    size_t,
+                                                    int,
+                                                    std::nullopt_t *,
+                                                    std::nullopt_t *,
+                                                    std::nullopt_t *,
+                                                    std::nullopt_t *,
+                                                    std::nullopt_t *,
+                                                    std::vector<seqan3::cigar>>
+            result_value{};
+        result_value.sequence1_id = id;
+        result_value.sequence2_id = id;
+        result_value.score = score;
+        result_value.cigar_sequence = {{2, 'M'_cigar_operation}, {1, 'I'_cigar_operation}, {1, 'D'_cigar_operation}};
+        seqan3::alignment_result result{result_value};
+        debug_stream << result;
+
+        EXPECT_EQ(ostream.str(), "{sequence1 id: 3, sequence2 id: 3, score: -15, cigar: 2M1I1D}");
+    }
 }
@@ -0,0 +1,234 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <seqan3/alignment/configuration/align_config_linear_memory.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/views/to_char.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+#include "fixture/global_affine_banded.hpp"
+#include "fixture/global_affine_unbanded.hpp"
+#include "fixture/semi_global_affine_banded.hpp"
+#include "fixture/semi_global_affine_unbanded.hpp"
+#include "pairwise_alignment_single_test_template.hpp"
+
+// Recomputes the score of the given alignment with affine gap costs.
+template <typename alignment_t, typename scoring_scheme_t>
+int32_t score_of(alignment_t const & alignment,
+                 scoring_scheme_t const & scheme,
+                 seqan3::align_cfg::gap_cost_affine const & gap_cost)
+{
+    auto const & [gapped_sequence1, gapped_sequence2] = alignment;
+
+    int32_t score = 0;
+    bool in_gap1 = false;
+    bool in_gap2 = false;
+    for (size_t i = 0; i < std::ranges::size(gapped_sequence1); ++i)
+    {
+        bool const is_gap1 = gapped_sequence1[i] == seqan3::gap{};
+        bool const is_gap2 = gapped_sequence2[i] == seqan3::gap{};
+
+        bool const opens_gap = (is_gap1 && !in_gap1) || (is_gap2 && !in_gap2);
+
+        if (is_gap1 || is_gap2)
+            score += gap_cost.extension_score + (opens_gap ? gap_cost.open_score : 0);
+        else
+            score += scheme.score(gapped_sequence1[i].template convert_to<seqan3::dna4>(),
+                                  gapped_sequence2[i].template convert_to<seqan3::dna4>());
+
+        in_gap1 = is_gap1;
+        in_gap2 = is_gap2;
+    }
+    return score;
+}
+
+// Only the fixture of the single test template is used.
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(pairwise_alignment_test);
+
+template <typename fixture_t>
+class pairwise_alignment_linear_memory_test : public fixture_t
+{};
+
+TYPED_TEST_SUITE_P(pairwise_alignment_linear_memory_test);
+
+TYPED_TEST_P(pairwise_alignment_linear_memory_test, alignment)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg = fixture.config | seqan3::align_cfg::output_score{}
+                                    | seqan3::align_cfg::output_end_position{}
+                                    | seqan3::align_cfg::output_begin_position{} | seqan3::align_cfg::output_alignment{}
+                                    | seqan3::align_cfg::linear_memory{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto alignment_rng = seqan3::align_pairwise(std::tie(database, query), align_cfg);
+    auto res = *alignment_rng.begin();
+
+    EXPECT_EQ(res.score(), fixture.score);
+    EXPECT_EQ(res.sequence1_end_position(), fixture.sequence1_end_position);
+    EXPECT_EQ(res.sequence2_end_position(), fixture.sequence2_end_position);
+    EXPECT_EQ(res.sequence1_begin_position(), fixture.sequence1_begin_position);
+    EXPECT_EQ(res.sequence2_begin_position(), fixture.sequence2_begin_position);
+
+    auto && [gapped_database, gapped_query] = res.alignment();
+    EXPECT_RANGE_EQ(gapped_database | seqan3::views::to_char, fixture.aligned_sequence1);
+    EXPECT_RANGE_EQ(gapped_query | seqan3::views::to_char, fixture.aligned_sequence2);
+}
+
+TYPED_TEST_P(pairwise_alignment_linear_memory_test, begin_positions)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg = fixture.config | seqan3::align_cfg::output_begin_position{}
+                                    | seqan3::align_cfg::output_score{} | seqan3::align_cfg::linear_memory{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto alignment_rng = seqan3::align_pairwise(std::tie(database, query), align_cfg);
+    auto res = *alignment_rng.begin();
+
+    EXPECT_EQ(res.score(), fixture.score);
+    EXPECT_EQ(res.sequence1_begin_position(), fixture.sequence1_begin_position);
+    EXPECT_EQ(res.sequence2_begin_position(), fixture.sequence2_begin_position);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(pairwise_alignment_linear_memory_test, alignment, begin_positions);
+
+namespace global_unbanded = seqan3::test::alignment::fixture::global::affine::unbanded;
+namespace global_banded = seqan3::test::alignment::fixture::global::affine::banded;
+namespace semi_global_unbanded = seqan3::test::alignment::fixture::semi_global::affine::unbanded;
+namespace semi_global_banded = seqan3::test::alignment::fixture::semi_global::affine::banded;
+
+using pairwise_linear_memory_testing_types =
+    ::testing::Types<pairwise_alignment_fixture<&global_unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_01>,
+                     pairwise_alignment_fixture<&global_unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_02>,
+                     pairwise_alignment_fixture<&global_unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_03>,
+                     pairwise_alignment_fixture<&global_unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_04>,
+                     pairwise_alignment_fixture<&global_unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_05>,
+                     pairwise_alignment_fixture<&global_unbanded::dna4_match_4_mismatch_5_gap_1_open_10_seq1_empty>,
+                     pairwise_alignment_fixture<&global_unbanded::dna4_match_4_mismatch_5_gap_1_open_10_seq2_empty>,
+                     pairwise_alignment_fixture<&global_unbanded::dna4_match_4_mismatch_5_gap_1_open_10_both_empty>,
+                     pairwise_alignment_fixture<&global_banded::dna4_01>,
+                     pairwise_alignment_fixture<&global_banded::dna4_same_sequence_upper_diagonal_0>,
+                     pairwise_alignment_fixture<&global_banded::dna4_same_sequence_lower_diagonal_0>,
+                     pairwise_alignment_fixture<&global_banded::dna4_small_band>,
+                     pairwise_alignment_fixture<&global_banded::dna4_single_diagonal>,
+                     pairwise_alignment_fixture<&global_banded::dna4_large_band>,
+                     pairwise_alignment_fixture<&semi_global_unbanded::dna4_01_semi_first>,
+                     pairwise_alignment_fixture<&semi_global_unbanded::dna4_02_semi_first>,
+                     pairwise_alignment_fixture<&semi_global_unbanded::dna4_03_semi_second>,
+                     pairwise_alignment_fixture<&semi_global_unbanded::dna4_04_semi_second>,
+                     pairwise_alignment_fixture<&semi_global_banded::dna4_01_semi_first>,
+                     pairwise_alignment_fixture<&semi_global_banded::dna4_03_semi_second>,
+                     pairwise_alignment_fixture<&semi_global_banded::dna4_04_semi_second>,
+                     pairwise_alignment_fixture<&semi_global_banded::dna4_free_lb_with_band_tl2br_no_matches>>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(pairwise_global_affine_linear_memory,
+                               pairwise_alignment_linear_memory_test,
+                               pairwise_linear_memory_testing_types, );
+
+// Long sequences such that the divide-and-conquer recursion is used and not only the base case.
+class pairwise_global_affine_linear_memory_random : public ::testing::TestWithParam<int>
+{
+public:
+    std::vector<seqan3::dna4> generate_sequence(size_t const size, std::mt19937_64 & engine) const
+    {
+        std::uniform_int_distribution<uint8_t> rank_distribution{0, 3};
+        std::vector<seqan3::dna4> sequence(size);
+        for (seqan3::dna4 & symbol : sequence)
+            symbol.assign_rank(rank_distribution(engine));
+        return sequence;
+    }
+
+    // Introduces random substitutions and indels into the sequence.
+    std::vector<seqan3::dna4> mutate(std::vector<seqan3::dna4> sequence, std::mt19937_64 & engine) const
+    {
+        std::uniform_int_distribution<size_t> position_distribution{0, sequence.size() - 1};
+        for (size_t i = 0; i < sequence.size() / 20; ++i)
+        {
+            size_t const position = position_distribution(engine);
+            switch (i % 3)
+            {
+                case 0:
+                    sequence[position].assign_rank((sequence[position].to_rank() + 1) % 4);
+                    break;
+                case 1:
+                    sequence.erase(sequence.begin() + position,
+                                   sequence.begin() + std::min(position + 5, sequence.size() - 1));
+                    break;
+                default:
+                    sequence.insert(sequence.begin() + position, 4, seqan3::dna4{}.assign_rank(i % 4));
+            }
+            position_distribution = std::uniform_int_distribution<size_t>{0, sequence.size() - 1};
+        }
+        return sequence;
+    }
+
+    template <typename config_t>
+    void check(config_t const & method_cfg)
+    {
+        std::mt19937_64 engine{static_cast<uint64_t>(GetParam())};
+        std::vector<seqan3::dna4> sequence1 = generate_sequence(700, engine);
+        std::vector<seqan3::dna4> sequence2 = mutate(sequence1, engine);
+        sequence2.erase(sequence2.begin(), sequence2.begin() + 50);
+
+        seqan3::nucleotide_scoring_scheme scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}};
+        seqan3::align_cfg::gap_cost_affine gap_cost{seqan3::align_cfg::open_score{-10},
+                                                    seqan3::align_cfg::extension_score{-1}};
+
+        auto cfg = method_cfg | seqan3::align_cfg::scoring_scheme{scheme} | gap_cost
+                 | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_begin_position{}
+                 | seqan3::align_cfg::output_end_position{} | seqan3::align_cfg::output_alignment{};
+
+        auto expected = *seqan3::align_pairwise(std::tie(sequence1, sequence2), cfg).begin();
+        auto actual =
+            *seqan3::align_pairwise(std::tie(sequence1, sequence2), cfg | seqan3::align_cfg::linear_memory{}).begin();
+
+        EXPECT_EQ(actual.score(), expected.score());
+        EXPECT_EQ(actual.sequence1_end_position(), expected.sequence1_end_position());
+        EXPECT_EQ(actual.sequence2_end_position(), expected.sequence2_end_position());
+        EXPECT_EQ(score_of(actual.alignment(), scheme, gap_cost), expected.score());
+
+        // The alignment must cover the sequences between the begin and the end positions.
+        auto is_no_gap = [](auto const symbol)
+        {
+            return symbol != seqan3::gap{};
+        };
+        auto && [gapped_sequence1, gapped_sequence2] = actual.alignment();
+        EXPECT_EQ(std::ranges::distance(gapped_sequence1 | std::views::filter(is_no_gap)),
+                  actual.sequence1_end_position() - actual.sequence1_begin_position());
+        EXPECT_EQ(std::ranges::distance(gapped_sequence2 | std::views::filter(is_no_gap)),
+                  actual.sequence2_end_position() - actual.sequence2_begin_position());
+    }
+};
+
+TEST_P(pairwise_global_affine_linear_memory_random, global)
+{
+    check(seqan3::align_cfg::method_global{});
+}
+
+TEST_P(pairwise_global_affine_linear_memory_random, semi_global)
+{
+    check(seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                           seqan3::align_cfg::free_end_gaps_sequence2_leading{true},
+                                           seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                           seqan3::align_cfg::free_end_gaps_sequence2_trailing{true}});
+}
+
+TEST_P(pairwise_global_affine_linear_memory_random, global_banded)
+{
+    check(seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                           seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                           seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                           seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}}
+          | seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-10},
+                                               seqan3::align_cfg::upper_diagonal{120}});
+}
+
+INSTANTIATE_TEST_SUITE_P(seeds, pairwise_global_affine_linear_memory_random, ::testing::Range(0, 5));
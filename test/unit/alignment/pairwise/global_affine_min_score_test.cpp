@@ -0,0 +1,213 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using namespace seqan3::literals;
+
+static auto const dna4_config =
+    seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                        seqan3::mismatch_score{-5}}}
+    | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10}, seqan3::align_cfg::extension_score{-1}};
+
+static constexpr int32_t inf = std::numeric_limits<int32_t>::max();
+
+// Pairs of a read and a mutated copy of it, such that some of them reach a high score and others do not.
+std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> generate_pairs()
+{
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<uint8_t> rank_distribution{0, 3};
+    std::uniform_int_distribution<size_t> size_distribution{0, 150};
+    std::uniform_int_distribution<size_t> error_distribution{0, 99};
+
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> pairs{};
+    for (size_t error_rate : {0u, 2u, 5u, 10u, 30u, 100u})
+    {
+        for (size_t iteration = 0; iteration < 5; ++iteration)
+        {
+            std::vector<seqan3::dna4> sequence1(size_distribution(generator));
+            for (auto & symbol : sequence1)
+                symbol.assign_rank(rank_distribution(generator));
+
+            std::vector<seqan3::dna4> sequence2{};
+            for (seqan3::dna4 symbol : sequence1)
+            {
+                if (error_distribution(generator) >= error_rate)
+                    sequence2.push_back(symbol);
+                else if (size_t error_type = rank_distribution(generator); error_type == 0) // insertion
+                    sequence2.insert(sequence2.end(), {symbol, symbol});
+                else if (error_type == 1) // substitution
+                    sequence2.push_back(seqan3::dna4{}.assign_rank((symbol.to_rank() + 1) % 4));
+                // otherwise deletion
+            }
+
+            pairs.emplace_back(std::move(sequence1), std::move(sequence2));
+        }
+    }
+
+    return pairs;
+}
+
+// Compares the results with a minimal score to the results without one.
+template <typename config_t>
+void compare_to_unrestricted_alignment(config_t const & config)
+{
+    auto const output_config = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{}
+                             | seqan3::align_cfg::output_begin_position{};
+
+    for (auto const & [sequence1, sequence2] : generate_pairs())
+    {
+        auto expected = *seqan3::align_pairwise(std::tie(sequence1, sequence2), config | output_config).begin();
+
+        for (int32_t const offset : {-20, -1, 0, 1, 20})
+        {
+            int32_t const min_score = expected.score() + offset;
+            auto result = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                                  config | output_config | seqan3::align_cfg::min_score{min_score})
+                               .begin();
+
+            if (offset <= 0)
+            {
+                EXPECT_EQ(result.score(), expected.score());
+                EXPECT_EQ(result.sequence1_begin_position(), expected.sequence1_begin_position());
+                EXPECT_EQ(result.sequence2_begin_position(), expected.sequence2_begin_position());
+                EXPECT_EQ(result.sequence1_end_position(), expected.sequence1_end_position());
+                EXPECT_EQ(result.sequence2_end_position(), expected.sequence2_end_position());
+            }
+            else
+            {
+                EXPECT_EQ(result.score(), inf);
+                EXPECT_EQ(result.sequence1_begin_position(), sequence1.size());
+                EXPECT_EQ(result.sequence2_begin_position(), sequence2.size());
+                EXPECT_EQ(result.sequence1_end_position(), sequence1.size());
+                EXPECT_EQ(result.sequence2_end_position(), sequence2.size());
+            }
+        }
+    }
+}
+
+TEST(global_affine_min_score, global)
+{
+    compare_to_unrestricted_alignment(seqan3::align_cfg::method_global{} | dna4_config);
+}
+
+TEST(global_affine_min_score, semi_global)
+{
+    using namespace seqan3::align_cfg;
+
+    compare_to_unrestricted_alignment(method_global{free_end_gaps_sequence1_leading{true},
+                                                    free_end_gaps_sequence2_leading{false},
+                                                    free_end_gaps_sequence1_trailing{true},
+                                                    free_end_gaps_sequence2_trailing{false}}
+                                      | dna4_config);
+    compare_to_unrestricted_alignment(method_global{free_end_gaps_sequence1_leading{true},
+                                                    free_end_gaps_sequence2_leading{true},
+                                                    free_end_gaps_sequence1_trailing{true},
+                                                    free_end_gaps_sequence2_trailing{true}}
+                                      | dna4_config);
+}
+
+TEST(global_affine_min_score, banded)
+{
+    using namespace seqan3::align_cfg;
+
+    auto const free_end_gaps = method_global{free_end_gaps_sequence1_leading{true},
+                                             free_end_gaps_sequence2_leading{true},
+                                             free_end_gaps_sequence1_trailing{true},
+                                             free_end_gaps_sequence2_trailing{true}};
+
+    compare_to_unrestricted_alignment(free_end_gaps | dna4_config
+                                      | band_fixed_size{lower_diagonal{-200}, upper_diagonal{200}});
+    compare_to_unrestricted_alignment(free_end_gaps | dna4_config
+                                      | band_fixed_size{lower_diagonal{-160}, upper_diagonal{8}});
+}
+
+TEST(global_affine_min_score, positive_gap_score)
+{
+    // The computation is not stopped early, but the minimal score is still applied to the result.
+    compare_to_unrestricted_alignment(
+        seqan3::align_cfg::method_global{}
+        | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                              seqan3::mismatch_score{-5}}}
+        | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-2}, seqan3::align_cfg::extension_score{1}});
+}
+
+TEST(global_affine_min_score, long_gap)
+{
+    // The best alignment continues a gap that is already open in the checked columns.
+    std::vector<seqan3::dna4> const sequence1 = "ACGT"_dna4;
+    std::vector<seqan3::dna4> sequence2 = "ACGT"_dna4;
+    sequence2.insert(sequence2.end(), 100, 'A'_dna4);
+
+    auto const config = seqan3::align_cfg::method_global{} | dna4_config | seqan3::align_cfg::output_score{};
+
+    for (int32_t const min_score : {-94, -100})
+    {
+        auto const restricted_config = config | seqan3::align_cfg::min_score{min_score};
+        EXPECT_EQ(seqan3::align_pairwise(std::tie(sequence2, sequence1), restricted_config).begin()->score(), -94);
+        EXPECT_EQ(seqan3::align_pairwise(std::tie(sequence1, sequence2), restricted_config).begin()->score(), -94);
+    }
+
+    EXPECT_EQ(seqan3::align_pairwise(std::tie(sequence2, sequence1), config | seqan3::align_cfg::min_score{-93})
+                  .begin()
+                  ->score(),
+              inf);
+}
+
+TEST(global_affine_min_score, alignment_and_cigar)
+{
+    std::vector<seqan3::dna4> const sequence1 = "ACGTGACTGACTTTACGTGACTGA"_dna4;
+    std::vector<seqan3::dna4> const sequence2 = "ACGTGACTGAGTTTACGTCACTGA"_dna4;
+    auto const config = seqan3::align_cfg::method_global{} | dna4_config | seqan3::align_cfg::output_score{}
+                      | seqan3::align_cfg::output_alignment{} | seqan3::align_cfg::output_cigar{};
+
+    auto expected = *seqan3::align_pairwise(std::tie(sequence1, sequence2), config).begin();
+    EXPECT_EQ(expected.score(), 78);
+
+    auto result = *seqan3::align_pairwise(std::tie(sequence1, sequence2), config | seqan3::align_cfg::min_score{78})
+                       .begin();
+    EXPECT_EQ(result.score(), expected.score());
+    EXPECT_EQ(result.alignment(), expected.alignment());
+    EXPECT_EQ(result.cigar_sequence(), expected.cigar_sequence());
+
+    result = *seqan3::align_pairwise(std::tie(sequence1, sequence2), config | seqan3::align_cfg::min_score{79})
+                  .begin();
+    EXPECT_EQ(result.score(), inf);
+    EXPECT_TRUE(std::ranges::empty(std::get<0>(result.alignment())));
+    EXPECT_TRUE(result.cigar_sequence().empty());
+}
+
+TEST(global_affine_min_score, collection)
+{
+    auto pairs = generate_pairs();
+    auto const config = seqan3::align_cfg::method_global{} | dna4_config | seqan3::align_cfg::output_score{}
+                      | seqan3::align_cfg::output_sequence1_id{};
+
+    std::vector<int32_t> scores{};
+    for (auto && result : seqan3::align_pairwise(pairs, config))
+        scores.push_back(result.score());
+
+    // The scalar and the vectorised algorithm mark the same alignments as not reaching the minimal score.
+    for (auto && result : seqan3::align_pairwise(pairs, config | seqan3::align_cfg::min_score{0}))
+        EXPECT_EQ(result.score(), (scores[result.sequence1_id()] >= 0) ? scores[result.sequence1_id()] : inf);
+
+    for (auto && result :
+         seqan3::align_pairwise(pairs, config | seqan3::align_cfg::min_score{0} | seqan3::align_cfg::vectorised{}))
+        EXPECT_EQ(result.score(), (scores[result.sequence1_id()] >= 0) ? scores[result.sequence1_id()] : inf);
+}
@@ -0,0 +1,243 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <ranges>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/hamming_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/utility/views/zip.hpp>
+
+using namespace seqan3::literals;
+
+static constexpr int32_t match = 4;
+static constexpr int32_t mismatch = -5;
+static constexpr int32_t gap_open = -10;
+static constexpr int32_t gap_extension = -1;
+
+static auto const dna4_config =
+    seqan3::align_cfg::method_global{}
+    | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{match},
+                                                                          seqan3::mismatch_score{mismatch}}}
+    | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{gap_open},
+                                         seqan3::align_cfg::extension_score{gap_extension}};
+
+// Generates a random sequence and a copy of it with the given number of random edits.
+std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>
+similar_sequences(std::mt19937_64 & generator, size_t const size, size_t const edits)
+{
+    std::uniform_int_distribution<uint8_t> rank_distribution{0, 3};
+    std::uniform_int_distribution<size_t> edit_distribution{0, 2};
+
+    std::vector<seqan3::dna4> sequence1(size);
+    for (auto & symbol : sequence1)
+        symbol.assign_rank(rank_distribution(generator));
+
+    std::vector<seqan3::dna4> sequence2 = sequence1;
+    for (size_t edit = 0; edit < edits; ++edit)
+    {
+        size_t const position = std::uniform_int_distribution<size_t>{0, sequence2.size()}(generator);
+        size_t const kind = edit_distribution(generator);
+
+        if (kind == 0 && position < sequence2.size()) // Substitution.
+            sequence2[position].assign_rank(rank_distribution(generator));
+        else if (kind == 1 && position < sequence2.size()) // Deletion.
+            sequence2.erase(sequence2.begin() + position);
+        else // Insertion.
+            sequence2.insert(sequence2.begin() + position, seqan3::dna4{}.assign_rank(rank_distribution(generator)));
+    }
+
+    return {std::move(sequence1), std::move(sequence2)};
+}
+
+// Recomputes the score of the given alignment with affine gap costs.
+template <typename alignment_t>
+int32_t alignment_score(alignment_t const & alignment)
+{
+    auto const & [gapped_sequence1, gapped_sequence2] = alignment;
+    EXPECT_EQ(std::ranges::distance(gapped_sequence1), std::ranges::distance(gapped_sequence2));
+
+    int32_t score = 0;
+    bool in_gap1 = false;
+    bool in_gap2 = false;
+    for (auto && [symbol1, symbol2] : seqan3::views::zip(gapped_sequence1, gapped_sequence2))
+    {
+        bool const is_gap1 = symbol1 == seqan3::gap{};
+        bool const is_gap2 = symbol2 == seqan3::gap{};
+        EXPECT_FALSE(is_gap1 && is_gap2);
+
+        if (is_gap1)
+            score += gap_extension + (in_gap1 ? 0 : gap_open);
+        else if (is_gap2)
+            score += gap_extension + (in_gap2 ? 0 : gap_open);
+        else
+            score += (symbol1 == symbol2) ? match : mismatch;
+
+        in_gap1 = is_gap1;
+        in_gap2 = is_gap2;
+    }
+
+    return score;
+}
+
+template <typename sequence_t>
+void compare_to_default_algorithm(sequence_t const & sequence1, sequence_t const & sequence2)
+{
+    auto expected = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                            dna4_config | seqan3::align_cfg::output_score{})
+                         .begin();
+
+    auto score_result = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                                dna4_config | seqan3::align_cfg::output_score{}
+                                                    | seqan3::align_cfg::output_end_position{}
+                                                    | seqan3::align_cfg::wavefront{})
+                             .begin();
+
+    EXPECT_EQ(score_result.score(), expected.score());
+    EXPECT_EQ(score_result.sequence1_end_position(), sequence1.size());
+    EXPECT_EQ(score_result.sequence2_end_position(), sequence2.size());
+
+    auto alignment_result =
+        *seqan3::align_pairwise(std::tie(sequence1, sequence2), dna4_config | seqan3::align_cfg::wavefront{}).begin();
+
+    EXPECT_EQ(alignment_result.score(), expected.score());
+    EXPECT_EQ(alignment_result.sequence1_begin_position(), 0u);
+    EXPECT_EQ(alignment_result.sequence2_begin_position(), 0u);
+    EXPECT_EQ(alignment_result.sequence1_end_position(), sequence1.size());
+    EXPECT_EQ(alignment_result.sequence2_end_position(), sequence2.size());
+    EXPECT_EQ(alignment_score(alignment_result.alignment()), expected.score());
+}
+
+TEST(global_affine_wavefront, example)
+{
+    std::vector<seqan3::dna4> const sequence1 = "ACGTACGTTTACGTACGTACGTACGTGGGACGTACGT"_dna4;
+    std::vector<seqan3::dna4> const sequence2 = "ACGTACGTACGTACGTACGTAACGTACGT"_dna4;
+
+    compare_to_default_algorithm(sequence1, sequence2);
+}
+
+TEST(global_affine_wavefront, identical_and_empty)
+{
+    std::vector<seqan3::dna4> const sequence = "ACGTACGTACGTACGT"_dna4;
+    std::vector<seqan3::dna4> const empty{};
+
+    compare_to_default_algorithm(sequence, sequence);
+    compare_to_default_algorithm(sequence, empty);
+    compare_to_default_algorithm(empty, sequence);
+    compare_to_default_algorithm(empty, empty);
+
+    auto result =
+        *seqan3::align_pairwise(std::tie(sequence, sequence), dna4_config | seqan3::align_cfg::wavefront{}).begin();
+    EXPECT_EQ(result.score(), 16 * match);
+    EXPECT_TRUE(std::ranges::equal(std::get<0>(result.alignment()), sequence));
+}
+
+TEST(global_affine_wavefront, similar_sequences)
+{
+    std::mt19937_64 generator{42};
+
+    for (size_t edits : {1u, 3u, 10u, 30u})
+        for (size_t iteration = 0; iteration < 10; ++iteration)
+        {
+            auto [sequence1, sequence2] = similar_sequences(generator, 200, edits);
+            compare_to_default_algorithm(sequence1, sequence2);
+        }
+}
+
+TEST(global_affine_wavefront, random_sequences)
+{
+    std::mt19937_64 generator{7};
+    std::uniform_int_distribution<uint8_t> rank_distribution{0, 3};
+    std::uniform_int_distribution<size_t> size_distribution{0, 100};
+
+    for (size_t iteration = 0; iteration < 30; ++iteration)
+    {
+        std::vector<seqan3::dna4> sequence1(size_distribution(generator));
+        std::vector<seqan3::dna4> sequence2(size_distribution(generator));
+        for (auto & symbol : sequence1)
+            symbol.assign_rank(rank_distribution(generator));
+        for (auto & symbol : sequence2)
+            symbol.assign_rank(rank_distribution(generator));
+
+        compare_to_default_algorithm(sequence1, sequence2);
+    }
+}
+
+TEST(global_affine_wavefront, hamming_scoring_scheme)
+{
+    std::vector<seqan3::dna4> const sequence1 = "AGTCCTAGCTAGCTA"_dna4;
+    std::vector<seqan3::dna4> const sequence2 = "AGTCTAGCTTAGCTA"_dna4;
+
+    auto const config = seqan3::align_cfg::method_global{}
+                      | seqan3::align_cfg::scoring_scheme{seqan3::hamming_scoring_scheme{}}
+                      | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-2},
+                                                           seqan3::align_cfg::extension_score{-1}}
+                      | seqan3::align_cfg::output_score{};
+
+    auto expected = *seqan3::align_pairwise(std::tie(sequence1, sequence2), config).begin();
+    auto result =
+        *seqan3::align_pairwise(std::tie(sequence1, sequence2), config | seqan3::align_cfg::wavefront{}).begin();
+
+    EXPECT_EQ(result.score(), expected.score());
+}
+
+TEST(global_affine_wavefront, invalid_configuration)
+{
+    std::vector<seqan3::dna4> const sequence1 = "ACGTACGT"_dna4;
+    std::vector<seqan3::dna4> const sequence2 = "ACGTTACGT"_dna4;
+
+    // Free end gaps.
+    auto const free_end_gaps_config =
+        seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                         seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                         seqan3::align_cfg::free_end_gaps_sequence1_trailing{false},
+                                         seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}}
+        | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{}} | seqan3::align_cfg::wavefront{};
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence1, sequence2), free_end_gaps_config),
+                 seqan3::invalid_alignment_configuration);
+
+    // Match score not larger than mismatch score.
+    auto const equal_scores_config =
+        seqan3::align_cfg::method_global{}
+        | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{-1},
+                                                                              seqan3::mismatch_score{-1}}}
+        | seqan3::align_cfg::wavefront{};
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence1, sequence2), equal_scores_config),
+                 seqan3::invalid_alignment_configuration);
+
+    // Twice the gap extension score is not smaller than the match score.
+    auto const positive_gap_config =
+        seqan3::align_cfg::method_global{}
+        | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{}}
+        | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{0}, seqan3::align_cfg::extension_score{0}}
+        | seqan3::align_cfg::wavefront{};
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence1, sequence2), positive_gap_config),
+                 seqan3::invalid_alignment_configuration);
+
+    // More than one mismatch score.
+    std::vector<seqan3::aa27> const protein1 = "ACDEFGHIKLMNPQRSTVWY"_aa27;
+    std::vector<seqan3::aa27> const protein2 = "ACDEFGHIKLMNPQRSTVWY"_aa27;
+    auto const matrix_config = seqan3::align_cfg::method_global{}
+                             | seqan3::align_cfg::scoring_scheme{seqan3::aminoacid_scoring_scheme{
+                                 seqan3::aminoacid_similarity_matrix::blosum62}}
+                             | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                                  seqan3::align_cfg::extension_score{-1}}
+                             | seqan3::align_cfg::wavefront{};
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(protein1, protein2), matrix_config),
+                 seqan3::invalid_alignment_configuration);
+}
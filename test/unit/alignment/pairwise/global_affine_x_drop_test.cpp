@@ -0,0 +1,214 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_drop.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using namespace seqan3::literals;
+
+struct extension_result
+{
+    int32_t score;
+    size_t sequence1_end_position;
+    size_t sequence2_end_position;
+};
+
+// Computes the best cell of the entire global alignment matrix with affine gap costs.
+extension_result full_extension(std::vector<seqan3::dna4> const & sequence1,
+                                std::vector<seqan3::dna4> const & sequence2,
+                                int32_t const match,
+                                int32_t const mismatch,
+                                int32_t const gap_open,
+                                int32_t const gap_extension)
+{
+    int32_t const minus_infinity = std::numeric_limits<int32_t>::lowest() / 4;
+    size_t const rows = sequence2.size() + 1;
+
+    std::vector<int32_t> optimal(rows);
+    std::vector<int32_t> horizontal(rows, minus_infinity);
+    extension_result best{0, 0, 0};
+
+    for (size_t i = 1; i < rows; ++i)
+        optimal[i] = gap_open + static_cast<int32_t>(i) * gap_extension;
+
+    auto update = [&](int32_t const score, size_t const column, size_t const row)
+    {
+        if (score >= best.score)
+            best = {score, column, row};
+    };
+
+    for (size_t i = 0; i < rows; ++i)
+        update(optimal[i], 0, i);
+
+    for (size_t j = 1; j <= sequence1.size(); ++j)
+    {
+        int32_t diagonal = optimal[0];
+        optimal[0] = gap_open + static_cast<int32_t>(j) * gap_extension;
+        update(optimal[0], j, 0);
+        int32_t vertical = minus_infinity;
+
+        for (size_t i = 1; i < rows; ++i)
+        {
+            horizontal[i] = std::max(horizontal[i], optimal[i] + gap_open) + gap_extension;
+            vertical = std::max(vertical, optimal[i - 1] + gap_open) + gap_extension;
+            int32_t const score = diagonal + (sequence1[j - 1] == sequence2[i - 1] ? match : mismatch);
+            diagonal = optimal[i];
+            optimal[i] = std::max({score, horizontal[i], vertical});
+            update(optimal[i], j, i);
+        }
+    }
+
+    return best;
+}
+
+static auto const base_config = seqan3::align_cfg::method_global{}
+                              | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{
+                                  seqan3::match_score{4},
+                                  seqan3::mismatch_score{-5}}}
+                              | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                                   seqan3::align_cfg::extension_score{-1}}
+                              | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+
+// 10 matches, 20 mismatches and 30 matches.
+static std::vector<seqan3::dna4> const sequence1 = "AAAAAAAAAACCCCCCCCCCCCCCCCCCCCAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"_dna4;
+static std::vector<seqan3::dna4> const sequence2 = "AAAAAAAAAAGGGGGGGGGGGGGGGGGGGGAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"_dna4;
+
+TEST(global_affine_x_drop, without_drop)
+{
+    extension_result const expected = full_extension(sequence1, sequence2, 4, -5, -10, -1);
+    auto res = *seqan3::align_pairwise(std::tie(sequence1, sequence2), base_config | seqan3::align_cfg::x_drop{})
+                    .begin();
+
+    EXPECT_EQ(res.score(), expected.score);
+    EXPECT_EQ(res.sequence1_end_position(), 60u);
+    EXPECT_EQ(res.sequence2_end_position(), 60u);
+}
+
+TEST(global_affine_x_drop, x_drop)
+{
+    auto res =
+        *seqan3::align_pairwise(std::tie(sequence1, sequence2), base_config | seqan3::align_cfg::x_drop{30}).begin();
+
+    EXPECT_EQ(res.score(), 40);
+    EXPECT_EQ(res.sequence1_end_position(), 10u);
+    EXPECT_EQ(res.sequence2_end_position(), 10u);
+
+    // A large X-drop bridges the mismatch region.
+    extension_result const expected = full_extension(sequence1, sequence2, 4, -5, -10, -1);
+    res = *seqan3::align_pairwise(std::tie(sequence1, sequence2), base_config | seqan3::align_cfg::x_drop{100})
+               .begin();
+
+    EXPECT_EQ(res.score(), expected.score);
+    EXPECT_EQ(res.sequence1_end_position(), 60u);
+    EXPECT_EQ(res.sequence2_end_position(), 60u);
+}
+
+TEST(global_affine_x_drop, z_drop)
+{
+    auto res =
+        *seqan3::align_pairwise(std::tie(sequence1, sequence2), base_config | seqan3::align_cfg::z_drop{5}).begin();
+
+    EXPECT_EQ(res.score(), 40);
+    EXPECT_EQ(res.sequence1_end_position(), 10u);
+    EXPECT_EQ(res.sequence2_end_position(), 10u);
+
+    // Gaps are not penalised twice, hence a large Z-drop does not stop the extension.
+    extension_result const expected = full_extension(sequence1, sequence2, 4, -5, -10, -1);
+    res = *seqan3::align_pairwise(std::tie(sequence1, sequence2), base_config | seqan3::align_cfg::z_drop{100})
+               .begin();
+
+    EXPECT_EQ(res.score(), expected.score);
+
+    // Both heuristics can be combined.
+    res = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                  base_config | seqan3::align_cfg::x_drop{30} | seqan3::align_cfg::z_drop{100})
+               .begin();
+
+    EXPECT_EQ(res.score(), 40);
+    EXPECT_EQ(res.sequence1_end_position(), 10u);
+    EXPECT_EQ(res.sequence2_end_position(), 10u);
+}
+
+TEST(global_affine_x_drop, gap)
+{
+    // Sequence1 has an insertion of four symbols in the middle.
+    std::vector<seqan3::dna4> const sequence1 = "ACGTACGTACGTACGTTTTTACGTACGTACGTACGTCCCCCCCCCCCC"_dna4;
+    std::vector<seqan3::dna4> const sequence2 = "ACGTACGTACGTACGTACGTACGTACGTACGTGGGGGGGGGGGG"_dna4;
+
+    auto res =
+        *seqan3::align_pairwise(std::tie(sequence1, sequence2), base_config | seqan3::align_cfg::x_drop{20}).begin();
+
+    EXPECT_EQ(res.score(), 32 * 4 - 10 - 4);
+    EXPECT_EQ(res.sequence1_end_position(), 36u);
+    EXPECT_EQ(res.sequence2_end_position(), 32u);
+}
+
+TEST(global_affine_x_drop, random_sequences)
+{
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<uint8_t> rank_distribution{0, 3};
+    std::uniform_int_distribution<size_t> size_distribution{0, 150};
+
+    for (size_t iteration = 0; iteration < 50; ++iteration)
+    {
+        std::vector<seqan3::dna4> sequence1(size_distribution(generator));
+        std::vector<seqan3::dna4> sequence2(size_distribution(generator));
+        for (auto & symbol : sequence1)
+            symbol.assign_rank(rank_distribution(generator));
+        for (auto & symbol : sequence2)
+            symbol.assign_rank(rank_distribution(generator));
+
+        extension_result const expected = full_extension(sequence1, sequence2, 4, -5, -10, -1);
+
+        // Without any drop the best cell of the entire matrix is found.
+        auto res = *seqan3::align_pairwise(std::tie(sequence1, sequence2), base_config | seqan3::align_cfg::x_drop{})
+                        .begin();
+
+        EXPECT_EQ(res.score(), expected.score);
+        EXPECT_EQ(res.sequence1_end_position(), expected.sequence1_end_position);
+        EXPECT_EQ(res.sequence2_end_position(), expected.sequence2_end_position);
+
+        // The X-drop can never find a better extension.
+        res = *seqan3::align_pairwise(std::tie(sequence1, sequence2), base_config | seqan3::align_cfg::x_drop{10})
+                   .begin();
+
+        EXPECT_LE(res.score(), expected.score);
+        EXPECT_GE(res.score(), 0);
+    }
+}
+
+TEST(global_affine_x_drop, invalid_configuration)
+{
+    // Requires the trace.
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                        base_config | seqan3::align_cfg::x_drop{10}
+                                            | seqan3::align_cfg::output_begin_position{}),
+                 seqan3::invalid_alignment_configuration);
+
+    // Default output configuration includes the alignment.
+    auto const default_output_config =
+        seqan3::align_cfg::method_global{}
+        | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{}} | seqan3::align_cfg::z_drop{10};
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence1, sequence2), default_output_config),
+                 seqan3::invalid_alignment_configuration);
+
+    // Negative values.
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence1, sequence2), base_config | seqan3::align_cfg::x_drop{-1}),
+                 seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence1, sequence2), base_config | seqan3::align_cfg::z_drop{-1}),
+                 seqan3::invalid_alignment_configuration);
+}
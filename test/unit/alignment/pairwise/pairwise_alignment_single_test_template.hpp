@@ -6,6 +6,7 @@
 
 #include <gtest/gtest.h>
 
+#include <seqan3/alignment/cigar_conversion/cigar_from_alignment.hpp>
 #include <seqan3/alignment/configuration/align_config_score_type.hpp>
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
 #include <seqan3/alphabet/views/to_char.hpp>
@@ -112,4 +113,35 @@ TYPED_TEST_P(pairwise_alignment_test, alignment)
     EXPECT_RANGE_EQ(static_cast<trace_matrix_t>(res.trace_matrix()), fixture.trace_vector);
 }
 
-REGISTER_TYPED_TEST_SUITE_P(pairwise_alignment_test, score, end_positions, begin_positions, alignment);
+TYPED_TEST_P(pairwise_alignment_test, cigar)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg = fixture.config | seqan3::align_cfg::output_begin_position{}
+                                    | seqan3::align_cfg::output_end_position{} | seqan3::align_cfg::output_cigar{};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto res = *seqan3::align_pairwise(std::tie(database, query), align_cfg).begin();
+    auto expected =
+        *seqan3::align_pairwise(std::tie(database, query), align_cfg | seqan3::align_cfg::output_alignment{}).begin();
+
+    EXPECT_EQ(res.sequence1_end_position(), fixture.sequence1_end_position);
+    EXPECT_EQ(res.sequence2_end_position(), fixture.sequence2_end_position);
+    EXPECT_EQ(res.sequence1_begin_position(), fixture.sequence1_begin_position);
+    EXPECT_EQ(res.sequence2_begin_position(), fixture.sequence2_begin_position);
+
+    // The CIGAR string is the same as the one obtained from the alignment.
+    EXPECT_EQ(expected.cigar_sequence(), res.cigar_sequence());
+    if (std::ranges::empty(std::get<0>(expected.alignment())))
+        EXPECT_TRUE(res.cigar_sequence().empty());
+    else
+        EXPECT_EQ(res.cigar_sequence(), seqan3::cigar_from_alignment(expected.alignment()));
+
+    // Only the CIGAR string.
+    auto cigar_only =
+        *seqan3::align_pairwise(std::tie(database, query), fixture.config | seqan3::align_cfg::output_cigar{}).begin();
+    EXPECT_EQ(cigar_only.cigar_sequence(), res.cigar_sequence());
+}
+
+REGISTER_TYPED_TEST_SUITE_P(pairwise_alignment_test, score, end_positions, begin_positions, alignment, cigar);
@@ -4,12 +4,24 @@
 
 #include <gtest/gtest.h>
 
+#include <list>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/adaptation/char.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
 #include <seqan3/alphabet/composite/alphabet_variant.hpp>
 #include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
 #include <seqan3/alphabet/nucleotide/concept.hpp>
 #include <seqan3/alphabet/nucleotide/dna15.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/nucleotide/rna4.hpp>
 #include <seqan3/alphabet/views/complement.hpp>
+#include <seqan3/alphabet/views/to_char.hpp>
+#include <seqan3/alphabet/views/to_rank.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
 #include <seqan3/test/expect_same_type.hpp>
 #include <seqan3/test/range/container_test_template.hpp>
@@ -62,3 +74,173 @@ TEST(bitpacked_sequence_test, issue3264)
     seqan3::dna4 val = static_cast<seqan3::dna4>(*it); // this line caused the compiler error
     EXPECT_EQ(val, 'A'_dna4);
 }
+
+template <typename alphabet_t>
+std::vector<alphabet_t> make_sequence(size_t const size)
+{
+    std::vector<alphabet_t> sequence(size);
+    for (size_t i = 0; i < size; ++i)
+        sequence[i] = seqan3::assign_rank_to((i * 7u + i / 3u) % seqan3::alphabet_size<alphabet_t>, alphabet_t{});
+
+    return sequence;
+}
+
+template <typename alphabet_t>
+class bitpacked_sequence_bulk_test : public ::testing::Test
+{};
+
+using bulk_alphabet_types = ::testing::Types<seqan3::dna4,
+                                             seqan3::rna4,
+                                             seqan3::dna5,
+                                             seqan3::dna15,
+                                             seqan3::aa27,
+                                             seqan3::gapped<seqan3::dna4>,
+                                             char>;
+
+TYPED_TEST_SUITE(bitpacked_sequence_bulk_test, bulk_alphabet_types, );
+
+TYPED_TEST(bitpacked_sequence_bulk_test, insert)
+{
+    for (size_t const size : {0u, 1u, 31u, 64u, 300u, 1000u})
+    {
+        std::vector<TypeParam> const letters = make_sequence<TypeParam>(size);
+        std::vector<TypeParam> expected = make_sequence<TypeParam>(77u);
+        seqan3::bitpacked_sequence<TypeParam> sequence{expected};
+
+        // In the middle from a contiguous range.
+        expected.insert(expected.begin() + 13, letters.begin(), letters.end());
+        sequence.insert(sequence.cbegin() + 13, letters.begin(), letters.end());
+        EXPECT_RANGE_EQ(sequence, expected);
+
+        // At the end from a non-contiguous range.
+        std::list<TypeParam> const list(letters.begin(), letters.end());
+        expected.insert(expected.end(), list.begin(), list.end());
+        sequence.insert(sequence.cend(), list.begin(), list.end());
+        EXPECT_RANGE_EQ(sequence, expected);
+
+        // At the begin.
+        expected.insert(expected.begin(), letters.begin(), letters.end());
+        sequence.insert(sequence.cbegin(), letters.begin(), letters.end());
+        EXPECT_RANGE_EQ(sequence, expected);
+
+        sequence.assign(letters);
+        EXPECT_RANGE_EQ(sequence, letters);
+    }
+}
+
+TYPED_TEST(bitpacked_sequence_bulk_test, chars)
+{
+    for (size_t const size : {0u, 1u, 31u, 64u, 300u, 1000u})
+    {
+        std::vector<TypeParam> const letters = make_sequence<TypeParam>(size);
+        std::string const chars = letters | seqan3::views::to_char | seqan3::ranges::to<std::string>();
+
+        seqan3::bitpacked_sequence<TypeParam> sequence{make_sequence<TypeParam>(17u)};
+        sequence.assign_chars(chars);
+        EXPECT_RANGE_EQ(sequence, letters);
+
+        std::string output(size + 3u, '!');
+        sequence.copy_chars_to(output);
+        EXPECT_EQ(output, chars + "!!!");
+
+        // Not contiguous.
+        std::list<char> const list(chars.begin(), chars.end());
+        sequence.assign_chars(list);
+        EXPECT_RANGE_EQ(sequence, letters);
+
+        std::list<char> list_output(size);
+        sequence.copy_chars_to(list_output);
+        EXPECT_RANGE_EQ(list_output, list);
+    }
+}
+
+TYPED_TEST(bitpacked_sequence_bulk_test, ranks)
+{
+    using rank_t = seqan3::alphabet_rank_t<TypeParam>;
+
+    for (size_t const size : {0u, 1u, 31u, 64u, 300u, 1000u})
+    {
+        std::vector<TypeParam> const letters = make_sequence<TypeParam>(size);
+        std::vector<rank_t> const ranks = letters | seqan3::views::to_rank | seqan3::ranges::to<std::vector>();
+
+        seqan3::bitpacked_sequence<TypeParam> sequence{};
+        sequence.assign_ranks(ranks);
+        EXPECT_RANGE_EQ(sequence, letters);
+
+        std::vector<size_t> const wide_ranks(ranks.begin(), ranks.end());
+        sequence.assign_ranks(wide_ranks);
+        EXPECT_RANGE_EQ(sequence, letters);
+
+        std::vector<rank_t> output(size);
+        sequence.copy_ranks_to(output);
+        EXPECT_EQ(output, ranks);
+    }
+}
+
+TYPED_TEST(bitpacked_sequence_bulk_test, packed_ranks)
+{
+    constexpr size_t bits = std::bit_width(seqan3::alphabet_size<TypeParam> - 1u);
+    std::vector<TypeParam> const letters = make_sequence<TypeParam>(200u);
+    seqan3::bitpacked_sequence<TypeParam> const sequence{letters};
+
+    for (size_t count = 0; count * bits <= 64u; ++count)
+    {
+        for (size_t position = 0; position + count <= letters.size(); position += 3u)
+        {
+            uint64_t expected{};
+            for (size_t i = 0; i < count; ++i)
+                expected = (expected << bits) | seqan3::to_rank(letters[position + i]);
+
+            EXPECT_EQ(sequence.packed_ranks(position, count), expected);
+        }
+    }
+}
+
+TEST(bitpacked_sequence_test, packed_ranks_kmer_hash)
+{
+    std::vector<seqan3::dna4> const letters = make_sequence<seqan3::dna4>(500u);
+    seqan3::bitpacked_sequence<seqan3::dna4> const sequence{letters};
+
+    size_t position{};
+    for (size_t const hash : letters | seqan3::views::kmer_hash(seqan3::ungapped{19}))
+        EXPECT_EQ(sequence.packed_ranks(position++, 19u), hash);
+}
+
+template <typename alphabet_t>
+class bitpacked_sequence_reverse_complement_test : public ::testing::Test
+{};
+
+using nucleotide_types = ::testing::Types<seqan3::dna4, seqan3::rna4, seqan3::dna5, seqan3::dna15>;
+
+TYPED_TEST_SUITE(bitpacked_sequence_reverse_complement_test, nucleotide_types, );
+
+TYPED_TEST(bitpacked_sequence_reverse_complement_test, reverse_complement)
+{
+    for (size_t const size : {0u, 1u, 2u, 31u, 32u, 33u, 64u, 65u, 1000u})
+    {
+        std::vector<TypeParam> const letters = make_sequence<TypeParam>(size);
+        std::vector<TypeParam> const expected =
+            letters | std::views::reverse | seqan3::views::complement | seqan3::ranges::to<std::vector>();
+
+        seqan3::bitpacked_sequence<TypeParam> sequence{letters};
+        sequence.reverse_complement();
+        EXPECT_RANGE_EQ(sequence, expected);
+        EXPECT_EQ(sequence, seqan3::bitpacked_sequence<TypeParam>{expected});
+
+        sequence.reverse_complement();
+        EXPECT_RANGE_EQ(sequence, letters);
+    }
+}
+
+TEST(bitpacked_sequence_test, reverse_complement_after_pop_back)
+{
+    // The bits of removed letters must not show up in the reverse complement.
+    seqan3::bitpacked_sequence<seqan3::dna4> sequence{"ACGTTTGCA"_dna4};
+    sequence.pop_back();
+    sequence.pop_back();
+    sequence.reverse_complement();
+    EXPECT_RANGE_EQ(sequence, "CAAACGT"_dna4);
+
+    sequence.push_back('G'_dna4);
+    EXPECT_RANGE_EQ(sequence, "CAAACGTG"_dna4);
+}
@@ -0,0 +1,231 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <list>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alphabet/adaptation/char.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/container/mapped_concatenated_sequences.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/views/rank_to.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/tmp_directory.hpp>
+#include <seqan3/utility/range/to.hpp>
+
+template <typename alphabet_t>
+class mapped_concatenated_sequences_test : public ::testing::Test
+{
+public:
+    // Sequences of various lengths, such that the letters straddle word boundaries for all widths.
+    std::vector<std::vector<alphabet_t>> sequences() const
+    {
+        std::vector<std::vector<alphabet_t>> result{};
+        for (size_t length : {0u, 1u, 5u, 63u, 64u, 65u, 0u, 1000u, 4095u, 4097u, 9000u, 3u})
+        {
+            result.push_back(std::views::iota(size_t{result.size()}, result.size() + length)
+                             | std::views::transform(
+                                 [](size_t const i)
+                                 {
+                                     return static_cast<seqan3::alphabet_rank_t<alphabet_t>>(
+                                         (i * 7919u) % seqan3::alphabet_size<alphabet_t>);
+                                 })
+                             | seqan3::views::rank_to<alphabet_t> | seqan3::ranges::to<std::vector>());
+        }
+
+        return result;
+    }
+
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path file_name{tmp.path() / "sequences.seqs"};
+};
+
+using alphabet_types = ::testing::Types<seqan3::dna4, seqan3::dna5, seqan3::dna15, seqan3::aa27, char>;
+
+TYPED_TEST_SUITE(mapped_concatenated_sequences_test, alphabet_types, );
+
+TYPED_TEST(mapped_concatenated_sequences_test, concepts)
+{
+    using container_t = seqan3::mapped_concatenated_sequences<TypeParam>;
+
+    EXPECT_TRUE(std::ranges::random_access_range<container_t const>);
+    EXPECT_TRUE(std::ranges::sized_range<container_t const>);
+    EXPECT_TRUE(std::ranges::random_access_range<typename container_t::value_type>);
+    EXPECT_TRUE(std::ranges::sized_range<typename container_t::value_type>);
+    EXPECT_TRUE(std::ranges::view<typename container_t::value_type>);
+    EXPECT_FALSE(std::copy_constructible<container_t>);
+    EXPECT_TRUE(std::move_constructible<container_t>);
+}
+
+TYPED_TEST(mapped_concatenated_sequences_test, write_and_map)
+{
+    using container_t = seqan3::mapped_concatenated_sequences<TypeParam>;
+    auto const sequences = this->sequences();
+
+    container_t::write(this->file_name, sequences);
+    container_t mapped{this->file_name};
+
+    ASSERT_EQ(mapped.size(), sequences.size());
+    EXPECT_FALSE(mapped.empty());
+    EXPECT_EQ(mapped.concat_size(), std::ranges::distance(sequences | std::views::join));
+
+    for (size_t i = 0; i < sequences.size(); ++i)
+        EXPECT_RANGE_EQ(mapped[i], sequences[i]);
+
+    EXPECT_RANGE_EQ(mapped.front(), sequences.front());
+    EXPECT_RANGE_EQ(mapped.back(), sequences.back());
+    EXPECT_RANGE_EQ(mapped.concat(), sequences | std::views::join);
+    EXPECT_RANGE_EQ(mapped.at(3), sequences[3]);
+    EXPECT_THROW(mapped.at(sequences.size()), std::out_of_range);
+
+    size_t i = 0;
+    for (auto && sequence : mapped)
+        EXPECT_RANGE_EQ(sequence, sequences[i++]);
+    EXPECT_EQ(i, sequences.size());
+
+    auto [words, delimiters] = mapped.raw_data();
+    EXPECT_EQ(delimiters.size(), sequences.size() + 1u);
+    EXPECT_EQ(delimiters.front(), 0u);
+    EXPECT_EQ(delimiters.back(), mapped.concat_size());
+    size_t const bits_per_letter = seqan3::detail::ceil_log2(seqan3::alphabet_size<TypeParam>);
+    EXPECT_EQ(words.size(), (mapped.concat_size() * bits_per_letter + 63u) / 64u);
+}
+
+TYPED_TEST(mapped_concatenated_sequences_test, write_bitpacked_sequences)
+{
+    using container_t = seqan3::mapped_concatenated_sequences<TypeParam>;
+    auto const sequences = this->sequences();
+
+    std::vector<seqan3::bitpacked_sequence<TypeParam>> bitpacked{};
+    for (auto const & sequence : sequences)
+        bitpacked.emplace_back(sequence);
+
+    container_t::write(this->file_name, bitpacked);
+    container_t mapped{this->file_name};
+
+    ASSERT_EQ(mapped.size(), sequences.size());
+    for (size_t i = 0; i < sequences.size(); ++i)
+        EXPECT_RANGE_EQ(mapped[i], sequences[i]);
+}
+
+TYPED_TEST(mapped_concatenated_sequences_test, write_single_pass_range)
+{
+    using container_t = seqan3::mapped_concatenated_sequences<TypeParam>;
+    auto const sequences = this->sequences();
+    std::list<std::vector<TypeParam>> list{sequences.begin(), sequences.end()};
+
+    // Neither the outer nor the inner ranges are sized.
+    container_t::write(this->file_name,
+                       list | std::views::transform(
+                           [](auto const & sequence)
+                           {
+                               return sequence | std::views::filter(
+                                          [](auto)
+                                          {
+                                              return true;
+                                          });
+                           }));
+    container_t mapped{this->file_name};
+
+    ASSERT_EQ(mapped.size(), sequences.size());
+    for (size_t i = 0; i < sequences.size(); ++i)
+        EXPECT_RANGE_EQ(mapped[i], sequences[i]);
+}
+
+TYPED_TEST(mapped_concatenated_sequences_test, empty)
+{
+    using container_t = seqan3::mapped_concatenated_sequences<TypeParam>;
+
+    container_t default_constructed{};
+    EXPECT_TRUE(default_constructed.empty());
+    EXPECT_EQ(default_constructed.begin(), default_constructed.end());
+    EXPECT_TRUE(default_constructed.raw_data().second.empty());
+
+    container_t::write(this->file_name, std::vector<std::vector<TypeParam>>{});
+    container_t mapped{this->file_name};
+    EXPECT_TRUE(mapped.empty());
+    EXPECT_EQ(mapped.concat_size(), 0u);
+    EXPECT_EQ(mapped.begin(), mapped.end());
+}
+
+TYPED_TEST(mapped_concatenated_sequences_test, move_and_share)
+{
+    using container_t = seqan3::mapped_concatenated_sequences<TypeParam>;
+    auto const sequences = this->sequences();
+    container_t::write(this->file_name, sequences);
+
+    container_t first{this->file_name};
+    container_t second{this->file_name}; // Both map the same file.
+    container_t moved{std::move(first)};
+
+    EXPECT_TRUE(first.empty());
+    ASSERT_EQ(moved.size(), sequences.size());
+    ASSERT_EQ(second.size(), sequences.size());
+    EXPECT_RANGE_EQ(moved[7], sequences[7]);
+    EXPECT_RANGE_EQ(second[7], sequences[7]);
+
+    first = std::move(second);
+    EXPECT_TRUE(second.empty());
+    EXPECT_RANGE_EQ(first[8], sequences[8]);
+}
+
+TEST(mapped_concatenated_sequences, invalid_files)
+{
+    using namespace seqan3::literals;
+
+    seqan3::test::tmp_directory tmp{};
+    auto const file_name = tmp.path() / "sequences.seqs";
+    using container_t = seqan3::mapped_concatenated_sequences<seqan3::dna4>;
+
+    // Missing file.
+    EXPECT_THROW(container_t{tmp.path() / "missing.seqs"}, std::filesystem::filesystem_error);
+
+    // Not a file of mapped sequences.
+    {
+        std::ofstream stream{file_name};
+        stream << ">seq1\nACGT\n";
+    }
+    EXPECT_THROW(container_t{file_name}, std::runtime_error);
+
+    // Empty file.
+    std::ofstream{file_name, std::ios::trunc};
+    EXPECT_THROW(container_t{file_name}, std::runtime_error);
+
+    // Wrong alphabet.
+    seqan3::mapped_concatenated_sequences<seqan3::dna5>::write(file_name, std::vector<seqan3::dna5_vector>{"ACGTN"_dna5});
+    EXPECT_THROW(container_t{file_name}, std::runtime_error);
+
+    // Truncated file.
+    container_t::write(file_name, std::vector{"ACGTACGT"_dna4, "ACGT"_dna4});
+    std::filesystem::resize_file(file_name, std::filesystem::file_size(file_name) - 8u);
+    EXPECT_THROW(container_t{file_name}, std::runtime_error);
+
+    // Corrupted headers whose counts overflow.
+    auto corrupt_header = [&](auto const & sequences, uint64_t const sequence_count, uint64_t const letter_count)
+    {
+        container_t::write(file_name, sequences);
+
+        seqan3::detail::mapped_concatenated_sequences_header header{};
+        std::fstream stream{file_name, std::ios::binary | std::ios::in | std::ios::out};
+        stream.read(reinterpret_cast<char *>(&header), sizeof(header));
+        header.sequence_count = sequence_count;
+        header.letter_count = letter_count;
+        stream.seekp(0);
+        stream.write(reinterpret_cast<char const *>(&header), sizeof(header));
+    };
+
+    // The offset of the last delimiter wraps around to the first one.
+    corrupt_header(std::vector<seqan3::dna4_vector>{""_dna4}, uint64_t{1} << 61, 0u);
+    EXPECT_THROW(container_t{file_name}, std::runtime_error);
+    corrupt_header(std::vector{"ACGTACGT"_dna4, "ACGT"_dna4}, 2u, (uint64_t{1} << 63) + 12u);
+    EXPECT_THROW(container_t{file_name}, std::runtime_error);
+}
@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/adaptation/char.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/nucleotide/rna4.hpp>
+#include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/alphabet/quality/phred94.hpp>
+#include <seqan3/alphabet/quality/qualified.hpp>
+#include <seqan3/alphabet/range/bulk_conversion.hpp>
+#include <seqan3/alphabet/views/char_to.hpp>
+#include <seqan3/alphabet/views/complement.hpp>
+#include <seqan3/alphabet/views/to_char.hpp>
+#include <seqan3/alphabet/views/to_rank.hpp>
+#include <seqan3/utility/range/to.hpp>
+
+template <typename alphabet_t>
+class bulk_conversion : public ::testing::Test
+{};
+
+using alphabet_types = ::testing::Types<seqan3::dna4,
+                                        seqan3::rna4,
+                                        seqan3::dna5,
+                                        seqan3::dna15,
+                                        seqan3::aa27,
+                                        seqan3::phred42,
+                                        seqan3::phred94,
+                                        seqan3::gapped<seqan3::dna4>,
+                                        seqan3::qualified<seqan3::dna4, seqan3::phred42>,
+                                        char>;
+
+TYPED_TEST_SUITE(bulk_conversion, alphabet_types, );
+
+// All characters in random order, with sizes around the SIMD widths.
+static std::vector<std::string> const texts = []()
+{
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<int> char_distribution{0, 255};
+
+    std::vector<std::string> result{};
+    for (size_t size : {0, 1, 15, 31, 32, 33, 63, 64, 65, 127, 128, 129, 1000})
+    {
+        std::string text(size, ' ');
+        for (char & chr : text)
+            chr = static_cast<char>(char_distribution(generator));
+        result.push_back(text);
+    }
+
+    return result;
+}();
+
+TYPED_TEST(bulk_conversion, char_to)
+{
+    for (std::string const & text : texts)
+    {
+        std::vector<TypeParam> sequence(text.size());
+        seqan3::bulk_char_to(text, sequence);
+        EXPECT_EQ(sequence, text | seqan3::views::char_to<TypeParam> | seqan3::ranges::to<std::vector>());
+
+        // Non-contiguous output.
+        std::list<TypeParam> list(text.size());
+        seqan3::bulk_char_to(text, list);
+        EXPECT_TRUE(std::ranges::equal(list, sequence));
+    }
+}
+
+TYPED_TEST(bulk_conversion, to_char_and_to_rank)
+{
+    for (std::string const & text : texts)
+    {
+        std::vector<TypeParam> sequence(text.size());
+        seqan3::bulk_char_to(text, sequence);
+
+        std::string chars(text.size(), ' ');
+        seqan3::bulk_to_char(sequence, chars);
+        EXPECT_EQ(chars, sequence | seqan3::views::to_char | seqan3::ranges::to<std::string>());
+
+        std::vector<seqan3::alphabet_rank_t<TypeParam>> ranks(text.size());
+        seqan3::bulk_to_rank(sequence, ranks);
+        EXPECT_TRUE(std::ranges::equal(ranks, sequence | seqan3::views::to_rank));
+    }
+}
+
+TYPED_TEST(bulk_conversion, complement)
+{
+    if constexpr (seqan3::nucleotide_alphabet<TypeParam>)
+    {
+        for (std::string const & text : texts)
+        {
+            std::vector<TypeParam> sequence(text.size());
+            seqan3::bulk_char_to(text, sequence);
+
+            std::vector<TypeParam> expected = sequence | seqan3::views::complement | seqan3::ranges::to<std::vector>();
+            std::vector<TypeParam> complement(text.size());
+            seqan3::bulk_complement(sequence, complement);
+            EXPECT_EQ(complement, expected);
+
+            std::ranges::reverse(expected);
+            std::vector<TypeParam> reverse_complement(text.size());
+            seqan3::bulk_reverse_complement(sequence, reverse_complement);
+            EXPECT_EQ(reverse_complement, expected);
+
+            // In place.
+            seqan3::bulk_reverse_complement(sequence, sequence);
+            EXPECT_EQ(sequence, expected);
+
+            // Non-contiguous input.
+            std::list<TypeParam> list(complement.begin(), complement.end());
+            seqan3::bulk_reverse_complement(list, reverse_complement);
+            EXPECT_TRUE(std::ranges::equal(reverse_complement,
+                                           complement | std::views::reverse | seqan3::views::complement));
+        }
+    }
+}
+
+TEST(bulk_conversion, byte_rank_alphabet)
+{
+    EXPECT_TRUE(seqan3::detail::byte_rank_alphabet<seqan3::dna4>);
+    EXPECT_TRUE((seqan3::detail::byte_rank_alphabet<seqan3::qualified<seqan3::dna4, seqan3::phred42>>));
+    EXPECT_TRUE(seqan3::detail::byte_rank_alphabet<char>);
+    EXPECT_FALSE(seqan3::detail::byte_rank_alphabet<char16_t>);
+}
+
+TEST(byte_lookup_table, window)
+{
+    // Characters to ranks: only letters differ. 'A' has rank 0 and 'B' is the first letter with another rank.
+    seqan3::detail::byte_lookup_table const & dna4_table = seqan3::detail::char_to_rank_lookup_table<seqan3::dna4>;
+    EXPECT_TRUE(dna4_table.has_window);
+    EXPECT_EQ(dna4_table.window_begin, 'B');
+    EXPECT_EQ(dna4_table.default_value, 0);
+
+    // Ranks to characters.
+    EXPECT_TRUE(seqan3::detail::rank_to_char_lookup_table<seqan3::aa27>.has_window);
+    EXPECT_FALSE(seqan3::detail::rank_to_char_lookup_table<seqan3::phred94>.has_window);
+}
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/core/algorithm/detail/parallel_for.hpp>
+
+TEST(parallel_for, every_index_once)
+{
+    for (size_t thread_count : {0u, 1u, 4u, 100u})
+    {
+        std::vector<std::atomic<size_t>> calls(50);
+        seqan3::detail::parallel_for(calls.size(),
+                                     thread_count,
+                                     [&](size_t const index)
+                                     {
+                                         ++calls[index];
+                                     });
+
+        for (auto const & call_count : calls)
+            EXPECT_EQ(call_count, 1u);
+    }
+}
+
+TEST(parallel_for, empty)
+{
+    size_t call_count{};
+    seqan3::detail::parallel_for(0u,
+                                 4u,
+                                 [&](size_t)
+                                 {
+                                     ++call_count;
+                                 });
+    EXPECT_EQ(call_count, 0u);
+}
+
+TEST(parallel_for, exception)
+{
+    EXPECT_THROW(seqan3::detail::parallel_for(50u,
+                                              4u,
+                                              [](size_t const index)
+                                              {
+                                                  if (index == 10u)
+                                                      throw std::runtime_error{"error"};
+                                              }),
+                 std::runtime_error);
+}
@@ -0,0 +1,185 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <seqan3/search/detail/window_minimum.hpp>
+#include <seqan3/search/views/minimiser.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/utility/range/to.hpp>
+
+// The positions of the minimisers as defined by seqan3::views::minimiser: the rightmost minimum of the first window,
+// then whenever the minimiser leaves the window (rightmost minimum of the window) or a smaller value enters.
+std::vector<size_t> naive_minimiser_positions(std::vector<uint64_t> const & values, size_t window_size)
+{
+    std::vector<size_t> result{};
+    if (values.empty())
+        return result;
+
+    window_size = std::min(window_size, values.size());
+
+    auto rightmost_minimum = [&](size_t const begin)
+    {
+        size_t position = begin;
+        for (size_t i = begin; i < begin + window_size; ++i)
+            if (values[i] <= values[position])
+                position = i;
+        return position;
+    };
+
+    size_t position = rightmost_minimum(0u);
+    result.push_back(position);
+
+    for (size_t begin = 1u; begin + window_size <= values.size(); ++begin)
+    {
+        size_t const end = begin + window_size - 1u;
+        if (position < begin)
+            position = rightmost_minimum(begin);
+        else if (values[end] < values[position])
+            position = end;
+        else
+            continue;
+        result.push_back(position);
+    }
+
+    return result;
+}
+
+std::vector<uint64_t> random_values(size_t const size, uint64_t const max_value, unsigned const seed)
+{
+    std::mt19937_64 engine{seed};
+    std::uniform_int_distribution<uint64_t> distribution{0u, max_value};
+    std::vector<uint64_t> values(size);
+    for (uint64_t & value : values)
+        value = distribution(engine);
+    return values;
+}
+
+TEST(window_minimum, minimum)
+{
+    seqan3::detail::window_minimum<uint64_t> window{3u};
+    EXPECT_EQ(window.window_size(), 3u);
+    EXPECT_EQ(window.next_position(), 0u);
+
+    // position:          0  1  2  3  4  5  6  7
+    std::vector<uint64_t> values{5, 3, 3, 7, 8, 9, 1, 1};
+    std::vector<uint64_t> expected_minimum{5, 3, 3, 3, 3, 7, 1, 1};
+    std::vector<size_t> expected_position{0, 1, 2, 2, 2, 3, 6, 7};
+
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        window.push(values[i]);
+        EXPECT_EQ(window.next_position(), i + 1u);
+        EXPECT_EQ(window.minimum(), expected_minimum[i]) << "position " << i;
+        EXPECT_EQ(window.minimum_position(), expected_position[i]) << "position " << i;
+    }
+}
+
+TEST(window_minimum, same_as_rescanning)
+{
+    for (size_t const window_size : {1u, 2u, 3u, 7u, 8u, 9u, 64u})
+    {
+        for (uint64_t const max_value : {1u, 5u, 1000u})
+        {
+            std::vector<uint64_t> const values = random_values(1000u, max_value, window_size + max_value);
+            seqan3::detail::window_minimum<uint64_t> window{window_size};
+
+            for (size_t i = 0; i < values.size(); ++i)
+            {
+                window.push(values[i]);
+
+                size_t const begin = (i + 1u < window_size) ? 0u : i + 1u - window_size;
+                size_t position = begin;
+                for (size_t j = begin; j <= i; ++j)
+                    if (values[j] <= values[position])
+                        position = j;
+
+                ASSERT_EQ(window.minimum_position(), position);
+                ASSERT_EQ(window.minimum(), values[position]);
+            }
+        }
+    }
+}
+
+TEST(window_minimum, copy)
+{
+    seqan3::detail::window_minimum<uint64_t> window{4u};
+    window.push(4u);
+    window.push(2u);
+
+    seqan3::detail::window_minimum<uint64_t> copy{window};
+    copy.push(1u);
+    EXPECT_EQ(window.minimum(), 2u);
+    EXPECT_EQ(copy.minimum(), 1u);
+    EXPECT_EQ(copy.minimum_position(), 2u);
+}
+
+TEST(window_minimum_batch, same_as_minimiser_view)
+{
+    // The sizes cover several chunks of the batch algorithm.
+    for (size_t const window_size : {1u, 2u, 3u, 8u, 17u, 100u})
+    {
+        for (uint64_t const max_value : {uint64_t{0}, uint64_t{3}, uint64_t{100}, ~uint64_t{}})
+        {
+            for (size_t const size : {0u, 1u, 5u, 99u, 100u, 101u, 4096u, 20000u})
+            {
+                std::vector<uint64_t> const values = random_values(size, max_value, window_size * 31u + size);
+                std::vector<size_t> const expected = naive_minimiser_positions(values, window_size);
+
+                std::vector<size_t> positions(values.size());
+                seqan3::detail::window_minimum_batch<uint64_t> batch{window_size};
+                positions.resize(batch(values, positions));
+                ASSERT_EQ(positions, expected) << "window " << window_size << " size " << size;
+
+                if (window_size > 1u && size >= window_size)
+                {
+                    std::vector<uint64_t> const view_values =
+                        values | seqan3::views::minimiser(window_size) | seqan3::ranges::to<std::vector>();
+                    std::vector<uint64_t> batch_values{};
+                    for (size_t const position : positions)
+                        batch_values.push_back(values[position]);
+                    ASSERT_EQ(batch_values, view_values);
+                }
+            }
+        }
+    }
+}
+
+TEST(window_minimum_batch, reuse)
+{
+    seqan3::detail::window_minimum_batch<uint64_t> batch{4u};
+    std::vector<size_t> positions(10u);
+
+    std::vector<uint64_t> const first{28, 100, 9, 23, 4, 1, 72, 37, 8};
+    positions.resize(batch(first, positions));
+    EXPECT_RANGE_EQ(positions, (std::vector<size_t>{2, 4, 5}));
+
+    std::vector<uint64_t> const second{30, 2, 11, 101, 199, 73, 34, 900};
+    positions.resize(10u);
+    positions.resize(batch(second, positions));
+    EXPECT_RANGE_EQ(positions, (std::vector<size_t>{1, 2, 6}));
+}
+
+TEST(window_minimum_batch, minima)
+{
+    for (size_t const window_size : {1u, 4u, 33u})
+    {
+        for (size_t const size : {0u, 3u, 4u, 5000u, 10000u})
+        {
+            std::vector<uint64_t> const values = random_values(size, 50u, window_size + size);
+            std::vector<uint64_t> expected{};
+            size_t const effective_window_size = std::min(window_size, size);
+            for (size_t i = 0; i + effective_window_size <= size && size > 0u; ++i)
+                expected.push_back(*std::ranges::min_element(values.begin() + i,
+                                                             values.begin() + i + effective_window_size));
+
+            std::vector<uint64_t> minima(size);
+            seqan3::detail::window_minimum_batch<uint64_t> batch{window_size};
+            minima.resize(batch.minima(values, minima));
+            EXPECT_EQ(minima, expected) << "window " << window_size << " size " << size;
+        }
+    }
+}
@@ -0,0 +1,168 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <seqan3/search/dream_index/counting_interleaved_bloom_filter.hpp>
+#include <seqan3/utility/bloom_filter/counting_bloom_filter.hpp>
+#include <seqan3/test/cereal.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+template <typename ibf_type>
+struct counting_interleaved_bloom_filter_test : public ::testing::Test
+{};
+
+using ibf_types = ::testing::Types<seqan3::counting_interleaved_bloom_filter<4>,
+                                   seqan3::counting_interleaved_bloom_filter<8>>;
+
+TYPED_TEST_SUITE(counting_interleaved_bloom_filter_test, ibf_types, );
+
+TYPED_TEST(counting_interleaved_bloom_filter_test, construction)
+{
+    EXPECT_TRUE(std::is_default_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_copy_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_move_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_copy_assignable_v<TypeParam>);
+    EXPECT_TRUE(std::is_move_assignable_v<TypeParam>);
+    EXPECT_TRUE(std::is_destructible_v<TypeParam>);
+
+    // num hash functions defaults to two
+    TypeParam ibf1{seqan3::bin_count{64u}, seqan3::bin_size{1024u}};
+    TypeParam ibf2{seqan3::bin_count{64u}, seqan3::bin_size{1024u}, seqan3::hash_function_count{2u}};
+    EXPECT_TRUE(ibf1 == ibf2);
+
+    // bin_size parameter is too small
+    EXPECT_THROW((TypeParam{seqan3::bin_count{64u}, seqan3::bin_size{0u}}), std::logic_error);
+    // not enough bins
+    EXPECT_THROW((TypeParam{seqan3::bin_count{0u}, seqan3::bin_size{32u}}), std::logic_error);
+    // not enough hash functions
+    EXPECT_THROW((TypeParam{seqan3::bin_count{64u}, seqan3::bin_size{32u}, seqan3::hash_function_count{0u}}),
+                 std::logic_error);
+    // too many hash functions
+    EXPECT_THROW((TypeParam{seqan3::bin_count{64u}, seqan3::bin_size{32u}, seqan3::hash_function_count{6u}}),
+                 std::logic_error);
+}
+
+TYPED_TEST(counting_interleaved_bloom_filter_test, member_getter)
+{
+    TypeParam ibf{seqan3::bin_count{73u}, seqan3::bin_size{1024u}, seqan3::hash_function_count{3u}};
+    EXPECT_EQ(ibf.bin_count(), 73u);
+    EXPECT_EQ(ibf.bin_size(), 1024u);
+    EXPECT_EQ(ibf.hash_function_count(), 3u);
+    // 73 bins are stored as 128 technical bins.
+    EXPECT_EQ(ibf.bit_size(), 128u * 1024u * std::bit_width(TypeParam::max_count));
+    EXPECT_EQ(ibf.raw_data().size(), ibf.bit_size() / 8u);
+}
+
+TYPED_TEST(counting_interleaved_bloom_filter_test, bulk_abundance)
+{
+    TypeParam ibf{seqan3::bin_count{67u}, seqan3::bin_size{4096u}};
+
+    // Value v is inserted v % 4 times into bin v % 67.
+    for (size_t value = 0; value < 200u; ++value)
+        ibf.emplace(value, seqan3::bin_index{value % 67u}, value % 4u);
+
+    auto agent = ibf.counting_agent();
+    for (size_t value = 0; value < 200u; ++value)
+    {
+        auto & res = agent.bulk_abundance(value);
+        ASSERT_EQ(res.size(), 67u);
+        // The filter is sparse enough to count exactly.
+        std::vector<uint16_t> expected(67u, 0u);
+        expected[value % 67u] = value % 4u;
+        EXPECT_RANGE_EQ(res, expected);
+    }
+}
+
+TYPED_TEST(counting_interleaved_bloom_filter_test, saturation)
+{
+    TypeParam ibf{seqan3::bin_count{3u}, seqan3::bin_size{128u}};
+
+    ibf.emplace(17u, seqan3::bin_index{0u}, 1000u);
+    for (size_t i = 0; i < TypeParam::max_count + 1u; ++i)
+        ibf.emplace(17u, seqan3::bin_index{1u});
+    ibf.emplace(17u, seqan3::bin_index{2u}, TypeParam::max_count - 1u);
+
+    auto agent = ibf.counting_agent();
+    std::vector<uint16_t> expected{TypeParam::max_count, TypeParam::max_count, TypeParam::max_count - 1u};
+    EXPECT_RANGE_EQ(agent.bulk_abundance(17u), expected);
+}
+
+TYPED_TEST(counting_interleaved_bloom_filter_test, clear)
+{
+    TypeParam ibf{seqan3::bin_count{3u}, seqan3::bin_size{128u}};
+
+    for (size_t bin = 0; bin < 3u; ++bin)
+        ibf.emplace(5u, seqan3::bin_index{bin}, bin + 1u);
+
+    ibf.clear(seqan3::bin_index{1u});
+
+    auto agent = ibf.counting_agent();
+    std::vector<uint16_t> expected{1u, 0u, 3u};
+    EXPECT_RANGE_EQ(agent.bulk_abundance(5u), expected);
+}
+
+// Every bin of a counting Interleaved Bloom Filter behaves like a seqan3::counting_bloom_filter of the same size.
+// Small bins and many bins exercise the SIMD kernels including their remainders and collisions.
+TYPED_TEST(counting_interleaved_bloom_filter_test, same_counts_as_counting_bloom_filter)
+{
+    constexpr size_t counter_bits = std::bit_width(TypeParam::max_count);
+    size_t const bins = 203u;
+    size_t const bin_size = 61u;
+
+    TypeParam ibf{seqan3::bin_count{bins}, seqan3::bin_size{bin_size}, seqan3::hash_function_count{3u}};
+    std::vector<seqan3::counting_bloom_filter<counter_bits>> filters(
+        bins,
+        seqan3::counting_bloom_filter<counter_bits>{seqan3::bin_size{bin_size}, seqan3::hash_function_count{3u}});
+
+    std::mt19937_64 engine{42u};
+    for (size_t i = 0; i < 5000u; ++i)
+    {
+        size_t const value = engine() % 500u;
+        size_t const bin = engine() % bins;
+        ibf.emplace(value, seqan3::bin_index{bin});
+        filters[bin].emplace(value);
+    }
+
+    auto agent = ibf.template counting_agent<uint32_t>();
+    std::vector<uint32_t> expected_sum(bins, 0u);
+    for (size_t value = 0; value < 600u; ++value)
+    {
+        std::vector<uint32_t> expected(bins);
+        for (size_t bin = 0; bin < bins; ++bin)
+            expected[bin] = filters[bin].abundance(value);
+
+        EXPECT_RANGE_EQ(agent.bulk_abundance(value), expected);
+
+        for (size_t bin = 0; bin < bins; ++bin)
+            expected_sum[bin] += expected[bin];
+    }
+
+    EXPECT_RANGE_EQ(agent.bulk_count(std::views::iota(0u, 600u)), expected_sum);
+}
+
+TYPED_TEST(counting_interleaved_bloom_filter_test, bulk_count)
+{
+    TypeParam ibf{seqan3::bin_count{10u}, seqan3::bin_size{4096u}};
+
+    for (size_t value = 0; value < 50u; ++value)
+        ibf.emplace(value, seqan3::bin_index{value / 5u}, 2u);
+
+    auto agent = ibf.template counting_agent<uint8_t>();
+    std::vector<size_t> const values{1u, 2u, 3u, 12u, 49u, 100u};
+    std::vector<uint8_t> expected{6u, 0u, 2u, 0u, 0u, 0u, 0u, 0u, 0u, 2u};
+    EXPECT_RANGE_EQ(agent.bulk_count(values), expected);
+
+    // The empty range yields no counts.
+    EXPECT_RANGE_EQ(agent.bulk_count(std::vector<size_t>{}), std::vector<uint8_t>(10u, 0u));
+}
+
+TYPED_TEST(counting_interleaved_bloom_filter_test, serialisation)
+{
+    TypeParam ibf{seqan3::bin_count{73u}, seqan3::bin_size{1024u}};
+    ibf.emplace(3u, seqan3::bin_index{5u}, 3u);
+    seqan3::test::do_serialisation(ibf);
+}
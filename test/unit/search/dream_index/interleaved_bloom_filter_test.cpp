@@ -4,6 +4,8 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
+
 #include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
 #include <seqan3/test/cereal.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
@@ -302,6 +304,54 @@ TYPED_TEST(interleaved_bloom_filter_test, counting_agent_no_ub)
     EXPECT_RANGE_EQ(agent2.bulk_count(std::views::iota(0u, 128u)), expected);
 }
 
+// The range overload of bulk_contains and bulk_count process the values in batches. Check that they yield the same
+// results as single lookups, for a number of values that is not a multiple of the batch size.
+TYPED_TEST(interleaved_bloom_filter_test, bulk_contains_range)
+{
+    // 1. Test uncompressed interleaved_bloom_filter directly because the compressed one is not mutable.
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{200u},
+                                         seqan3::bin_size{509u},
+                                         seqan3::hash_function_count{3u}};
+
+    std::mt19937_64 engine{42u};
+    for (size_t i = 0; i < 20000u; ++i)
+        ibf.emplace(engine() % 1000u, seqan3::bin_index{engine() % 200u});
+
+    // 2. Construct either the uncompressed or compressed interleaved_bloom_filter and compare to single lookups.
+    TypeParam ibf2{ibf};
+    auto agent = ibf2.membership_agent();
+    auto single_agent = ibf2.membership_agent();
+    std::vector<size_t> values(1000u);
+    std::ranges::generate(values,
+                          [&engine]()
+                          {
+                              return engine() % 1500u;
+                          });
+
+    size_t index{};
+    seqan3::counting_vector<size_t> expected(200u, 0u);
+    agent.bulk_contains(values,
+                        [&](auto const & result)
+                        {
+                            ASSERT_LT(index, values.size());
+                            auto & single_result = single_agent.bulk_contains(values[index++]);
+                            EXPECT_RANGE_EQ(result, single_result);
+                            expected += single_result;
+                        });
+    EXPECT_EQ(index, values.size());
+
+    auto counting_agent = ibf2.template counting_agent<size_t>();
+    EXPECT_RANGE_EQ(counting_agent.bulk_count(values), expected);
+
+    // The empty range yields no results.
+    EXPECT_RANGE_EQ(counting_agent.bulk_count(values | std::views::take(0)), std::vector<size_t>(200u, 0u));
+    agent.bulk_contains(std::vector<size_t>{},
+                        [](auto const &)
+                        {
+                            FAIL();
+                        });
+}
+
 TYPED_TEST(interleaved_bloom_filter_test, increase_bin_number_to)
 {
     seqan3::interleaved_bloom_filter ibf1{seqan3::bin_count{73u}, seqan3::bin_size{1024u}};
@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <fstream>
+#include <limits>
+#include <random>
+
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+#include <seqan3/search/dream_index/mapped_interleaved_bloom_filter.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/tmp_directory.hpp>
+
+// 200 bins with collisions, such that the shards have full and partial words.
+static seqan3::interleaved_bloom_filter<> const & test_ibf()
+{
+    static seqan3::interleaved_bloom_filter<> const ibf = []()
+    {
+        seqan3::interleaved_bloom_filter<> ibf{seqan3::bin_count{200u},
+                                               seqan3::bin_size{509u},
+                                               seqan3::hash_function_count{3u}};
+        std::mt19937_64 engine{42u};
+        for (size_t i = 0; i < 20000u; ++i)
+            ibf.emplace(engine() % 1000u, seqan3::bin_index{engine() % 200u});
+        return ibf;
+    }();
+    return ibf;
+}
+
+static std::vector<size_t> test_values()
+{
+    std::vector<size_t> values(1000u);
+    std::mt19937_64 engine{7u};
+    std::ranges::generate(values,
+                          [&engine]()
+                          {
+                              return engine() % 1500u;
+                          });
+    return values;
+}
+
+static std::vector<uint32_t> expected_counts(std::vector<size_t> const & values)
+{
+    auto agent = test_ibf().counting_agent<uint32_t>();
+    auto const & counts = agent.bulk_count(values);
+    return {counts.begin(), counts.end()};
+}
+
+TEST(mapped_interleaved_bloom_filter, write_and_map)
+{
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path const path{tmp.path() / "all.ibf"};
+    test_ibf().write(path);
+
+    seqan3::mapped_interleaved_bloom_filter mapped{path};
+    EXPECT_EQ(mapped.bin_count(), 200u);
+    EXPECT_EQ(mapped.total_bin_count(), 200u);
+    EXPECT_EQ(mapped.first_bin(), 0u);
+    EXPECT_EQ(mapped.bin_size(), 509u);
+    EXPECT_EQ(mapped.hash_function_count(), 3u);
+    EXPECT_EQ(std::filesystem::file_size(path), 64u + 509u * 4u * 8u);
+
+    std::vector<size_t> const values = test_values();
+    auto agent = mapped.counting_agent<uint32_t>();
+    EXPECT_RANGE_EQ(agent.bulk_count(values), expected_counts(values));
+
+    // A single value is counted once in each bin that contains it.
+    auto membership_agent = test_ibf().membership_agent();
+    for (size_t value : {0u, 17u, 999u, 1234u})
+        EXPECT_RANGE_EQ(agent.bulk_count(std::views::single(value)), membership_agent.bulk_contains(value));
+
+    seqan3::mapped_interleaved_bloom_filter moved{std::move(mapped)};
+    EXPECT_EQ(mapped.bin_count(), 0u);
+    EXPECT_EQ(moved.bin_count(), 200u);
+    auto moved_agent = moved.counting_agent<uint32_t>();
+    EXPECT_RANGE_EQ(moved_agent.bulk_count(values), expected_counts(values));
+}
+
+TEST(mapped_interleaved_bloom_filter, shards)
+{
+    seqan3::test::tmp_directory tmp{};
+    std::vector<std::filesystem::path> const paths{tmp.path() / "0.ibf", tmp.path() / "1.ibf", tmp.path() / "2.ibf"};
+    test_ibf().write(paths[0], seqan3::bin_index{0u}, seqan3::bin_count{64u});
+    test_ibf().write(paths[1], seqan3::bin_index{64u}, seqan3::bin_count{128u});
+    test_ibf().write(paths[2], seqan3::bin_index{192u}, seqan3::bin_count{8u});
+
+    std::vector<size_t> const values = test_values();
+    std::vector<uint32_t> const expected = expected_counts(values);
+
+    // Each shard counts its own bins.
+    std::filesystem::path const partial_path{tmp.path() / "partial.ibf"};
+    test_ibf().write(partial_path, seqan3::bin_index{64u}, seqan3::bin_count{100u});
+    seqan3::mapped_interleaved_bloom_filter const shard{partial_path};
+    EXPECT_EQ(shard.first_bin(), 64u);
+    EXPECT_EQ(shard.bin_count(), 100u);
+    EXPECT_EQ(shard.total_bin_count(), 200u);
+    auto shard_agent = shard.counting_agent<uint32_t>();
+    EXPECT_RANGE_EQ(shard_agent.bulk_count(values), expected | std::views::drop(64u) | std::views::take(100u));
+
+    // All shards together yield the counts of the Interleaved Bloom Filter, regardless of the order of the paths.
+    seqan3::sharded_interleaved_bloom_filter const sharded{{paths[2], paths[0], paths[1]}};
+    EXPECT_EQ(sharded.bin_count(), 200u);
+    ASSERT_EQ(sharded.shard_list().size(), 3u);
+    EXPECT_EQ(sharded.shard_list()[2].first_bin(), 192u);
+    auto agent = sharded.counting_agent<uint32_t>();
+    EXPECT_RANGE_EQ(agent.bulk_count(values), expected);
+
+    // Bins without a shard, here bins 0 to 63 and 164 to 191, are never counted.
+    seqan3::sharded_interleaved_bloom_filter const partial{{partial_path, paths[2]}};
+    std::vector<uint32_t> expected_partial = expected;
+    std::ranges::fill_n(expected_partial.begin(), 64u, 0u);
+    std::ranges::fill_n(expected_partial.begin() + 164u, 28u, 0u);
+    auto partial_agent = partial.counting_agent<uint32_t>();
+    EXPECT_RANGE_EQ(partial_agent.bulk_count(values), expected_partial);
+}
+
+TEST(mapped_interleaved_bloom_filter, invalid_shards)
+{
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path const path{tmp.path() / "shard.ibf"};
+    seqan3::interleaved_bloom_filter<> const & ibf = test_ibf();
+
+    EXPECT_THROW(ibf.write(path, seqan3::bin_index{0u}, seqan3::bin_count{0u}), std::logic_error);
+    EXPECT_THROW(ibf.write(path, seqan3::bin_index{32u}, seqan3::bin_count{32u}), std::logic_error);
+    EXPECT_THROW(ibf.write(path, seqan3::bin_index{128u}, seqan3::bin_count{73u}), std::logic_error);
+    EXPECT_THROW(ibf.write(path, seqan3::bin_index{std::numeric_limits<size_t>::max() - 63u}, seqan3::bin_count{128u}),
+                 std::logic_error);
+
+    EXPECT_THROW(seqan3::sharded_interleaved_bloom_filter{{}}, std::invalid_argument);
+
+    std::filesystem::path const other_path{tmp.path() / "other.ibf"};
+    ibf.write(path, seqan3::bin_index{0u}, seqan3::bin_count{100u});
+    ibf.write(other_path, seqan3::bin_index{64u}, seqan3::bin_count{64u});
+    EXPECT_THROW((seqan3::sharded_interleaved_bloom_filter{{path, other_path}}), std::invalid_argument);
+
+    seqan3::interleaved_bloom_filter<>{seqan3::bin_count{200u}, seqan3::bin_size{1024u}}.write(other_path);
+    EXPECT_THROW((seqan3::sharded_interleaved_bloom_filter{{path, other_path}}), std::invalid_argument);
+}
+
+TEST(mapped_interleaved_bloom_filter, invalid_files)
+{
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path const path{tmp.path() / "all.ibf"};
+    EXPECT_THROW(seqan3::mapped_interleaved_bloom_filter{path}, std::filesystem::filesystem_error);
+
+    {
+        std::ofstream stream{path};
+        stream << "not an Interleaved Bloom Filter";
+    }
+    EXPECT_THROW(seqan3::mapped_interleaved_bloom_filter{path}, std::runtime_error);
+
+    test_ibf().write(path);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8u);
+    EXPECT_THROW(seqan3::mapped_interleaved_bloom_filter{path}, std::runtime_error);
+
+    // Corrupted headers whose values overflow.
+    auto write_header = [&](uint64_t const bin_count, uint64_t const first_bin, uint64_t const shard_bin_count)
+    {
+        seqan3::detail::interleaved_bloom_filter_header header{};
+        header.hash_function_count = 2u;
+        header.bin_count = bin_count;
+        header.bin_size = 1u;
+        header.first_bin = first_bin;
+        header.shard_bin_count = shard_bin_count;
+
+        std::ofstream stream{path, std::ios::binary | std::ios::trunc};
+        stream.write(reinterpret_cast<char const *>(&header), sizeof(header));
+        std::array<uint64_t, 4> const row{};
+        stream.write(reinterpret_cast<char const *>(row.data()), sizeof(row));
+    };
+
+    uint64_t const max = std::numeric_limits<uint64_t>::max();
+    write_header(max, 0u, max);
+    EXPECT_THROW(seqan3::mapped_interleaved_bloom_filter{path}, std::runtime_error);
+    write_header(256u, max - 63u, 128u);
+    EXPECT_THROW(seqan3::mapped_interleaved_bloom_filter{path}, std::runtime_error);
+    write_header(256u, 128u, 256u);
+    EXPECT_THROW(seqan3::mapped_interleaved_bloom_filter{path}, std::runtime_error);
+}
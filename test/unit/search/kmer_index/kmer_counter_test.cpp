@@ -0,0 +1,218 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <sstream>
+#include <vector>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+#include <seqan3/search/kmer_index/kmer_counter.hpp>
+#include <seqan3/search/views/canonical_kmer_hash.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+#include <seqan3/test/tmp_directory.hpp>
+
+using seqan3::operator""_dna4;
+using seqan3::operator""_dna5;
+using seqan3::operator""_shape;
+
+std::vector<std::vector<seqan3::dna4>> generate_sequences(std::vector<size_t> const & sizes)
+{
+    std::vector<std::vector<seqan3::dna4>> sequences{};
+    size_t x = 0x1234'5678u;
+    for (size_t const size : sizes)
+    {
+        std::vector<seqan3::dna4> & sequence = sequences.emplace_back(size);
+        for (seqan3::dna4 & letter : sequence)
+        {
+            x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+            letter.assign_rank((x >> 60) % 4u);
+        }
+    }
+    return sequences;
+}
+
+template <typename alphabet_t>
+std::map<uint64_t, uint64_t> expected_counts(std::vector<std::vector<alphabet_t>> const & sequences,
+                                             seqan3::shape const & shape,
+                                             bool const canonical)
+{
+    std::map<uint64_t, uint64_t> counts{};
+    for (auto const & sequence : sequences)
+    {
+        if (canonical)
+        {
+            for (uint64_t const hash : sequence | seqan3::views::canonical_kmer_hash(shape))
+                ++counts[hash];
+        }
+        else
+        {
+            for (uint64_t const hash : sequence | seqan3::views::kmer_hash(shape))
+                ++counts[hash];
+        }
+    }
+    return counts;
+}
+
+void expect_counts(seqan3::kmer_counter & counter, std::map<uint64_t, uint64_t> const & expected)
+{
+    std::vector<seqan3::kmer_count> counts = counter.counts();
+    ASSERT_EQ(counts.size(), expected.size());
+
+    uint64_t total{};
+    for (seqan3::kmer_count const & count : counts)
+    {
+        ASSERT_TRUE(expected.contains(count.hash));
+        EXPECT_EQ(count.count, expected.at(count.hash));
+        total += count.count;
+    }
+    EXPECT_EQ(counter.total_count(), total);
+}
+
+TEST(kmer_counter, canonical)
+{
+    // The long sequence is hashed in several pieces.
+    std::vector<std::vector<seqan3::dna4>> const sequences = generate_sequences({200000u, 0u, 5u, 7u, 3000u, 150u});
+
+    for (seqan3::shape const shape : {seqan3::shape{seqan3::ungapped{7}}, 0b1101'1011_shape})
+    {
+        seqan3::kmer_counter counter{shape};
+        counter.count(sequences);
+        expect_counts(counter, expected_counts(sequences, shape, true));
+    }
+}
+
+TEST(kmer_counter, forward)
+{
+    std::vector<std::vector<seqan3::dna4>> const sequences = generate_sequences({1000u, 2000u, 10u});
+
+    seqan3::kmer_counter counter{seqan3::ungapped{5}, {.canonical = false}};
+    counter.count(sequences);
+    expect_counts(counter, expected_counts(sequences, seqan3::ungapped{5}, false));
+}
+
+TEST(kmer_counter, protein)
+{
+    std::vector<seqan3::aa27> const protein{seqan3::assign_char_to('M', seqan3::aa27{}),
+                                            seqan3::assign_char_to('K', seqan3::aa27{}),
+                                            seqan3::assign_char_to('M', seqan3::aa27{}),
+                                            seqan3::assign_char_to('K', seqan3::aa27{})};
+    std::vector<std::vector<seqan3::aa27>> const sequences{protein};
+
+    seqan3::kmer_counter canonical{seqan3::ungapped{2}};
+    EXPECT_THROW(canonical.count(sequences), std::invalid_argument);
+
+    seqan3::kmer_counter counter{seqan3::ungapped{2}, {.canonical = false}};
+    counter.count(sequences);
+    std::vector<seqan3::kmer_count> const counts = counter.counts();
+    ASSERT_EQ(counts.size(), 2u);
+    EXPECT_EQ(counts[0].count + counts[1].count, 3u);
+    EXPECT_EQ(std::max(counts[0].count, counts[1].count), 2u);
+}
+
+TEST(kmer_counter, threads_and_batches)
+{
+    std::vector<std::vector<seqan3::dna4>> const sequences = generate_sequences({70000u, 300u, 20000u, 20000u, 9u});
+    std::map<uint64_t, uint64_t> const expected = expected_counts(sequences, seqan3::ungapped{9}, true);
+
+    seqan3::kmer_counter single{seqan3::ungapped{9}};
+    single.count(sequences);
+    std::vector<seqan3::kmer_count> const reference = single.counts();
+
+    for (size_t const thread_count : {2u, 4u})
+    {
+        for (size_t const batch_size : {1u, 1000u, 100000u})
+        {
+            seqan3::kmer_counter counter{seqan3::ungapped{9},
+                                         {.thread_count = thread_count, .batch_size = batch_size}};
+            counter.count(sequences);
+            EXPECT_EQ(counter.counts(), reference);
+        }
+    }
+
+    expect_counts(single, expected);
+}
+
+TEST(kmer_counter, spill_to_disk)
+{
+    std::vector<std::vector<seqan3::dna4>> const sequences = generate_sequences({30000u, 30000u, 30000u, 500u});
+    seqan3::test::tmp_directory tmp{};
+
+    seqan3::kmer_counter reference{seqan3::ungapped{11}};
+    reference.count(sequences);
+
+    {
+        seqan3::kmer_counter counter{
+            seqan3::ungapped{11},
+            {.thread_count = 2u, .memory_limit = 1u, .spill_directory = tmp.path(), .batch_size = 20000u}};
+        counter.count(sequences);
+        EXPECT_FALSE(std::filesystem::is_empty(tmp.path()));
+
+        EXPECT_EQ(counter.counts(), reference.counts());
+        EXPECT_EQ(counter.histogram(), reference.histogram());
+
+        // Counting can continue after the counts were read.
+        counter.count(sequences);
+        reference.count(sequences);
+        EXPECT_EQ(counter.counts(), reference.counts());
+
+        seqan3::kmer_counter moved{std::move(counter)};
+        EXPECT_EQ(moved.counts(), reference.counts());
+        EXPECT_TRUE(counter.counts().empty());
+    }
+
+    // The runs are removed with the counter.
+    EXPECT_TRUE(std::filesystem::is_empty(tmp.path()));
+
+    // Nothing is written to disk if the counter fits into memory.
+    seqan3::kmer_counter counter{seqan3::ungapped{11}, {.thread_count = 2u, .spill_directory = tmp.path()}};
+    counter.count(sequences);
+    counter.count(sequences);
+    EXPECT_TRUE(std::filesystem::is_empty(tmp.path()));
+    EXPECT_EQ(counter.counts(), reference.counts());
+}
+
+TEST(kmer_counter, histogram)
+{
+    std::vector<std::vector<seqan3::dna4>> sequences{"ACGTTA"_dna4, "ACGAAAAAAA"_dna4};
+
+    seqan3::kmer_counter counter{seqan3::ungapped{3}, {.canonical = false}};
+    counter.count(sequences);
+
+    // ACG: 2, CGT: 1, GTT: 1, TTA: 1, CGA: 1, GAA: 1, AAA: 5
+    EXPECT_EQ(counter.histogram(4u), (std::vector<uint64_t>{0u, 5u, 1u, 0u, 1u}));
+
+    std::vector<uint64_t> expected(256u);
+    expected[1] = 5u;
+    expected[2] = 1u;
+    expected[5] = 1u;
+    EXPECT_EQ(counter.histogram(), expected);
+}
+
+TEST(kmer_counter, sequence_file)
+{
+    std::istringstream stream{">read1\nACGTACGTAC\n>read2\nTTTTACGTAG\n>read3\nAC\n"};
+    seqan3::sequence_file_input fin{stream, seqan3::format_fasta{}};
+
+    seqan3::kmer_counter counter{seqan3::ungapped{4}, {.batch_size = 12u}};
+    counter.count(fin);
+
+    // The default alphabet of the file is seqan3::dna5.
+    std::vector<std::vector<seqan3::dna5>> const sequences{"ACGTACGTAC"_dna5, "TTTTACGTAG"_dna5, "AC"_dna5};
+    expect_counts(counter, expected_counts(sequences, seqan3::ungapped{4}, true));
+}
+
+TEST(kmer_counter, invalid)
+{
+    EXPECT_THROW(seqan3::kmer_counter{seqan3::shape{}}, std::invalid_argument);
+    EXPECT_THROW((seqan3::kmer_counter{seqan3::ungapped{4}, {.batch_size = 0u}}), std::invalid_argument);
+
+    seqan3::kmer_counter counter{seqan3::ungapped{4}};
+    EXPECT_TRUE(counter.counts().empty());
+    EXPECT_EQ(counter.total_count(), 0u);
+}
@@ -0,0 +1,298 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <fstream>
+#include <map>
+#include <span>
+#include <vector>
+
+#include <seqan3/alphabet/container/concatenated_sequences.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/kmer_index/kmer_index.hpp>
+#include <seqan3/search/views/canonical_kmer_hash.hpp>
+#include <seqan3/test/cereal.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/tmp_directory.hpp>
+#include <seqan3/utility/range/to.hpp>
+
+using seqan3::operator""_dna4;
+using seqan3::operator""_shape;
+
+using occurrence_map = std::map<uint64_t, std::vector<seqan3::kmer_occurrence>>;
+
+seqan3::concatenated_sequences<std::vector<seqan3::dna4>> generate_sequences(std::vector<size_t> const & sizes)
+{
+    seqan3::concatenated_sequences<std::vector<seqan3::dna4>> sequences{};
+    size_t x = 0x1234'5678u;
+    for (size_t const size : sizes)
+    {
+        std::vector<seqan3::dna4> sequence(size);
+        for (seqan3::dna4 & letter : sequence)
+        {
+            x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+            letter.assign_rank((x >> 60) % 4u);
+        }
+        sequences.push_back(sequence);
+    }
+    return sequences;
+}
+
+// The occurrences of all seeds, ordered by sequence and position.
+template <typename extractor_t>
+occurrence_map expected_occurrences(seqan3::concatenated_sequences<std::vector<seqan3::dna4>> const & sequences,
+                                    extractor_t extractor)
+{
+    occurrence_map occurrences{};
+    for (size_t i = 0; i < sequences.size(); ++i)
+    {
+        std::vector<seqan3::kmer_seed> seeds(sequences[i].size());
+        seeds.resize(extractor(sequences[i], seeds));
+        for (seqan3::kmer_seed const & seed : seeds)
+            occurrences[seed.hash].emplace_back(i, seed.position, seed.reverse_complement);
+    }
+    return occurrences;
+}
+
+template <typename index_t>
+void expect_occurrences(index_t const & index, occurrence_map const & expected)
+{
+    size_t occurrence_count{};
+    for (auto const & [hash, occurrences] : expected)
+    {
+        EXPECT_RANGE_EQ(index.find(hash), occurrences);
+        occurrence_count += occurrences.size();
+    }
+
+    EXPECT_EQ(index.key_count(), expected.size());
+    EXPECT_EQ(index.size(), occurrence_count);
+
+    // Hash values that do not occur.
+    for (uint64_t hash = 0; hash < 1000u; ++hash)
+    {
+        if (!expected.contains(hash))
+        {
+            EXPECT_TRUE(index.find(hash).empty());
+        }
+    }
+}
+
+TEST(kmer_occurrence, members)
+{
+    seqan3::kmer_occurrence const occurrence{7u, seqan3::kmer_occurrence::max_position, true};
+    EXPECT_EQ(occurrence.sequence_id(), 7u);
+    EXPECT_EQ(occurrence.position(), seqan3::kmer_occurrence::max_position);
+    EXPECT_TRUE(occurrence.reverse_complement());
+
+    EXPECT_LT((seqan3::kmer_occurrence{1u, 5u, true}), (seqan3::kmer_occurrence{2u, 0u, false}));
+    EXPECT_LT((seqan3::kmer_occurrence{1u, 5u, true}), (seqan3::kmer_occurrence{1u, 6u, false}));
+    EXPECT_LT((seqan3::kmer_occurrence{1u, 5u, false}), (seqan3::kmer_occurrence{1u, 5u, true}));
+    EXPECT_EQ((seqan3::kmer_occurrence{}), (seqan3::kmer_occurrence{0u, 0u, false}));
+}
+
+TEST(kmer_index, empty)
+{
+    seqan3::kmer_index const index{};
+    EXPECT_EQ(index.size(), 0u);
+    EXPECT_EQ(index.key_count(), 0u);
+    EXPECT_EQ(index.sequence_count(), 0u);
+    EXPECT_TRUE(index.find(42u).empty());
+
+    seqan3::concatenated_sequences<std::vector<seqan3::dna4>> const sequences = generate_sequences({0u, 3u});
+    seqan3::kmer_index const no_kmers{sequences, seqan3::ungapped{4}};
+    EXPECT_EQ(no_kmers.size(), 0u);
+    EXPECT_EQ(no_kmers.sequence_count(), 2u);
+    EXPECT_TRUE(no_kmers.find(0u).empty());
+}
+
+TEST(kmer_index, all_kmers)
+{
+    seqan3::concatenated_sequences<std::vector<seqan3::dna4>> const sequences =
+        generate_sequences({1000u, 0u, 17u, 5000u, 3u, 2000u});
+
+    for (seqan3::shape const shape : {seqan3::shape{seqan3::ungapped{5}}, 0b1101'1011_shape})
+    {
+        occurrence_map expected{};
+        for (size_t i = 0; i < sequences.size(); ++i)
+        {
+            seqan3::detail::canonical_kmer_hash_view view{sequences[i], shape, 0u};
+            uint32_t position{};
+            for (auto it = view.begin(); it != view.end(); ++it, ++position)
+                expected[*it].emplace_back(i, position, it.is_reverse_complement());
+        }
+
+        seqan3::kmer_index const index{sequences, shape};
+        EXPECT_EQ(index.sequence_count(), sequences.size());
+        expect_occurrences(index, expected);
+    }
+}
+
+TEST(kmer_index, extractors)
+{
+    seqan3::concatenated_sequences<std::vector<seqan3::dna4>> const sequences =
+        generate_sequences({20000u, 150u, 8000u});
+
+    seqan3::minimiser_extractor const minimisers{seqan3::ungapped{11}, seqan3::window_size{20}};
+    expect_occurrences(seqan3::kmer_index{sequences, minimisers}, expected_occurrences(sequences, minimisers));
+
+    seqan3::syncmer_extractor const syncmers{{.kmer_size = 13u, .smer_size = 5u}};
+    expect_occurrences(seqan3::kmer_index{sequences, syncmers}, expected_occurrences(sequences, syncmers));
+
+    seqan3::strobemer_extractor const strobemers{{.strobe_size = 9u, .window_min = 3u, .window_max = 12u}};
+    expect_occurrences(seqan3::kmer_index{sequences, strobemers}, expected_occurrences(sequences, strobemers));
+}
+
+TEST(kmer_index, keys_in_one_bucket)
+{
+    // Distinct keys in the same bucket, as the k-mers of a periodic sequence can have. Sorting such a bucket must not
+    // take quadratic time.
+    uint64_t constexpr multiplier = seqan3::detail::kmer_index_table::key_multiplier;
+    uint64_t inverse = multiplier;
+    for (size_t iteration = 0; iteration < 5u; ++iteration)
+        inverse *= 2u - multiplier * inverse;
+    ASSERT_EQ(seqan3::detail::kmer_index_table::key_of(inverse), 1u);
+
+    auto const extractor = [inverse](auto const & sequence, std::span<seqan3::kmer_seed> const seeds) -> size_t
+    {
+        for (uint32_t position = 0; position < sequence.size(); ++position)
+            seeds[position] = {.hash = inverse * (position % 3u + 1u), .position = position};
+        return sequence.size();
+    };
+
+    seqan3::concatenated_sequences<std::vector<seqan3::dna4>> const sequences = generate_sequences({200000u, 50000u});
+    expect_occurrences(seqan3::kmer_index{sequences, extractor}, expected_occurrences(sequences, extractor));
+}
+
+TEST(kmer_index, threads)
+{
+    std::vector<size_t> sizes(50u, 3000u);
+    sizes[7] = 40000u;
+    seqan3::concatenated_sequences<std::vector<seqan3::dna4>> const sequences = generate_sequences(sizes);
+    seqan3::minimiser_extractor const extractor{seqan3::ungapped{12}, seqan3::window_size{16}};
+    occurrence_map const expected = expected_occurrences(sequences, extractor);
+
+    seqan3::kmer_index const index{sequences, extractor, 4u};
+    expect_occurrences(index, expected);
+
+    // The index does not depend on the number of threads.
+    seqan3::test::tmp_directory tmp{};
+    seqan3::kmer_index{sequences, extractor, 1u}.write(tmp.path() / "single.kmers");
+    index.write(tmp.path() / "multiple.kmers");
+
+    auto read = [](std::filesystem::path const & path)
+    {
+        std::ifstream stream{path, std::ios::binary};
+        return std::string{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+    };
+    EXPECT_EQ(read(tmp.path() / "single.kmers"), read(tmp.path() / "multiple.kmers"));
+}
+
+TEST(kmer_index, bulk_find)
+{
+    seqan3::concatenated_sequences<std::vector<seqan3::dna4>> const sequences = generate_sequences({3000u, 5000u});
+    seqan3::kmer_index const index{sequences, seqan3::ungapped{6}};
+
+    std::vector<uint64_t> hashes{};
+    for (uint64_t hash = 0; hash < 4200u; hash += 3u)
+        hashes.push_back(hash);
+
+    std::vector<std::span<seqan3::kmer_occurrence const>> results(hashes.size());
+    index.find(hashes, results);
+    for (size_t i = 0; i < hashes.size(); ++i)
+        EXPECT_RANGE_EQ(results[i], index.find(hashes[i]));
+
+    // Views as query.
+    std::vector<seqan3::dna4> const query{"ACGTAGCTAGCTAGCATCGATCGACTAGCTAGCATCGACTTT"_dna4};
+    auto query_hashes = query | seqan3::views::canonical_kmer_hash(seqan3::ungapped{6})
+                      | seqan3::ranges::to<std::vector>();
+    index.find(query_hashes | std::views::reverse, results);
+    for (size_t i = 0; i < query_hashes.size(); ++i)
+        EXPECT_RANGE_EQ(results[i], index.find(query_hashes[query_hashes.size() - 1u - i]));
+
+    std::vector<std::span<seqan3::kmer_occurrence const>> too_few_results(2u);
+    EXPECT_THROW(index.find(hashes, too_few_results), std::invalid_argument);
+}
+
+TEST(kmer_index, serialisation)
+{
+    seqan3::concatenated_sequences<std::vector<seqan3::dna4>> const sequences = generate_sequences({300u, 500u});
+    seqan3::kmer_index index{sequences, seqan3::ungapped{4}};
+    seqan3::test::do_serialisation(index);
+}
+
+TEST(mapped_kmer_index, write_and_map)
+{
+    seqan3::concatenated_sequences<std::vector<seqan3::dna4>> const sequences =
+        generate_sequences({10000u, 0u, 700u});
+    seqan3::minimiser_extractor const extractor{seqan3::ungapped{9}, seqan3::window_size{14}};
+    occurrence_map const expected = expected_occurrences(sequences, extractor);
+
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path const path{tmp.path() / "index.kmers"};
+    seqan3::kmer_index{sequences, extractor, 2u}.write(path);
+
+    seqan3::mapped_kmer_index mapped{path};
+    EXPECT_EQ(mapped.sequence_count(), 3u);
+    expect_occurrences(mapped, expected);
+
+    std::vector<uint64_t> hashes{};
+    for (auto const & [hash, occurrences] : expected)
+        hashes.push_back(hash);
+    std::vector<std::span<seqan3::kmer_occurrence const>> results(hashes.size());
+    mapped.find(hashes, results);
+    for (size_t i = 0; i < hashes.size(); ++i)
+        EXPECT_RANGE_EQ(results[i], expected.at(hashes[i]));
+
+    seqan3::mapped_kmer_index moved{std::move(mapped)};
+    EXPECT_EQ(mapped.size(), 0u);
+    EXPECT_TRUE(mapped.find(hashes.front()).empty());
+    expect_occurrences(moved, expected);
+}
+
+TEST(mapped_kmer_index, empty)
+{
+    seqan3::mapped_kmer_index const index{};
+    EXPECT_EQ(index.size(), 0u);
+    EXPECT_EQ(index.key_count(), 0u);
+    EXPECT_TRUE(index.find(1u).empty());
+
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path const path{tmp.path() / "empty.kmers"};
+    seqan3::kmer_index{}.write(path);
+    seqan3::mapped_kmer_index const mapped{path};
+    EXPECT_EQ(mapped.size(), 0u);
+    EXPECT_TRUE(mapped.find(1u).empty());
+}
+
+TEST(mapped_kmer_index, invalid_files)
+{
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path const path{tmp.path() / "index.kmers"};
+    EXPECT_THROW(seqan3::mapped_kmer_index{path}, std::filesystem::filesystem_error);
+
+    {
+        std::ofstream stream{path};
+        stream << "not an index";
+    }
+    EXPECT_THROW(seqan3::mapped_kmer_index{path}, std::runtime_error);
+
+    seqan3::kmer_index{generate_sequences({100u}), seqan3::ungapped{4}}.write(path);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8u);
+    EXPECT_THROW(seqan3::mapped_kmer_index{path}, std::runtime_error);
+
+    // A corrupted header whose size of the arrays overflows to the size of the file.
+    {
+        seqan3::detail::kmer_index_header header{};
+        header.bucket_bits = 1u;
+        header.key_count = uint64_t{1} << 62;
+
+        std::array<uint64_t, 4> const words{0u, 0u, header.key_count, 0u};
+        std::ofstream stream{path, std::ios::binary | std::ios::trunc};
+        stream.write(reinterpret_cast<char const *>(&header), sizeof(header));
+        stream.write(reinterpret_cast<char const *>(words.data()), sizeof(words));
+    }
+    EXPECT_THROW(seqan3::mapped_kmer_index{path}, std::runtime_error);
+}
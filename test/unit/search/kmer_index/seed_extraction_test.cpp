@@ -0,0 +1,307 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <forward_list>
+#include <sstream>
+
+#include <seqan3/alphabet/container/concatenated_sequences.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/views/char_to.hpp>
+#include <seqan3/alphabet/views/complement.hpp>
+#include <seqan3/alphabet/views/to_char.hpp>
+#include <seqan3/search/kmer_index/seed_extraction.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+#include <seqan3/search/views/minimiser_hash.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/utility/range/to.hpp>
+
+using seqan3::operator""_dna4;
+using seqan3::operator""_shape;
+
+inline constexpr uint64_t default_seed = 0x8F'3F'73'B5'CF'1C'9A'DE;
+
+template <typename alphabet_t>
+std::vector<alphabet_t> generate_text(size_t const size, size_t const seed = 0u)
+{
+    return std::views::iota(size_t{0}, size)
+         | std::views::transform(
+               [seed](size_t const i)
+               {
+                   size_t const x = (i + seed) * 0x9E37'79B9'7F4A'7C15ULL;
+                   return seqan3::assign_rank_to((x >> 41) % seqan3::alphabet_size<alphabet_t>, alphabet_t{});
+               })
+         | seqan3::ranges::to<std::vector>();
+}
+
+// The forward and reverse complement hash values of all k-mers, XORed with the seed.
+template <typename alphabet_t>
+std::pair<std::vector<uint64_t>, std::vector<uint64_t>>
+strand_hashes(std::vector<alphabet_t> const & text, seqan3::shape const & shape, uint64_t const seed)
+{
+    auto xor_seed = std::views::transform(
+        [seed](uint64_t const hash)
+        {
+            return hash ^ seed;
+        });
+    std::vector<uint64_t> forward =
+        text | seqan3::views::kmer_hash(shape) | xor_seed | seqan3::ranges::to<std::vector>();
+    std::vector<uint64_t> reverse = text | seqan3::views::complement | std::views::reverse
+                                  | seqan3::views::kmer_hash(shape) | std::views::reverse | xor_seed
+                                  | seqan3::ranges::to<std::vector>();
+    return {forward, reverse};
+}
+
+// Checks that the seeds describe the k-mers at their positions.
+template <typename alphabet_t>
+void expect_valid_seeds(std::vector<alphabet_t> const & text,
+                        seqan3::shape const & shape,
+                        uint64_t const seed,
+                        std::span<seqan3::kmer_seed const> const seeds)
+{
+    auto [forward, reverse] = strand_hashes(text, shape, seed);
+    for (seqan3::kmer_seed const & kmer_seed : seeds)
+    {
+        ASSERT_LT(kmer_seed.position, forward.size());
+        EXPECT_EQ(kmer_seed.hash, std::min(forward[kmer_seed.position], reverse[kmer_seed.position]));
+        EXPECT_EQ(kmer_seed.reverse_complement, reverse[kmer_seed.position] < forward[kmer_seed.position]);
+    }
+}
+
+TEST(minimiser_extractor, same_as_minimiser_hash)
+{
+    for (seqan3::shape const shape : {seqan3::shape{seqan3::ungapped{4}},
+                                      seqan3::shape{seqan3::ungapped{19}},
+                                      0b1101'1011'0111_shape})
+    {
+        for (uint32_t const window_size : {uint32_t{20}, uint32_t{40}})
+        {
+            for (size_t const size : {0u, 3u, 25u, 1000u, 20000u})
+            {
+                std::vector<seqan3::dna4> const text = generate_text<seqan3::dna4>(size, window_size);
+                seqan3::minimiser_extractor extractor{shape, seqan3::window_size{window_size}};
+
+                std::vector<seqan3::kmer_seed> seeds(size);
+                seeds.resize(extractor(text, seeds));
+
+                std::vector<uint64_t> const expected =
+                    text | seqan3::views::minimiser_hash(shape, seqan3::window_size{window_size})
+                    | seqan3::ranges::to<std::vector>();
+                EXPECT_RANGE_EQ(seeds | std::views::transform(&seqan3::kmer_seed::hash), expected);
+                EXPECT_TRUE(std::ranges::is_sorted(seeds, std::less<>{}, &seqan3::kmer_seed::position));
+                expect_valid_seeds(text, shape, default_seed, seeds);
+            }
+        }
+    }
+}
+
+TEST(minimiser_extractor, seed)
+{
+    std::vector<seqan3::dna5> const text = generate_text<seqan3::dna5>(500u);
+    seqan3::minimiser_extractor extractor{seqan3::ungapped{5}, seqan3::window_size{12}, seqan3::seed{0}};
+
+    std::vector<seqan3::kmer_seed> seeds(500u);
+    seeds.resize(extractor(text, seeds));
+
+    std::vector<uint64_t> const expected =
+        text | seqan3::views::minimiser_hash(seqan3::ungapped{5}, seqan3::window_size{12}, seqan3::seed{0})
+        | seqan3::ranges::to<std::vector>();
+    EXPECT_RANGE_EQ(seeds | std::views::transform(&seqan3::kmer_seed::hash), expected);
+    expect_valid_seeds(text, seqan3::ungapped{5}, 0u, seeds);
+}
+
+TEST(minimiser_extractor, range_types)
+{
+    std::vector<seqan3::dna4> const text = generate_text<seqan3::dna4>(300u);
+    seqan3::minimiser_extractor extractor{seqan3::ungapped{7}, seqan3::window_size{15}};
+
+    std::vector<seqan3::kmer_seed> expected(300u);
+    expected.resize(extractor(text, expected));
+
+    std::forward_list<seqan3::dna4> const list{text.begin(), text.end()};
+    std::vector<seqan3::kmer_seed> seeds(300u);
+    seeds.resize(extractor(list, seeds));
+    EXPECT_EQ(seeds, expected);
+
+    std::istringstream stream{text | seqan3::views::to_char | seqan3::ranges::to<std::string>()};
+    seeds.resize(300u);
+    seeds.resize(extractor(std::views::istream<char>(stream) | seqan3::views::char_to<seqan3::dna4>, seeds));
+    EXPECT_EQ(seeds, expected);
+}
+
+TEST(minimiser_extractor, invalid)
+{
+    EXPECT_THROW((seqan3::minimiser_extractor{seqan3::ungapped{20}, seqan3::window_size{19}}), std::invalid_argument);
+
+    std::vector<seqan3::dna4> const text = generate_text<seqan3::dna4>(300u);
+    seqan3::minimiser_extractor extractor{seqan3::ungapped{7}, seqan3::window_size{15}};
+    std::vector<seqan3::kmer_seed> seeds(3u);
+    EXPECT_THROW(extractor(text, seeds), std::invalid_argument);
+}
+
+TEST(syncmer_extractor, closed)
+{
+    std::vector<seqan3::dna4> const text = generate_text<seqan3::dna4>(2000u);
+    seqan3::syncmer_parameters const parameters{.kmer_size = 15u, .smer_size = 5u};
+    seqan3::syncmer_extractor extractor{parameters};
+
+    std::vector<seqan3::kmer_seed> seeds(2000u);
+    seeds.resize(extractor(text, seeds));
+
+    // A k-mer is a closed syncmer if its first or last s-mer is minimal.
+    auto [forward, reverse] = strand_hashes(text, seqan3::ungapped{5}, default_seed);
+    std::vector<uint32_t> expected_positions{};
+    for (size_t i = 0; i + 15u <= text.size(); ++i)
+    {
+        uint64_t minimum = std::numeric_limits<uint64_t>::max();
+        for (size_t j = i; j < i + 11u; ++j)
+            minimum = std::min({minimum, forward[j], reverse[j]});
+
+        if (std::min(forward[i], reverse[i]) == minimum || std::min(forward[i + 10u], reverse[i + 10u]) == minimum)
+            expected_positions.push_back(i);
+    }
+
+    EXPECT_RANGE_EQ(seeds | std::views::transform(&seqan3::kmer_seed::position), expected_positions);
+    expect_valid_seeds(text, seqan3::ungapped{15}, default_seed, seeds);
+
+    // Closed syncmers are canonical: the reverse complement has the same syncmers at mirrored positions.
+    std::vector<seqan3::dna4> const reverse_complement =
+        text | seqan3::views::complement | std::views::reverse | seqan3::ranges::to<std::vector>();
+    std::vector<seqan3::kmer_seed> reverse_seeds(2000u);
+    reverse_seeds.resize(extractor(reverse_complement, reverse_seeds));
+    ASSERT_EQ(reverse_seeds.size(), seeds.size());
+    for (size_t i = 0; i < seeds.size(); ++i)
+    {
+        seqan3::kmer_seed const & mirrored = reverse_seeds[seeds.size() - 1u - i];
+        EXPECT_EQ(mirrored.hash, seeds[i].hash);
+        EXPECT_EQ(mirrored.position, text.size() - 15u - seeds[i].position);
+    }
+}
+
+TEST(syncmer_extractor, open)
+{
+    std::vector<seqan3::dna4> const text = generate_text<seqan3::dna4>(2000u, 7u);
+    seqan3::syncmer_parameters const parameters{.kmer_size = 12u,
+                                                .smer_size = 4u,
+                                                .kind = seqan3::syncmer_kind::open,
+                                                .offset = 3u,
+                                                .seed = 0u};
+    seqan3::syncmer_extractor extractor{parameters};
+
+    std::vector<seqan3::kmer_seed> seeds(2000u);
+    seeds.resize(extractor(text, seeds));
+
+    auto [forward, reverse] = strand_hashes(text, seqan3::ungapped{4}, 0u);
+    std::vector<uint32_t> expected_positions{};
+    for (size_t i = 0; i + 12u <= text.size(); ++i)
+    {
+        uint64_t minimum = std::numeric_limits<uint64_t>::max();
+        for (size_t j = i; j < i + 9u; ++j)
+            minimum = std::min({minimum, forward[j], reverse[j]});
+
+        if (std::min(forward[i + 3u], reverse[i + 3u]) == minimum)
+            expected_positions.push_back(i);
+    }
+
+    EXPECT_FALSE(expected_positions.empty());
+    EXPECT_RANGE_EQ(seeds | std::views::transform(&seqan3::kmer_seed::position), expected_positions);
+    expect_valid_seeds(text, seqan3::ungapped{12}, 0u, seeds);
+}
+
+TEST(syncmer_extractor, invalid)
+{
+    EXPECT_THROW((seqan3::syncmer_extractor{{.kmer_size = 5u, .smer_size = 5u}}), std::invalid_argument);
+    EXPECT_THROW((seqan3::syncmer_extractor{{.kmer_size = 5u, .smer_size = 0u}}), std::invalid_argument);
+    EXPECT_THROW((seqan3::syncmer_extractor{
+                     {.kmer_size = 8u, .smer_size = 4u, .kind = seqan3::syncmer_kind::open, .offset = 5u}}),
+                 std::invalid_argument);
+    EXPECT_NO_THROW((seqan3::syncmer_extractor{
+        {.kmer_size = 8u, .smer_size = 4u, .kind = seqan3::syncmer_kind::open, .offset = 4u}}));
+
+    std::vector<seqan3::dna4> const text = generate_text<seqan3::dna4>(300u);
+    seqan3::syncmer_extractor extractor{{.kmer_size = 15u, .smer_size = 5u}};
+    std::vector<seqan3::kmer_seed> seeds(3u);
+    EXPECT_THROW(extractor(text, seeds), std::invalid_argument);
+
+    std::vector<seqan3::dna4> const short_text{"ACGT"_dna4};
+    EXPECT_EQ(extractor(short_text, seeds), 0u);
+}
+
+TEST(strobemer_extractor, randstrobes)
+{
+    std::vector<seqan3::dna4> const text = generate_text<seqan3::dna4>(1000u, 3u);
+    seqan3::strobemer_parameters const parameters{.strobe_size = 10u, .window_min = 5u, .window_max = 20u};
+    seqan3::strobemer_extractor extractor{parameters};
+
+    std::vector<seqan3::kmer_seed> seeds(1000u);
+    seeds.resize(extractor(text, seeds));
+
+    auto [forward, reverse] = strand_hashes(text, seqan3::ungapped{10}, default_seed);
+    std::vector<uint64_t> hashes{};
+    for (size_t i = 0; i < forward.size(); ++i)
+        hashes.push_back(std::min(forward[i], reverse[i]));
+
+    ASSERT_EQ(seeds.size(), hashes.size() - 5u);
+    for (size_t i = 0; i < seeds.size(); ++i)
+    {
+        size_t best = i + 5u;
+        for (size_t j = i + 5u; j <= std::min(i + 20u, hashes.size() - 1u); ++j)
+            if ((hashes[i] ^ hashes[j]) < (hashes[i] ^ hashes[best]))
+                best = j;
+
+        EXPECT_EQ(seeds[i].position, i);
+        EXPECT_EQ(seeds[i].hash, hashes[i] ^ std::rotl(hashes[best], 1));
+        EXPECT_EQ(seeds[i].reverse_complement, reverse[i] < forward[i]);
+    }
+}
+
+TEST(strobemer_extractor, invalid)
+{
+    EXPECT_THROW((seqan3::strobemer_extractor{{.strobe_size = 0u}}), std::invalid_argument);
+    EXPECT_THROW((seqan3::strobemer_extractor{{.window_min = 0u}}), std::invalid_argument);
+    EXPECT_THROW((seqan3::strobemer_extractor{{.window_min = 10u, .window_max = 9u}}), std::invalid_argument);
+
+    seqan3::strobemer_extractor extractor{{.strobe_size = 10u, .window_min = 5u, .window_max = 20u}};
+    std::vector<seqan3::kmer_seed> seeds(10u);
+    EXPECT_EQ(extractor(generate_text<seqan3::dna4>(14u), seeds), 0u);
+    EXPECT_EQ(extractor(generate_text<seqan3::dna4>(15u), seeds), 1u);
+    EXPECT_THROW(extractor(generate_text<seqan3::dna4>(100u), seeds), std::invalid_argument);
+}
+
+TEST(seed_extraction, collection)
+{
+    seqan3::concatenated_sequences<std::vector<seqan3::dna4>> sequences{};
+    for (size_t const size : {500u, 0u, 10u, 2000u})
+        sequences.push_back(generate_text<seqan3::dna4>(size, size));
+
+    seqan3::minimiser_extractor minimisers{seqan3::ungapped{11}, seqan3::window_size{21}};
+    seqan3::syncmer_extractor syncmers{{.kmer_size = 11u, .smer_size = 4u}};
+    seqan3::strobemer_extractor strobemers{{.strobe_size = 11u, .window_min = 3u, .window_max = 9u}};
+
+    auto check = [&](auto & extractor)
+    {
+        std::vector<seqan3::kmer_seed> seeds(2510u);
+        std::vector<size_t> seed_offsets(sequences.size() + 1u);
+        size_t const count = extractor(sequences, seeds, seed_offsets);
+
+        EXPECT_EQ(seed_offsets.front(), 0u);
+        EXPECT_EQ(seed_offsets.back(), count);
+
+        for (size_t i = 0; i < sequences.size(); ++i)
+        {
+            std::vector<seqan3::kmer_seed> expected(2510u);
+            expected.resize(extractor(sequences[i], expected));
+            EXPECT_RANGE_EQ(std::span{seeds}.subspan(seed_offsets[i], seed_offsets[i + 1] - seed_offsets[i]), expected);
+        }
+
+        std::vector<size_t> too_few_offsets(sequences.size());
+        EXPECT_THROW(extractor(sequences, seeds, too_few_offsets), std::invalid_argument);
+    };
+
+    check(minimisers);
+    check(syncmers);
+    check(strobemers);
+}
@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <forward_list>
+#include <list>
+#include <sstream>
+
+#include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/nucleotide/rna4.hpp>
+#include <seqan3/alphabet/views/char_to.hpp>
+#include <seqan3/alphabet/views/complement.hpp>
+#include <seqan3/search/views/canonical_kmer_hash.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/utility/range/to.hpp>
+
+using seqan3::operator""_dna4;
+using seqan3::operator""_shape;
+using result_t = std::vector<size_t>;
+
+// The element-wise minimum of the hash values of both strands, computed with two seqan3::views::kmer_hash.
+template <typename alphabet_t>
+result_t expected_hashes(std::vector<alphabet_t> const & text, seqan3::shape const & shape, uint64_t const seed = 0u)
+{
+    auto forward = text | seqan3::views::kmer_hash(shape) | seqan3::ranges::to<result_t>();
+    auto reverse = text | seqan3::views::complement | std::views::reverse | seqan3::views::kmer_hash(shape)
+                 | std::views::reverse | seqan3::ranges::to<result_t>();
+
+    result_t result{};
+    for (size_t i = 0; i < forward.size(); ++i)
+        result.push_back(std::min(forward[i] ^ seed, reverse[i] ^ seed));
+    return result;
+}
+
+template <typename alphabet_t>
+std::vector<alphabet_t> generate_text(size_t const size)
+{
+    return std::views::iota(size_t{0}, size)
+         | std::views::transform(
+               [](size_t const i)
+               {
+                   return seqan3::assign_rank_to((i * i * 7u + i / 3u) % seqan3::alphabet_size<alphabet_t>,
+                                                 alphabet_t{});
+               })
+         | seqan3::ranges::to<std::vector>();
+}
+
+template <typename T>
+class canonical_kmer_hash_test : public ::testing::Test
+{};
+
+using alphabet_types = ::testing::Types<seqan3::dna4, seqan3::rna4, seqan3::dna5, seqan3::dna15>;
+
+TYPED_TEST_SUITE(canonical_kmer_hash_test, alphabet_types, );
+
+TYPED_TEST(canonical_kmer_hash_test, same_as_both_strands)
+{
+    std::vector<TypeParam> const text = generate_text<TypeParam>(300);
+
+    for (seqan3::shape const shape : {seqan3::shape{seqan3::ungapped{1}},
+                                      seqan3::shape{seqan3::ungapped{3}},
+                                      seqan3::shape{seqan3::ungapped{15}},
+                                      0b101_shape,
+                                      0b1001_shape,
+                                      0b1101'1011'0111_shape,
+                                      0b1'0000'0000'0000'0101_shape})
+    {
+        EXPECT_RANGE_EQ(text | seqan3::views::canonical_kmer_hash(shape), expected_hashes(text, shape));
+
+        seqan3::detail::canonical_kmer_hash_view seeded{text, shape, 0x8F'3F'73'B5'CF'1C'9A'DEULL};
+        EXPECT_RANGE_EQ(seeded, expected_hashes(text, shape, 0x8F'3F'73'B5'CF'1C'9A'DEULL));
+    }
+}
+
+TYPED_TEST(canonical_kmer_hash_test, strand_independent)
+{
+    std::vector<TypeParam> const text = generate_text<TypeParam>(100);
+    std::vector<TypeParam> const reverse_complement =
+        text | seqan3::views::complement | std::views::reverse | seqan3::ranges::to<std::vector>();
+
+    for (seqan3::shape const shape : {seqan3::shape{seqan3::ungapped{5}}, 0b11011_shape})
+    {
+        result_t const reverse_hashes =
+            reverse_complement | seqan3::views::canonical_kmer_hash(shape) | seqan3::ranges::to<result_t>();
+        EXPECT_RANGE_EQ(text | seqan3::views::canonical_kmer_hash(shape), reverse_hashes | std::views::reverse);
+    }
+}
+
+TEST(canonical_kmer_hash_test, long_shapes)
+{
+    std::vector<seqan3::dna4> const text = generate_text<seqan3::dna4>(500);
+
+    // Spans of 32 (64 bits), 33 and 58 positions.
+    for (seqan3::shape const shape : {seqan3::shape{seqan3::ungapped{32}},
+                                      0b1'0000'0000'0000'0000'0000'0000'0000'0001_shape,
+                                      0x3'FF'FF'F0'00'00'00'01_shape})
+    {
+        EXPECT_RANGE_EQ(text | seqan3::views::canonical_kmer_hash(shape), expected_hashes(text, shape));
+    }
+}
+
+TEST(canonical_kmer_hash_test, range_types)
+{
+    std::vector<seqan3::dna4> const text = generate_text<seqan3::dna4>(100);
+    seqan3::shape const shape = 0b10111_shape;
+    result_t const expected = expected_hashes(text, shape);
+
+    seqan3::bitpacked_sequence<seqan3::dna4> const bitpacked{text};
+    EXPECT_RANGE_EQ(bitpacked | seqan3::views::canonical_kmer_hash(shape), expected);
+
+    std::forward_list<seqan3::dna4> const forward_list{text.begin(), text.end()};
+    EXPECT_RANGE_EQ(forward_list | seqan3::views::canonical_kmer_hash(shape), expected);
+
+    // A single pass range.
+    std::istringstream stream{text | seqan3::views::to_char | seqan3::ranges::to<std::string>()};
+    auto streamed = std::views::istream<char>(stream) | seqan3::views::char_to<seqan3::dna4>;
+    auto hashes = streamed | seqan3::views::canonical_kmer_hash(shape);
+    EXPECT_TRUE(std::ranges::input_range<decltype(hashes)>);
+    EXPECT_FALSE(std::ranges::forward_range<decltype(hashes)>);
+    EXPECT_RANGE_EQ(hashes, expected);
+
+    // Stops at the sentinel of a range that is not a common range.
+    auto prefix = text | std::views::take_while(
+                             [](seqan3::dna4 const letter)
+                             {
+                                 return letter != 'T'_dna4;
+                             });
+    EXPECT_RANGE_EQ(prefix | seqan3::views::canonical_kmer_hash(shape),
+                    expected_hashes(prefix | seqan3::ranges::to<std::vector>(), shape));
+}
+
+TEST(canonical_kmer_hash_test, concepts)
+{
+    std::vector<seqan3::dna4> text{"ACGTAGC"_dna4};
+    auto v = text | seqan3::views::canonical_kmer_hash(seqan3::ungapped{3});
+    using view_t = decltype(v);
+
+    EXPECT_TRUE(std::ranges::forward_range<view_t>);
+    EXPECT_FALSE(std::ranges::bidirectional_range<view_t>);
+    EXPECT_TRUE(std::ranges::view<view_t>);
+    EXPECT_TRUE(std::ranges::sized_range<view_t>);
+    EXPECT_FALSE(std::ranges::common_range<view_t>);
+    EXPECT_TRUE(seqan3::const_iterable_range<view_t>);
+    EXPECT_TRUE((std::same_as<std::ranges::range_reference_t<view_t>, size_t>));
+
+    EXPECT_EQ(v.size(), 5u);
+    EXPECT_EQ(std::ranges::distance(v), 5);
+    EXPECT_EQ(*std::ranges::next(v.begin(), 3), 28u);
+    EXPECT_TRUE(std::ranges::equal(std::as_const(v), v));
+}
+
+TEST(canonical_kmer_hash_test, short_text)
+{
+    std::vector<seqan3::dna4> text{"ACG"_dna4};
+    EXPECT_TRUE(std::ranges::empty(text | seqan3::views::canonical_kmer_hash(seqan3::ungapped{4})));
+    EXPECT_EQ((text | seqan3::views::canonical_kmer_hash(seqan3::ungapped{4})).size(), 0u);
+    EXPECT_RANGE_EQ(text | seqan3::views::canonical_kmer_hash(seqan3::ungapped{3}), result_t{6});
+
+    std::vector<seqan3::dna4> empty_text{};
+    EXPECT_TRUE(std::ranges::empty(empty_text | seqan3::views::canonical_kmer_hash(seqan3::ungapped{1})));
+}
+
+TEST(canonical_kmer_hash_test, invalid_shapes)
+{
+    std::vector<seqan3::dna4> dna4_text{"ACGT"_dna4};
+    EXPECT_NO_THROW(dna4_text | seqan3::views::canonical_kmer_hash(seqan3::ungapped{32}));
+    EXPECT_THROW(dna4_text | seqan3::views::canonical_kmer_hash(seqan3::ungapped{33}), std::invalid_argument);
+
+    // 43 positions of 3 bits exceed 128 bits.
+    std::vector<seqan3::dna5> dna5_text{};
+    seqan3::shape const span_42 = 0b1'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'1_shape;
+    seqan3::shape const span_43 = 0b10'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000'1_shape;
+    EXPECT_NO_THROW(dna5_text | seqan3::views::canonical_kmer_hash(span_42));
+    EXPECT_THROW(dna5_text | seqan3::views::canonical_kmer_hash(span_43), std::invalid_argument);
+}
@@ -15,6 +15,7 @@
 #include <seqan3/search/views/kmer_hash.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
 #include <seqan3/test/expect_throw_msg.hpp>
+#include <seqan3/utility/range/to.hpp>
 #include <seqan3/utility/views/repeat_n.hpp>
 
 #include "../../range/iterator_test_template.hpp"
@@ -356,3 +357,63 @@ TYPED_TEST(kmer_hash_gapped_test, issue2415)
         EXPECT_RANGE_EQ(gapped, v);
     }
 }
+
+// Gapped shapes over alphabets whose size is a power of two are hashed with a window of packed ranks.
+TYPED_TEST(kmer_hash_gapped_test, packed_window)
+{
+    std::vector<seqan3::dna4> const letters = std::views::iota(0u, 300u)
+                                            | std::views::transform(
+                                                  [](unsigned const i)
+                                                  {
+                                                      return seqan3::assign_rank_to((i * i + i / 7u) % 4u,
+                                                                                    seqan3::dna4{});
+                                                  })
+                                            | seqan3::ranges::to<std::vector>();
+    TypeParam text(letters.begin(), letters.end());
+
+    auto expected_hashes = [&letters](seqan3::shape const & shape)
+    {
+        result_t hashes{};
+        for (size_t begin = 0; begin + shape.size() <= letters.size(); ++begin)
+        {
+            size_t hash{};
+            for (size_t i = 0; i < shape.size(); ++i)
+                hash = shape[i] ? hash * 4u + seqan3::to_rank(letters[begin + i]) : hash;
+
+            // The last position is always added, see the documentation of the iterator.
+            size_t const last = begin + shape.size() - 1u;
+            hashes.push_back(shape[shape.size() - 1u] ? hash : hash + seqan3::to_rank(letters[last]));
+        }
+        return hashes;
+    };
+
+    // Windows of 4, 62, 64, 66, 94 and 114 bits.
+    for (seqan3::shape const shape : {0b101_shape,
+                                      0b1101'1011'0000'1101'1010'1001'0101'1111_shape,
+                                      0b1'0000'0000'0000'0000'0000'0000'0000'0001_shape,
+                                      0b11'0000'0000'0000'0000'0000'0000'0000'0011_shape,
+                                      0xF'FF'FF'FF'E0'01_shape,
+                                      0x3'FF'FF'F0'00'00'00'01_shape})
+    {
+        result_t const expected = expected_hashes(shape);
+        EXPECT_RANGE_EQ(text | seqan3::views::kmer_hash(shape), expected);
+
+        if constexpr (std::ranges::bidirectional_range<TypeParam>)
+        {
+            EXPECT_RANGE_EQ(text | seqan3::views::kmer_hash(shape) | std::views::reverse,
+                            expected | std::views::reverse);
+        }
+
+        if constexpr (std::ranges::random_access_range<TypeParam>)
+        {
+            auto v = text | seqan3::views::kmer_hash(shape);
+            auto it = v.begin() + 100;
+            EXPECT_EQ(*it, expected[100]);
+            ++it;
+            EXPECT_EQ(*it, expected[101]);
+            it -= 50;
+            --it;
+            EXPECT_EQ(*it, expected[50]);
+        }
+    }
+}
@@ -4,6 +4,9 @@
 
 #include <gtest/gtest.h>
 
+#include <numeric>
+#include <random>
+
 #include <seqan3/test/cereal.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
 #include <seqan3/utility/bloom_filter/bloom_filter.hpp>
@@ -130,3 +133,183 @@ TYPED_TEST(bloom_filter_test, serialisation)
     TypeParam bf{TestFixture::make_bf(seqan3::bin_size{1024u})};
     seqan3::test::do_serialisation(bf);
 }
+
+template <typename bf_type>
+struct blocked_bloom_filter_test : public ::testing::Test
+{
+    using uncompressed_type =
+        seqan3::bloom_filter<seqan3::data_layout::uncompressed, seqan3::bloom_filter_layout::blocked>;
+};
+
+using blocked_bf_types =
+    ::testing::Types<seqan3::bloom_filter<seqan3::data_layout::uncompressed, seqan3::bloom_filter_layout::blocked>,
+                     seqan3::bloom_filter<seqan3::data_layout::compressed, seqan3::bloom_filter_layout::blocked>>;
+
+TYPED_TEST_SUITE(blocked_bloom_filter_test, blocked_bf_types, );
+
+TYPED_TEST(blocked_bloom_filter_test, construction)
+{
+    using uncompressed_type = typename TestFixture::uncompressed_type;
+
+    EXPECT_TRUE(std::is_default_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_copy_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_move_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_copy_assignable_v<TypeParam>);
+    EXPECT_TRUE(std::is_move_assignable_v<TypeParam>);
+    EXPECT_TRUE(std::is_destructible_v<TypeParam>);
+    EXPECT_TRUE(TypeParam::layout == seqan3::bloom_filter_layout::blocked);
+
+    // The standard and the blocked layout cannot be converted into each other.
+    EXPECT_FALSE((std::is_constructible_v<TypeParam, seqan3::bloom_filter<seqan3::data_layout::uncompressed>>));
+
+    // bin_size parameter is too small
+    EXPECT_THROW((uncompressed_type{seqan3::bin_size{0u}}), std::logic_error);
+    // not enough hash functions
+    EXPECT_THROW((uncompressed_type{seqan3::bin_size{32u}, seqan3::hash_function_count{0u}}), std::logic_error);
+    // too many hash functions
+    EXPECT_THROW((uncompressed_type{seqan3::bin_size{32u}, seqan3::hash_function_count{6u}}), std::logic_error);
+}
+
+TYPED_TEST(blocked_bloom_filter_test, member_getter)
+{
+    using uncompressed_type = typename TestFixture::uncompressed_type;
+
+    // The size is rounded up to a multiple of the block size.
+    TypeParam bf{uncompressed_type{seqan3::bin_size{1019u}, seqan3::hash_function_count{3u}}};
+    EXPECT_EQ(bf.bit_size(), 1024u);
+    EXPECT_EQ(bf.hash_function_count(), 3u);
+
+    TypeParam bf2{uncompressed_type{seqan3::bin_size{1025u}}};
+    EXPECT_EQ(bf2.bit_size(), 1536u);
+}
+
+TYPED_TEST(blocked_bloom_filter_test, emplace_and_contains)
+{
+    using uncompressed_type = typename TestFixture::uncompressed_type;
+
+    for (size_t funs = 1u; funs <= 5u; ++funs)
+    {
+        uncompressed_type bf{seqan3::bin_size{8192u}, seqan3::hash_function_count{funs}};
+
+        for (size_t hash : std::views::iota(0u, 64u))
+            EXPECT_FALSE(bf.contains(hash));
+
+        for (size_t hash : std::views::iota(0u, 64u))
+            bf.emplace(hash);
+
+        TypeParam bf2{bf};
+        for (size_t hash : std::views::iota(0u, 64u))
+            EXPECT_TRUE(bf2.contains(hash));
+
+        // All bits of a value are set in a single block.
+        uncompressed_type single{seqan3::bin_size{8192u}, seqan3::hash_function_count{funs}};
+        single.emplace(42u);
+        size_t blocks_with_bits{};
+        size_t set_bits{};
+        for (size_t block = 0; block < single.bit_size(); block += uncompressed_type::block_size)
+        {
+            size_t bits_in_block{};
+            for (size_t i = 0; i < uncompressed_type::block_size; i += 64)
+                bits_in_block += std::popcount(single.raw_data().get_int(block + i));
+            blocks_with_bits += bits_in_block > 0u;
+            set_bits += bits_in_block;
+        }
+        EXPECT_EQ(blocks_with_bits, 1u);
+        EXPECT_GE(set_bits, 1u);
+        EXPECT_LE(set_bits, funs);
+    }
+}
+
+TYPED_TEST(blocked_bloom_filter_test, counting)
+{
+    using uncompressed_type = typename TestFixture::uncompressed_type;
+
+    uncompressed_type bf{seqan3::bin_size{8192u}, seqan3::hash_function_count{2u}};
+    for (size_t hash : std::views::iota(0u, 128u))
+        bf.emplace(hash);
+
+    TypeParam bf2{bf};
+    EXPECT_EQ(bf2.count(std::views::iota(0u, 128u)), 128u);
+    EXPECT_EQ(bf2.count(std::views::iota(22u, 42u)), 20u);
+    // Not a multiple of the batch size.
+    EXPECT_EQ(bf2.count(std::views::iota(5u, 100u)), 95u);
+
+    bf.reset();
+    EXPECT_EQ(bf.count(std::views::iota(0u, 128u)), 0u);
+}
+
+TYPED_TEST(blocked_bloom_filter_test, serialisation)
+{
+    using uncompressed_type = typename TestFixture::uncompressed_type;
+
+    uncompressed_type bf{seqan3::bin_size{1024u}};
+    bf.emplace(3u);
+    TypeParam bf2{bf};
+    seqan3::test::do_serialisation(bf2);
+}
+
+template <typename bf_type>
+struct bloom_filter_layout_test : public ::testing::Test
+{};
+
+using layout_types =
+    ::testing::Types<seqan3::bloom_filter<seqan3::data_layout::uncompressed, seqan3::bloom_filter_layout::standard>,
+                     seqan3::bloom_filter<seqan3::data_layout::uncompressed, seqan3::bloom_filter_layout::blocked>>;
+
+TYPED_TEST_SUITE(bloom_filter_layout_test, layout_types, );
+
+TYPED_TEST(bloom_filter_layout_test, bulk_contains)
+{
+    TypeParam bf{seqan3::bin_size{1u << 12}, seqan3::hash_function_count{3u}};
+    for (size_t hash = 0; hash < 1000u; hash += 3u)
+        bf.emplace(hash);
+
+    std::vector<size_t> values(1000u);
+    std::iota(values.begin(), values.end(), 0u);
+    std::unique_ptr<bool[]> results{new bool[values.size()]};
+    bf.bulk_contains(values, std::span<bool>{results.get(), values.size()});
+
+    for (size_t i = 0; i < values.size(); ++i)
+        EXPECT_EQ(results[i], bf.contains(values[i])) << i;
+
+    EXPECT_EQ(static_cast<size_t>(std::ranges::count(results.get(), results.get() + values.size(), true)),
+              bf.count(values));
+}
+
+// The false positive rates of the table in the documentation of seqan3::bloom_filter.
+TYPED_TEST(bloom_filter_layout_test, false_positive_rate)
+{
+    constexpr bool blocked = TypeParam::layout == seqan3::bloom_filter_layout::blocked;
+    size_t const value_count = 1u << 15;
+
+    struct parameters
+    {
+        size_t bits_per_value;
+        size_t hash_funs;
+        double standard;
+        double blocked;
+    };
+
+    for (auto const & [bits_per_value, hash_funs, standard, blocked_rate] : {parameters{8u, 2u, 0.0489, 0.0494},
+                                                                             parameters{8u, 4u, 0.0240, 0.0251},
+                                                                             parameters{16u, 2u, 0.0138, 0.0142},
+                                                                             parameters{16u, 4u, 0.0024, 0.0027}})
+    {
+        TypeParam bf{seqan3::bin_size{value_count * bits_per_value}, seqan3::hash_function_count{hash_funs}};
+
+        // Insert random values and query other random values, which are (almost surely) not in the filter.
+        std::mt19937_64 engine{bits_per_value * 10u + hash_funs};
+        for (size_t i = 0; i < value_count; ++i)
+            bf.emplace(engine());
+
+        size_t const query_count = 1u << 18;
+        size_t false_positives{};
+        for (size_t i = 0; i < query_count; ++i)
+            false_positives += bf.contains(engine());
+
+        double const expected = blocked ? blocked_rate : standard;
+        double const observed = static_cast<double>(false_positives) / query_count;
+        EXPECT_NEAR(observed, expected, expected * 0.1) << bits_per_value << " bits per value, " << hash_funs
+                                                         << " hash functions";
+    }
+}
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <seqan3/utility/bloom_filter/bloom_filter.hpp>
+#include <seqan3/utility/bloom_filter/counting_bloom_filter.hpp>
+#include <seqan3/test/cereal.hpp>
+
+template <typename cbf_type>
+struct counting_bloom_filter_test : public ::testing::Test
+{};
+
+using cbf_types = ::testing::Types<seqan3::counting_bloom_filter<4>, seqan3::counting_bloom_filter<8>>;
+
+TYPED_TEST_SUITE(counting_bloom_filter_test, cbf_types, );
+
+TYPED_TEST(counting_bloom_filter_test, construction)
+{
+    EXPECT_TRUE(std::is_default_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_copy_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_move_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_copy_assignable_v<TypeParam>);
+    EXPECT_TRUE(std::is_move_assignable_v<TypeParam>);
+    EXPECT_TRUE(std::is_destructible_v<TypeParam>);
+
+    // num hash functions defaults to two
+    TypeParam cbf1{seqan3::bin_size{1024u}};
+    TypeParam cbf2{seqan3::bin_size{1024u}, seqan3::hash_function_count{2u}};
+    EXPECT_TRUE(cbf1 == cbf2);
+
+    // bin_size parameter is too small
+    EXPECT_THROW((TypeParam{seqan3::bin_size{0u}}), std::logic_error);
+    // not enough hash functions
+    EXPECT_THROW((TypeParam{seqan3::bin_size{32u}, seqan3::hash_function_count{0u}}), std::logic_error);
+    // too many hash functions
+    EXPECT_THROW((TypeParam{seqan3::bin_size{32u}, seqan3::hash_function_count{6u}}), std::logic_error);
+}
+
+TYPED_TEST(counting_bloom_filter_test, member_getter)
+{
+    TypeParam cbf{seqan3::bin_size{1001u}, seqan3::hash_function_count{3u}};
+    EXPECT_EQ(cbf.hash_function_count(), 3u);
+    EXPECT_EQ(cbf.counter_count(), 1001u);
+    EXPECT_EQ(cbf.bit_size(), 1001u * std::bit_width(TypeParam::max_count));
+}
+
+TYPED_TEST(counting_bloom_filter_test, abundance)
+{
+    TypeParam cbf{seqan3::bin_size{8192u}};
+
+    for (size_t value = 0; value < 64u; ++value)
+        cbf.emplace(value, value % 8u);
+
+    for (size_t value = 0; value < 64u; ++value)
+    {
+        EXPECT_GE(cbf.abundance(value), value % 8u);
+        EXPECT_EQ(cbf.contains(value), cbf.abundance(value) > 0u);
+    }
+
+    // The filter is sparse enough to count exactly.
+    for (size_t value = 0; value < 64u; ++value)
+        EXPECT_EQ(cbf.abundance(value), value % 8u);
+
+    EXPECT_EQ(cbf.count(std::views::iota(0u, 64u)), 56u);
+    EXPECT_EQ(cbf.abundance(1000u), 0u);
+}
+
+TYPED_TEST(counting_bloom_filter_test, saturation)
+{
+    TypeParam cbf{seqan3::bin_size{1024u}, seqan3::hash_function_count{3u}};
+
+    for (size_t i = 0; i < TypeParam::max_count + 10u; ++i)
+        cbf.emplace(17u);
+    EXPECT_EQ(cbf.abundance(17u), TypeParam::max_count);
+
+    cbf.emplace(42u, 5000u);
+    EXPECT_EQ(cbf.abundance(42u), TypeParam::max_count);
+
+    cbf.reset();
+    EXPECT_EQ(cbf.abundance(17u), 0u);
+    EXPECT_EQ(cbf.abundance(42u), 0u);
+}
+
+TYPED_TEST(counting_bloom_filter_test, same_presence_as_bloom_filter)
+{
+    // Small filters with many collisions.
+    TypeParam cbf{seqan3::bin_size{97u}, seqan3::hash_function_count{3u}};
+    seqan3::bloom_filter bf{seqan3::bin_size{97u}, seqan3::hash_function_count{3u}};
+
+    for (size_t value = 0; value < 300u; value += 7u)
+    {
+        cbf.emplace(value);
+        bf.emplace(value);
+    }
+
+    for (size_t value = 0; value < 1000u; ++value)
+        EXPECT_EQ(cbf.contains(value), bf.contains(value)) << value;
+}
+
+TYPED_TEST(counting_bloom_filter_test, data_access)
+{
+    TypeParam cbf{seqan3::bin_size{1024u}};
+    EXPECT_EQ(cbf.raw_data().size(), 1024u * std::bit_width(TypeParam::max_count) / 8u);
+}
+
+TYPED_TEST(counting_bloom_filter_test, serialisation)
+{
+    TypeParam cbf{seqan3::bin_size{1024u}};
+    cbf.emplace(3u, 3u);
+    seqan3::test::do_serialisation(cbf);
+}
@@ -160,6 +160,38 @@ TYPED_TEST(simd_algorithm_extract, extract_eighth)
     }
 }
 
+//-----------------------------------------------------------------------------
+// Algorithm gather
+//-----------------------------------------------------------------------------
+
+template <typename simd_t>
+struct simd_algorithm_gather : ::testing::Test
+{
+    static constexpr size_t simd_length = seqan3::simd::simd_traits<simd_t>::length;
+};
+
+using simd_gather_types = ::testing::Types<seqan3::simd::simd_type_t<int8_t>,
+                                           seqan3::simd::simd_type_t<int16_t>,
+                                           seqan3::simd::simd_type_t<int32_t>,
+                                           seqan3::simd::simd_type_t<int64_t>>;
+TYPED_TEST_SUITE(simd_algorithm_gather, simd_gather_types, );
+
+TYPED_TEST(simd_algorithm_gather, gather)
+{
+    // Negative values to check that the gathered values are not zero extended.
+    std::vector<int32_t> table(60);
+    for (size_t i = 0; i < table.size(); ++i)
+        table[i] = 50 - static_cast<int32_t>(i) * 3;
+
+    TypeParam indices{};
+    for (size_t i = 0; i < TestFixture::simd_length; ++i)
+        indices[i] = (i * 7 + 3) % table.size();
+
+    TypeParam result = seqan3::detail::gather(table.data(), indices);
+    for (size_t i = 0; i < TestFixture::simd_length; ++i)
+        EXPECT_EQ(result[i], table[(i * 7 + 3) % table.size()]);
+}
+
 //-----------------------------------------------------------------------------
 // Algorithm upcast
 //-----------------------------------------------------------------------------